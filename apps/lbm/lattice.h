@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Neon/core/core.h"
+#include "Neon/domain/interface/Stencil.h"
+
+/**
+ * Get the x, y, or z component of the lattice vector
+ * represented by the component k.
+ */
+template <unsigned int DIM>
+NEON_CUDA_HOST_DEVICE int get_e(const int k, const int id)
+{
+    static_assert(DIM == 2 || DIM == 3, "Dimension has to be either 2 or 3");
+
+    if constexpr (DIM == 2) {
+        static int array_x[9] = {0, 1, 0, -1, 0, 1, -1, -1, 1};
+        static int array_y[9] = {0, 0, 1, 0, -1, 1, 1, -1, -1};
+        switch (id) {
+            case 0:
+                return array_x[k];
+            case 1:
+                return array_y[k];
+            default:
+                return 0;
+        }
+    }
+
+    if constexpr (DIM == 3) {
+        static int arr[19][3] = {
+            {0, 0, 0},
+
+            {1, 0, 0},
+            {-1, 0, 0},
+            {0, 1, 0},
+            {0, -1, 0},
+            {0, 0, 1},
+            {0, 0, -1},
+
+            {1, 1, 0},
+            {-1, 1, 0},
+            {1, -1, 0},
+            {-1, -1, 0},
+            {1, 0, 1},
+            {-1, 0, 1},
+            {1, 0, -1},
+            {-1, 0, -1},
+            {0, 1, 1},
+            {0, -1, 1},
+            {0, 1, -1},
+            {0, -1, -1},
+        };
+        return arr[k][id];
+    }
+}
+
+
+/**
+ * Get the weight that corresponds to the
+ * lattice component represented by the component k.
+ */
+template <unsigned int DIM>
+NEON_CUDA_HOST_DEVICE double get_w(const int k)
+{
+    static_assert(DIM == 2 || DIM == 3, "Dimension has to be either 2 or 3");
+
+    if constexpr (DIM == 2) {
+        static double array[9] = {4.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0,
+                                  1.0 / 9.0, 1.0 / 9.0, 1.0 / 36.0,
+                                  1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0};
+        return array[k];
+    }
+
+    if constexpr (DIM == 3) {
+        static double array[19] = {
+            1.0 / 3.0,  // k = 0
+            1.0 / 18.0, 1.0 / 18.0, 1.0 / 18.0,
+            1.0 / 18.0, 1.0 / 18.0, 1.0 / 18.0,  // k = 1,..6
+            1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0,
+            1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0,  // k = 7,..12
+            1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0,
+            1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0  // k = 13,..18
+        };
+        return array[k];
+    }
+}
+
+/**
+ * Get the lattice component that points in the
+ * opposite direction of the component k, i.e. e(opposite(k)) == -e(k).
+ */
+template <unsigned int DIM>
+NEON_CUDA_HOST_DEVICE int get_opposite(const int k)
+{
+    static_assert(DIM == 2 || DIM == 3, "Dimension has to be either 2 or 3");
+
+    if constexpr (DIM == 2) {
+        static int array[9] = {0, 3, 4, 1, 2, 7, 8, 5, 6};
+        return array[k];
+    }
+
+    if constexpr (DIM == 3) {
+        static int array[19] = {
+            0,  // k = 0
+            2, 1, 4, 3, 6, 5,  // k = 1,..6
+            10, 9, 8, 7,  // k = 7,..10
+            14, 13, 12, 11,  // k = 11,..14
+            18, 17, 16, 15  // k = 15,..18
+        };
+        return array[k];
+    }
+}
+
+template <unsigned int DIM, unsigned int COMP>
+Neon::domain::Stencil create_stencil();
+
+template <>
+inline Neon::domain::Stencil create_stencil<2, 9>()
+{
+    std::vector<Neon::index_3d> stencil;
+    stencil.reserve(9);
+    for (int x = -1; x <= 1; ++x) {
+        for (int y = -1; y <= 1; ++y) {
+            stencil.emplace_back(Neon::index_3d(x, y, 0));
+        }
+    }
+    return Neon::domain::Stencil(stencil);
+}
+
+template <>
+inline Neon::domain::Stencil create_stencil<3, 19>()
+{
+    // filterCenterOut = false;
+    return Neon::domain::Stencil::s19_t(false);
+}
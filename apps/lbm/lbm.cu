@@ -10,35 +10,14 @@
 #include "Neon/domain/dGrid.h"
 #include "Neon/skeleton/Skeleton.h"
 
+#include "lattice.h"
+
 enum class FlowType
 {
     border = 0,
     obstacle = 1,
 };
 
-template <unsigned int DIM, unsigned int COMP>
-Neon::domain::Stencil create_stencil();
-
-template <>
-Neon::domain::Stencil create_stencil<2, 9>()
-{
-    std::vector<Neon::index_3d> stencil;
-    stencil.reserve(9);
-    for (int x = -1; x <= 1; ++x) {
-        for (int y = -1; y <= 1; ++y) {
-            stencil.emplace_back(Neon::index_3d(x, y, 0));
-        }
-    }
-    return Neon::domain::Stencil(stencil);
-}
-
-template <>
-Neon::domain::Stencil create_stencil<3, 19>()
-{
-    // filterCenterOut = false;
-    return Neon::domain::Stencil::s19_t(false);
-}
-
 template <typename Field>
 inline void exportVTI(const int t, Field& field)
 {
@@ -48,90 +27,10 @@ inline void exportVTI(const int t, Field& field)
     oss << std::setw(precision) << std::setfill('0') << t;
     std::string prefix = "lbm" + std::to_string(field.getCardinality()) + "D_";
     std::string fname = prefix + oss.str();
-    field.ioToVtk(fname, "field");
+    field.template ioToVtk<typename Field::ComputeType>(fname, "field");
 }
 
 
-/**
- * Get the x, y, or z component of the lattice vector 
- * represented by the component k.
- */
-template <unsigned int DIM>
-NEON_CUDA_HOST_DEVICE int get_e(const int k, const int id)
-{
-    static_assert(DIM == 2 || DIM == 3, "Dimension has to be either 2 or 3");
-
-    if constexpr (DIM == 2) {
-        static int array_x[9] = {0, 1, 0, -1, 0, 1, -1, -1, 1};
-        static int array_y[9] = {0, 0, 1, 0, -1, 1, 1, -1, -1};
-        switch (id) {
-            case 0:
-                return array_x[k];
-            case 1:
-                return array_y[k];
-            default:
-                return 0;
-        }
-    }
-
-    if constexpr (DIM == 3) {
-        static int arr[19][3] = {
-            {0, 0, 0},
-
-            {1, 0, 0},
-            {-1, 0, 0},
-            {0, 1, 0},
-            {0, -1, 0},
-            {0, 0, 1},
-            {0, 0, -1},
-
-            {1, 1, 0},
-            {-1, 1, 0},
-            {1, -1, 0},
-            {-1, -1, 0},
-            {1, 0, 1},
-            {-1, 0, 1},
-            {1, 0, -1},
-            {-1, 0, -1},
-            {0, 1, 1},
-            {0, -1, 1},
-            {0, 1, -1},
-            {0, -1, -1},
-        };
-        return arr[k][id];
-    }
-}
-
-
-/**
- * Get the weight that corresponds to the 
- * lattice component represented by the component k.
- */
-template <unsigned int DIM>
-NEON_CUDA_HOST_DEVICE double get_w(const int k)
-{
-    static_assert(DIM == 2 || DIM == 3, "Dimension has to be either 2 or 3");
-
-    if constexpr (DIM == 2) {
-        static double array[9] = {4.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0,
-                                  1.0 / 9.0, 1.0 / 9.0, 1.0 / 36.0,
-                                  1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0};
-        return array[k];
-    }
-
-    if constexpr (DIM == 3) {
-        static double array[19] = {
-            1.0 / 3.0,  // k = 0
-            1.0 / 18.0, 1.0 / 18.0, 1.0 / 18.0,
-            1.0 / 18.0, 1.0 / 18.0, 1.0 / 18.0,  // k = 1,..6
-            1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0,
-            1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0,  // k = 7,..12
-            1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0,
-            1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0  // k = 13,..18
-        };
-        return array[k];
-    }
-}
 /**
  * Update the velocity and density of the fluid after the
  * collide and stream step.
@@ -156,15 +55,15 @@ template <unsigned int DIM,
           unsigned int COMP,
           typename RealFieldT,
           typename MaskFeildT>
-Neon::set::Container computeVelocity(const RealFieldT&         in_voxels,
-                                     RealFieldT&               old_voxels,
-                                     const MaskFeildT&         mask,
-                                     RealFieldT&               out_velocity,
-                                     RealFieldT&               density,
-                                     RealFieldT&               density_temp,
-                                     typename RealFieldT::Type tau)
+Neon::set::Container computeVelocity(const RealFieldT&                in_voxels,
+                                     RealFieldT&                      old_voxels,
+                                     const MaskFeildT&                mask,
+                                     RealFieldT&                      out_velocity,
+                                     RealFieldT&                      density,
+                                     RealFieldT&                      density_temp,
+                                     typename RealFieldT::ComputeType tau)
 {
-    using T = typename RealFieldT::Type;
+    using T = typename RealFieldT::ComputeType;
     return in_voxels.getGrid().getContainer(
         "ComputeVelocity", [&, tau](Neon::set::Loader& loader) {
             const auto& ins = loader.load(in_voxels);
@@ -227,14 +126,14 @@ template <unsigned int DIM,
           unsigned int COMP,
           typename RealFieldT,
           typename MaskFeildT>
-Neon::set::Container collideAndStream(const RealFieldT&         density,
-                                      const RealFieldT&         in_velocity,
-                                      const RealFieldT&         in_voxels,
-                                      const MaskFeildT&         mask,
-                                      RealFieldT&               out_voxels,
-                                      typename RealFieldT::Type tau)
+Neon::set::Container collideAndStream(const RealFieldT&                density,
+                                      const RealFieldT&                in_velocity,
+                                      const RealFieldT&                in_voxels,
+                                      const MaskFeildT&                mask,
+                                      RealFieldT&                      out_voxels,
+                                      typename RealFieldT::ComputeType tau)
 {
-    using T = typename RealFieldT::Type;
+    using T = typename RealFieldT::ComputeType;
     return in_voxels.getGrid().getContainer(
         "CollideAndStream", [&, tau](Neon::set::Loader& loader) {
             const auto& ins = loader.load(in_voxels, Neon::Compute::STENCIL);
@@ -303,18 +202,18 @@ template <unsigned int DIM,
           unsigned int COMP,
           typename RealFieldT,
           typename MaskFeildT>
-Neon::set::Container boundaryConditions(const RealFieldT&               in_voxels,
-                                        const RealFieldT&               in_velocity,
-                                        const MaskFeildT&               boundary_mask,
-                                        const RealFieldT&               read_density,
-                                        RealFieldT&                     out_voxels,
-                                        RealFieldT&                     out_velocity,
-                                        RealFieldT&                     density,
-                                        const typename RealFieldT::Type tau,
-                                        const typename RealFieldT::Type sphere_x,
-                                        const typename RealFieldT::Type sphere_y)
+Neon::set::Container boundaryConditions(const RealFieldT&                      in_voxels,
+                                        const RealFieldT&                      in_velocity,
+                                        const MaskFeildT&                      boundary_mask,
+                                        const RealFieldT&                      read_density,
+                                        RealFieldT&                            out_voxels,
+                                        RealFieldT&                            out_velocity,
+                                        RealFieldT&                            density,
+                                        const typename RealFieldT::ComputeType tau,
+                                        const typename RealFieldT::ComputeType sphere_x,
+                                        const typename RealFieldT::ComputeType sphere_y)
 {
-    using T = typename RealFieldT::Type;
+    using T = typename RealFieldT::ComputeType;
     return in_voxels.getGrid().getContainer(
         "BoundaryConditions", [&, tau](Neon::set::Loader& loader) {
             const auto& ins = loader.load(in_voxels, Neon::Compute::STENCIL);
@@ -490,21 +389,22 @@ Neon::set::Container boundaryConditions(const RealFieldT&               in_voxel
 
 
 template <unsigned int DIM, unsigned int COMP, typename RealFieldT, typename MaskFeildT>
-inline void setup(const FlowType                  flow_type,
-                  MaskFeildT&                     boundary_mask,
-                  MaskFeildT&                     center_mask,
-                  RealFieldT&                     lattice_1,
-                  RealFieldT&                     lattice_2,
-                  RealFieldT&                     velocity_1,
-                  RealFieldT&                     velocity_2,
-                  RealFieldT&                     rho_1,
-                  RealFieldT&                     rho_2,
-                  const typename RealFieldT::Type sphere_x,
-                  const typename RealFieldT::Type sphere_y,
-                  const typename RealFieldT::Type sphere_r)
+inline void setup(const FlowType                         flow_type,
+                  MaskFeildT&                            boundary_mask,
+                  MaskFeildT&                            center_mask,
+                  RealFieldT&                            lattice_1,
+                  RealFieldT&                            lattice_2,
+                  RealFieldT&                            velocity_1,
+                  RealFieldT&                            velocity_2,
+                  RealFieldT&                            rho_1,
+                  RealFieldT&                            rho_2,
+                  const typename RealFieldT::ComputeType sphere_x,
+                  const typename RealFieldT::ComputeType sphere_y,
+                  const typename RealFieldT::ComputeType sphere_r)
 {
     auto dim = boundary_mask.getDimension();
     using T = typename RealFieldT::Type;
+    using C = typename RealFieldT::ComputeType;
 
     if (DIM == 2) {
         if (flow_type == FlowType::border) {
@@ -529,7 +429,7 @@ inline void setup(const FlowType                  flow_type,
         } else if (flow_type == FlowType::obstacle) {
             boundary_mask.forEachActiveCell(
                 [&](const Neon::index_3d& idx, const int& c, int& val) {
-                    T dist = (idx.x - sphere_x) * (idx.x - sphere_x) +
+                    C    dist = (idx.x - sphere_x) * (idx.x - sphere_x) +
                              (idx.y - sphere_y) * (idx.y - sphere_y);
                     bool in_circle = dist <= sphere_r * sphere_r;
                     if (idx.x > 0 && idx.x < dim.x - 1 && idx.y > 0 &&
@@ -541,7 +441,7 @@ inline void setup(const FlowType                  flow_type,
                 });
             center_mask.forEachActiveCell(
                 [&](const Neon::index_3d& idx, const int& c, int& val) {
-                    T dist = (idx.x - sphere_x) * (idx.x - sphere_x) +
+                    C    dist = (idx.x - sphere_x) * (idx.x - sphere_x) +
                              (idx.y - sphere_y) * (idx.y - sphere_y);
                     bool in_circle = dist <= sphere_r * sphere_r;
                     if (idx.x > 0 && idx.x < dim.x - 1 && idx.y > 0 &&
@@ -635,21 +535,41 @@ inline void setup(const FlowType                  flow_type,
 }
 
 
+/**
+ * Minimum number of bytes read and written per cell by one LBM step,
+ * i.e. assuming each loaded field value is moved only once.
+ */
+template <unsigned int DIM, unsigned int COMP, typename RealFieldT, typename MaskFeildT>
+size_t bytesPerCellPerStep()
+{
+    const size_t realBytes = sizeof(typename RealFieldT::Type);
+    const size_t maskBytes = sizeof(typename MaskFeildT::Type);
+
+    // collideAndStream: reads lattice, velocity and density, writes lattice
+    const size_t collideAndStream = (COMP + DIM + 1) * realBytes + COMP * realBytes + maskBytes;
+    // computeVelocity: reads lattice, writes lattice, velocity and two densities
+    const size_t computeVelocity = COMP * realBytes + (COMP + DIM + 2) * realBytes + maskBytes;
+    // boundaryConditions: reads lattice, velocity, density, writes them back
+    const size_t boundaryConditions = 2 * (COMP + DIM + 1) * realBytes + maskBytes;
+
+    return collideAndStream + computeVelocity + boundaryConditions;
+}
+
 template <unsigned int DIM, unsigned int COMP, typename RealFieldT, typename MaskFeildT>
-inline void run(const int                       num_frames,
-                const FlowType                  flow_type,
-                MaskFeildT&                     boundary_mask,
-                MaskFeildT&                     center_mask,
-                RealFieldT&                     lattice_1,
-                RealFieldT&                     lattice_2,
-                RealFieldT&                     velocity_1,
-                RealFieldT&                     velocity_2,
-                RealFieldT&                     rho_1,
-                RealFieldT&                     rho_2,
-                const typename RealFieldT::Type tau,
-                const typename RealFieldT::Type sphere_x,
-                const typename RealFieldT::Type sphere_y,
-                const typename RealFieldT::Type sphere_r)
+inline void run(const int                              num_frames,
+                const FlowType                         flow_type,
+                MaskFeildT&                            boundary_mask,
+                MaskFeildT&                            center_mask,
+                RealFieldT&                            lattice_1,
+                RealFieldT&                            lattice_2,
+                RealFieldT&                            velocity_1,
+                RealFieldT&                            velocity_2,
+                RealFieldT&                            rho_1,
+                RealFieldT&                            rho_2,
+                const typename RealFieldT::ComputeType tau,
+                const typename RealFieldT::ComputeType sphere_x,
+                const typename RealFieldT::ComputeType sphere_y,
+                const typename RealFieldT::ComputeType sphere_r)
 {
     const auto& backend = boundary_mask.getBackend();
 
@@ -674,81 +594,120 @@ inline void run(const int                       num_frames,
 
     int save_id = 0;
 
+    Neon::Timer_ms timer;
+    double         computeTimeMs = 0;
     int t = (DIM == 2) ? 1000 : 40;
     for (int f = 0; f < num_frames; ++f) {
+        timer.start();
         sk.run();
 
         if (f % t == 0) {
             backend.syncAll();
+            timer.stop();
+            computeTimeMs += timer.time();
+
             velocity_1.updateIO(0);
             exportVTI(save_id, velocity_1);
             printf("\n frame  %d exported", f);
             save_id++;
+        } else {
+            timer.stop();
+            computeTimeMs += timer.time();
         }
     }
+    timer.start();
     backend.syncAll();
+    timer.stop();
+    computeTimeMs += timer.time();
+
+    const size_t numCells = size_t(boundary_mask.getDimension().rMul());
+    const double bytesPerStep = double(bytesPerCellPerStep<DIM, COMP, RealFieldT, MaskFeildT>()) * double(numCells);
+    const double stepTimeMs = computeTimeMs / double(num_frames);
+    printf("\n storage type size %d bytes, step time %f ms, bytes moved per step %e, effective bandwidth %f GB/s\n",
+           int(sizeof(typename RealFieldT::Type)), stepTimeMs, bytesPerStep, bytesPerStep / (stepTimeMs * 1.0e6));
 }
 
-int main(int argc, char** argv)
+template <typename StorageT>
+void runLbm(const Neon::Backend& backend)
 {
-    Neon::init();
-    if (Neon::sys::globalSpace::gpuSysObjStorage.numDevs() > 0) {
+    //2D
+    //constexpr int DIM = 2;
+    //constexpr int COMP = 9;
 
-        auto             runtime = Neon::Runtime::stream;
-        std::vector<int> gpu_ids{0};
-        Neon::Backend    backend(gpu_ids, runtime);
+    //3D
+    constexpr int DIM = 3;
+    constexpr int COMP = 19;
 
-        //2D
-        //constexpr int DIM = 2;
-        //constexpr int COMP = 9;
 
-        //3D
-        constexpr int DIM = 3;
-        constexpr int COMP = 19;
+    const FlowType flow_type = FlowType::border;
 
+    const int   dim_x = (DIM == 3) ? 64 : ((flow_type == FlowType::border) ? 256 : 801);
+    const int   dim_y = (DIM == 3) ? 64 : ((flow_type == FlowType::border) ? 256 : 201);
+    const int   dim_z = (DIM < 3) ? 1 : 64;
+    const float niu = (DIM == 3) ? 0.063 : ((flow_type == FlowType::border) ? 0.0255f : 0.01f);
+    const float tau = 3.0 * niu + 0.5;
 
-        const FlowType flow_type = FlowType::border;
+    const float sphere_x = 160.0;
+    const float sphere_y = 100.0;
+    const float sphere_r = 20.0;
 
-        const int   dim_x = (DIM == 3) ? 64 : ((flow_type == FlowType::border) ? 256 : 801);
-        const int   dim_y = (DIM == 3) ? 64 : ((flow_type == FlowType::border) ? 256 : 201);
-        const int   dim_z = (DIM < 3) ? 1 : 64;
-        const float niu = (DIM == 3) ? 0.063 : ((flow_type == FlowType::border) ? 0.0255f : 0.01f);
-        const float tau = 3.0 * niu + 0.5;
+    const Neon::index_3d grid_dim(dim_x, dim_y, dim_z);
+    const size_t         num_frames = (DIM == 2) ? 60000 : 2000;
 
-        const float sphere_x = 160.0;
-        const float sphere_y = 100.0;
-        const float sphere_r = 20.0;
+    using Grid = Neon::domain::dGrid;
+    using dataT = StorageT;
 
-        const Neon::index_3d grid_dim(dim_x, dim_y, dim_z);
-        const size_t         num_frames = (DIM == 2) ? 60000 : 2000;
+    Grid grid(
+        backend, grid_dim, [](Neon::index_3d idx) { return true; },
+        create_stencil<DIM, COMP>(), true);
 
-        using Grid = Neon::domain::dGrid;
-        using dataT = float;
+    constexpr int lattice_cardinality = COMP;  // 9 or 19
+    constexpr int velocity_cardinality = DIM;  // 2 or 3
+    constexpr int rho_cardinality = 1;
+    dataT         inactive = 0;
 
-        Grid grid(
-            backend, grid_dim, [](Neon::index_3d idx) { return true; },
-            create_stencil<DIM, COMP>(), true);
+    auto lattice_1 = grid.template newField<dataT>("lattice_1", lattice_cardinality, inactive);
+    auto lattice_2 = grid.template newField<dataT>("lattice_2", lattice_cardinality, inactive);
 
-        constexpr int lattice_cardinality = COMP;  // 9 or 19
-        constexpr int velocity_cardinality = DIM;  // 2 or 3
-        constexpr int rho_cardinality = 1;
-        dataT         inactive = 0;
+    auto velocity_1 = grid.template newField<dataT>("velocity_1", velocity_cardinality, inactive);
+    auto velocity_2 = grid.template newField<dataT>("velocity_2", velocity_cardinality, inactive);
 
-        auto lattice_1 = grid.template newField<dataT>("lattice_1", lattice_cardinality, inactive);
-        auto lattice_2 = grid.template newField<dataT>("lattice_2", lattice_cardinality, inactive);
+    auto rho_1 = grid.template newField<dataT>("rho_1", rho_cardinality, inactive);
+    auto rho_2 = grid.template newField<dataT>("rho_2", rho_cardinality, inactive);
 
-        auto velocity_1 = grid.template newField<dataT>("velocity_1", velocity_cardinality, inactive);
-        auto velocity_2 = grid.template newField<dataT>("velocity_2", velocity_cardinality, inactive);
 
-        auto rho_1 = grid.template newField<dataT>("rho_1", rho_cardinality, inactive);
-        auto rho_2 = grid.template newField<dataT>("rho_2", rho_cardinality, inactive);
+    auto boundary_mask = grid.template newField<int>("boundary_mask", rho_cardinality, 0);
+    auto center_mask = grid.template newField<int>("center_mask", rho_cardinality, 0);
 
+    setup<DIM, COMP>(flow_type, boundary_mask, center_mask, lattice_1, lattice_2, velocity_1, velocity_2, rho_1, rho_2, sphere_x, sphere_y, sphere_r);
 
-        auto boundary_mask = grid.template newField<int>("boundary_mask", rho_cardinality, int(inactive));
-        auto center_mask = grid.template newField<int>("center_mask", rho_cardinality, int(inactive));
+    run<DIM, COMP>(num_frames, flow_type, boundary_mask, center_mask, lattice_1, lattice_2, velocity_1, velocity_2, rho_1, rho_2, tau, sphere_x, sphere_y, sphere_r);
+}
 
-        setup<DIM, COMP>(flow_type, boundary_mask, center_mask, lattice_1, lattice_2, velocity_1, velocity_2, rho_1, rho_2, sphere_x, sphere_y, sphere_r);
+/**
+ * Usage: app-lbm [fp32|fp16|bf16]
+ * The optional argument selects the storage type of the lattice, velocity and density fields.
+ * Computation is always done in single precision.
+ */
+int main(int argc, char** argv)
+{
+    Neon::init();
+    if (Neon::sys::globalSpace::gpuSysObjStorage.numDevs() > 0) {
 
-        run<DIM, COMP>(num_frames, flow_type, boundary_mask, center_mask, lattice_1, lattice_2, velocity_1, velocity_2, rho_1, rho_2, tau, sphere_x, sphere_y, sphere_r);
+        auto             runtime = Neon::Runtime::stream;
+        std::vector<int> gpu_ids{0};
+        Neon::Backend    backend(gpu_ids, runtime);
+
+        const std::string storage = (argc > 1) ? std::string(argv[1]) : std::string("fp32");
+        if (storage == "fp32") {
+            runLbm<float>(backend);
+        } else if (storage == "fp16") {
+            runLbm<Neon::Half>(backend);
+        } else if (storage == "bf16") {
+            runLbm<Neon::BFloat16>(backend);
+        } else {
+            printf("unknown storage type %s, options are fp32, fp16 and bf16\n", storage.c_str());
+            exit(EXIT_FAILURE);
+        }
     }
-}
\ No newline at end of file
+}
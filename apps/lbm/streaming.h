@@ -0,0 +1,199 @@
+#pragma once
+
+#include "Neon/Neon.h"
+#include "Neon/set/Containter.h"
+
+#include "lattice.h"
+
+/**
+ * Fused single-kernel LBM (BGK collision) on a lid driven cavity.
+ * The domain is closed by no-slip walls handled with half-way bounce back.
+ * The wall above the top y layer moves along x with velocity lid_velocity.
+ *
+ * Two streaming schemes are provided:
+ * - collideAndStreamPull: classic two-lattice scheme. Populations are gathered
+ *   from the neighbours of in_lattice, collided and stored into out_lattice.
+ * - collideAndStreamInPlace: single-lattice AA-pattern. Even steps read and write
+ *   only the cell's own populations (stored back in the opposite slot), odd steps
+ *   read from and write to the neighbours. Each memory location is read and then
+ *   written by the same cell, so the update is race free without a second lattice.
+ *   After an odd step the lattice holds the streamed (not yet collided) populations
+ *   in their natural order, so density and velocity can be computed as usual.
+ */
+
+/**
+ * Bounce back correction for a population that travels along k after
+ * being reflected by the wall cell wall_global.
+ * Only the moving lid (wall cells above the top y layer) contributes.
+ */
+template <unsigned int DIM, typename T>
+NEON_CUDA_HOST_DEVICE inline T bounceBackTerm(const int             k,
+                                              const Neon::index_3d& wall_global,
+                                              const int             ny,
+                                              const T               lid_velocity)
+{
+    if (wall_global.y >= ny) {
+        return T(6.0 * get_w<DIM>(k) * get_e<DIM>(k, 0)) * lid_velocity;
+    }
+    return 0;
+}
+
+/**
+ * BGK collision applied in place on the populations of one cell.
+ */
+template <unsigned int DIM, unsigned int COMP, typename T>
+NEON_CUDA_HOST_DEVICE inline void collideBGK(T* f, const T omega)
+{
+    T rho = 0;
+    T vel[3] = {0, 0, 0};
+    for (int k = 0; k < int(COMP); k++) {
+        rho += f[k];
+        for (int i = 0; i < int(DIM); i++) {
+            vel[i] += get_e<DIM>(k, i) * f[k];
+        }
+    }
+    T uv = 0;
+    for (int i = 0; i < int(DIM); i++) {
+        vel[i] /= rho;
+        uv += vel[i] * vel[i];
+    }
+    for (int k = 0; k < int(COMP); k++) {
+        T eu = 0;
+        for (int i = 0; i < int(DIM); i++) {
+            eu += get_e<DIM>(k, i) * vel[i];
+        }
+        const T feq = T(get_w<DIM>(k)) * rho * (T(1.0) + T(3.0) * eu + T(4.5) * eu * eu - T(1.5) * uv);
+        f[k] = f[k] - omega * (f[k] - feq);
+    }
+}
+
+/**
+ * Two-lattice (pull) collide and stream step.
+ * @param in_lattice The populations of the previous step.
+ * @param out_lattice The lattice where the result will be stored.
+ * @param omega The relaxation frequency (1 / tau).
+ * @param lid_velocity The velocity of the top wall.
+ */
+template <unsigned int DIM,
+          unsigned int COMP,
+          typename LatticeFieldT>
+Neon::set::Container collideAndStreamPull(const LatticeFieldT&                in_lattice,
+                                          LatticeFieldT&                      out_lattice,
+                                          typename LatticeFieldT::ComputeType omega,
+                                          typename LatticeFieldT::ComputeType lid_velocity)
+{
+    using T = typename LatticeFieldT::ComputeType;
+    return in_lattice.getGrid().getContainer(
+        "CollideAndStreamPull", [&, omega, lid_velocity](Neon::set::Loader& loader) {
+            const auto& ins = loader.load(in_lattice, Neon::Compute::STENCIL);
+            auto&       out = loader.load(out_lattice);
+
+            const int ny = in_lattice.getDimension().y;
+
+            return [=] NEON_CUDA_HOST_DEVICE(
+                       const typename LatticeFieldT::Cell& idx) mutable {
+                const Neon::index_3d global = ins.mapToGlobal(idx);
+
+                T f[COMP];
+                for (int k = 0; k < int(COMP); k++) {
+                    typename LatticeFieldT::ngh_idx ngh(-get_e<DIM>(k, 0),
+                                                        -get_e<DIM>(k, 1),
+                                                        -get_e<DIM>(k, 2));
+                    typename LatticeFieldT::Cell    nghCell;
+                    if (ins.nghIdx(idx, ngh, nghCell)) {
+                        f[k] = ins(nghCell, k);
+                    } else {
+                        const Neon::index_3d wall(global.x + ngh.x, global.y + ngh.y, global.z + ngh.z);
+                        f[k] = T(ins(idx, get_opposite<DIM>(k))) + bounceBackTerm<DIM>(k, wall, ny, lid_velocity);
+                    }
+                }
+
+                collideBGK<DIM, COMP>(f, omega);
+
+                for (int k = 0; k < int(COMP); k++) {
+                    out(idx, k) = f[k];
+                }
+            };
+        });
+}
+
+/**
+ * Single-lattice (AA-pattern) collide and stream step.
+ * The odd step accesses the neighbour cells directly through the partition,
+ * therefore the lattice must live on a single partition.
+ * @param lattice The populations, updated in place.
+ * @param even_step Selects the even or odd access pattern. Steps must alternate starting from an even one.
+ * @param omega The relaxation frequency (1 / tau).
+ * @param lid_velocity The velocity of the top wall.
+ */
+template <unsigned int DIM,
+          unsigned int COMP,
+          typename LatticeFieldT>
+Neon::set::Container collideAndStreamInPlace(LatticeFieldT&                      lattice,
+                                             bool                                even_step,
+                                             typename LatticeFieldT::ComputeType omega,
+                                             typename LatticeFieldT::ComputeType lid_velocity)
+{
+    using T = typename LatticeFieldT::ComputeType;
+    if (lattice.getGrid().getDevSet().setCardinality() != 1) {
+        NEON_THROW_UNSUPPORTED_OPTION("The in place LBM streaming requires a single partition");
+    }
+    const std::string name = even_step ? "CollideAndStreamInPlaceEven" : "CollideAndStreamInPlaceOdd";
+    return lattice.getGrid().getContainer(
+        name, [&, even_step, omega, lid_velocity](Neon::set::Loader& loader) {
+            auto& lat = loader.load(lattice);
+
+            const int ny = lattice.getDimension().y;
+
+            return [=] NEON_CUDA_HOST_DEVICE(
+                       const typename LatticeFieldT::Cell& idx) mutable {
+                T f[COMP];
+
+                if (even_step) {
+                    for (int k = 0; k < int(COMP); k++) {
+                        f[k] = lat(idx, k);
+                    }
+                    collideBGK<DIM, COMP>(f, omega);
+                    for (int k = 0; k < int(COMP); k++) {
+                        lat(idx, get_opposite<DIM>(k)) = f[k];
+                    }
+                    return;
+                }
+
+                const Neon::index_3d global = lat.mapToGlobal(idx);
+
+                // The incoming population k was stored by the neighbour at idx - e_k in slot opposite(k).
+                // If the neighbour is a wall, the population bounced back from the slot k of this cell.
+                for (int k = 0; k < int(COMP); k++) {
+                    typename LatticeFieldT::ngh_idx ngh(-get_e<DIM>(k, 0),
+                                                        -get_e<DIM>(k, 1),
+                                                        -get_e<DIM>(k, 2));
+                    typename LatticeFieldT::Cell    nghCell;
+                    if (lat.nghIdx(idx, ngh, nghCell)) {
+                        f[k] = lat(nghCell, get_opposite<DIM>(k));
+                    } else {
+                        const Neon::index_3d wall(global.x + ngh.x, global.y + ngh.y, global.z + ngh.z);
+                        f[k] = T(lat(idx, k)) + bounceBackTerm<DIM>(k, wall, ny, lid_velocity);
+                    }
+                }
+
+                collideBGK<DIM, COMP>(f, omega);
+
+                // The outgoing population k is stored by the neighbour at idx + e_k in slot k.
+                // If the neighbour is a wall, it is reflected into the slot opposite(k) of this cell.
+                for (int k = 0; k < int(COMP); k++) {
+                    typename LatticeFieldT::ngh_idx ngh(get_e<DIM>(k, 0),
+                                                        get_e<DIM>(k, 1),
+                                                        get_e<DIM>(k, 2));
+                    typename LatticeFieldT::Cell    nghCell;
+                    if (lat.nghIdx(idx, ngh, nghCell)) {
+                        lat(nghCell, k) = f[k];
+                    } else {
+                        const int            opp = get_opposite<DIM>(k);
+                        const Neon::index_3d wall(global.x + ngh.x, global.y + ngh.y, global.z + ngh.z);
+                        lat(idx, opp) = f[k] + bounceBackTerm<DIM>(opp, wall, ny, lid_velocity);
+                    }
+                }
+            };
+        });
+}
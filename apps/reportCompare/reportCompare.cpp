@@ -0,0 +1,79 @@
+// Compares the reports (JSON files written by Neon::Report) of a baseline and of a candidate
+// and flags the performance metrics that regressed.
+// Reports of the same configuration given more than once are treated as repetitions.
+// The exit code is 0 when there is no regression, 1 when there is at least one and 2 on errors,
+// so the tool can be used in scripts and CI jobs, e.g.
+//
+//   app-reportCompare -baseline main_*.json -candidate branch_*.json -threshold 0.05
+
+#include <cstdlib>
+#include <iostream>
+
+#include "Neon/core/tools/ReportCompare.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/core/types/Exceptions.h"
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string>           baseline;
+    std::vector<std::string>           candidate;
+    Neon::core::ReportCompare::Options options;
+    bool                               verbose = false;
+
+    auto cli = (clipp::required("-baseline") & clipp::values("files", baseline) % "Reports of the baseline",
+                clipp::required("-candidate") & clipp::values("files", candidate) % "Reports of the candidate",
+                clipp::option("-threshold") & clipp::value("threshold", options.threshold) % "Relative slowdown that is a regression (default 0.05)",
+                clipp::option("-keys") & clipp::values("keys", options.keys) % "Configuration keys used to match the runs (default all)",
+                clipp::option("-metrics") & clipp::values("metrics", options.metrics) % "Metrics to compare (default all)",
+                clipp::option("-verbose").set(verbose) % "Print the unmatched configurations");
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << "Invalid input arguments!\n";
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        return 2;
+    }
+
+    Neon::core::ReportCompare                     cmp(options);
+    std::vector<Neon::core::ReportCompare::Delta> deltas;
+    try {
+        for (const auto& fname : baseline) {
+            cmp.loadBaseline(fname);
+        }
+        for (const auto& fname : candidate) {
+            cmp.loadCandidate(fname);
+        }
+        deltas = cmp.compare();
+    } catch (const Neon::NeonException& e) {
+        std::cerr << "Unable to compare the reports: " << e.what() << std::endl;
+        return 2;
+    } catch (const std::exception& e) {
+        std::cerr << "Unable to compare the reports: " << e.what() << std::endl;
+        return 2;
+    }
+
+    Neon::core::ReportCompare::print(std::cout, deltas);
+
+    int nRegressions = 0;
+    int nImprovements = 0;
+    for (const auto& d : deltas) {
+        nRegressions += d.isRegression ? 1 : 0;
+        nImprovements += d.isImprovement ? 1 : 0;
+    }
+    const auto unmatched = cmp.unmatched();
+    if (verbose) {
+        for (const auto& config : unmatched) {
+            std::cout << config << "\n";
+        }
+    }
+    std::cout << deltas.size() << " metrics compared, "
+              << nRegressions << " regressions, "
+              << nImprovements << " improvements, "
+              << unmatched.size() << " unmatched configurations\n";
+
+    if (deltas.empty()) {
+        std::cout << "No configuration is shared by the baseline and the candidate\n";
+        return 2;
+    }
+    return nRegressions > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,9 @@
+#Toggle the bricked spatial layouts of dGrid fields. Disabled by default. To enable use "-DNEON_USE_SPATIAL_LAYOUT=ON"
+#When disabled, dGrid partitions address the cells linearly without checking the layout at every access.
+set(NEON_USE_SPATIAL_LAYOUT "OFF" CACHE BOOL "Support tiled and Morton spatial layouts in dGrid")
+
+if (${NEON_USE_SPATIAL_LAYOUT})
+	message(STATUS "Spatial layouts are enabled")
+else ()
+	message(STATUS "Spatial layouts are disabled")
+endif ()
@@ -0,0 +1,10 @@
+#Toggle the zero-copy halos of dGrid partitions. Disabled by default. To enable use "-DNEON_USE_ZERO_COPY_HALO=ON"
+#When disabled, dGrid partitions do not carry the neighbour memory nor check it at every access,
+#and dGrid fields update their halo as usual even if the backend requests zero-copy halos.
+set(NEON_USE_ZERO_COPY_HALO "OFF" CACHE BOOL "Support zero-copy halos in dGrid")
+
+if (${NEON_USE_ZERO_COPY_HALO})
+	message(STATUS "dGrid zero-copy halos are enabled")
+else ()
+	message(STATUS "dGrid zero-copy halos are disabled")
+endif ()
@@ -30,6 +30,8 @@
 #include "Neon/core/types/Macros.h"
 #include "Neon/core/types/mode.h"
 #include "Neon/core/types/SetIdx.h"
+#include "Neon/core/types/SpatialLayout.h"
+#include "Neon/core/types/StorageType.h"
 #include "Neon/core/types/vec.h"
 #include "Neon/core/types/DataUse.h"
 #include "Neon/core/types/memSetOptions.h"
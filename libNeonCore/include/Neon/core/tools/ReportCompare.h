@@ -0,0 +1,133 @@
+#pragma once
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <rapidjson/document.h>
+
+namespace Neon {
+namespace core {
+
+/**
+ * Compares the performance metrics of two sets of reports written by Neon::Report:
+ * a baseline (e.g. the reports of the main branch) and a candidate (e.g. the reports of a change).
+ *
+ * Each report, and each of its subdocs, is a run. A run is described by its configuration
+ * (string, boolean and integer members such as the grid, the OCC, the transfer mode, the cardinality
+ * or the dimensions, plus the configuration inherited from the enclosing document) and by its metrics
+ * (numeric members recognized as performance measures by their name, see ReportCompare::direction).
+ * Runs of the same side with the same configuration are repetitions, as are the values of a metric
+ * stored as an array. The git, date and command line members and the System, CUDA and GPU subdocs
+ * describe the environment and are ignored.
+ *
+ * For each configuration and metric found on both sides the relative change of the mean is computed
+ * and a Welch t-test at 95% confidence tells whether the change is significant. A metric regresses when
+ * it changes in the bad direction by more than the threshold and the change is significant.
+ * With a single repetition on either side the threshold alone decides.
+ */
+class ReportCompare
+{
+   public:
+    enum class Direction
+    {
+        lowerIsBetter = 0 /**< times and latencies */,
+        higherIsBetter = 1 /**< bandwidths and throughputs */
+    };
+
+    static auto toString(Direction direction) -> std::string;
+
+    struct Options
+    {
+        double                   threshold{0.05} /**< relative change in the bad direction that is a regression */;
+        std::vector<std::string> keys /**< configuration keys used to match the runs, all of them if empty */;
+        std::vector<std::string> metrics /**< metrics to compare, all of them if empty */;
+    };
+
+    /**
+     * Mean and sample standard deviation of the repetitions of a metric
+     */
+    struct Stats
+    {
+        int    n{0};
+        double mean{0};
+        double stddev{0};
+    };
+
+    struct Delta
+    {
+        std::string config /**< configuration of the run, as a sorted list of key=value */;
+        std::string metric;
+        Direction   direction{Direction::lowerIsBetter};
+        Stats       baseline;
+        Stats       candidate;
+        double      change{0} /**< relative change of the mean, (candidate - baseline) / baseline */;
+        bool        isSignificant{false};
+        bool        isRegression{false};
+        bool        isImprovement{false};
+    };
+
+    ReportCompare();
+
+    explicit ReportCompare(Options options);
+
+    /**
+     * Adds a report file to the baseline
+     */
+    auto loadBaseline(const std::string& fname) -> void;
+
+    /**
+     * Adds a report file to the candidate
+     */
+    auto loadCandidate(const std::string& fname) -> void;
+
+    /**
+     * Adds a report, given as JSON text, to the baseline
+     */
+    auto parseBaseline(const std::string& json, const std::string& name = "baseline") -> void;
+
+    /**
+     * Adds a report, given as JSON text, to the candidate
+     */
+    auto parseCandidate(const std::string& json, const std::string& name = "candidate") -> void;
+
+    /**
+     * Deltas of the metrics found on both sides, sorted by configuration and metric
+     */
+    auto compare() const -> std::vector<Delta>;
+
+    /**
+     * Configurations found only in the baseline or only in the candidate
+     */
+    auto unmatched() const -> std::vector<std::string>;
+
+    /**
+     * Prints the deltas as a table, regressions first
+     */
+    static auto print(std::ostream& os, const std::vector<Delta>& deltas) -> void;
+
+    /**
+     * Returns true if the name of the member is a performance metric and sets its direction:
+     * times and latencies (e.g. "TimeToSolution_ms", "timeMs", "p99Ms") are better when lower,
+     * bandwidths and throughputs (e.g. "GBs", "GFLOPs", "MCUPS") are better when higher.
+     */
+    static auto direction(const std::string& metric, Direction& dir) -> bool;
+
+   private:
+    using Samples = std::map<std::string, std::vector<double>> /**< metric to repetitions */;
+    using Side = std::map<std::string, Samples> /**< configuration to metrics */;
+
+    auto helpParse(const std::string& json, const std::string& name, Side& side) -> void;
+    auto helpAddRun(const rapidjson::Value&            doc,
+                    std::map<std::string, std::string> config,
+                    Side&                              side) const -> void;
+    auto helpIsKey(const std::string& key) const -> bool;
+    auto helpIsMetric(const std::string& metric, Direction& dir) const -> bool;
+
+    Options mOptions;
+    Side    mBaseline;
+    Side    mCandidate;
+};
+
+}  // namespace core
+}  // namespace Neon
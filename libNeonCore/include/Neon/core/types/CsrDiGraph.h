@@ -0,0 +1,274 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Neon/core/types/Exceptions.h"
+#include "Neon/core/types/digraph.h"
+
+namespace Neon {
+
+/**
+ * Immutable directed graph stored in compressed sparse row (CSR) format.
+ *
+ * Vertices are renumbered with dense indices in [0, numVertices) following the ascending order of their ids,
+ * out and in neighbours are stored in flat arrays. The structure is meant to run whole-graph analyses
+ * (topological order, BFS, levels, transitive reduction) on a snapshot of a DiGraph, which is optimized
+ * for local modifications instead.
+ *
+ * Methods work on dense indices, vertexId and vertexIdx convert from and to the original vertex ids.
+ */
+class CsrDiGraph
+{
+   public:
+    using Edge = std::pair<size_t, size_t>;
+
+    CsrDiGraph() = default;
+
+    /**
+     * Creates the graph from a list of vertex ids and a list of edges between them.
+     * Duplicated edges are merged.
+     */
+    CsrDiGraph(std::vector<size_t> vertices, const std::vector<Edge>& edges)
+    {
+        std::sort(vertices.begin(), vertices.end());
+        vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+        mIds = std::move(vertices);
+
+        std::vector<Edge> dense;
+        dense.reserve(edges.size());
+        for (const auto& edge : edges) {
+            dense.emplace_back(vertexIdx(edge.first), vertexIdx(edge.second));
+        }
+        std::sort(dense.begin(), dense.end());
+        dense.erase(std::unique(dense.begin(), dense.end()), dense.end());
+
+        const size_t n = mIds.size();
+        mOutOffsets.assign(n + 1, 0);
+        mInOffsets.assign(n + 1, 0);
+        for (const auto& edge : dense) {
+            mOutOffsets[edge.first + 1]++;
+            mInOffsets[edge.second + 1]++;
+        }
+        for (size_t i = 0; i < n; i++) {
+            mOutOffsets[i + 1] += mOutOffsets[i];
+            mInOffsets[i + 1] += mInOffsets[i];
+        }
+        // Edges are sorted by source, out neighbours of each vertex are therefore sorted too
+        mOutTargets.resize(dense.size());
+        mInSources.resize(dense.size());
+        std::vector<size_t> inFill(mInOffsets.begin(), mInOffsets.end() - 1);
+        for (size_t e = 0; e < dense.size(); e++) {
+            mOutTargets[e] = dense[e].second;
+            mInSources[inFill[dense[e].second]++] = dense[e].first;
+        }
+    }
+
+    /**
+     * Snapshot of the structure of a DiGraph, properties are not copied
+     */
+    template <typename VertexProp, typename EdgeProp>
+    static auto fromDiGraph(const DiGraph<VertexProp, EdgeProp>& graph,
+                            const std::vector<Edge>&             extraEdges = {}) -> CsrDiGraph
+    {
+        std::vector<size_t> vertices;
+        std::vector<Edge>   edges(extraEdges);
+        vertices.reserve(graph.numVertices());
+        for (const auto& kv : graph.adj()) {
+            vertices.push_back(kv.first);
+            for (size_t target : kv.second) {
+                edges.emplace_back(kv.first, target);
+            }
+        }
+        return CsrDiGraph(std::move(vertices), edges);
+    }
+
+    auto numVertices() const -> size_t
+    {
+        return mIds.size();
+    }
+
+    auto numEdges() const -> size_t
+    {
+        return mOutTargets.size();
+    }
+
+    /**
+     * Original id of the vertex with dense index idx
+     */
+    auto vertexId(size_t idx) const -> size_t
+    {
+        return mIds[idx];
+    }
+
+    /**
+     * Dense index of the vertex with the given original id. Throws if the vertex does not exist.
+     */
+    auto vertexIdx(size_t id) const -> size_t
+    {
+        auto it = std::lower_bound(mIds.begin(), mIds.end(), id);
+        if (it == mIds.end() || *it != id) {
+            NeonException exception("CsrDiGraph::vertexIdx");
+            exception << "Vertex " + std::to_string(id) + " does not exist.";
+            NEON_THROW(exception);
+        }
+        return size_t(it - mIds.begin());
+    }
+
+    auto outDegree(size_t idx) const -> size_t
+    {
+        return mOutOffsets[idx + 1] - mOutOffsets[idx];
+    }
+
+    auto inDegree(size_t idx) const -> size_t
+    {
+        return mInOffsets[idx + 1] - mInOffsets[idx];
+    }
+
+    /**
+     * Run fn(childIdx) on each out neighbour, in ascending order
+     */
+    template <typename Fn>
+    auto forEachOutNeighbor(size_t idx, Fn fn) const -> void
+    {
+        for (size_t e = mOutOffsets[idx]; e < mOutOffsets[idx + 1]; e++) {
+            fn(mOutTargets[e]);
+        }
+    }
+
+    /**
+     * Run fn(parentIdx) on each in neighbour
+     */
+    template <typename Fn>
+    auto forEachInNeighbor(size_t idx, Fn fn) const -> void
+    {
+        for (size_t e = mInOffsets[idx]; e < mInOffsets[idx + 1]; e++) {
+            fn(mInSources[e]);
+        }
+    }
+
+    /**
+     * Dense indices in topological order (Kahn algorithm, ties broken by index).
+     * Throws if the graph has a cycle.
+     */
+    auto topologicalOrder() const -> std::vector<size_t>
+    {
+        const size_t        n = numVertices();
+        std::vector<size_t> inCount(n);
+        std::vector<size_t> order;
+        order.reserve(n);
+        for (size_t v = 0; v < n; v++) {
+            inCount[v] = inDegree(v);
+            if (inCount[v] == 0) {
+                order.push_back(v);
+            }
+        }
+        for (size_t head = 0; head < order.size(); head++) {
+            forEachOutNeighbor(order[head], [&](size_t child) {
+                if (--inCount[child] == 0) {
+                    order.push_back(child);
+                }
+            });
+        }
+        if (order.size() != n) {
+            NeonException exception("CsrDiGraph::topologicalOrder");
+            exception << "The graph is not acyclic.";
+            NEON_THROW(exception);
+        }
+        return order;
+    }
+
+    /**
+     * Breadth first visit from rootIdx, fn(idx, depth) is called once per reachable vertex
+     */
+    template <typename Fn>
+    auto bfs(size_t rootIdx, Fn fn) const -> void
+    {
+        std::vector<int>    depth(numVertices(), -1);
+        std::vector<size_t> queue;
+        queue.reserve(numVertices());
+        queue.push_back(rootIdx);
+        depth[rootIdx] = 0;
+        for (size_t head = 0; head < queue.size(); head++) {
+            const size_t v = queue[head];
+            fn(v, depth[v]);
+            forEachOutNeighbor(v, [&](size_t child) {
+                if (depth[child] == -1) {
+                    depth[child] = depth[v] + 1;
+                    queue.push_back(child);
+                }
+            });
+        }
+    }
+
+    /**
+     * Level of each vertex: 0 for vertices without in edges, otherwise one more than the highest level
+     * of its parents (length of the longest path from a source). Throws if the graph has a cycle.
+     */
+    auto longestPathLevels() const -> std::vector<int>
+    {
+        std::vector<int> level(numVertices(), 0);
+        for (size_t v : topologicalOrder()) {
+            forEachOutNeighbor(v, [&](size_t child) {
+                level[child] = std::max(level[child], level[v] + 1);
+            });
+        }
+        return level;
+    }
+
+    /**
+     * Edges (original ids) that are implied by another path and can be removed without changing
+     * the reachability of the graph. Throws if the graph has a cycle.
+     *
+     * Descendants are stored as bitsets and computed in reverse topological order. An edge (v, c) is redundant
+     * when c is a descendant of another child of v; such a child always comes before c in topological order.
+     */
+    auto transitiveReduction() const -> std::vector<Edge>
+    {
+        const size_t n = numVertices();
+        const size_t nWords = (n + 63) / 64;
+
+        const std::vector<size_t> order = topologicalOrder();
+        std::vector<size_t>       position(n);
+        for (size_t i = 0; i < n; i++) {
+            position[order[i]] = i;
+        }
+
+        std::vector<uint64_t> descendants(n * nWords, 0);
+        std::vector<size_t>   children;
+        std::vector<Edge>     redundant;
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            const size_t v = *it;
+            uint64_t*    row = descendants.data() + v * nWords;
+
+            children.clear();
+            forEachOutNeighbor(v, [&](size_t child) { children.push_back(child); });
+            std::sort(children.begin(), children.end(), [&](size_t a, size_t b) { return position[a] < position[b]; });
+
+            for (size_t child : children) {
+                if ((row[child / 64] >> (child % 64)) & 1u) {
+                    redundant.emplace_back(vertexId(v), vertexId(child));
+                    continue;
+                }
+                const uint64_t* childRow = descendants.data() + child * nWords;
+                for (size_t w = 0; w < nWords; w++) {
+                    row[w] |= childRow[w];
+                }
+                row[child / 64] |= uint64_t(1) << (child % 64);
+            }
+        }
+        return redundant;
+    }
+
+   private:
+    std::vector<size_t> mIds;         // Dense index to original vertex id (sorted)
+    std::vector<size_t> mOutOffsets;  // CSR offsets of the out neighbours
+    std::vector<size_t> mOutTargets;  // Out neighbours
+    std::vector<size_t> mInOffsets;   // CSR offsets of the in neighbours
+    std::vector<size_t> mInSources;   // In neighbours
+};
+
+}  // namespace Neon
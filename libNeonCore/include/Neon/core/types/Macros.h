@@ -215,6 +215,39 @@
 #endif
 //------------------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------------
+///////////////// HOST LOOP VECTORIZATION /////////////////
+//// NEON_FLATTEN -> every call in the body of the function is inlined, e.g. the user lambda of a host loop.
+//// NEON_IVDEP -> the following host loop has no loop carried dependency through memory.
+//// NEON_UNROLL -> the following short loop with a compile time trip count is unrolled completely.
+//// The host compiler of nvcc is identified by its own flags, the device pass only honours NEON_UNROLL.
+#if defined(NEON_PLACE_CUDA_DEVICE)
+#define NEON_FLATTEN
+#define NEON_IVDEP
+#define NEON_UNROLL _Pragma("unroll")
+#elif defined(__clang__)
+#define NEON_FLATTEN __attribute__((flatten))
+#define NEON_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#define NEON_UNROLL _Pragma("unroll")
+#elif defined(__INTEL_COMPILER)
+#define NEON_FLATTEN
+#define NEON_IVDEP _Pragma("ivdep")
+#define NEON_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#define NEON_FLATTEN __attribute__((flatten))
+#define NEON_IVDEP _Pragma("GCC ivdep")
+#define NEON_UNROLL _Pragma("GCC unroll 32")
+#elif defined(_MSC_VER)
+#define NEON_FLATTEN
+#define NEON_IVDEP __pragma(loop(ivdep))
+#define NEON_UNROLL
+#else
+#define NEON_FLATTEN
+#define NEON_IVDEP
+#define NEON_UNROLL
+#endif
+//------------------------------------------------------------------------------------
+
 //------------------------------------------------------------------------------------
 ///////////////// __attribute__((__deprecated__)) /////////////////
 #ifdef NEON_COMPILER_VS
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+
+namespace Neon {
+
+/**
+ * Order in which the cells of a partition are stored in memory.
+ * It is orthogonal to Neon::MemoryLayout, which defines how the components
+ * of a multi-cardinality field are interleaved.
+ *
+ * - linear: x is the fastest index, then y, then z.
+ * - tiled4, tiled8: cells are grouped in bricks of 4x4x4 or 8x8x8 cells.
+ *   Cells in a brick are stored contiguously, bricks are stored in linear order.
+ * - morton4, morton8: as tiled4 and tiled8, but bricks are stored following
+ *   the Morton (Z-order) curve.
+ *
+ * Bricked layouts improve the cache and TLB reuse of stencil operations on
+ * large domains. They are only supported by dGrid, when Neon is built with
+ * NEON_USE_SPATIAL_LAYOUT; requesting one in any other case throws.
+ */
+enum class SpatialLayout
+{
+    linear = 0,
+    tiled4 = 1,
+    tiled8 = 2,
+    morton4 = 3,
+    morton8 = 4
+};
+
+class SpatialLayoutUtils
+{
+   public:
+    static constexpr int nConfig{5};
+
+    static auto toString(const SpatialLayout& config) -> const char*;
+    static auto toInt(const SpatialLayout& config) -> int;
+    static auto fromInt(const int& config) -> SpatialLayout;
+    static auto fromString(const std::string& config) -> SpatialLayout;
+
+    /**
+     * Returns the log2 of the brick edge, 0 for the linear layout.
+     */
+    static auto brickLog2(const SpatialLayout& config) -> int;
+
+    /**
+     * Returns true if bricks are stored in Morton order.
+     */
+    static auto isMorton(const SpatialLayout& config) -> bool;
+};
+
+}  // namespace Neon
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "Neon/core/types/Macros.h"
+
+namespace Neon {
+
+/**
+ * Storage types are compact representations of real numbers that can be used as
+ * the cell type of a field (e.g. grid.newField<Neon::Half>(...)).
+ *
+ * Values are kept compressed in memory and converted to and from their compute type
+ * (float) at the accessor boundary: reading a value from a partition returns a reference
+ * to the compressed value which implicitly converts to float, while assigning a float
+ * (or using a compound assignment operator) compresses it back.
+ * Arithmetic is therefore always executed in the compute type.
+ *
+ * All storage types are trivially copyable, so halo updates and host/device
+ * transfers work on them as on any other type, moving only the compressed bytes.
+ */
+
+/**
+ * IEEE-754 binary16 storage: 1 sign bit, 5 exponent bits, 10 mantissa bits.
+ * Conversion from float uses round-to-nearest-even.
+ */
+class Half
+{
+   public:
+    using ComputeType = float;
+
+    Half() = default;
+
+    NEON_CUDA_HOST_DEVICE inline Half(float value /**< [in] value to be compressed */);
+
+    NEON_CUDA_HOST_DEVICE inline operator float() const;
+
+    NEON_CUDA_HOST_DEVICE inline auto operator+=(float value) -> Half&;
+    NEON_CUDA_HOST_DEVICE inline auto operator-=(float value) -> Half&;
+    NEON_CUDA_HOST_DEVICE inline auto operator*=(float value) -> Half&;
+    NEON_CUDA_HOST_DEVICE inline auto operator/=(float value) -> Half&;
+
+    /**
+     * Returns the raw binary16 representation
+     */
+    NEON_CUDA_HOST_DEVICE inline auto getBits() const -> uint16_t;
+
+    /**
+     * Creates a Half from its raw binary16 representation
+     */
+    NEON_CUDA_HOST_DEVICE static inline auto fromBits(uint16_t bits) -> Half;
+
+   private:
+    uint16_t mBits;
+};
+
+/**
+ * Brain floating point storage: 1 sign bit, 8 exponent bits, 7 mantissa bits.
+ * It has the same range of a float with a reduced precision.
+ * Conversion from float uses round-to-nearest-even.
+ */
+class BFloat16
+{
+   public:
+    using ComputeType = float;
+
+    BFloat16() = default;
+
+    NEON_CUDA_HOST_DEVICE inline BFloat16(float value /**< [in] value to be compressed */);
+
+    NEON_CUDA_HOST_DEVICE inline operator float() const;
+
+    NEON_CUDA_HOST_DEVICE inline auto operator+=(float value) -> BFloat16&;
+    NEON_CUDA_HOST_DEVICE inline auto operator-=(float value) -> BFloat16&;
+    NEON_CUDA_HOST_DEVICE inline auto operator*=(float value) -> BFloat16&;
+    NEON_CUDA_HOST_DEVICE inline auto operator/=(float value) -> BFloat16&;
+
+    /**
+     * Returns the raw bfloat16 representation
+     */
+    NEON_CUDA_HOST_DEVICE inline auto getBits() const -> uint16_t;
+
+    /**
+     * Creates a BFloat16 from its raw representation
+     */
+    NEON_CUDA_HOST_DEVICE static inline auto fromBits(uint16_t bits) -> BFloat16;
+
+   private:
+    uint16_t mBits;
+};
+
+/**
+ * Fixed point storage: a value v is stored as the integer round(v * 2^FractionBits).
+ * Values outside the representable range are saturated.
+ *
+ * For example ScaledInt<int16_t, 12> covers [-8, 8) with a resolution of 2^-12.
+ */
+template <typename IntegerT /**< Integer type used for the storage */,
+          int FractionBits /**< Number of bits dedicated to the fractional part */>
+class ScaledInt
+{
+   public:
+    static_assert(std::is_integral<IntegerT>::value, "ScaledInt requires an integer storage type");
+    static_assert(FractionBits >= 0 && FractionBits < int(sizeof(IntegerT) * 8), "Invalid number of fraction bits");
+
+    using ComputeType = float;
+    using Integer = IntegerT;
+
+    static constexpr float kScale = float(uint64_t(1) << FractionBits);
+    static constexpr float kInvScale = 1.0f / kScale;
+
+    ScaledInt() = default;
+
+    NEON_CUDA_HOST_DEVICE inline ScaledInt(float value /**< [in] value to be compressed */);
+
+    NEON_CUDA_HOST_DEVICE inline operator float() const;
+
+    NEON_CUDA_HOST_DEVICE inline auto operator+=(float value) -> ScaledInt&;
+    NEON_CUDA_HOST_DEVICE inline auto operator-=(float value) -> ScaledInt&;
+    NEON_CUDA_HOST_DEVICE inline auto operator*=(float value) -> ScaledInt&;
+    NEON_CUDA_HOST_DEVICE inline auto operator/=(float value) -> ScaledInt&;
+
+    /**
+     * Returns the raw integer representation
+     */
+    NEON_CUDA_HOST_DEVICE inline auto getBits() const -> IntegerT;
+
+    /**
+     * Creates a ScaledInt from its raw integer representation
+     */
+    NEON_CUDA_HOST_DEVICE static inline auto fromBits(IntegerT bits) -> ScaledInt;
+
+   private:
+    IntegerT mBits;
+};
+
+/**
+ * Traits that associate a storage type with the type used for computation.
+ * For standard types the two types match.
+ */
+template <typename T>
+struct StorageTypeTraits
+{
+    using ComputeType = T;
+    static constexpr bool isCompressed = false;
+};
+
+template <>
+struct StorageTypeTraits<Half>
+{
+    using ComputeType = Half::ComputeType;
+    static constexpr bool isCompressed = true;
+};
+
+template <>
+struct StorageTypeTraits<BFloat16>
+{
+    using ComputeType = BFloat16::ComputeType;
+    static constexpr bool isCompressed = true;
+};
+
+template <typename IntegerT, int FractionBits>
+struct StorageTypeTraits<ScaledInt<IntegerT, FractionBits>>
+{
+    using ComputeType = typename ScaledInt<IntegerT, FractionBits>::ComputeType;
+    static constexpr bool isCompressed = true;
+};
+
+/**
+ * Shortcut to the compute type associated to a storage type
+ */
+template <typename T>
+using ComputeTypeOf = typename StorageTypeTraits<T>::ComputeType;
+
+}  // namespace Neon
+
+#include "Neon/core/types/StorageType_imp.h"
@@ -0,0 +1,270 @@
+#pragma once
+
+#include "Neon/core/types/StorageType.h"
+
+namespace Neon {
+
+namespace internal::storageType {
+
+NEON_CUDA_HOST_DEVICE inline auto floatToBits(float value) -> uint32_t
+{
+#if defined(NEON_PLACE_CUDA_DEVICE)
+    return __float_as_uint(value);
+#else
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+#endif
+}
+
+NEON_CUDA_HOST_DEVICE inline auto bitsToFloat(uint32_t bits) -> float
+{
+#if defined(NEON_PLACE_CUDA_DEVICE)
+    return __uint_as_float(bits);
+#else
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+#endif
+}
+
+/**
+ * float -> binary16 with round-to-nearest-even.
+ * Overflows are mapped to infinity, NaNs are mapped to a quiet NaN.
+ */
+NEON_CUDA_HOST_DEVICE inline auto floatToHalfBits(float value) -> uint16_t
+{
+    constexpr uint32_t kFloatInf = 255u << 23;
+    constexpr uint32_t kHalfOverflow = (127u + 16u) << 23;
+    constexpr uint32_t kHalfMinNormal = 113u << 23;
+    constexpr uint32_t kDenormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+    uint32_t       bits = floatToBits(value);
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    uint16_t result;
+    if (bits >= kHalfOverflow) {
+        // Inf or NaN
+        result = (bits > kFloatInf) ? 0x7e00 : 0x7c00;
+    } else if (bits < kHalfMinNormal) {
+        // Sub-normal or zero: the addition aligns the 10 mantissa bits
+        // at the bottom of the float and rounds to nearest even.
+        const float aligned = bitsToFloat(bits) + bitsToFloat(kDenormMagic);
+        result = uint16_t(floatToBits(aligned) - kDenormMagic);
+    } else {
+        const uint32_t mantissaOdd = (bits >> 13) & 1u;
+        bits += ((15u - 127u) << 23) + 0xfffu;
+        bits += mantissaOdd;
+        result = uint16_t(bits >> 13);
+    }
+    return uint16_t(result | (sign >> 16));
+}
+
+/**
+ * binary16 -> float (exact)
+ */
+NEON_CUDA_HOST_DEVICE inline auto halfBitsToFloat(uint16_t half) -> float
+{
+    constexpr uint32_t kShiftedExp = 0x7c00u << 13;
+    constexpr uint32_t kMagic = 113u << 23;
+
+    uint32_t       bits = uint32_t(half & 0x7fffu) << 13;
+    const uint32_t exp = kShiftedExp & bits;
+    bits += (127u - 15u) << 23;
+
+    if (exp == kShiftedExp) {
+        // Inf or NaN
+        bits += (128u - 16u) << 23;
+    } else if (exp == 0) {
+        // Zero or sub-normal
+        bits += 1u << 23;
+        bits = floatToBits(bitsToFloat(bits) - bitsToFloat(kMagic));
+    }
+    bits |= uint32_t(half & 0x8000u) << 16;
+    return bitsToFloat(bits);
+}
+
+/**
+ * float -> bfloat16 with round-to-nearest-even.
+ */
+NEON_CUDA_HOST_DEVICE inline auto floatToBFloat16Bits(float value) -> uint16_t
+{
+    uint32_t bits = floatToBits(value);
+    if ((bits & 0x7fffffffu) > 0x7f800000u) {
+        // Quiet NaN
+        return uint16_t((bits >> 16) | 0x40u);
+    }
+    bits += 0x7fffu + ((bits >> 16) & 1u);
+    return uint16_t(bits >> 16);
+}
+
+/**
+ * bfloat16 -> float (exact)
+ */
+NEON_CUDA_HOST_DEVICE inline auto bFloat16BitsToFloat(uint16_t bf16) -> float
+{
+    return bitsToFloat(uint32_t(bf16) << 16);
+}
+
+}  // namespace internal::storageType
+
+NEON_CUDA_HOST_DEVICE inline Half::Half(float value)
+    : mBits(internal::storageType::floatToHalfBits(value))
+{
+}
+
+NEON_CUDA_HOST_DEVICE inline Half::operator float() const
+{
+    return internal::storageType::halfBitsToFloat(mBits);
+}
+
+NEON_CUDA_HOST_DEVICE inline auto Half::operator+=(float value) -> Half&
+{
+    *this = Half(float(*this) + value);
+    return *this;
+}
+
+NEON_CUDA_HOST_DEVICE inline auto Half::operator-=(float value) -> Half&
+{
+    *this = Half(float(*this) - value);
+    return *this;
+}
+
+NEON_CUDA_HOST_DEVICE inline auto Half::operator*=(float value) -> Half&
+{
+    *this = Half(float(*this) * value);
+    return *this;
+}
+
+NEON_CUDA_HOST_DEVICE inline auto Half::operator/=(float value) -> Half&
+{
+    *this = Half(float(*this) / value);
+    return *this;
+}
+
+NEON_CUDA_HOST_DEVICE inline auto Half::getBits() const -> uint16_t
+{
+    return mBits;
+}
+
+NEON_CUDA_HOST_DEVICE inline auto Half::fromBits(uint16_t bits) -> Half
+{
+    Half h;
+    h.mBits = bits;
+    return h;
+}
+
+NEON_CUDA_HOST_DEVICE inline BFloat16::BFloat16(float value)
+    : mBits(internal::storageType::floatToBFloat16Bits(value))
+{
+}
+
+NEON_CUDA_HOST_DEVICE inline BFloat16::operator float() const
+{
+    return internal::storageType::bFloat16BitsToFloat(mBits);
+}
+
+NEON_CUDA_HOST_DEVICE inline auto BFloat16::operator+=(float value) -> BFloat16&
+{
+    *this = BFloat16(float(*this) + value);
+    return *this;
+}
+
+NEON_CUDA_HOST_DEVICE inline auto BFloat16::operator-=(float value) -> BFloat16&
+{
+    *this = BFloat16(float(*this) - value);
+    return *this;
+}
+
+NEON_CUDA_HOST_DEVICE inline auto BFloat16::operator*=(float value) -> BFloat16&
+{
+    *this = BFloat16(float(*this) * value);
+    return *this;
+}
+
+NEON_CUDA_HOST_DEVICE inline auto BFloat16::operator/=(float value) -> BFloat16&
+{
+    *this = BFloat16(float(*this) / value);
+    return *this;
+}
+
+NEON_CUDA_HOST_DEVICE inline auto BFloat16::getBits() const -> uint16_t
+{
+    return mBits;
+}
+
+NEON_CUDA_HOST_DEVICE inline auto BFloat16::fromBits(uint16_t bits) -> BFloat16
+{
+    BFloat16 b;
+    b.mBits = bits;
+    return b;
+}
+
+template <typename IntegerT, int FractionBits>
+NEON_CUDA_HOST_DEVICE inline ScaledInt<IntegerT, FractionBits>::ScaledInt(float value)
+{
+    constexpr float kMax = float(std::numeric_limits<IntegerT>::max());
+    constexpr float kMin = float(std::numeric_limits<IntegerT>::min());
+
+    float scaled = value * kScale;
+    scaled = scaled >= 0 ? scaled + 0.5f : scaled - 0.5f;
+    if (!(scaled < kMax)) {
+        // Saturation (NaNs are saturated too)
+        mBits = std::numeric_limits<IntegerT>::max();
+    } else if (scaled <= kMin) {
+        mBits = std::numeric_limits<IntegerT>::min();
+    } else {
+        mBits = IntegerT(scaled);
+    }
+}
+
+template <typename IntegerT, int FractionBits>
+NEON_CUDA_HOST_DEVICE inline ScaledInt<IntegerT, FractionBits>::operator float() const
+{
+    return float(mBits) * kInvScale;
+}
+
+template <typename IntegerT, int FractionBits>
+NEON_CUDA_HOST_DEVICE inline auto ScaledInt<IntegerT, FractionBits>::operator+=(float value) -> ScaledInt&
+{
+    *this = ScaledInt(float(*this) + value);
+    return *this;
+}
+
+template <typename IntegerT, int FractionBits>
+NEON_CUDA_HOST_DEVICE inline auto ScaledInt<IntegerT, FractionBits>::operator-=(float value) -> ScaledInt&
+{
+    *this = ScaledInt(float(*this) - value);
+    return *this;
+}
+
+template <typename IntegerT, int FractionBits>
+NEON_CUDA_HOST_DEVICE inline auto ScaledInt<IntegerT, FractionBits>::operator*=(float value) -> ScaledInt&
+{
+    *this = ScaledInt(float(*this) * value);
+    return *this;
+}
+
+template <typename IntegerT, int FractionBits>
+NEON_CUDA_HOST_DEVICE inline auto ScaledInt<IntegerT, FractionBits>::operator/=(float value) -> ScaledInt&
+{
+    *this = ScaledInt(float(*this) / value);
+    return *this;
+}
+
+template <typename IntegerT, int FractionBits>
+NEON_CUDA_HOST_DEVICE inline auto ScaledInt<IntegerT, FractionBits>::getBits() const -> IntegerT
+{
+    return mBits;
+}
+
+template <typename IntegerT, int FractionBits>
+NEON_CUDA_HOST_DEVICE inline auto ScaledInt<IntegerT, FractionBits>::fromBits(IntegerT bits) -> ScaledInt
+{
+    ScaledInt s;
+    s.mBits = bits;
+    return s;
+}
+
+}  // namespace Neon
@@ -32,6 +32,9 @@ struct Empty
 
 /**
  * DiGraph is a directed graph datastructure implemented using an adjacency list.
+ * Incoming edges are tracked by a second (reverse) adjacency list, so that
+ * in-edge queries only depend on the in-degree of the vertex.
+ * See CsrDiGraph for a compact read-only snapshot used for whole-graph analyses.
  * 
  * Self loops can be represented.
  * Parallel loops cannot be represented.
@@ -47,6 +50,7 @@ class DiGraph
 
    private:
     std::map<size_t, std::set<size_t>> mAdj;    // Adjacency list
+    std::map<size_t, std::set<size_t>> mInAdj;  // Reverse adjacency list
     std::map<size_t, VertexProp>       mVprop;  // Per-vertex properties
     std::map<Edge, EdgeProp>           mEprop;  // Per-edge properties
 
@@ -102,7 +106,8 @@ class DiGraph
         if (!hasVertex(v1) || !hasVertex(v2)) {
             return false;
         }
-        return std::find(mAdj.at(v1).begin(), mAdj.at(v1).end(), v2) != mAdj.at(v1).end();
+        const auto& adjList = mAdj.at(v1);
+        return adjList.find(v2) != adjList.end();
     }
 
     /**
@@ -131,6 +136,7 @@ class DiGraph
             return false;
         }
         mAdj.insert({v, std::set<size_t>()});
+        mInAdj.insert({v, std::set<size_t>()});
         mVprop.insert({v, prop});
         return true;
     }
@@ -155,6 +161,7 @@ class DiGraph
             return false;
         }
         mAdj[v1].insert(v2);
+        mInAdj[v2].insert(v1);
         setEdgeProperty({v1, v2}, prop);
         return true;
     }
@@ -207,11 +214,15 @@ class DiGraph
      */
     void forEachInEdge(size_t vertex, std::function<void(const Edge&)> fn)
     {
-        for (auto& kv : mAdj) {
-            const auto& adjList = kv.second;
-            if (adjList.find(vertex) != adjList.end()) {
-                fn({kv.first, vertex});
-            }
+        // A vertex that is not in the graph has no incoming edges
+        auto it = mInAdj.find(vertex);
+        if (it == mInAdj.end()) {
+            return;
+        }
+        // Iterating over a copy as fn may modify the graph
+        const std::vector<size_t> sources(it->second.begin(), it->second.end());
+        for (size_t source : sources) {
+            fn({source, vertex});
         }
     }
 
@@ -223,11 +234,12 @@ class DiGraph
      */
     void forEachInEdge(size_t vertex, std::function<void(const Edge&)> fn) const
     {
-        for (auto& kv : mAdj) {
-            const auto& adjList = kv.second;
-            if (adjList.find(vertex) != adjList.end()) {
-                fn({kv.first, vertex});
-            }
+        auto it = mInAdj.find(vertex);
+        if (it == mInAdj.end()) {
+            return;
+        }
+        for (size_t source : it->second) {
+            fn({source, vertex});
         }
     }
 
@@ -250,9 +262,7 @@ class DiGraph
      */
     auto outEdgesCount(size_t vertex) -> size_t
     {
-        size_t count = 0;
-        forEachOutEdge(vertex, [&](const Edge&) { count++; });
-        return count;
+        return mAdj.at(vertex).size();
     }
 
     /**
@@ -262,9 +272,8 @@ class DiGraph
      */
     auto inEdgesCount(size_t vertex) -> size_t
     {
-        size_t count = 0;
-        forEachInEdge(vertex, [&](const Edge&) { count++; });
-        return count;
+        auto it = mInAdj.find(vertex);
+        return it == mInAdj.end() ? 0 : it->second.size();
     }
 
 
@@ -289,7 +298,7 @@ class DiGraph
     std::set<Edge> edges() const
     {
         std::set<Edge> edges;
-        for (auto i : mAdj) {
+        for (const auto& i : mAdj) {
             size_t src = i.first;
             for (size_t tgt : i.second) {
                 edges.insert({src, tgt});
@@ -565,6 +574,7 @@ class DiGraph
     {
         validateEdge(u, v);
         mAdj[u].erase(v);
+        mInAdj[v].erase(u);
         mEprop.erase({u, v});
     }
 
@@ -598,6 +608,7 @@ class DiGraph
         }
         // Remove vertex
         mAdj.erase(v);
+        mInAdj.erase(v);
         // Remove vertex property
         mVprop.erase(v);
     }
@@ -611,6 +622,7 @@ class DiGraph
     {
         validateVertex(v);
         mAdj[v].erase(v);
+        mInAdj[v].erase(v);
         mEprop.erase({v, v});
     }
 
@@ -630,6 +642,7 @@ class DiGraph
     void clear()
     {
         mAdj.clear();
+        mInAdj.clear();
         mEprop.clear();
         mVprop.clear();
     }
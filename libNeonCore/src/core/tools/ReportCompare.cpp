@@ -0,0 +1,354 @@
+#include "Neon/core/tools/ReportCompare.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+#include <rapidjson/error/en.h>
+
+#include "Neon/core/types/Exceptions.h"
+
+namespace Neon {
+namespace core {
+
+namespace {
+auto toLower(std::string str) -> std::string
+{
+    std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) { return char(std::tolower(c)); });
+    return str;
+}
+
+auto endsWith(const std::string& str, const std::string& suffix) -> bool
+{
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/**
+ * Members written by Report that describe the environment of the run rather than its configuration
+ */
+auto isEnvironment(const std::string& key) -> bool
+{
+    static const std::set<std::string> members{"git_sha", "git_local_changes_status", "git_refspec",
+                                               "date", "command_line", "token", "System", "CUDA"};
+    return members.count(key) != 0 || key.rfind("GPU_", 0) == 0;
+}
+
+auto valueToString(const rapidjson::Value& val) -> std::string
+{
+    if (val.IsString()) {
+        return val.GetString();
+    }
+    if (val.IsBool()) {
+        return val.GetBool() ? "true" : "false";
+    }
+    if (val.IsInt64()) {
+        return std::to_string(val.GetInt64());
+    }
+    return std::to_string(val.GetUint64());
+}
+
+auto stats(const std::vector<double>& values) -> ReportCompare::Stats
+{
+    ReportCompare::Stats s;
+    s.n = int(values.size());
+    for (double v : values) {
+        s.mean += v;
+    }
+    s.mean /= double(std::max(1, s.n));
+    if (s.n > 1) {
+        double var = 0;
+        for (double v : values) {
+            var += (v - s.mean) * (v - s.mean);
+        }
+        s.stddev = std::sqrt(var / double(s.n - 1));
+    }
+    return s;
+}
+
+/**
+ * Two-sided critical value of the Student t distribution at 95% confidence
+ */
+auto tCritical(double dof) -> double
+{
+    static const double table[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                   2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                   2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (dof < 1) {
+        return table[0];
+    }
+    if (dof <= 30) {
+        return table[int(dof) - 1];
+    }
+    if (dof <= 60) {
+        return 2.000;
+    }
+    if (dof <= 120) {
+        return 1.980;
+    }
+    return 1.960;
+}
+
+/**
+ * Welch t-test on the difference of the means
+ */
+auto isSignificant(const ReportCompare::Stats& a, const ReportCompare::Stats& b) -> bool
+{
+    if (a.n < 2 || b.n < 2) {
+        return true;
+    }
+    const double va = a.stddev * a.stddev / double(a.n);
+    const double vb = b.stddev * b.stddev / double(b.n);
+    const double se = std::sqrt(va + vb);
+    if (se == 0) {
+        return a.mean != b.mean;
+    }
+    const double t = std::abs(b.mean - a.mean) / se;
+    const double dof = (va + vb) * (va + vb) / (va * va / double(a.n - 1) + vb * vb / double(b.n - 1));
+    return t > tCritical(dof);
+}
+
+auto readFile(const std::string& fname) -> std::string
+{
+    std::ifstream in(fname);
+    if (!in) {
+        NeonException exp("ReportCompare");
+        exp << "Unable to open " << fname;
+        NEON_THROW(exp);
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    return buffer.str();
+}
+}  // namespace
+
+auto ReportCompare::toString(Direction direction) -> std::string
+{
+    switch (direction) {
+        case Direction::lowerIsBetter: {
+            return "lowerIsBetter";
+        }
+        case Direction::higherIsBetter: {
+            return "higherIsBetter";
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+ReportCompare::ReportCompare()
+    : ReportCompare(Options())
+{
+}
+
+ReportCompare::ReportCompare(Options options)
+    : mOptions(std::move(options))
+{
+}
+
+auto ReportCompare::direction(const std::string& metric, Direction& dir) -> bool
+{
+    const std::string name = toLower(metric);
+    for (const char* higher : {"gbs", "gb/s", "gflops", "mcups", "mlups", "throughput", "bandwidth", "speedup"}) {
+        if (name.find(higher) != std::string::npos) {
+            dir = Direction::higherIsBetter;
+            return true;
+        }
+    }
+    if (name.find("time") != std::string::npos ||
+        name.find("latency") != std::string::npos ||
+        endsWith(name, "_ms") || endsWith(metric, "Ms") ||
+        endsWith(name, "_us") || endsWith(metric, "Us") ||
+        endsWith(name, "_ns") || endsWith(metric, "Ns")) {
+        dir = Direction::lowerIsBetter;
+        return true;
+    }
+    return false;
+}
+
+auto ReportCompare::helpIsKey(const std::string& key) const -> bool
+{
+    return mOptions.keys.empty() ||
+           std::find(mOptions.keys.begin(), mOptions.keys.end(), key) != mOptions.keys.end();
+}
+
+auto ReportCompare::helpIsMetric(const std::string& metric, Direction& dir) const -> bool
+{
+    if (mOptions.metrics.empty()) {
+        return direction(metric, dir);
+    }
+    if (std::find(mOptions.metrics.begin(), mOptions.metrics.end(), metric) == mOptions.metrics.end()) {
+        return false;
+    }
+    // Metrics requested explicitly are lower-is-better unless their name says otherwise
+    if (!direction(metric, dir)) {
+        dir = Direction::lowerIsBetter;
+    }
+    return true;
+}
+
+auto ReportCompare::helpAddRun(const rapidjson::Value&            doc,
+                               std::map<std::string, std::string> config,
+                               Side&                              side) const -> void
+{
+    Samples                                       samples;
+    std::vector<const rapidjson::Value::Member*> subdocs;
+    Direction                                     dir;
+
+    for (const auto& member : doc.GetObject()) {
+        const std::string key = member.name.GetString();
+        const auto&       val = member.value;
+        if (isEnvironment(key)) {
+            continue;
+        }
+        if (val.IsObject()) {
+            subdocs.push_back(&member);
+            continue;
+        }
+        if (val.IsNumber() && helpIsMetric(key, dir)) {
+            samples[key].push_back(val.GetDouble());
+            continue;
+        }
+        if (val.IsArray() && helpIsMetric(key, dir)) {
+            for (const auto& v : val.GetArray()) {
+                if (v.IsNumber()) {
+                    samples[key].push_back(v.GetDouble());
+                }
+            }
+            continue;
+        }
+        if ((val.IsString() || val.IsBool() || val.IsInt64() || val.IsUint64()) && helpIsKey(key)) {
+            config[key] = valueToString(val);
+        }
+    }
+
+    std::string configName;
+    for (const auto& [key, val] : config) {
+        configName += (configName.empty() ? "" : ", ") + key + "=" + val;
+    }
+    if (!samples.empty()) {
+        auto& dst = side[configName];
+        for (auto& [metric, values] : samples) {
+            dst[metric].insert(dst[metric].end(), values.begin(), values.end());
+        }
+    }
+
+    // Subdocs inherit the configuration of the enclosing document
+    for (const auto* member : subdocs) {
+        auto subConfig = config;
+        subConfig["section"] = member->name.GetString();
+        helpAddRun(member->value, subConfig, side);
+    }
+}
+
+auto ReportCompare::helpParse(const std::string& json, const std::string& name, Side& side) -> void
+{
+    rapidjson::Document doc;
+    doc.Parse(json.c_str());
+    if (doc.HasParseError() || !doc.IsObject()) {
+        NeonException exp("ReportCompare");
+        exp << "Invalid report " << name;
+        if (doc.HasParseError()) {
+            exp << ": " << rapidjson::GetParseError_En(doc.GetParseError()) << " at offset " << doc.GetErrorOffset();
+        }
+        NEON_THROW(exp);
+    }
+    helpAddRun(doc, {}, side);
+}
+
+auto ReportCompare::loadBaseline(const std::string& fname) -> void
+{
+    helpParse(readFile(fname), fname, mBaseline);
+}
+
+auto ReportCompare::loadCandidate(const std::string& fname) -> void
+{
+    helpParse(readFile(fname), fname, mCandidate);
+}
+
+auto ReportCompare::parseBaseline(const std::string& json, const std::string& name) -> void
+{
+    helpParse(json, name, mBaseline);
+}
+
+auto ReportCompare::parseCandidate(const std::string& json, const std::string& name) -> void
+{
+    helpParse(json, name, mCandidate);
+}
+
+auto ReportCompare::compare() const -> std::vector<Delta>
+{
+    std::vector<Delta> deltas;
+    for (const auto& [config, baseSamples] : mBaseline) {
+        auto candIt = mCandidate.find(config);
+        if (candIt == mCandidate.end()) {
+            continue;
+        }
+        for (const auto& [metric, baseValues] : baseSamples) {
+            auto valIt = candIt->second.find(metric);
+            if (valIt == candIt->second.end()) {
+                continue;
+            }
+            Delta d;
+            d.config = config;
+            d.metric = metric;
+            helpIsMetric(metric, d.direction);
+            d.baseline = stats(baseValues);
+            d.candidate = stats(valIt->second);
+            d.change = d.baseline.mean != 0 ? (d.candidate.mean - d.baseline.mean) / std::abs(d.baseline.mean) : 0;
+            d.isSignificant = isSignificant(d.baseline, d.candidate);
+
+            const double worsening = d.direction == Direction::lowerIsBetter ? d.change : -d.change;
+            d.isRegression = d.isSignificant && worsening > mOptions.threshold;
+            d.isImprovement = d.isSignificant && -worsening > mOptions.threshold;
+            deltas.push_back(d);
+        }
+    }
+    return deltas;
+}
+
+auto ReportCompare::unmatched() const -> std::vector<std::string>
+{
+    std::vector<std::string> ret;
+    for (const auto& [config, samples] : mBaseline) {
+        if (mCandidate.count(config) == 0) {
+            ret.push_back("baseline only: " + config);
+        }
+    }
+    for (const auto& [config, samples] : mCandidate) {
+        if (mBaseline.count(config) == 0) {
+            ret.push_back("candidate only: " + config);
+        }
+    }
+    return ret;
+}
+
+auto ReportCompare::print(std::ostream& os, const std::vector<Delta>& deltas) -> void
+{
+    std::vector<const Delta*> sorted;
+    for (const auto& d : deltas) {
+        sorted.push_back(&d);
+    }
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Delta* a, const Delta* b) {
+        return a->isRegression > b->isRegression;
+    });
+
+    std::string lastConfig;
+    for (const auto* d : sorted) {
+        if (d->config != lastConfig) {
+            os << "[" << d->config << "]\n";
+            lastConfig = d->config;
+        }
+        const char* status = d->isRegression ? "REGRESSION" : (d->isImprovement ? "improvement" : (d->isSignificant ? "ok" : "noise"));
+        os << "  " << std::left << std::setw(32) << d->metric << std::right
+           << std::setw(14) << d->baseline.mean << " +- " << std::setw(10) << d->baseline.stddev << " (n=" << d->baseline.n << ")"
+           << std::setw(14) << d->candidate.mean << " +- " << std::setw(10) << d->candidate.stddev << " (n=" << d->candidate.n << ")"
+           << std::setw(10) << std::fixed << std::setprecision(2) << d->change * 100.0 << "%" << std::defaultfloat << std::setprecision(6)
+           << "  " << status << "\n";
+    }
+}
+
+}  // namespace core
+}  // namespace Neon
@@ -0,0 +1,82 @@
+#include "Neon/core/types/SpatialLayout.h"
+#include "Neon/core/core.h"
+
+
+namespace Neon {
+
+auto SpatialLayoutUtils::toString(const SpatialLayout& config) -> const char*
+{
+    switch (config) {
+        case SpatialLayout::linear: {
+            return "linear";
+        }
+        case SpatialLayout::tiled4: {
+            return "tiled4";
+        }
+        case SpatialLayout::tiled8: {
+            return "tiled8";
+        }
+        case SpatialLayout::morton4: {
+            return "morton4";
+        }
+        case SpatialLayout::morton8: {
+            return "morton8";
+        }
+        default: {
+            NEON_THROW_UNSUPPORTED_OPTION("");
+        }
+    }
+}
+
+auto SpatialLayoutUtils::toInt(const SpatialLayout& config) -> int
+{
+    return static_cast<int>(config);
+}
+
+auto SpatialLayoutUtils::fromInt(const int& config) -> SpatialLayout
+{
+    for (int i = 0; i < nConfig; i++) {
+        if (config == i) {
+            return static_cast<SpatialLayout>(i);
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto SpatialLayoutUtils::fromString(const std::string& config) -> SpatialLayout
+{
+    for (int i = 0; i < nConfig; i++) {
+        const SpatialLayout layout = static_cast<SpatialLayout>(i);
+        if (config == toString(layout)) {
+            return layout;
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto SpatialLayoutUtils::brickLog2(const SpatialLayout& config) -> int
+{
+    switch (config) {
+        case SpatialLayout::linear: {
+            return 0;
+        }
+        case SpatialLayout::tiled4:
+        case SpatialLayout::morton4: {
+            return 2;
+        }
+        case SpatialLayout::tiled8:
+        case SpatialLayout::morton8: {
+            return 3;
+        }
+        default: {
+            NEON_THROW_UNSUPPORTED_OPTION("");
+        }
+    }
+}
+
+auto SpatialLayoutUtils::isMorton(const SpatialLayout& config) -> bool
+{
+    return config == SpatialLayout::morton4 || config == SpatialLayout::morton8;
+}
+
+}  // namespace Neon
@@ -1,4 +1,5 @@
 
+#include <Neon/core/types/CsrDiGraph.h>
 #include <Neon/core/types/digraph.h>
 
 #include <cstring>
@@ -143,6 +144,122 @@ TEST(DiGraph, IncomingOutgoing)
     ASSERT_TRUE(outEdges.find({2, 4}) != outEdges.end());
 }
 
+TEST(DiGraph, IncomingAfterRemoval)
+{
+    Neon::DiGraph G;
+    for (size_t v = 0; v < 4; v++) {
+        G.addVertex(v);
+    }
+    G.addEdge(0, 3);
+    G.addEdge(1, 3);
+    G.addEdge(2, 3);
+    ASSERT_EQ(G.inEdgesCount(3), 3);
+    G.removeEdge(1, 3);
+    G.removeVertex(2);
+    ASSERT_EQ(G.inEdgesCount(3), 1);
+    ASSERT_EQ(G.inNeighbors(3), std::set<size_t>({0}));
+    // A removed vertex has no incoming edges
+    ASSERT_TRUE(G.inNeighbors(2).empty());
+    ASSERT_EQ(G.inEdgesCount(2), 0);
+    G.addEdge(3, 3);
+    G.removeSelfLoops();
+    ASSERT_EQ(G.inEdgesCount(3), 1);
+}
+
+TEST(CsrDiGraph, Structure)
+{
+    // Vertex ids do not need to be contiguous
+    Neon::DiGraph G;
+    G.addVertex(10);
+    G.addVertex(20);
+    G.addVertex(30);
+    G.addVertex(40);
+    G.addEdge(10, 30);
+    G.addEdge(20, 30);
+    G.addEdge(30, 40);
+
+    auto csr = Neon::CsrDiGraph::fromDiGraph(G, {{10, 30}, {10, 20}});
+    ASSERT_EQ(csr.numVertices(), 4);
+    ASSERT_EQ(csr.numEdges(), 4);
+    ASSERT_EQ(csr.vertexId(csr.vertexIdx(30)), 30);
+    ASSERT_EQ(csr.inDegree(csr.vertexIdx(30)), 2);
+    ASSERT_EQ(csr.outDegree(csr.vertexIdx(10)), 2);
+    ASSERT_ANY_THROW(csr.vertexIdx(50));
+
+    std::vector<size_t> bfsOrder;
+    csr.bfs(csr.vertexIdx(10), [&](size_t idx, int depth) {
+        bfsOrder.push_back(csr.vertexId(idx));
+        ASSERT_EQ(depth, csr.vertexId(idx) == 10 ? 0 : (csr.vertexId(idx) == 40 ? 2 : 1));
+    });
+    ASSERT_EQ(bfsOrder, std::vector<size_t>({10, 20, 30, 40}));
+
+    // 10 -> 20 -> 30 -> 40: 30 is at level 2 because of the path through 20
+    auto levels = csr.longestPathLevels();
+    ASSERT_EQ(levels[csr.vertexIdx(10)], 0);
+    ASSERT_EQ(levels[csr.vertexIdx(20)], 1);
+    ASSERT_EQ(levels[csr.vertexIdx(30)], 2);
+    ASSERT_EQ(levels[csr.vertexIdx(40)], 3);
+
+    G.addEdge(40, 10);
+    ASSERT_ANY_THROW(Neon::CsrDiGraph::fromDiGraph(G).topologicalOrder());
+}
+
+TEST(CsrDiGraph, TransitiveReduction)
+{
+    // Layered graph with random shortcuts, checked against a reachability computed by DFS
+    const size_t n = 200;
+    Neon::DiGraph G;
+    for (size_t v = 0; v < n; v++) {
+        G.addVertex(v);
+    }
+    uint64_t seed = 7;
+    auto     rnd = [&]() {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return size_t(seed >> 33);
+    };
+    for (size_t v = 0; v + 1 < n; v++) {
+        if (rnd() % 4 != 0) {
+            G.addEdge(v, v + 1);
+        }
+        for (int k = 0; k < 3; k++) {
+            G.addEdge(v, v + 1 + rnd() % std::min<size_t>(20, n - v - 1));
+        }
+    }
+
+    auto reach = [](const Neon::DiGraph<>& graph, size_t from, size_t to) {
+        std::vector<size_t> stack{from};
+        std::set<size_t>    visited;
+        while (!stack.empty()) {
+            size_t v = stack.back();
+            stack.pop_back();
+            for (size_t child : graph.neighbors(v)) {
+                if (child == to) {
+                    return true;
+                }
+                if (visited.insert(child).second) {
+                    stack.push_back(child);
+                }
+            }
+        }
+        return false;
+    };
+
+    Neon::DiGraph reduced = G;
+    for (const auto& edge : Neon::CsrDiGraph::fromDiGraph(G).transitiveReduction()) {
+        reduced.removeEdge(edge);
+    }
+    for (const auto& edge : G.edges()) {
+        // Same reachability
+        ASSERT_TRUE(reach(reduced, edge.first, edge.second));
+        // Only edges without an alternative path are left
+        if (reduced.hasEdge(edge)) {
+            reduced.removeEdge(edge);
+            ASSERT_FALSE(reach(reduced, edge.first, edge.second));
+            reduced.addEdge(edge.first, edge.second);
+        }
+    }
+}
+
 TEST(DiGraph, ExportDotFile)
 {
     Neon::DiGraph<MyVertexProp, MyEdgeProp> G;
@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+
+#include "Neon/core/types/StorageType.h"
+
+#include <cmath>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable_v<Neon::Half>);
+static_assert(std::is_trivially_copyable_v<Neon::BFloat16>);
+static_assert(std::is_trivially_copyable_v<Neon::ScaledInt<int16_t, 12>>);
+static_assert(sizeof(Neon::Half) == 2);
+static_assert(sizeof(Neon::BFloat16) == 2);
+static_assert(sizeof(Neon::ScaledInt<int16_t, 12>) == 2);
+static_assert(std::is_same_v<Neon::ComputeTypeOf<Neon::Half>, float>);
+static_assert(std::is_same_v<Neon::ComputeTypeOf<double>, double>);
+static_assert(!Neon::StorageTypeTraits<float>::isCompressed);
+
+namespace storageTypeTests {
+template <typename StorageT>
+void roundTrip()
+{
+    for (uint32_t bits = 0; bits < (1u << 16); bits++) {
+        const StorageT a = StorageT::fromBits(uint16_t(bits));
+        const float    value = a;
+        if (std::isnan(value)) {
+            continue;
+        }
+        const StorageT b(value);
+        ASSERT_EQ(a.getBits(), b.getBits()) << value;
+    }
+}
+}  // namespace storageTypeTests
+
+TEST(StorageType, halfRoundTrip)
+{
+    storageTypeTests::roundTrip<Neon::Half>();
+}
+
+TEST(StorageType, bFloat16RoundTrip)
+{
+    storageTypeTests::roundTrip<Neon::BFloat16>();
+}
+
+TEST(StorageType, halfRounding)
+{
+    // 1 + 2^-11 is a tie between 1 and 1 + 2^-10: rounds to the even mantissa
+    ASSERT_EQ(float(Neon::Half(1.0f + 1.0f / 2048.0f)), 1.0f);
+    ASSERT_EQ(float(Neon::Half(1.0f + 3.0f / 2048.0f)), 1.0f + 2.0f / 1024.0f);
+    ASSERT_TRUE(std::isinf(float(Neon::Half(70000.0f))));
+    ASSERT_EQ(float(Neon::Half(65504.0f)), 65504.0f);
+    // Smallest sub-normal
+    ASSERT_EQ(float(Neon::Half(std::ldexp(1.0f, -24))), std::ldexp(1.0f, -24));
+    ASSERT_EQ(float(Neon::Half(std::ldexp(1.0f, -26))), 0.0f);
+    ASSERT_TRUE(std::isnan(float(Neon::Half(std::nanf("")))));
+}
+
+TEST(StorageType, bFloat16Rounding)
+{
+    ASSERT_EQ(float(Neon::BFloat16(1.0f + 1.0f / 256.0f)), 1.0f);
+    ASSERT_EQ(float(Neon::BFloat16(1.0f + 3.0f / 256.0f)), 1.0f + 2.0f / 128.0f);
+    ASSERT_EQ(float(Neon::BFloat16(3.0e38f)), float(Neon::BFloat16::fromBits(0x7f62)));
+    ASSERT_TRUE(std::isnan(float(Neon::BFloat16(std::nanf("")))));
+}
+
+TEST(StorageType, scaledInt)
+{
+    using Fixed = Neon::ScaledInt<int16_t, 12>;
+    ASSERT_EQ(Fixed(1.25f).getBits(), 5120);
+    ASSERT_EQ(float(Fixed(1.25f)), 1.25f);
+    ASSERT_EQ(float(Fixed(-1.25f)), -1.25f);
+    // Saturation
+    ASSERT_EQ(Fixed(100.0f).getBits(), std::numeric_limits<int16_t>::max());
+    ASSERT_EQ(Fixed(-100.0f).getBits(), std::numeric_limits<int16_t>::min());
+    // Rounding to the nearest representable value
+    ASSERT_EQ(Fixed(1.0f / 8192.0f + 1.0f / 65536.0f).getBits(), 1);
+}
+
+TEST(StorageType, computeInFloat)
+{
+    Neon::Half h = 0;
+    h += 1.5f;
+    h *= 2;
+    ASSERT_EQ(float(h), 3.0f);
+    h -= 1;
+    h /= 4;
+    ASSERT_EQ(float(h), 0.5f);
+
+    const float sum = h + h * 0.5f;
+    ASSERT_EQ(sum, 0.75f);
+
+    Neon::BFloat16 b = float(h);
+    ASSERT_EQ(float(b), 0.5f);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
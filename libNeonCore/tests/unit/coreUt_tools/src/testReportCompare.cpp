@@ -0,0 +1,147 @@
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Neon/core/tools/ReportCompare.h"
+
+using Neon::core::ReportCompare;
+
+namespace reportCompareTest {
+/**
+ * A report as written by Neon::Report, with a run per subdoc
+ */
+std::string report(const std::string& sha, double axpyMs, double laplaceGBs, const std::string& occ = "standard")
+{
+    std::ostringstream json;
+    json << "{\"Record Name\": \"bench\", \"git_sha\": \"" << sha << "\", \"date\": \"" << sha << "\","
+         << " \"System\": {\"Hostname\": \"" << sha << "\", \"Peak Memory Bandwidth (GB/s)\": 1.0},"
+         << " \"cardinality\": 1, \"skeletonOCC\": \"" << occ << "\","
+         << " \"axpy\": {\"grid\": \"dGrid\", \"timeMs\": " << axpyMs << "},"
+         << " \"laplace\": {\"grid\": \"dGrid\", \"GBs\": " << laplaceGBs << ", \"arithmeticIntensity\": 0.5}}";
+    return json.str();
+}
+
+const ReportCompare::Delta* find(const std::vector<ReportCompare::Delta>& deltas, const std::string& metric)
+{
+    for (const auto& d : deltas) {
+        if (d.metric == metric) {
+            return &d;
+        }
+    }
+    return nullptr;
+}
+}  // namespace reportCompareTest
+
+TEST(reportCompare, direction)
+{
+    ReportCompare::Direction dir;
+    ASSERT_TRUE(ReportCompare::direction("TimeToSolution_ms", dir));
+    ASSERT_EQ(dir, ReportCompare::Direction::lowerIsBetter);
+    ASSERT_TRUE(ReportCompare::direction("p99Ms", dir));
+    ASSERT_EQ(dir, ReportCompare::Direction::lowerIsBetter);
+    ASSERT_TRUE(ReportCompare::direction("GFLOPs", dir));
+    ASSERT_EQ(dir, ReportCompare::Direction::higherIsBetter);
+    ASSERT_TRUE(ReportCompare::direction("fill0.5_b8_MCUPS", dir));
+    ASSERT_EQ(dir, ReportCompare::Direction::higherIsBetter);
+    ASSERT_FALSE(ReportCompare::direction("IterationsTaken", dir));
+    ASSERT_FALSE(ReportCompare::direction("ResidualFinal", dir));
+}
+
+TEST(reportCompare, singleRun)
+{
+    using namespace reportCompareTest;
+    ReportCompare::Options opt;
+    opt.threshold = 0.05;
+    ReportCompare cmp(opt);
+    // The environment (git, date, System) differs but does not prevent the match
+    cmp.parseBaseline(report("aaa", 10.0, 100.0));
+    cmp.parseCandidate(report("bbb", 12.0, 101.0));
+
+    const auto deltas = cmp.compare();
+    ASSERT_EQ(deltas.size(), size_t(2));
+    ASSERT_TRUE(cmp.unmatched().empty());
+
+    const auto* axpy = find(deltas, "timeMs");
+    ASSERT_TRUE(axpy != nullptr);
+    ASSERT_NEAR(axpy->change, 0.2, 1e-12);
+    ASSERT_TRUE(axpy->isRegression);
+    ASSERT_NE(axpy->config.find("section=axpy"), std::string::npos);
+    ASSERT_NE(axpy->config.find("skeletonOCC=standard"), std::string::npos);
+
+    const auto* laplace = find(deltas, "GBs");
+    ASSERT_TRUE(laplace != nullptr);
+    ASSERT_EQ(laplace->direction, ReportCompare::Direction::higherIsBetter);
+    ASSERT_FALSE(laplace->isRegression);
+    ASSERT_FALSE(laplace->isImprovement);
+}
+
+TEST(reportCompare, repetitions)
+{
+    using namespace reportCompareTest;
+    {  // A 3% slowdown hidden in the noise is not significant
+        ReportCompare cmp;
+        for (double ms : {10.0, 11.0, 9.0}) {
+            cmp.parseBaseline(report("aaa", ms, 100));
+        }
+        for (double ms : {10.3, 11.3, 9.3}) {
+            cmp.parseCandidate(report("bbb", ms, 100));
+        }
+        const auto* axpy = find(cmp.compare(), "timeMs");
+        ASSERT_TRUE(axpy != nullptr);
+        ASSERT_EQ(axpy->baseline.n, 3);
+        ASSERT_NEAR(axpy->baseline.stddev, 1.0, 1e-12);
+        ASSERT_FALSE(axpy->isSignificant);
+        ASSERT_FALSE(axpy->isRegression);
+    }
+    {  // A 20% slowdown with little noise is
+        ReportCompare cmp;
+        for (double ms : {10.0, 10.1, 9.9}) {
+            cmp.parseBaseline(report("aaa", ms, 100));
+        }
+        for (double ms : {12.0, 12.1, 11.9}) {
+            cmp.parseCandidate(report("bbb", ms, 100));
+        }
+        const auto* axpy = find(cmp.compare(), "timeMs");
+        ASSERT_TRUE(axpy != nullptr);
+        ASSERT_TRUE(axpy->isSignificant);
+        ASSERT_TRUE(axpy->isRegression);
+    }
+    {  // Repetitions stored as an array and a bandwidth improvement
+        ReportCompare cmp;
+        cmp.parseBaseline("{\"grid\": \"eGrid\", \"GBs\": [10.0, 10.2, 9.8]}");
+        cmp.parseCandidate("{\"grid\": \"eGrid\", \"GBs\": [12.0, 12.2, 11.8]}");
+        const auto deltas = cmp.compare();
+        ASSERT_EQ(deltas.size(), size_t(1));
+        ASSERT_TRUE(deltas[0].isImprovement);
+        ASSERT_FALSE(deltas[0].isRegression);
+    }
+}
+
+TEST(reportCompare, keys)
+{
+    using namespace reportCompareTest;
+    {  // Different configurations are not compared
+        ReportCompare cmp;
+        cmp.parseBaseline(report("aaa", 10.0, 100.0, "standard"));
+        cmp.parseCandidate(report("bbb", 20.0, 100.0, "none"));
+        ASSERT_TRUE(cmp.compare().empty());
+        ASSERT_EQ(cmp.unmatched().size(), size_t(4));
+    }
+    {  // Unless the configuration is restricted to other keys
+        ReportCompare::Options opt;
+        opt.keys = {"grid"};
+        opt.metrics = {"timeMs"};
+        ReportCompare cmp(opt);
+        cmp.parseBaseline(report("aaa", 10.0, 100.0, "standard"));
+        cmp.parseCandidate(report("bbb", 20.0, 100.0, "none"));
+        const auto deltas = cmp.compare();
+        ASSERT_EQ(deltas.size(), size_t(1));
+        ASSERT_TRUE(deltas[0].isRegression);
+        ASSERT_EQ(deltas[0].config, "grid=dGrid, section=axpy");
+    }
+    ReportCompare cmp;
+    ASSERT_ANY_THROW(cmp.parseBaseline("{\"grid\": "));
+    ASSERT_ANY_THROW(cmp.loadBaseline("reportCompareTest_missing.json"));
+}
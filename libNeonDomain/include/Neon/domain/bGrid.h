@@ -2,5 +2,8 @@
 #include "Neon/domain/internal/bGrid/bGrid.h"
 
 namespace Neon::domain {
-using bGrid = Neon::domain::internal::bGrid::bGrid;
-}
\ No newline at end of file
+using bGrid4 = Neon::domain::internal::bGrid::bGrid<4>;
+using bGrid8 = Neon::domain::internal::bGrid::bGrid<8>;
+using bGrid16 = Neon::domain::internal::bGrid::bGrid<16>;
+using bGrid = bGrid8;
+}
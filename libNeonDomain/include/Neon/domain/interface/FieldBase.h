@@ -21,6 +21,7 @@ class FieldBase
    public:
     using Self = FieldBase<T, C>;
     using Type = T;
+    using ComputeType = Neon::ComputeTypeOf<T>;
     virtual ~FieldBase() = default;
 
     FieldBase();
@@ -135,6 +136,17 @@ class FieldBase
                  const std::string& fieldName,
                  bool               isNodeSpace = false) const -> void;
 
+   protected:
+    /**
+     * Runs fun on every cardinality of the active cells, it is the engine of forEachActiveCell.
+     * The default implementation sweeps the bounding box and skips the voxels that are not inside the domain.
+     * Grids that store only their active cells override it to visit them without sweeping the box.
+     */
+    virtual auto helpForEachActiveCell(const std::function<void(const Neon::index_3d&,
+                                                                const int& cardinality,
+                                                                T&)>& fun,
+                                       Neon::computeMode_t::computeMode_e mode)
+        -> void;
 
    private:
     struct Storage
@@ -28,6 +28,7 @@ class FieldBaseTemplate : public FieldBase<T, C>,
     using Storage = S;
     using Grid = G;
     using Type = T;
+    using ComputeType = Neon::ComputeTypeOf<T>;
 
     static constexpr int Cardinality = C;
 
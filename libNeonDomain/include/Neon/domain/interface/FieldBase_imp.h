@@ -99,9 +99,19 @@ auto FieldBase<T, C>::forEachActiveCell(const std::function<void(const Neon::ind
                                                                  const int& cardinality,
                                                                  T&)>& fun)
     -> void
+{
+    helpForEachActiveCell(fun, mode);
+}
+
+template <typename T, int C>
+auto FieldBase<T, C>::helpForEachActiveCell(const std::function<void(const Neon::index_3d&,
+                                                                     const int& cardinality,
+                                                                     T&)>& fun,
+                                            Neon::computeMode_t::computeMode_e mode)
+    -> void
 {
     const auto& dim = getDimension();
-    if constexpr (mode == Neon::computeMode_t::computeMode_e::par) {
+    if (mode == Neon::computeMode_t::computeMode_e::par) {
 #ifdef _MSC_VER
 #pragma omp parallel for
 #else
@@ -7,9 +7,11 @@
 #include "Neon/set/Backend.h"
 #include "Neon/set/DataSet.h"
 #include "Neon/set/DevSet.h"
+#include "Neon/set/Containter.h"
 
 #include "Neon/domain/interface/CellProperties.h"
 #include "Neon/domain/interface/GridBase.h"
+#include "Neon/domain/patterns/PatternReduction.h"
 
 namespace Neon::domain::interface {
 
@@ -25,6 +27,26 @@ class GridBaseTemplate : public GridBase
 
     virtual auto getProperties(const Neon::index_3d& idx) const
         -> CellProperties = 0;
+
+    /**
+     * User defined reduction over the active cells of the grid.
+     * The loading lambda follows the getContainer convention but the returned per-cell lambda
+     * maps a cell to a value of type T. Values are folded with the associative combine operator
+     * (e.g. Neon::reduceOp::Sum/Min/Max) starting from identity.
+     * On the CPU every thread keeps its own partial which are then combined with a tree,
+     * on the GPU each CUDA block combines its values in shared memory.
+     * The result is stored in scalar (a PatternReduction or a PatternScalar), which is loaded
+     * as a REDUCE so that the Skeleton can overlap the container with halo updates.
+     */
+    template <typename T, typename ScalarT, typename LoadingLambda, typename CombineOp>
+    auto reduce(const std::string& name,
+                LoadingLambda      lambda,
+                CombineOp          combine,
+                T                  identity,
+                ScalarT&           scalar) const
+        -> Neon::set::Container;
 };
 
 }  // namespace Neon::domain::interface
+
+#include "Neon/domain/interface/GridBaseTemplate_imp.h"
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Neon/domain/interface/GridBaseTemplate.h"
+
+namespace Neon::domain::interface {
+
+template <typename GridT, typename CellT>
+template <typename T, typename ScalarT, typename LoadingLambda, typename CombineOp>
+auto GridBaseTemplate<GridT, CellT>::reduce(const std::string& name,
+                                            LoadingLambda      lambda,
+                                            CombineOp          combine,
+                                            T                  identity,
+                                            ScalarT&           scalar) const
+    -> Neon::set::Container
+{
+    const GridT& grid = static_cast<const GridT&>(*this);
+
+    // The result is registered as a REDUCE token before the user fields are loaded
+    auto loadingLambda = [lambda, &scalar](Neon::set::Loader& loader) {
+        loader.load(scalar, Neon::Compute::REDUCE);
+        return lambda(loader);
+    };
+
+    // The container combines the INTERNAL and BOUNDARY results into the STANDARD one
+    auto resultSink = [&scalar](Neon::DataView dataView, T result) {
+        scalar(dataView) = result;
+    };
+
+    return Neon::set::Container::factoryReduce(name,
+                                               Neon::set::internal::ContainerAPI::DataViewSupport::on,
+                                               grid,
+                                               loadingLambda,
+                                               grid.getDefaultBlock(),
+                                               [](const Neon::index_3d&) { return 0; },
+                                               identity,
+                                               combine,
+                                               std::function<void(Neon::DataView, T)>(resultSink));
+}
+
+}  // namespace Neon::domain::interface
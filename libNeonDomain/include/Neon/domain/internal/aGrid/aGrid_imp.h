@@ -32,6 +32,12 @@ auto aGrid::newField(const std::string   fieldUserName,
         NeonException exception("Dynamic and static cardinality values do not match.");
         NEON_THROW(exception);
     }
+    if (memoryOptions.getSpatialLayout() != Neon::SpatialLayout::linear) {
+        NeonException exception("aGrid::newField");
+        exception << "Spatial layout " << Neon::SpatialLayoutUtils::toString(memoryOptions.getSpatialLayout())
+                  << " is not supported, only dGrid supports bricked layouts.";
+        NEON_THROW(exception);
+    }
     aField<T, C> field(fieldUserName, *this, cardinality, inactiveValue,
                        haloStatus, dataUse, memoryOptions);
     return field;
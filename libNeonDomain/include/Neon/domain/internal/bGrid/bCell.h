@@ -3,36 +3,56 @@
 #include "Neon/core/core.h"
 
 namespace Neon::domain::internal::bGrid {
+
+template <int BlockSize>
+class bPartitionIndexSpace;
+
+template <int BlockSize>
+class bGrid;
+
+/**
+ * A cell of a bGrid. Blocks are cubes of BlockSize^3 voxels.
+ * Small blocks fit very sparse domains better, large blocks amortize the
+ * neighbour block indirection on dense domains.
+ */
+template <int BlockSize>
 class bCell
 {
    public:
-    friend class bPartitionIndexSpace;
+    static_assert(BlockSize == 4 || BlockSize == 8 || BlockSize == 16,
+                  "bGrid supports blocks of 4^3, 8^3 and 16^3 voxels");
+
+    friend class bPartitionIndexSpace<BlockSize>;
 
-    template <typename T, int C>
+    template <typename T, int C, int B>
     friend class bPartition;
 
-    template <typename T, int C>
+    template <typename T, int C, int B>
     friend class bField;
 
-    friend class bPartitionIndexSpace;
-
-    friend class bGrid;
+    friend class bGrid<BlockSize>;
 
     using Location = int16_3d;
     using BlockSizeT = int8_t;
     using OuterCell = bCell;
 
-    static constexpr BlockSizeT sBlockSizeX = 8;
-    static constexpr BlockSizeT sBlockSizeY = 8;
-    static constexpr BlockSizeT sBlockSizeZ = 8;
+    static constexpr BlockSizeT sBlockSizeX = BlockSize;
+    static constexpr BlockSizeT sBlockSizeY = BlockSize;
+    static constexpr BlockSizeT sBlockSizeZ = BlockSize;
     static constexpr BlockSizeT sBlockSize[3]{sBlockSizeX, sBlockSizeY, sBlockSizeZ};
 
+    //number of voxels in a block
+    static constexpr uint32_t sBlockVolume = uint32_t(BlockSize) * uint32_t(BlockSize) * uint32_t(BlockSize);
+
     //We use uint32_t data type to store the block mask and thus the mask size is 32
     //i.e., each entry in the mask array store the state of 32 voxels
     static constexpr uint32_t sMaskSize = 32;
 
+    //number of mask entries per block i.e., 2 for 4^3, 16 for 8^3 and 128 for 16^3 blocks
+    static constexpr uint32_t sMaskWordsPerBlock = (sBlockVolume + sMaskSize - 1) / sMaskSize;
+
     bCell() = default;
-    virtual ~bCell() = default;
+    ~bCell() = default;
 
     NEON_CUDA_HOST_DEVICE inline auto isActive() const -> bool;
 
@@ -41,6 +61,9 @@ class bCell
     Location mLocation;
     uint32_t mBlockID;
     bool     mIsActive;
+    //host only, the 3x3x3 block neighbourhood of mBlockID cached by the CPU block execution
+    //(see bPartitionIndexSpace::forEachActiveCellInBlock), nullptr when the cell is not visited through a block
+    const uint32_t* mNghBlocks = nullptr;
 
     NEON_CUDA_HOST_DEVICE inline explicit bCell(const Location::Integer& x,
                                                 const Location::Integer& y,
@@ -63,7 +86,7 @@ class bCell
 
     static NEON_CUDA_HOST_DEVICE inline auto getNeighbourBlockID(const int16_3d& blockOffset) -> uint32_t;
 
-    NEON_CUDA_HOST_DEVICE inline auto pitch(int card) const -> Location::Integer;
+    NEON_CUDA_HOST_DEVICE inline auto pitch(int card) const -> int32_t;
 };
 }  // namespace Neon::domain::internal::bGrid
 
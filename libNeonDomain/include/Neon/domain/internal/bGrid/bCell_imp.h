@@ -1,16 +1,20 @@
+#pragma once
+
 #include "Neon/domain/internal/bGrid/bCell.h"
 
 namespace Neon::domain::internal::bGrid {
 
-NEON_CUDA_HOST_DEVICE inline bCell::bCell(const Location& location)
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline bCell<BlockSize>::bCell(const Location& location)
 {
     mLocation = location;
     mIsActive = true;
 }
 
-NEON_CUDA_HOST_DEVICE inline bCell::bCell(const Location::Integer& x,
-                                          const Location::Integer& y,
-                                          const Location::Integer& z)
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline bCell<BlockSize>::bCell(const Location::Integer& x,
+                                                     const Location::Integer& y,
+                                                     const Location::Integer& z)
 {
     mLocation.x = x;
     mLocation.y = y;
@@ -18,50 +22,58 @@ NEON_CUDA_HOST_DEVICE inline bCell::bCell(const Location::Integer& x,
     mIsActive = true;
 }
 
-NEON_CUDA_HOST_DEVICE inline auto bCell::set() -> Location&
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bCell<BlockSize>::set() -> Location&
 {
     return mLocation;
 }
-NEON_CUDA_HOST_DEVICE inline auto bCell::get() const -> const Location&
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bCell<BlockSize>::get() const -> const Location&
 {
     return mLocation;
 }
 
-NEON_CUDA_HOST_DEVICE inline auto bCell::getLocal1DID() const -> Location::Integer
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bCell<BlockSize>::getLocal1DID() const -> Location::Integer
 {
     return mLocation.x +
            mLocation.y * sBlockSizeX +
            mLocation.z * sBlockSizeX * sBlockSizeY;
 }
 
-NEON_CUDA_HOST_DEVICE inline auto bCell::getMaskLocalID() const -> int32_t
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bCell<BlockSize>::getMaskLocalID() const -> int32_t
 {
     return getLocal1DID() / sMaskSize;
 }
 
-NEON_CUDA_HOST_DEVICE inline auto bCell::getMaskBitPosition() const -> int32_t
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bCell<BlockSize>::getMaskBitPosition() const -> int32_t
 {
     return getLocal1DID() % sMaskSize;
 }
 
-NEON_CUDA_HOST_DEVICE inline auto bCell::getBlockMaskStride() const -> int32_t
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bCell<BlockSize>::getBlockMaskStride() const -> int32_t
 {
-    return mBlockID * NEON_DIVIDE_UP(sBlockSizeX * sBlockSizeY * sBlockSizeZ,
-                                     sMaskSize);
+    return mBlockID * sMaskWordsPerBlock;
 }
 
-NEON_CUDA_HOST_DEVICE inline auto bCell::computeIsActive(const uint32_t* activeMask) const -> bool
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bCell<BlockSize>::computeIsActive(const uint32_t* activeMask) const -> bool
 {
     const uint32_t mask = activeMask[getBlockMaskStride() + getMaskLocalID()];
     return (mask & (1 << getMaskBitPosition()));
 }
 
-NEON_CUDA_HOST_DEVICE inline auto bCell::isActive() const -> bool
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bCell<BlockSize>::isActive() const -> bool
 {
     return mIsActive;
 }
 
-NEON_CUDA_HOST_DEVICE inline auto bCell::getNeighbourBlockID(const int16_3d& blockOffset) -> uint32_t
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bCell<BlockSize>::getNeighbourBlockID(const int16_3d& blockOffset) -> uint32_t
 {
     /* We only store the indices of the immediate neighbor blocks of each block. This method takes a 3d offset 
     * from the block assigned to this cell and find 1d index of the neighbor block. This x, y, or z component of
@@ -98,12 +110,13 @@ NEON_CUDA_HOST_DEVICE inline auto bCell::getNeighbourBlockID(const int16_3d& blo
     return id;
 }
 
-NEON_CUDA_HOST_DEVICE inline auto bCell::pitch(int card) const -> Location::Integer
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bCell<BlockSize>::pitch(int card) const -> int32_t
 {
     return
         //stride across cardinalities before card within the block
-        sBlockSizeX * sBlockSizeY * sBlockSizeZ * static_cast<Location::Integer>(card) +
+        int32_t(sBlockVolume) * card +
         //offset to this cell's data
-        mLocation.x + mLocation.y * sBlockSizeX + mLocation.z * sBlockSizeX * sBlockSizeY;
+        int32_t(getLocal1DID());
 }
 }  // namespace Neon::domain::internal::bGrid
\ No newline at end of file
@@ -4,24 +4,26 @@
 #include "Neon/set/patterns/BlasSet.h"
 
 namespace Neon::domain::internal::bGrid {
+template <int BlockSize>
 class bGrid;
 
 
-template <typename T, int C = 0>
+template <typename T, int C, int BlockSize>
 class bField : public Neon::domain::interface::FieldBaseTemplate<T,
                                                                  C,
-                                                                 bGrid,
-                                                                 bPartition<T, C>,
+                                                                 bGrid<BlockSize>,
+                                                                 bPartition<T, C, BlockSize>,
                                                                  int>
 {
-    friend bGrid;
+    friend bGrid<BlockSize>;
 
    public:
     using Type = T;
-    using Grid = bGrid;
+    using ComputeType = Neon::ComputeTypeOf<T>;
+    using Grid = bGrid<BlockSize>;
     using Field = bField;
-    using Partition = bPartition<T, C>;
-    using Cell = bCell;
+    using Partition = bPartition<T, C, BlockSize>;
+    using Cell = bCell<BlockSize>;
     using ngh_idx = typename Partition::nghIdx_t;
 
     bField() = default;
@@ -64,7 +66,7 @@ class bField : public Neon::domain::interface::FieldBaseTemplate<T,
     auto getSharedMemoryBytes(const int32_t stencilRadius) const -> size_t;
 
     auto dot(Neon::set::patterns::BlasSet<T>& blasSet,
-             const bField<T>&                 input,
+             const bField<T, 0, BlockSize>&   input,
              Neon::set::MemDevSet<T>&         output,
              const Neon::DataView&            dataView) -> void;
 
@@ -75,7 +77,7 @@ class bField : public Neon::domain::interface::FieldBaseTemplate<T,
 
    private:
     bField(const std::string&             name,
-           const bGrid&                   grid,
+           const Grid&                    grid,
            int                            cardinality,
            T                              outsideVal,
            Neon::DataUse                  dataUse,
@@ -92,7 +94,7 @@ class bField : public Neon::domain::interface::FieldBaseTemplate<T,
 
     struct Data
     {
-        std::shared_ptr<bGrid> mGrid;
+        std::shared_ptr<Grid>  mGrid;
         Neon::set::MemSet_t<T> mMem;
         int                    mCardinality;
 
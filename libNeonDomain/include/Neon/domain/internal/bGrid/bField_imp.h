@@ -4,14 +4,14 @@
 
 namespace Neon::domain::internal::bGrid {
 
-template <typename T, int C>
-bField<T, C>::bField(const std::string&             name,
-                     const bGrid&                   grid,
-                     int                            cardinality,
-                     T                              outsideVal,
-                     Neon::DataUse                  dataUse,
-                     const Neon::MemoryOptions&     memoryOptions,
-                     Neon::domain::haloStatus_et::e haloStatus)
+template <typename T, int C, int BlockSize>
+bField<T, C, BlockSize>::bField(const std::string&             name,
+                                const Grid&                    grid,
+                                int                            cardinality,
+                                T                              outsideVal,
+                                Neon::DataUse                  dataUse,
+                                const Neon::MemoryOptions&     memoryOptions,
+                                Neon::domain::haloStatus_et::e haloStatus)
     : Neon::domain::interface::FieldBaseTemplate<T, C, Grid, Partition, int>(&grid,
                                                                              name,
                                                                              "bField",
@@ -23,14 +23,14 @@ bField<T, C>::bField(const std::string&             name,
 {
     mData = std::make_shared<Data>();
 
-    mData->mGrid = std::make_shared<bGrid>(grid);
+    mData->mGrid = std::make_shared<Grid>(grid);
     mData->mCardinality = cardinality;
 
     //the allocation size is the number of blocks x block size x cardinality
     Neon::set::DataSet<uint64_t> allocSize = mData->mGrid->getBackend().devSet().template newDataSet<uint64_t>();
 
     for (int64_t i = 0; i < allocSize.size(); ++i) {
-        allocSize[i] = mData->mGrid->getNumBlocksPerPartition()[i] * Cell::sBlockSizeX * Cell::sBlockSizeY * Cell::sBlockSizeZ * cardinality;
+        allocSize[i] = mData->mGrid->getNumBlocksPerPartition()[i] * Cell::sBlockVolume * cardinality;
     }
 
     Neon::MemoryOptions memOptions(Neon::DeviceType::CPU,
@@ -54,7 +54,7 @@ bField<T, C>::bField(const std::string&             name,
 
         for (int32_t gpuID = 0; gpuID < int32_t(mData->mPartitions[PartitionBackend::cpu][dvID].size()); gpuID++) {
 
-            getPartition(Neon::DeviceType::CPU, Neon::SetIdx(gpuID), Neon::DataView(dvID)) = bPartition<T, C>(
+            getPartition(Neon::DeviceType::CPU, Neon::SetIdx(gpuID), Neon::DataView(dvID)) = Partition(
                 Neon::DataView(dvID),
                 mData->mMem.rawMem(gpuID, Neon::DeviceType::CPU),
                 mData->mGrid->getDimension(),
@@ -65,7 +65,7 @@ bField<T, C>::bField(const std::string&             name,
                 outsideVal,
                 stencil_ngh.rawMem(gpuID, Neon::DeviceType::CPU));
 
-            getPartition(Neon::DeviceType::CUDA, Neon::SetIdx(gpuID), Neon::DataView(dvID)) = bPartition<T, C>(
+            getPartition(Neon::DeviceType::CUDA, Neon::SetIdx(gpuID), Neon::DataView(dvID)) = Partition(
                 Neon::DataView(dvID),
                 mData->mMem.rawMem(gpuID, Neon::DeviceType::CUDA),
                 mData->mGrid->getDimension(),
@@ -80,10 +80,10 @@ bField<T, C>::bField(const std::string&             name,
 }
 
 
-template <typename T, int C>
-auto bField<T, C>::getPartition(const Neon::DeviceType& devType,
-                                const Neon::SetIdx&     idx,
-                                const Neon::DataView&   dataView) const -> const Partition&
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::getPartition(const Neon::DeviceType& devType,
+                                           const Neon::SetIdx&     idx,
+                                           const Neon::DataView&   dataView) const -> const Partition&
 {
     if (devType == Neon::DeviceType::CUDA) {
         return mData->mPartitions[PartitionBackend::gpu][Neon::DataViewUtil::toInt(dataView)][idx];
@@ -92,10 +92,10 @@ auto bField<T, C>::getPartition(const Neon::DeviceType& devType,
     }
 }
 
-template <typename T, int C>
-auto bField<T, C>::getPartition(const Neon::DeviceType& devType,
-                                const Neon::SetIdx&     idx,
-                                const Neon::DataView&   dataView) -> Partition&
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::getPartition(const Neon::DeviceType& devType,
+                                           const Neon::SetIdx&     idx,
+                                           const Neon::DataView&   dataView) -> Partition&
 {
     if (devType == Neon::DeviceType::CUDA) {
         return mData->mPartitions[PartitionBackend::gpu][Neon::DataViewUtil::toInt(dataView)][idx];
@@ -104,15 +104,15 @@ auto bField<T, C>::getPartition(const Neon::DeviceType& devType,
     }
 }
 
-template <typename T, int C>
-auto bField<T, C>::isInsideDomain(const Neon::index_3d& idx) const -> bool
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::isInsideDomain(const Neon::index_3d& idx) const -> bool
 {
     return mData->mGrid->isInsideDomain(idx);
 }
 
-template <typename T, int C>
-auto bField<T, C>::getRef(const Neon::index_3d& idx,
-                          const int&            cardinality) const -> T&
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::getRef(const Neon::index_3d& idx,
+                                     const int&            cardinality) const -> T&
 {
     //TODO need to figure out which device owns this block
     SetIdx devID(0);
@@ -125,75 +125,75 @@ auto bField<T, C>::getRef(const Neon::index_3d& idx,
     if (!itr) {
         return this->getOutsideValue();
     }
-    Cell cell(static_cast<Cell::Location::Integer>(idx.x % Cell::sBlockSizeX),
-              static_cast<Cell::Location::Integer>(idx.y % Cell::sBlockSizeY),
-              static_cast<Cell::Location::Integer>(idx.z % Cell::sBlockSizeZ));
+    Cell cell(static_cast<typename Cell::Location::Integer>(idx.x % Cell::sBlockSizeX),
+              static_cast<typename Cell::Location::Integer>(idx.y % Cell::sBlockSizeY),
+              static_cast<typename Cell::Location::Integer>(idx.z % Cell::sBlockSizeZ));
     cell.mBlockID = *itr;
     return partition(cell, cardinality);
 }
 
-template <typename T, int C>
-auto bField<T, C>::operator()(const Neon::index_3d& idx,
-                              const int&            cardinality) const -> T
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::operator()(const Neon::index_3d& idx,
+                                         const int&            cardinality) const -> T
 {
     return getRef(idx, cardinality);
 }
 
-template <typename T, int C>
-auto bField<T, C>::getReference(const Neon::index_3d& idx,
-                                const int&            cardinality) -> T&
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::getReference(const Neon::index_3d& idx,
+                                           const int&            cardinality) -> T&
 {
     return getRef(idx, cardinality);
 }
 
-template <typename T, int C>
-auto bField<T, C>::haloUpdate(Neon::set::HuOptions& /*opt*/) const -> void
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::haloUpdate(Neon::set::HuOptions& /*opt*/) const -> void
 {
     //TODO
     NEON_DEV_UNDER_CONSTRUCTION("bField::haloUpdate");
 }
 
-template <typename T, int C>
-auto bField<T, C>::haloUpdate(Neon::set::HuOptions& /*opt*/) -> void
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::haloUpdate(Neon::set::HuOptions& /*opt*/) -> void
 {
     //TODO
     NEON_DEV_UNDER_CONSTRUCTION("bField::haloUpdate");
 }
 
-template <typename T, int C>
-auto bField<T, C>::updateIO(int streamId) -> void
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::updateIO(int streamId) -> void
 {
     if (mData->mGrid->getBackend().devType() == Neon::DeviceType::CUDA) {
         mData->mMem.updateIO(mData->mGrid->getBackend(), streamId);
     }
 }
 
-template <typename T, int C>
-auto bField<T, C>::updateCompute(int streamId) -> void
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::updateCompute(int streamId) -> void
 {
     if (mData->mGrid->getBackend().devType() == Neon::DeviceType::CUDA) {
         mData->mMem.updateCompute(mData->mGrid->getBackend(), streamId);
     }
 }
 
-template <typename T, int C>
-auto bField<T, C>::getPartition([[maybe_unused]] Neon::Execution,
-                                [[maybe_unused]] Neon::SetIdx,
-                                [[maybe_unused]] const Neon::DataView& dataView) const -> const Partition&
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::getPartition([[maybe_unused]] Neon::Execution,
+                                           [[maybe_unused]] Neon::SetIdx,
+                                           [[maybe_unused]] const Neon::DataView& dataView) const -> const Partition&
 {
     NEON_DEV_UNDER_CONSTRUCTION("bField::getPartition");
 }
 
-template <typename T, int C>
-auto bField<T, C>::getPartition([[maybe_unused]] Neon::Execution,
-                                [[maybe_unused]] Neon::SetIdx          idx,
-                                [[maybe_unused]] const Neon::DataView& dataView) -> Partition&
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::getPartition([[maybe_unused]] Neon::Execution,
+                                           [[maybe_unused]] Neon::SetIdx          idx,
+                                           [[maybe_unused]] const Neon::DataView& dataView) -> Partition&
 {
     NEON_DEV_UNDER_CONSTRUCTION("bField::getPartition");
 }
 
-template <typename T, int C>
-auto bField<T, C>::getSharedMemoryBytes(const int32_t stencilRadius) const -> size_t
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::getSharedMemoryBytes(const int32_t stencilRadius) const -> size_t
 {
     //This return the optimal shared memory size give a stencil radius
     //i.e., only N layers is read from neighbor blocks into shared memory in addition
@@ -9,29 +9,40 @@
 #include "Neon/domain/internal/bGrid/bPartition.h"
 #include "Neon/domain/internal/bGrid/bPartitionIndexSpace.h"
 #include "Neon/domain/patterns/PatternScalar.h"
+#include "Neon/domain/patterns/PatternScalarVector.h"
 #include "Neon/domain/tools/PointHashTable.h"
 #include "Neon/set/Containter.h"
 
 namespace Neon::domain::internal::bGrid {
 
-template <typename T, int C>
+template <typename T, int C, int BlockSize>
 class bField;
 
-class bGrid : public Neon::domain::interface::GridBaseTemplate<bGrid, bCell>
+/**
+ * Block sparse grid. The domain is tiled with cubic blocks of BlockSize^3 voxels
+ * and only blocks that contain at least one active voxel are allocated.
+ * BlockSize can be 4, 8 or 16. Small blocks waste less memory on very sparse domains
+ * while large blocks reduce the cost of the neighbour block indirection on dense ones.
+ * On CUDA a block is mapped to a thread block, thus 16^3 blocks (4096 threads) are CPU only.
+ */
+template <int BlockSize>
+class bGrid : public Neon::domain::interface::GridBaseTemplate<bGrid<BlockSize>, bCell<BlockSize>>
 {
    public:
     using Grid = bGrid;
-    using Cell = bCell;
+    using Cell = bCell<BlockSize>;
 
     template <typename T, int C = 0>
-    using Partition = bPartition<T, C>;
+    using Partition = bPartition<T, C, BlockSize>;
 
     template <typename T, int C = 0>
-    using Field = Neon::domain::internal::bGrid::bField<T, C>;
+    using Field = Neon::domain::internal::bGrid::bField<T, C, BlockSize>;
 
     using nghIdx_t = typename Partition<int>::nghIdx_t;
 
-    using PartitionIndexSpace = Neon::domain::internal::bGrid::bPartitionIndexSpace;
+    using PartitionIndexSpace = Neon::domain::internal::bGrid::bPartitionIndexSpace<BlockSize>;
+
+    static constexpr int sBlockSize = BlockSize;
 
     bGrid() = default;
     virtual ~bGrid() = default;
@@ -45,7 +56,7 @@ class bGrid : public Neon::domain::interface::GridBaseTemplate<bGrid, bCell>
           const double_3d&             origin = double_3d(0, 0, 0));
 
     auto getProperties(const Neon::index_3d& idx) const
-        -> GridBaseTemplate::CellProperties final;
+        -> typename Neon::domain::interface::GridBaseTemplate<bGrid<BlockSize>, bCell<BlockSize>>::CellProperties final;
 
     auto isInsideDomain(const Neon::index_3d& idx) const
         -> bool final;
@@ -84,6 +95,7 @@ class bGrid : public Neon::domain::interface::GridBaseTemplate<bGrid, bCell>
     auto getBlockOriginTo1D() const -> const Neon::domain::tool::PointHashTable<int32_t, uint32_t>&;
 
     //for compatibility with other grids that can work on cub and cublas engine
+    //only CUB is accepted, the deterministic engine is specific to dGrid
     auto setReduceEngine(Neon::sys::patterns::Engine eng) -> void;
 
     template <typename T>
@@ -100,6 +112,18 @@ class bGrid : public Neon::domain::interface::GridBaseTemplate<bGrid, bCell>
                Field<T>&                        input,
                Neon::template PatternScalar<T>& scalar) const -> Neon::set::Container;
 
+    template <typename T>
+    auto newPatternScalarVector(int nScalars) const -> Neon::template PatternScalarVector<T>;
+
+    /**
+     * Dot product of each pair of fields computed in a single sweep over the active blocks.
+     * CPU only: each thread accumulates all products over the blocks it owns.
+     */
+    template <typename T>
+    auto multiDot(const std::string&                               name,
+                  const std::vector<std::pair<Field<T>, Field<T>>>& inputs,
+                  Neon::template PatternScalarVector<T>&           scalars) const -> Neon::set::Container;
+
 
     auto getKernelConfig(int            streamIdx,
                          Neon::DataView dataView) -> Neon::set::KernelConfig;
@@ -1,14 +1,18 @@
+#pragma once
+
+#include "Neon/domain/interface/KernelConfig.h"
 #include "Neon/domain/internal/bGrid/bGrid.h"
 
 namespace Neon::domain::internal::bGrid {
 
+template <int BlockSize>
 template <typename ActiveCellLambda>
-bGrid::bGrid(const Neon::Backend&                          backend,
-             const Neon::int32_3d&                         domainSize,
-             const ActiveCellLambda                        activeCellLambda,
-             [[maybe_unused]] const Neon::domain::Stencil& stencil,
-             const double_3d&                              spacingData,
-             const double_3d&                              origin)
+bGrid<BlockSize>::bGrid(const Neon::Backend&                          backend,
+                        const Neon::int32_3d&                         domainSize,
+                        const ActiveCellLambda                        activeCellLambda,
+                        [[maybe_unused]] const Neon::domain::Stencil& stencil,
+                        const double_3d&                              spacingData,
+                        const double_3d&                              origin)
 {
     if (backend.devSet().setCardinality() > 1) {
         NeonException exp("bGrid");
@@ -16,6 +20,14 @@ bGrid::bGrid(const Neon::Backend&                          backend,
         NEON_THROW(exp);
     }
 
+    // Each block is processed by one CUDA thread block
+    if (backend.devType() == Neon::DeviceType::CUDA && Cell::sBlockVolume > 1024) {
+        NeonException exp("bGrid");
+        exp << "bGrid with blocks of " << BlockSize << "^3 voxels exceeds the maximum number of threads in a CUDA block. "
+            << "Use a smaller block size or the CPU backend";
+        NEON_THROW(exp);
+    }
+
     mData = std::make_shared<Data>();
 
     Neon::int32_3d numBlockInDomain(NEON_DIVIDE_UP(domainSize.x, Cell::sBlockSizeX),
@@ -54,7 +66,9 @@ bGrid::bGrid(const Neon::Backend&                          backend,
                                                     blockOrigin.y + y,
                                                     blockOrigin.z + z);
 
-                            if (activeCellLambda(id)) {
+                            if (id.x < domainSize.x &&
+                                id.y < domainSize.y &&
+                                id.z < domainSize.z && activeCellLambda(id)) {
                                 isActiveBlock = true;
                                 numActiveVoxels[0]++;
                             }
@@ -106,9 +120,9 @@ bGrid::bGrid(const Neon::Backend&                          backend,
     for (int32_t c = 0; c < mData->mStencilNghIndex.cardinality(); ++c) {
         SetIdx devID(c);
         for (uint64_t s = 0; s < stencil.neighbours().size(); ++s) {
-            mData->mStencilNghIndex.eRef(c, s).x = static_cast<nghIdx_t::Integer>(stencil.neighbours()[s].x);
-            mData->mStencilNghIndex.eRef(c, s).y = static_cast<nghIdx_t::Integer>(stencil.neighbours()[s].y);
-            mData->mStencilNghIndex.eRef(c, s).z = static_cast<nghIdx_t::Integer>(stencil.neighbours()[s].z);
+            mData->mStencilNghIndex.eRef(c, s).x = static_cast<typename nghIdx_t::Integer>(stencil.neighbours()[s].x);
+            mData->mStencilNghIndex.eRef(c, s).y = static_cast<typename nghIdx_t::Integer>(stencil.neighbours()[s].y);
+            mData->mStencilNghIndex.eRef(c, s).z = static_cast<typename nghIdx_t::Integer>(stencil.neighbours()[s].z);
         }
     }
 
@@ -116,8 +130,7 @@ bGrid::bGrid(const Neon::Backend&                          backend,
     // bitmask
     mData->mActiveMaskSize = backend.devSet().template newDataSet<uint64_t>();
     for (int64_t i = 0; i < mData->mActiveMaskSize.size(); ++i) {
-        mData->mActiveMaskSize[i] = mData->mNumBlocks[i] * NEON_DIVIDE_UP(Cell::sBlockSizeX * Cell::sBlockSizeY * Cell::sBlockSizeZ,
-                                                                          Cell::sMaskSize);
+        mData->mActiveMaskSize[i] = mData->mNumBlocks[i] * Cell::sMaskWordsPerBlock;
     }
     mData->mActiveMask = backend.devSet().template newMemSet<uint32_t>({Neon::DataUse::IO_COMPUTE},
                                                                        1,
@@ -171,9 +184,9 @@ bGrid::bGrid(const Neon::Backend&                          backend,
                         id.y < domainSize.y &&
                         id.z < domainSize.z && activeCellLambda(id)) {
 
-                        Cell cell(static_cast<Cell::Location::Integer>(x),
-                                  static_cast<Cell::Location::Integer>(y),
-                                  static_cast<Cell::Location::Integer>(z));
+                        Cell cell(static_cast<typename Cell::Location::Integer>(x),
+                                  static_cast<typename Cell::Location::Integer>(y),
+                                  static_cast<typename Cell::Location::Integer>(z));
                         cell.mBlockID = blockIdx;
 
                         mData->mActiveMask.eRef(devID, cell.getBlockMaskStride() + cell.getMaskLocalID(), 0) |= 1 << cell.getMaskBitPosition();
@@ -240,30 +253,42 @@ bGrid::bGrid(const Neon::Backend&                          backend,
             mData->mPartitionIndexSpace[dv_id][gpuIdx].mDeviceActiveMask = mData->mActiveMask.rawMem(gpuIdx, Neon::DeviceType::CUDA);
             mData->mPartitionIndexSpace[dv_id][gpuIdx].mHostBlockOrigin = mData->mOrigin.rawMem(gpuIdx, Neon::DeviceType::CPU);
             mData->mPartitionIndexSpace[dv_id][gpuIdx].mDeviceBlockOrigin = mData->mOrigin.rawMem(gpuIdx, Neon::DeviceType::CUDA);
+            mData->mPartitionIndexSpace[dv_id][gpuIdx].mHostNeighbourBlocks = mData->mNeighbourBlocks.rawMem(gpuIdx, Neon::DeviceType::CPU);
         }
     }
 }
 
 
+template <int BlockSize>
 template <typename T, int C>
-auto bGrid::newField(const std::string          name,
-                     int                        cardinality,
-                     T                          inactiveValue,
-                     Neon::DataUse              dataUse,
-                     const Neon::MemoryOptions& memoryOptions) const -> Field<T, C>
+auto bGrid<BlockSize>::newField(const std::string          name,
+                                int                        cardinality,
+                                T                          inactiveValue,
+                                Neon::DataUse              dataUse,
+                                const Neon::MemoryOptions& memoryOptions) const -> Field<T, C>
 {
-    bField<T, C> field(name, *this, cardinality, inactiveValue, dataUse, memoryOptions, Neon::domain::haloStatus_et::ON);
+    // The default options are not initialized, they are only completed by the device set
+    const Neon::MemoryOptions sanitizedOptions = this->getDevSet().sanitizeMemoryOption(memoryOptions);
+    if (sanitizedOptions.getSpatialLayout() != Neon::SpatialLayout::linear) {
+        NeonException exception("bGrid::newField");
+        exception << "Spatial layout " << Neon::SpatialLayoutUtils::toString(sanitizedOptions.getSpatialLayout())
+                  << " is not supported, only dGrid supports bricked layouts.";
+        NEON_THROW(exception);
+    }
+
+    Field<T, C> field(name, *this, cardinality, inactiveValue, dataUse, memoryOptions, Neon::domain::haloStatus_et::ON);
 
     return field;
 }
 
+template <int BlockSize>
 template <typename LoadingLambda>
-auto bGrid::getContainer(const std::string& name,
-                         index_3d           blockSize,
-                         size_t             sharedMem,
-                         LoadingLambda      lambda) const -> Neon::set::Container
+auto bGrid<BlockSize>::getContainer(const std::string& name,
+                                    index_3d           blockSize,
+                                    size_t             sharedMem,
+                                    LoadingLambda      lambda) const -> Neon::set::Container
 {
-    const Neon::index_3d& defaultBlockSize = getDefaultBlock();
+    const Neon::index_3d& defaultBlockSize = this->getDefaultBlock();
     Neon::set::Container  kContainer = Neon::set::Container::factory(name,
                                                                     Neon::set::internal::ContainerAPI::DataViewSupport::on,
                                                                     *this,
@@ -273,11 +298,12 @@ auto bGrid::getContainer(const std::string& name,
     return kContainer;
 }
 
+template <int BlockSize>
 template <typename LoadingLambda>
-auto bGrid::getContainer(const std::string& name,
-                         LoadingLambda      lambda) const -> Neon::set::Container
+auto bGrid<BlockSize>::getContainer(const std::string& name,
+                                    LoadingLambda      lambda) const -> Neon::set::Container
 {
-    const Neon::index_3d& defaultBlockSize = getDefaultBlock();
+    const Neon::index_3d& defaultBlockSize = this->getDefaultBlock();
     Neon::set::Container  kContainer = Neon::set::Container::factory(name,
                                                                     Neon::set::internal::ContainerAPI::DataViewSupport::on,
                                                                     *this,
@@ -288,11 +314,12 @@ auto bGrid::getContainer(const std::string& name,
 }
 
 
+template <int BlockSize>
 template <typename T>
-auto bGrid::newPatternScalar() const -> Neon::template PatternScalar<T>
+auto bGrid<BlockSize>::newPatternScalar() const -> Neon::template PatternScalar<T>
 {
     // TODO this sets the numBlocks for only Standard dataView.
-    auto pattern = Neon::PatternScalar<T>(getBackend(), Neon::sys::patterns::Engine::CUB);
+    auto pattern = Neon::PatternScalar<T>(this->getBackend(), Neon::sys::patterns::Engine::CUB);
     for (SetIdx id = 0; id < mData->mNumBlocks.cardinality(); id++) {
         pattern.getBlasSet(Neon::DataView::STANDARD).getBlas(id.idx()).setNumBlocks(uint32_t(mData->mNumBlocks[id]));
     }
@@ -300,11 +327,12 @@ auto bGrid::newPatternScalar() const -> Neon::template PatternScalar<T>
 }
 
 
+template <int BlockSize>
 template <typename T>
-auto bGrid::dot(const std::string&               name,
-                Field<T>&                        input1,
-                Field<T>&                        input2,
-                Neon::template PatternScalar<T>& scalar) const -> Neon::set::Container
+auto bGrid<BlockSize>::dot(const std::string&               name,
+                           Field<T>&                        input1,
+                           Field<T>&                        input2,
+                           Neon::template PatternScalar<T>& scalar) const -> Neon::set::Container
 {
     return Neon::set::Container::factoryOldManaged(
         name,
@@ -323,13 +351,13 @@ auto bGrid::dot(const std::string&               name,
                     NEON_THROW(exc);
                 }
 
-                if (dataView != Neon::DataView::STANDARD && getBackend().devSet().setCardinality() == 1) {
+                if (dataView != Neon::DataView::STANDARD && this->getBackend().devSet().setCardinality() == 1) {
                     NeonException exc("bGrid");
                     exc << "Reduction operation can only run on standard data view when the number of partitions/GPUs is 1";
                     NEON_THROW(exc);
                 }
 
-                if (getBackend().devType() == Neon::DeviceType::CUDA) {
+                if (this->getBackend().devType() == Neon::DeviceType::CUDA) {
                     scalar.setStream(streamIdx, dataView);
 
                     // calc dot product and store results on device
@@ -364,10 +392,11 @@ auto bGrid::dot(const std::string&               name,
         });
 }
 
+template <int BlockSize>
 template <typename T>
-auto bGrid::norm2(const std::string&               name,
-                  Field<T>&                        input,
-                  Neon::template PatternScalar<T>& scalar) const -> Neon::set::Container
+auto bGrid<BlockSize>::norm2(const std::string&               name,
+                             Field<T>&                        input,
+                             Neon::template PatternScalar<T>& scalar) const -> Neon::set::Container
 {
     return Neon::set::Container::factoryOldManaged(
         name,
@@ -384,13 +413,13 @@ auto bGrid::norm2(const std::string&               name,
                     NEON_THROW(exc);
                 }
 
-                if (dataView != Neon::DataView::STANDARD && getBackend().devSet().setCardinality() == 1) {
+                if (dataView != Neon::DataView::STANDARD && this->getBackend().devSet().setCardinality() == 1) {
                     NeonException exc("bGrid");
                     exc << "Reduction operation can only run on standard data view when the number of partitions/GPUs is 1";
                     NEON_THROW(exc);
                 }
 
-                if (getBackend().devType() == Neon::DeviceType::CUDA) {
+                if (this->getBackend().devType() == Neon::DeviceType::CUDA) {
                     scalar.setStream(streamIdx, dataView);
 
                     // calc dot product and store results on device
@@ -424,4 +453,260 @@ auto bGrid::norm2(const std::string&               name,
             };
         });
 }
-}  // namespace Neon::domain::internal::bGrid
\ No newline at end of file
+
+template <int BlockSize>
+template <typename T>
+auto bGrid<BlockSize>::newPatternScalarVector(int nScalars) const -> Neon::template PatternScalarVector<T>
+{
+    return Neon::PatternScalarVector<T>(this->getBackend(), nScalars);
+}
+
+template <int BlockSize>
+template <typename T>
+auto bGrid<BlockSize>::multiDot(const std::string&                               name,
+                                const std::vector<std::pair<Field<T>, Field<T>>>& inputs,
+                                Neon::template PatternScalarVector<T>&           scalars) const -> Neon::set::Container
+{
+    if (inputs.empty() || int(inputs.size()) != scalars.size()) {
+        NeonException exc("bGrid");
+        exc << "multiDot expects one result per pair of fields: "
+            << inputs.size() << " pairs versus " << scalars.size() << " results";
+        NEON_THROW(exc);
+    }
+
+    return Neon::set::Container::factoryOldManaged(
+        name,
+        Neon::set::internal::ContainerAPI::DataViewSupport::on,
+        *this, [this, inputs, &scalars](Neon::set::Loader& loader) {
+            // each field is loaded once even if it shows up in several pairs
+            std::vector<Neon::set::MultiDeviceObjectUid> loaded;
+            auto                                         loadOnce = [&](const Field<T>& field) {
+                if (std::find(loaded.begin(), loaded.end(), field.getUid()) == loaded.end()) {
+                    loaded.push_back(field.getUid());
+                    loader.load(field);
+                }
+            };
+            for (const auto& [a, b] : inputs) {
+                loadOnce(a);
+                loadOnce(b);
+            }
+            loader.load(scalars, Neon::Compute::REDUCE);
+
+            return [this, inputs, &scalars](int, Neon::DataView dataView) mutable -> void {
+                if (dataView != Neon::DataView::STANDARD) {
+                    NeonException exc("bGrid");
+                    exc << "Reduction operation on bGrid works only on standard dataview";
+                    exc << "Input dataview is" << Neon::DataViewUtil::toString(dataView);
+                    NEON_THROW(exc);
+                }
+
+                if (this->getBackend().devType() == Neon::DeviceType::CUDA) {
+                    NeonException exc("bGrid");
+                    exc << "multiDot on bGrid is only supported on the CPU";
+                    NEON_THROW(exc);
+                }
+
+                const int      nProducts = scalars.size();
+                std::vector<T> results(nProducts, T(0));
+
+                this->getBackend().devSet().forEachSetIdxSeq([&](const Neon::SetIdx& setIdx) {
+                    using Partition = typename Field<T>::Partition;
+
+                    std::vector<const Partition*> a(nProducts);
+                    std::vector<const Partition*> b(nProducts);
+                    for (int k = 0; k < nProducts; ++k) {
+                        a[k] = &inputs[k].first.getPartition(Neon::DeviceType::CPU, setIdx, dataView);
+                        b[k] = &inputs[k].second.getPartition(Neon::DeviceType::CPU, setIdx, dataView);
+                    }
+                    const int   card = a[0]->cardinality();
+                    const auto& pis = mData->mPartitionIndexSpace.at(Neon::DataViewUtil::toInt(dataView))
+                                          .local(Neon::DeviceType::CPU, setIdx, dataView);
+
+                    // Each thread accumulates all the products over the blocks it owns,
+                    // the partial sums are then combined once per thread
+#pragma omp parallel default(shared)
+                    {
+                        std::vector<T> partial(nProducts, T(0));
+                        auto           accumulate = [&](const Cell& cell) {
+                            for (int k = 0; k < nProducts; ++k) {
+                                for (int c = 0; c < card; ++c) {
+                                    partial[k] += (*a[k])(cell, c) * (*b[k])(cell, c);
+                                }
+                            }
+                        };
+#pragma omp for schedule(static)
+                        for (int64_t blockIdx = 0; blockIdx < int64_t(pis.numBlocks()); ++blockIdx) {
+                            pis.template forEachActiveCellInBlock<false>(uint32_t(blockIdx), accumulate);
+                        }
+#pragma omp critical
+                        for (int k = 0; k < nProducts; ++k) {
+                            results[k] += partial[k];
+                        }
+                    }
+                });
+                scalars(dataView) = results;
+            };
+        });
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getProperties(const Neon::index_3d& idx) const
+    -> typename Neon::domain::interface::GridBaseTemplate<bGrid<BlockSize>, bCell<BlockSize>>::CellProperties
+{
+    typename bGrid::CellProperties cellProperties;
+    cellProperties.setIsInside(isInsideDomain(idx));
+    if (!cellProperties.isInside()) {
+        return cellProperties;
+    }
+
+    if (this->getDevSet().setCardinality() == 1) {
+        cellProperties.init(0, DataView::INTERNAL);
+    } else {
+        //TODO
+        NEON_DEV_UNDER_CONSTRUCTION("bGrid only support single GPU");
+    }
+    return cellProperties;
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::isInsideDomain(const Neon::index_3d& idx) const -> bool
+{
+    if (this->getDevSet().setCardinality() != 1) {
+        NEON_DEV_UNDER_CONSTRUCTION("bGrid only support single GPU");
+    }
+
+    //TODO need to figure out which device owns this block
+    SetIdx devID(0);
+
+    //Negative coordinates would round to the origin of an active block
+    if (!(idx >= Neon::index_3d(0, 0, 0) && idx < this->getDimension())) {
+        return false;
+    }
+
+    Neon::int32_3d block_origin = getOriginBlock3DIndex(idx);
+
+    auto itr = mData->mBlockOriginTo1D.getMetadata(block_origin);
+    if (itr) {
+        Cell cell(static_cast<typename Cell::Location::Integer>(idx.x % Cell::sBlockSizeX),
+                  static_cast<typename Cell::Location::Integer>(idx.y % Cell::sBlockSizeY),
+                  static_cast<typename Cell::Location::Integer>(idx.z % Cell::sBlockSizeZ));
+        cell.mBlockID = *itr;
+        cell.mIsActive = cell.computeIsActive(mData->mActiveMask.rawMem(devID, Neon::DeviceType::CPU));
+        return cell.mIsActive;
+    }
+    return false;
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getOriginBlock3DIndex(const Neon::int32_3d idx) const -> Neon::int32_3d
+{
+    //round n to nearest multiple of m
+    auto roundDownToNearestMultiple = [](int32_t n, int32_t m) -> int32_t {
+        return (n / m) * m;
+    };
+
+    Neon::int32_3d block_origin(roundDownToNearestMultiple(idx.x, Cell::sBlockSizeX),
+                                roundDownToNearestMultiple(idx.y, Cell::sBlockSizeY),
+                                roundDownToNearestMultiple(idx.z, Cell::sBlockSizeZ));
+    return block_origin;
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::setReduceEngine(Neon::sys::patterns::Engine eng) -> void
+{
+    if (eng != Neon::sys::patterns::Engine::CUB) {
+        NeonException exp("bGrid::setReduceEngine");
+        exp << "bGrid only work on CUB engine for reduction";
+        NEON_THROW(exp);
+    }
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getLaunchParameters(Neon::DataView                         dataView,
+                                           [[maybe_unused]] const Neon::index_3d& blockSize,
+                                           const size_t&                          sharedMem) const -> Neon::set::LaunchParameters
+{
+    //TODO
+    if (dataView != Neon::DataView::STANDARD) {
+        NEON_WARNING("Requesting LaunchParameters on {} data view but bGrid only supports Standard data view on a single GPU",
+                     Neon::DataViewUtil::toString(dataView));
+    }
+    const Neon::int32_3d        cuda_block(Cell::sBlockSizeX, Cell::sBlockSizeY, Cell::sBlockSizeZ);
+    Neon::set::LaunchParameters ret = this->getBackend().devSet().newLaunchParameters();
+    for (int i = 0; i < ret.cardinality(); ++i) {
+        if (this->getBackend().devType() == Neon::DeviceType::CUDA) {
+            ret[i].set(Neon::sys::GpuLaunchInfo::mode_e::cudaGridMode,
+                       Neon::int32_3d(int32_t(mData->mNumBlocks[i]), 1, 1),
+                       cuda_block, sharedMem);
+        } else {
+            ret[i].set(Neon::sys::GpuLaunchInfo::mode_e::domainGridMode,
+                       Neon::int32_3d(int32_t(mData->mNumBlocks[i] * Cell::sBlockVolume), 1, 1),
+                       cuda_block, sharedMem);
+        }
+    }
+    return ret;
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getPartitionIndexSpace(Neon::DeviceType dev,
+                                              SetIdx           setIdx,
+                                              Neon::DataView   dataView) -> const PartitionIndexSpace&
+{
+    return mData->mPartitionIndexSpace.at(Neon::DataViewUtil::toInt(dataView)).local(dev, setIdx, dataView);
+}
+
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getNumBlocksPerPartition() const -> const Neon::set::DataSet<uint64_t>&
+{
+    return mData->mNumBlocks;
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getOrigins() const -> const Neon::set::MemSet_t<Neon::int32_3d>&
+{
+    return mData->mOrigin;
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getStencilNghIndex() const -> const Neon::set::MemSet_t<nghIdx_t>&
+{
+    return mData->mStencilNghIndex;
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getNeighbourBlocks() const -> const Neon::set::MemSet_t<uint32_t>&
+{
+    return mData->mNeighbourBlocks;
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getActiveMask() const -> const Neon::set::MemSet_t<uint32_t>&
+{
+    return mData->mActiveMask;
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getBlockOriginTo1D() const -> const Neon::domain::tool::PointHashTable<int32_t, uint32_t>&
+{
+    return mData->mBlockOriginTo1D;
+}
+
+template <int BlockSize>
+auto bGrid<BlockSize>::getKernelConfig(int            streamIdx,
+                                       Neon::DataView dataView) -> Neon::set::KernelConfig
+{
+    Neon::domain::KernelConfig kernelConfig(streamIdx, dataView);
+    if (kernelConfig.runtime() != Neon::Runtime::system) {
+        NEON_DEV_UNDER_CONSTRUCTION("bGrid::getKernelConfig");
+    }
+
+    Neon::set::LaunchParameters launchInfoSet = getLaunchParameters(dataView,
+                                                                    this->getDefaultBlock(), 0);
+
+    kernelConfig.expertSetLaunchParameters(launchInfoSet);
+    kernelConfig.expertSetBackend(this->getBackend());
+
+    return kernelConfig;
+}
+}  // namespace Neon::domain::internal::bGrid
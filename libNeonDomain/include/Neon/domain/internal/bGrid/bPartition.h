@@ -7,16 +7,18 @@
 
 namespace Neon::domain::internal::bGrid {
 
+template <int BlockSize>
 class bPartitionIndexSpace;
 
-template <typename T, int C = 0>
+template <typename T, int C, int BlockSize>
 class bPartition
 {
    public:
-    using PartitionIndexSpace = bPartitionIndexSpace;
-    using Cell = bCell;
+    using PartitionIndexSpace = bPartitionIndexSpace<BlockSize>;
+    using Cell = bCell<BlockSize>;
     using nghIdx_t = int8_3d;
     using Type = T;
+    using ComputeType = Neon::ComputeTypeOf<T>;
 
    public:
     bPartition() = default;
@@ -37,12 +39,12 @@ class bPartition
 
     inline NEON_CUDA_HOST_DEVICE auto dim() const -> Neon::index_3d;
 
-    inline NEON_CUDA_HOST_DEVICE auto operator()(const bCell& cell,
-                                                 int          card)
+    inline NEON_CUDA_HOST_DEVICE auto operator()(const Cell& cell,
+                                                 int         card)
         -> T&;
 
-    inline NEON_CUDA_HOST_DEVICE auto operator()(const bCell& cell,
-                                                 int          card) const -> const T&;
+    inline NEON_CUDA_HOST_DEVICE auto operator()(const Cell& cell,
+                                                 int         card) const -> const T&;
 
     NEON_CUDA_HOST_DEVICE inline auto nghVal(const Cell&     cell,
                                              const nghIdx_t& offset,
@@ -61,7 +63,18 @@ class bPartition
    private:
     inline NEON_CUDA_HOST_DEVICE auto pitch(const Cell& cell, int card) const -> uint32_t;
     inline NEON_CUDA_HOST_DEVICE auto setNghCell(const Cell& cell, const nghIdx_t& offset) const -> Cell;
-    inline NEON_CUDA_HOST_DEVICE auto shmemPitch(const Cell& cell, const int card) const -> Cell::Location::Integer;
+    inline NEON_CUDA_HOST_DEVICE auto shmemPitch(const Cell& cell, const int card) const -> int32_t;
+
+    /**
+     * Host only. nghVal for cells visited through a block (see bPartitionIndexSpace::forEachActiveCellInBlock):
+     * the neighbour block comes from the block neighbourhood cached in the cell, and the loads always hit a valid
+     * address (the cell's own block when the neighbour block does not exist) so that a row can run as a SIMD loop.
+     * The offset spans at most one block in each direction.
+     */
+    inline auto helpNghValInBlock(const Cell&     cell,
+                                  const nghIdx_t& offset,
+                                  const int       card,
+                                  const T&        alternativeVal) const -> NghInfo<T>;
 
     Neon::DataView            mDataView;
     T*                        mMem;
@@ -3,25 +3,49 @@
 #include "Neon/domain/internal/bGrid/bCell.h"
 
 namespace Neon::domain::internal::bGrid {
+
+template <int BlockSize>
 class bPartitionIndexSpace
 {
    public:
     bPartitionIndexSpace() = default;
     virtual ~bPartitionIndexSpace() = default;
 
-    using Cell = bCell;
+    using Cell = bCell<BlockSize>;
 
-    friend class bGrid;
+    friend class bGrid<BlockSize>;
 
     static constexpr int SpaceDim = 1;
 
-    NEON_CUDA_HOST_DEVICE inline auto setAndValidate(bCell&        cell,
+    //the CPU executor hands a whole block to each thread (see forEachActiveCellInBlock)
+    static constexpr bool sBlockExecution = true;
+
+    NEON_CUDA_HOST_DEVICE inline auto setAndValidate(Cell&         cell,
                                                      const size_t& x,
                                                      const size_t& y,
                                                      const size_t& z) const -> bool;
 
+    /**
+     * Returns the number of blocks of the partition
+     */
+    inline auto numBlocks() const -> uint32_t;
+
+    /**
+     * Host only. Runs userLambda on the active cells of a block.
+     * The block is processed one x-row at a time: the row bits are extracted once from the active mask,
+     * empty rows are skipped, full rows run as a SIMD loop and partial rows skip their inactive lanes.
+     * The lambda is inlined in the row loop (NEON_FLATTEN), loops over the stencil points inside the lambda
+     * should be unrolled (NEON_UNROLL) for the row to vectorize.
+     * The ids of the 26 neighbour blocks are fetched once per block and cached in the cells,
+     * bPartition::nghVal then resolves the neighbours of a row without branching on the block boundaries.
+     * SimdRows is false for lambdas with a loop carried dependency, e.g. accumulating into a variable.
+     */
+    template <bool SimdRows = true, typename UserLambda>
+    inline auto forEachActiveCellInBlock(uint32_t    blockIdx,
+                                         UserLambda& userLambda) const -> void;
+
    private:
-    NEON_CUDA_HOST_DEVICE inline auto setCell(bCell&                         cell,
+    NEON_CUDA_HOST_DEVICE inline auto setCell(Cell&                          cell,
                                               [[maybe_unused]] const size_t& x,
                                               [[maybe_unused]] const size_t& y,
                                               [[maybe_unused]] const size_t& z) const -> void;
@@ -33,6 +57,7 @@ class bPartitionIndexSpace
     uint32_t*       mDeviceActiveMask;
     Neon::int32_3d* mHostBlockOrigin;
     Neon::int32_3d* mDeviceBlockOrigin;
+    uint32_t*       mHostNeighbourBlocks;
 };
 }  // namespace Neon::domain::internal::bGrid
 
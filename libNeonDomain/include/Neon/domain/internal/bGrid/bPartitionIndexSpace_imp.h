@@ -1,9 +1,12 @@
+#pragma once
+
 #include "Neon/domain/internal/bGrid/bPartitionIndexSpace.h"
 
 namespace Neon::domain::internal::bGrid {
 
-NEON_CUDA_HOST_DEVICE inline auto bPartitionIndexSpace::setCell(
-    bCell&                         cell,
+template <int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bPartitionIndexSpace<BlockSize>::setCell(
+    Cell&                          cell,
     [[maybe_unused]] const size_t& x,
     [[maybe_unused]] const size_t& y,
     [[maybe_unused]] const size_t& z) const -> void
@@ -17,8 +20,8 @@ NEON_CUDA_HOST_DEVICE inline auto bPartitionIndexSpace::setCell(
     cell.set().y = threadIdx.y;
     cell.set().z = threadIdx.z;
 #else
-    cell.mBlockID = static_cast<uint32_t>(x) / (Cell::sBlockSizeX * Cell::sBlockSizeY * Cell::sBlockSizeZ);
-    Cell::Location::Integer reminder = static_cast<Cell::Location::Integer>(x % (Cell::sBlockSizeX * Cell::sBlockSizeY * Cell::sBlockSizeZ));
+    cell.mBlockID = static_cast<uint32_t>(x) / Cell::sBlockVolume;
+    typename Cell::Location::Integer reminder = static_cast<typename Cell::Location::Integer>(x % Cell::sBlockVolume);
     cell.set().z = reminder / (Cell::sBlockSizeX * Cell::sBlockSizeY);
     reminder -= (cell.set().z * Cell::sBlockSizeX * Cell::sBlockSizeY);
     cell.set().y = reminder / Cell::sBlockSizeX;
@@ -27,11 +30,12 @@ NEON_CUDA_HOST_DEVICE inline auto bPartitionIndexSpace::setCell(
     cell.mIsActive = true;
 }
 
+template <int BlockSize>
 NEON_CUDA_HOST_DEVICE inline auto
-bPartitionIndexSpace::setAndValidate(bCell&                         cell,
-                                     [[maybe_unused]] const size_t& x,
-                                     [[maybe_unused]] const size_t& y,
-                                     [[maybe_unused]] const size_t& z) const -> bool
+bPartitionIndexSpace<BlockSize>::setAndValidate(Cell&                          cell,
+                                                [[maybe_unused]] const size_t& x,
+                                                [[maybe_unused]] const size_t& y,
+                                                [[maybe_unused]] const size_t& z) const -> bool
 {
     setCell(cell, x, y, z);
 
@@ -58,4 +62,63 @@ bPartitionIndexSpace::setAndValidate(bCell&                         cell,
     return true;
 }
 
-}  // namespace Neon::domain::internal::bGrid
\ No newline at end of file
+template <int BlockSize>
+inline auto bPartitionIndexSpace<BlockSize>::numBlocks() const -> uint32_t
+{
+    return mNumBlocks;
+}
+
+template <int BlockSize>
+template <bool SimdRows, typename UserLambda>
+NEON_FLATTEN inline auto bPartitionIndexSpace<BlockSize>::forEachActiveCellInBlock(uint32_t    blockIdx,
+                                                                                   UserLambda& userLambda) const -> void
+{
+    //a row never spans two mask words since BlockSize divides sMaskSize
+    static_assert(Cell::sMaskSize % BlockSize == 0);
+    constexpr uint32_t fullRow = (uint32_t(1) << BlockSize) - 1;
+
+    const uint32_t* blockMask = mHostActiveMask + blockIdx * Cell::sMaskWordsPerBlock;
+
+    //the 3x3x3 block neighbourhood indexed by the block offset shifted by one, the block itself in the middle
+    uint32_t        nghBlocks[27];
+    const uint32_t* nghRow = mHostNeighbourBlocks + 26 * blockIdx;
+    for (int i = 0; i < 27; i++) {
+        nghBlocks[i] = i < 13 ? nghRow[i] : (i == 13 ? blockIdx : nghRow[i - 1]);
+    }
+
+    Cell cell;
+    cell.mBlockID = blockIdx;
+    cell.mIsActive = true;
+    cell.mNghBlocks = nghBlocks;
+
+    for (int z = 0; z < BlockSize; z++) {
+        for (int y = 0; y < BlockSize; y++) {
+            const uint32_t rowStart = uint32_t((z * BlockSize + y) * BlockSize);
+            const uint32_t rowBits = (blockMask[rowStart / Cell::sMaskSize] >> (rowStart % Cell::sMaskSize)) & fullRow;
+            if (rowBits == 0) {
+                continue;
+            }
+            cell.mLocation.y = static_cast<typename Cell::Location::Integer>(y);
+            cell.mLocation.z = static_cast<typename Cell::Location::Integer>(z);
+
+            if (SimdRows && rowBits == fullRow) {
+                NEON_IVDEP
+                for (int x = 0; x < BlockSize; x++) {
+                    Cell laneCell = cell;
+                    laneCell.mLocation.x = static_cast<typename Cell::Location::Integer>(x);
+                    userLambda(laneCell);
+                }
+            } else {
+                for (int x = 0; x < BlockSize; x++) {
+                    if (rowBits & (uint32_t(1) << x)) {
+                        Cell laneCell = cell;
+                        laneCell.mLocation.x = static_cast<typename Cell::Location::Integer>(x);
+                        userLambda(laneCell);
+                    }
+                }
+            }
+        }
+    }
+}
+
+}  // namespace Neon::domain::internal::bGrid
@@ -5,16 +5,16 @@
 
 namespace Neon::domain::internal::bGrid {
 
-template <typename T, int C>
-bPartition<T, C>::bPartition(Neon::DataView  dataView,
-                             T*              mem,
-                             Neon::index_3d  dim,
-                             int             cardinality,
-                             uint32_t*       neighbourBlocks,
-                             Neon::int32_3d* origin,
-                             uint32_t*       mask,
-                             T               outsideValue,
-                             nghIdx_t*       stencilNghIndex)
+template <typename T, int C, int BlockSize>
+bPartition<T, C, BlockSize>::bPartition(Neon::DataView  dataView,
+                                        T*              mem,
+                                        Neon::index_3d  dim,
+                                        int             cardinality,
+                                        uint32_t*       neighbourBlocks,
+                                        Neon::int32_3d* origin,
+                                        uint32_t*       mask,
+                                        T               outsideValue,
+                                        nghIdx_t*       stencilNghIndex)
     : mDataView(dataView),
       mMem(mem),
       mDim(dim),
@@ -30,57 +30,59 @@ bPartition<T, C>::bPartition(Neon::DataView  dataView,
 {
 }
 
-template <typename T, int C>
-inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C>::cardinality() const -> int
+template <typename T, int C, int BlockSize>
+inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C, BlockSize>::cardinality() const -> int
 {
     return mCardinality;
 }
 
-template <typename T, int C>
-inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C>::dim() const -> Neon::index_3d
+template <typename T, int C, int BlockSize>
+inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C, BlockSize>::dim() const -> Neon::index_3d
 {
     return mDim;
 }
 
-template <typename T, int C>
-inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C>::operator()(const bCell& cell,
-                                                               int          card) -> T&
+template <typename T, int C, int BlockSize>
+inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C, BlockSize>::operator()(const Cell& cell,
+                                                                          int         card) -> T&
 {
+#ifdef NEON_PLACE_CUDA_DEVICE
     if (mIsInSharedMem) {
         return mMemSharedMem[shmemPitch(cell, card)];
-    } else {
-        return mMem[pitch(cell, card)];
     }
+#endif
+    return mMem[pitch(cell, card)];
 }
 
-template <typename T, int C>
-inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C>::operator()(const bCell& cell,
-                                                               int          card) const -> const T&
+template <typename T, int C, int BlockSize>
+inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C, BlockSize>::operator()(const Cell& cell,
+                                                                          int         card) const -> const T&
 {
     if (!cell.mIsActive) {
         return mOutsideValue;
     }
+#ifdef NEON_PLACE_CUDA_DEVICE
     if (mIsInSharedMem) {
         return mMemSharedMem[shmemPitch(cell, card)];
-    } else {
-        return mMem[pitch(cell, card)];
     }
+#endif
+    return mMem[pitch(cell, card)];
 }
 
-template <typename T, int C>
-inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C>::pitch(const Cell& cell, int card) const -> uint32_t
+template <typename T, int C, int BlockSize>
+inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C, BlockSize>::pitch(const Cell& cell, int card) const -> uint32_t
 {
     //assumes SoA within the block i.e., AoSoA
     return
         //stride across all block before cell's block
-        cell.mBlockID * Cell::sBlockSizeX * Cell::sBlockSizeY * Cell::sBlockSizeZ * cardinality() +
+        cell.mBlockID * Cell::sBlockVolume * cardinality() +
         //stride within the block
         cell.pitch(card);
 }
 
-template <typename T, int C>
-NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C>::setNghCell(const Cell&     cell,
-                                                               const nghIdx_t& offset) const -> Cell
+template <typename T, int C, int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C, BlockSize>::setNghCell(const Cell&     cell,
+                                                                          const nghIdx_t& offset) const -> Cell
 {
     Cell ngh_cell(cell.mLocation.x + offset.x,
                   cell.mLocation.y + offset.y,
@@ -126,22 +128,27 @@ NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C>::setNghCell(const Cell&     c
     return ngh_cell;
 }
 
-template <typename T, int C>
-NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C>::nghVal(const Cell& eId,
-                                                           uint8_t     nghID,
-                                                           int         card,
-                                                           const T&    alternativeVal) const -> NghInfo<T>
+template <typename T, int C, int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C, BlockSize>::nghVal(const Cell& eId,
+                                                                      uint8_t     nghID,
+                                                                      int         card,
+                                                                      const T&    alternativeVal) const -> NghInfo<T>
 {
     nghIdx_t nghOffset = mStencilNghIndex[nghID];
     return nghVal(eId, nghOffset, card, alternativeVal);
 }
 
-template <typename T, int C>
-NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C>::nghVal(const Cell&     cell,
-                                                           const nghIdx_t& offset,
-                                                           const int       card,
-                                                           const T         alternativeVal) const -> NghInfo<T>
+template <typename T, int C, int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C, BlockSize>::nghVal(const Cell&     cell,
+                                                                      const nghIdx_t& offset,
+                                                                      const int       card,
+                                                                      const T         alternativeVal) const -> NghInfo<T>
 {
+#ifndef NEON_PLACE_CUDA_DEVICE
+    if (cell.mNghBlocks != nullptr) {
+        return helpNghValInBlock(cell, offset, card, alternativeVal);
+    }
+#endif
     NghInfo<T> ret;
     ret.value = alternativeVal;
     ret.isValid = false;
@@ -164,21 +171,53 @@ NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C>::nghVal(const Cell&     cell,
     return ret;
 }
 
-template <typename T, int C>
-inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C>::shmemPitch(
+template <typename T, int C, int BlockSize>
+inline auto bPartition<T, C, BlockSize>::helpNghValInBlock(const Cell&     cell,
+                                                           const nghIdx_t& offset,
+                                                           const int       card,
+                                                           const T&        alternativeVal) const -> NghInfo<T>
+{
+    assert(offset.x >= -BlockSize && offset.x <= BlockSize &&
+           offset.y >= -BlockSize && offset.y <= BlockSize &&
+           offset.z >= -BlockSize && offset.z <= BlockSize);
+
+    //shifted by one block, the coordinates are non negative and their quotient is the shifted block offset
+    const int x = cell.mLocation.x + offset.x + BlockSize;
+    const int y = cell.mLocation.y + offset.y + BlockSize;
+    const int z = cell.mLocation.z + offset.z + BlockSize;
+
+    const uint32_t nghBlock = cell.mNghBlocks[x / BlockSize + 3 * (y / BlockSize) + 9 * (z / BlockSize)];
+    const bool     hasBlock = nghBlock != std::numeric_limits<uint32_t>::max();
+
+    Cell ngh_cell(static_cast<typename Cell::Location::Integer>(x % BlockSize),
+                  static_cast<typename Cell::Location::Integer>(y % BlockSize),
+                  static_cast<typename Cell::Location::Integer>(z % BlockSize));
+    ngh_cell.mBlockID = hasBlock ? nghBlock : cell.mBlockID;
+
+    //no short circuit, both loads are unconditional
+    const bool isValid = hasBlock & ngh_cell.computeIsActive(mMask);
+    const T    val = mMem[pitch(ngh_cell, card)];
+
+    NghInfo<T> ret;
+    ret.set(isValid ? val : alternativeVal, isValid);
+    return ret;
+}
+
+template <typename T, int C, int BlockSize>
+inline NEON_CUDA_HOST_DEVICE auto bPartition<T, C, BlockSize>::shmemPitch(
     const Cell& cell,
-    const int   card) const -> Cell::Location::Integer
+    const int   card) const -> int32_t
 {
     //similar to bCell.pitch but we add the stencil radius to the block size
     return
         //stride across cardinalities before card within the block
-        (2 * mStencilRadius + Cell::sBlockSizeX) * (2 * mStencilRadius + Cell::sBlockSizeY) * (2 * mStencilRadius + Cell::sBlockSizeZ) * static_cast<Cell::Location::Integer>(card) +
+        (2 * mStencilRadius + Cell::sBlockSizeX) * (2 * mStencilRadius + Cell::sBlockSizeY) * (2 * mStencilRadius + Cell::sBlockSizeZ) * static_cast<int32_t>(card) +
         //offset to this cell's data
         (cell.mLocation.x + mStencilRadius) + (cell.mLocation.y + mStencilRadius) * (2 * mStencilRadius + Cell::sBlockSizeX) + (cell.mLocation.z + mStencilRadius) * (2 * mStencilRadius + Cell::sBlockSizeX) * (2 * mStencilRadius + Cell::sBlockSizeY);
 }
 
-template <typename T, int C>
-NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C>::loadInSharedMemory(
+template <typename T, int C, int BlockSize>
+NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C, BlockSize>::loadInSharedMemory(
     [[maybe_unused]] const Cell&                cell,
     [[maybe_unused]] const nghIdx_t::Integer    stencilRadius,
     [[maybe_unused]] Neon::sys::ShmemAllocator& shmemAlloc) const -> void
@@ -356,9 +395,9 @@ NEON_CUDA_HOST_DEVICE inline auto bPartition<T, C>::loadInSharedMemory(
         //load the 8 corner
 
         //0,0,0
-        for (Cell::Location::Integer z = -mStencilRadius; z <= -1; ++z) {
-            for (Cell::Location::Integer y = -mStencilRadius; y <= -1; ++y) {
-                for (Cell::Location::Integer x = -mStencilRadius; x <= -1; ++x) {
+        for (typename Cell::Location::Integer z = -mStencilRadius; z <= -1; ++z) {
+            for (typename Cell::Location::Integer y = -mStencilRadius; y <= -1; ++y) {
+                for (typename Cell::Location::Integer x = -mStencilRadius; x <= -1; ++x) {
 
                     //0,0,0
                     if (cell.mLocation.x == 0 && cell.mLocation.y == 0 && cell.mLocation.z == 0) {
@@ -32,6 +32,7 @@ class dField : public Neon::domain::interface::FieldBaseTemplate<T,
    public:
     static constexpr int Cardinality = C;
     using Type = T;
+    using ComputeType = Neon::ComputeTypeOf<T>;
     using Self = dField<Type, Cardinality>;
 
     using Grid = dGrid;
@@ -126,6 +127,14 @@ class dField : public Neon::domain::interface::FieldBaseTemplate<T,
                   Neon::set::MemDevSet<T>&         output,
                   const Neon::DataView&            dataView = Neon::DataView::STANDARD) -> void;
 
+    /**
+     * Dot product of each pair of fields computed in a single sweep over the partitions
+     */
+    static auto multiDot(Neon::set::patterns::BlasSet<T>&                   blasSet,
+                         const std::vector<std::pair<dField<T>, dField<T>>>& inputs,
+                         Neon::set::MemDevSet<T>&                           output,
+                         const Neon::DataView&                              dataView = Neon::DataView::STANDARD) -> std::vector<T>;
+
     static auto swap(Field& A, Field& B) -> void;
 
    private:
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstring>
+
 #include "Neon/core/core.h"
 #include "Neon/core/tools/io/ioToVti.h"
 #include "Neon/core/types/Macros.h"
@@ -45,21 +47,29 @@ class dFieldDev
         Neon::DeviceType                                devType = {Neon::DeviceType::NONE};
         int                                             cardinality;
         Neon::memLayout_et::order_e                     memOrder;
+        Neon::SpatialLayout                             spatialLayout = {Neon::SpatialLayout::linear};
         Neon::Allocator                                 memAlloc;
         Neon::set::MemDevSet<element_t>                 memory;
         Neon::set::MemDevSet<typename field_t::ngh_idx> stencilNghIndex;
+        Neon::set::MemDevSet<int32_t>                   brickRank;
         Neon::set::DataSet<element_t*>                  userPointersSet;
         Neon::set::DataSet<Neon::size_4d>               pitch;
+        Neon::set::DataSet<dSpatialLayout>              layout;
 
         std::array<Neon::set::DataSet<local_t>, Neon::DataViewUtil::nConfig> dFieldComputeSetByView;
 
-        std::array<std::vector<Neon::set::DataSet<int>>, Neon::DataViewUtil::nConfig> startIDByView;
-        std::array<std::vector<Neon::set::DataSet<int>>, Neon::DataViewUtil::nConfig> nElementsByView;
+        std::array<std::vector<Neon::set::DataSet<int64_t>>, Neon::DataViewUtil::nConfig> startIDByView;
+        std::array<std::vector<Neon::set::DataSet<int64_t>>, Neon::DataViewUtil::nConfig> nElementsByView;
 
         std::shared_ptr<grid_t>        grid;
         int                            zHaloDim;
         Neon::domain::haloStatus_et::e haloStatus;
         bool                           periodic_z;
+        bool                           zeroCopyHalo = false; /**< halo values are read in place from the neighbour partitions */
+#if defined(NEON_USE_ZERO_COPY_HALO)
+        /** Neighbours of every partition of every view, the partitions only hold a pointer to their entry */
+        std::array<std::vector<typename local_t::ZeroCopyHalo>, Neon::DataViewUtil::nConfig> zeroCopyHaloByView;
+#endif
     };
     std::shared_ptr<data_t> m_data;
 
@@ -71,6 +81,7 @@ class dFieldDev
               Neon::domain::haloStatus_et::e            haloStatus,
               Neon::DeviceType                          deviceType,
               Neon::memLayout_et::order_e               memOrder,
+              Neon::SpatialLayout                       spatialLayout,
               Neon::Allocator                           allocator,
               int                                       cardinality);
 
@@ -97,6 +108,8 @@ class dFieldDev
 
     auto devType() const -> Neon::DeviceType;
 
+    auto spatialLayout() const -> Neon::SpatialLayout;
+
     auto dot(
         Neon::set::patterns::BlasSet<T>& blasSet,
         const dFieldDev<T>&              input,
@@ -116,6 +129,16 @@ class dFieldDev
         const Neon::DataView&            dataView)
         -> T;
 
+    /**
+     * Computes the dot product of each pair of fields with a single pass over the memory of each slice
+     */
+    static auto multiDot(
+        Neon::set::patterns::BlasSet<T>&                                        blasSet,
+        const std::vector<std::pair<const dFieldDev<T>*, const dFieldDev<T>*>>& inputs,
+        Neon::set::MemDevSet<T>&                                                output,
+        const Neon::DataView&                                                   dataView)
+        -> std::vector<T>;
+
     auto norm2CUB(
         Neon::set::patterns::BlasSet<T>& blasSet,
         Neon::set::MemDevSet<T>&         output,
@@ -8,6 +8,7 @@ dFieldDev<T, C>::dFieldDev(const grid_t&                             grid,
                            Neon::domain::haloStatus_et::e            haloStatus,
                            Neon::DeviceType                          deviceType,
                            Neon::memLayout_et::order_e               memOrder,
+                           Neon::SpatialLayout                       spatialLayout,
                            Neon::Allocator                           allocator,
                            int                                       cardinality)
 {
@@ -15,6 +16,7 @@ dFieldDev<T, C>::dFieldDev(const grid_t&                             grid,
     m_data->devType = deviceType;
     m_data->cardinality = cardinality;
     m_data->memOrder = memOrder;
+    m_data->spatialLayout = spatialLayout;
     m_data->memAlloc = allocator;
     m_data->grid = std::make_shared<grid_t>(grid);
     m_data->zHaloDim = zHaloDim;
@@ -105,6 +107,12 @@ auto dFieldDev<T, C>::devType() const -> Neon::DeviceType
     return m_data->devType;
 }
 
+template <typename T, int C>
+auto dFieldDev<T, C>::spatialLayout() const -> Neon::SpatialLayout
+{
+    return m_data->spatialLayout;
+}
+
 template <typename T, int C>
 auto dFieldDev<T, C>::dot(
     Neon::set::patterns::BlasSet<T>& blasSet,
@@ -112,17 +120,49 @@ auto dFieldDev<T, C>::dot(
     Neon::set::MemDevSet<T>&         output,
     const Neon::DataView&            dataView) -> T
 {
+    if (m_data->spatialLayout != input.m_data->spatialLayout) {
+        NeonException exc("dFieldDev");
+        exc << "dot operation requires fields with the same spatial layout.";
+        NEON_THROW(exc);
+    }
     const int dataView_id = static_cast<int>(dataView);
-    const int numSlices = int(m_data->startIDByView[dataView_id].size());
-    T         ret = 0;
-    for (int s = 0; s < numSlices; ++s) {
-        ret += blasSet.dot(m_data->memory,
-                           input.m_data->memory,
-                           output,
-                           m_data->startIDByView[dataView_id][s],
-                           m_data->nElementsByView[dataView_id][s]);
+    return blasSet.dot(m_data->memory,
+                       input.m_data->memory,
+                       output,
+                       m_data->startIDByView[dataView_id],
+                       m_data->nElementsByView[dataView_id]);
+}
+
+template <typename T, int C>
+auto dFieldDev<T, C>::multiDot(
+    Neon::set::patterns::BlasSet<T>&                                        blasSet,
+    const std::vector<std::pair<const dFieldDev<T>*, const dFieldDev<T>*>>& inputs,
+    Neon::set::MemDevSet<T>&                                                output,
+    const Neon::DataView&                                                   dataView) -> std::vector<T>
+{
+    // all fields are allocated by the same grid and with the same layout,
+    // thus the slices of the first field are valid for all of them
+    auto&                                       ref = *inputs.front().first->m_data;
+    std::vector<const Neon::set::MemDevSet<T>*> inputs1;
+    std::vector<const Neon::set::MemDevSet<T>*> inputs2;
+    for (const auto& [a, b] : inputs) {
+        if (a->m_data->spatialLayout != ref.spatialLayout || b->m_data->spatialLayout != ref.spatialLayout ||
+            a->m_data->memOrder != ref.memOrder || b->m_data->memOrder != ref.memOrder ||
+            a->m_data->cardinality != ref.cardinality || b->m_data->cardinality != ref.cardinality) {
+            NeonException exc("dFieldDev");
+            exc << "multiDot operation requires fields with the same spatial layout, memory order and cardinality.";
+            NEON_THROW(exc);
+        }
+        inputs1.push_back(&a->m_data->memory);
+        inputs2.push_back(&b->m_data->memory);
     }
-    return ret;
+
+    const int dataView_id = static_cast<int>(dataView);
+    return blasSet.multiDot(inputs1,
+                            inputs2,
+                            output,
+                            ref.startIDByView[dataView_id],
+                            ref.nElementsByView[dataView_id]);
 }
 
 template <typename T, int C>
@@ -132,17 +172,10 @@ auto dFieldDev<T, C>::norm2(
     const Neon::DataView&            dataView) -> T
 {
     const int dataView_id = static_cast<int>(dataView);
-    const int numSlices = int(m_data->startIDByView[dataView_id].size());
-    T         ret = 0;
-    for (int s = 0; s < numSlices; ++s) {
-        T temp = blasSet.norm2(m_data->memory,
-                               output,
-                               m_data->startIDByView[dataView_id][s],
-                               m_data->nElementsByView[dataView_id][s]);
-        ret += temp * temp;
-    }
-    ret = std::sqrt(ret);
-    return ret;
+    return blasSet.norm2(m_data->memory,
+                         output,
+                         m_data->startIDByView[dataView_id],
+                         m_data->nElementsByView[dataView_id]);
 }
 
 template <typename T, int C>
@@ -211,6 +244,10 @@ auto dFieldDev<T, C>::haloUpdate(const Neon::Backend& bk,
     if (startWithBarrier) {
         bk.syncAll();
     }
+    if (m_data->zeroCopyHalo) {
+        // Halo values are read in place from the neighbour partitions: nothing to transfer
+        return;
+    }
 
     const int ndevs = static_cast<int>(m_data->grid->partitions().size());
     auto&     streamSet = bk.streamSet(streamSetIdx);
@@ -232,7 +269,7 @@ auto dFieldDev<T, C>::haloUpdate(const Neon::Backend& bk,
                     T*    dst = field_compute[setId + 1].mem() + +field_compute[setId + 1].elPitch(dst_idx);
 
                     if (m_data->devType == Neon::DeviceType::CPU) {
-                        std::memcpy(dst, src, transferBytes);
+                        bk.devSet().hostTransfer(setId + 1, (char*)(dst), setId, (const char*)(src), transferBytes);
                     } else if (m_data->devType == Neon::DeviceType::CUDA) {
                         bk.devSet().template peerTransfer<transferMode_ta>(
                             streamSet,
@@ -255,7 +292,7 @@ auto dFieldDev<T, C>::haloUpdate(const Neon::Backend& bk,
                     T*    dst = field_compute[setId - 1].mem() + +field_compute[setId - 1].elPitch(dst_idx);
 
                     if (m_data->devType == Neon::DeviceType::CPU) {
-                        std::memcpy(dst, src, transferBytes);
+                        bk.devSet().hostTransfer(setId - 1, (char*)(dst), setId, (const char*)(src), transferBytes);
                     } else if (m_data->devType == Neon::DeviceType::CUDA) {
                         bk.devSet().template peerTransfer<transferMode_ta>(
                             streamSet,
@@ -291,7 +328,7 @@ auto dFieldDev<T, C>::haloUpdate(const Neon::Backend& bk,
                         T*    dst = field_compute[setId + 1].mem() + +field_compute[setId + 1].elPitch(dst_idx, card);
 
                         if (m_data->devType == Neon::DeviceType::CPU) {
-                            std::memcpy(dst, src, transferBytes);
+                            bk.devSet().hostTransfer(setId + 1, (char*)(dst), setId, (const char*)(src), transferBytes);
                         } else if (m_data->devType == Neon::DeviceType::CUDA) {
                             bk.devSet().template peerTransfer<transferMode_ta>(
                                 streamSet,
@@ -314,7 +351,7 @@ auto dFieldDev<T, C>::haloUpdate(const Neon::Backend& bk,
                         T*    dst = field_compute[setId - 1].mem() + +field_compute[setId - 1].elPitch(dst_idx, card);
 
                         if (m_data->devType == Neon::DeviceType::CPU) {
-                            std::memcpy(dst, src, transferBytes);
+                            bk.devSet().hostTransfer(setId - 1, (char*)(dst), setId, (const char*)(src), transferBytes);
                         } else if (m_data->devType == Neon::DeviceType::CUDA) {
                             bk.devSet().template peerTransfer<transferMode_ta>(
                                 streamSet,
@@ -354,6 +391,10 @@ auto dFieldDev<T, C>::haloUpdate(Neon::SetIdx         setIdx,
     if (startWithBarrier) {
         bk.syncAll();
     }
+    if (m_data->zeroCopyHalo) {
+        // Halo values are read in place from the neighbour partitions: nothing to transfer
+        return;
+    }
     int const setId = setIdx.idx();
     const int ndevs = static_cast<int>(m_data->grid->partitions().size());
     auto&     streamSet = bk.streamSet(streamSetIdx);
@@ -373,7 +414,7 @@ auto dFieldDev<T, C>::haloUpdate(Neon::SetIdx         setIdx,
                 T*    dst = field_compute[setId + 1].mem() + +field_compute[setId + 1].elPitch(dst_idx);
 
                 if (m_data->devType == Neon::DeviceType::CPU) {
-                    std::memcpy(dst, src, transferBytes);
+                    bk.devSet().hostTransfer(setId + 1, (char*)(dst), setId, (const char*)(src), transferBytes);
                 } else if (m_data->devType == Neon::DeviceType::CUDA) {
                     bk.devSet().template peerTransfer<transferMode_ta>(
                         streamSet,
@@ -396,7 +437,7 @@ auto dFieldDev<T, C>::haloUpdate(Neon::SetIdx         setIdx,
                 T*    dst = field_compute[setId - 1].mem() + +field_compute[setId - 1].elPitch(dst_idx);
 
                 if (m_data->devType == Neon::DeviceType::CPU) {
-                    std::memcpy(dst, src, transferBytes);
+                    bk.devSet().hostTransfer(setId - 1, (char*)(dst), setId, (const char*)(src), transferBytes);
                 } else if (m_data->devType == Neon::DeviceType::CUDA) {
                     bk.devSet().template peerTransfer<transferMode_ta>(
                         streamSet,
@@ -432,7 +473,7 @@ auto dFieldDev<T, C>::haloUpdate(Neon::SetIdx         setIdx,
                     T*    dst = field_compute[setId + 1].mem() + +field_compute[setId + 1].elPitch(dst_idx, card);
 
                     if (m_data->devType == Neon::DeviceType::CPU) {
-                        std::memcpy(dst, src, transferBytes);
+                        bk.devSet().hostTransfer(setId + 1, (char*)(dst), setId, (const char*)(src), transferBytes);
                     } else if (m_data->devType == Neon::DeviceType::CUDA) {
                         bk.devSet().template peerTransfer<transferMode_ta>(
                             streamSet,
@@ -455,7 +496,7 @@ auto dFieldDev<T, C>::haloUpdate(Neon::SetIdx         setIdx,
                     T*    dst = field_compute[setId - 1].mem() + +field_compute[setId - 1].elPitch(dst_idx, card);
 
                     if (m_data->devType == Neon::DeviceType::CPU) {
-                        std::memcpy(dst, src, transferBytes);
+                        bk.devSet().hostTransfer(setId - 1, (char*)(dst), setId, (const char*)(src), transferBytes);
                     } else if (m_data->devType == Neon::DeviceType::CUDA) {
                         bk.devSet().template peerTransfer<transferMode_ta>(
                             streamSet,
@@ -656,46 +697,9 @@ auto dFieldDev<T, C>::h_init(const Neon::set::DataSet<Neon::index_3d>& dims,
         m_data->dFieldComputeSetByView[dv_id] = grid.getBackend().devSet().template newDataSet<local_t>();
 
         switch (dv) {
-            case Neon::DataView::STANDARD: {
-                if (grid.getBackend().devSet().setCardinality() == 1 ||
-                    (grid.getBackend().devSet().setCardinality() > 1 && m_data->memOrder == Neon::memLayout_et::order_e::arrayOfStructs)) {
-                    m_data->startIDByView[dv_id].resize(1);
-                    m_data->startIDByView[dv_id][0] = grid.getBackend().devSet().template newDataSet<int>();
-
-                    m_data->nElementsByView[dv_id].resize(1);
-                    m_data->nElementsByView[dv_id][0] = grid.getBackend().devSet().template newDataSet<int>();
-                } else {
-                    m_data->startIDByView[dv_id].resize(m_data->cardinality);
-                    m_data->nElementsByView[dv_id].resize(m_data->cardinality);
-                    for (int i = 0; i < m_data->cardinality; ++i) {
-                        m_data->startIDByView[dv_id][i] = grid.getBackend().devSet().template newDataSet<int>();
-                        m_data->nElementsByView[dv_id][i] = grid.getBackend().devSet().template newDataSet<int>();
-                    }
-                }
-                break;
-            }
+            case Neon::DataView::STANDARD:
             case Neon::DataView::INTERNAL: {
-
-                if (grid.getBackend().devSet().setCardinality() > 1) {
-                    switch (m_data->memOrder) {
-                        case Neon::memLayout_et::order_e::structOfArrays: {
-                            m_data->startIDByView[dv_id].resize(m_data->cardinality);
-                            m_data->nElementsByView[dv_id].resize(m_data->cardinality);
-                            for (int i = 0; i < m_data->cardinality; ++i) {
-                                m_data->startIDByView[dv_id][i] = grid.getBackend().devSet().template newDataSet<int>();
-                                m_data->nElementsByView[dv_id][i] = grid.getBackend().devSet().template newDataSet<int>();
-                            }
-                            break;
-                        }
-                        case Neon::memLayout_et::order_e::arrayOfStructs: {
-                            m_data->startIDByView[dv_id].resize(1);
-                            m_data->startIDByView[dv_id][0] = grid.getBackend().devSet().template newDataSet<int>();
-                            m_data->nElementsByView[dv_id].resize(1);
-                            m_data->nElementsByView[dv_id][0] = grid.getBackend().devSet().template newDataSet<int>();
-                            break;
-                        }
-                    }
-                }
+                // Sized once the spatial layout of each partition is known
                 break;
             }
             case Neon::DataView::BOUNDARY: {
@@ -706,18 +710,18 @@ auto dFieldDev<T, C>::h_init(const Neon::set::DataSet<Neon::index_3d>& dims,
                             m_data->startIDByView[dv_id].resize(2 * m_data->cardinality);
                             m_data->nElementsByView[dv_id].resize(2 * m_data->cardinality);
                             for (int i = 0; i < 2 * m_data->cardinality; ++i) {
-                                m_data->startIDByView[dv_id][i] = grid.getBackend().devSet().template newDataSet<int>();
-                                m_data->nElementsByView[dv_id][i] = grid.getBackend().devSet().template newDataSet<int>();
+                                m_data->startIDByView[dv_id][i] = grid.getBackend().devSet().template newDataSet<int64_t>();
+                                m_data->nElementsByView[dv_id][i] = grid.getBackend().devSet().template newDataSet<int64_t>();
                             }
                             break;
                         }
                         case Neon::memLayout_et::order_e::arrayOfStructs: {
                             m_data->startIDByView[dv_id].resize(2);
-                            m_data->startIDByView[dv_id][0] = grid.getBackend().devSet().template newDataSet<int>();
-                            m_data->startIDByView[dv_id][1] = grid.getBackend().devSet().template newDataSet<int>();
+                            m_data->startIDByView[dv_id][0] = grid.getBackend().devSet().template newDataSet<int64_t>();
+                            m_data->startIDByView[dv_id][1] = grid.getBackend().devSet().template newDataSet<int64_t>();
                             m_data->nElementsByView[dv_id].resize(2);
-                            m_data->nElementsByView[dv_id][0] = grid.getBackend().devSet().template newDataSet<int>();
-                            m_data->nElementsByView[dv_id][1] = grid.getBackend().devSet().template newDataSet<int>();
+                            m_data->nElementsByView[dv_id][0] = grid.getBackend().devSet().template newDataSet<int64_t>();
+                            m_data->nElementsByView[dv_id][1] = grid.getBackend().devSet().template newDataSet<int64_t>();
                             break;
                         }
                     }
@@ -738,10 +742,29 @@ auto dFieldDev<T, C>::h_init(const Neon::set::DataSet<Neon::index_3d>& dims,
 
     Neon::set::DataSet<uint64_t> stencil_dim = grid.getBackend().devSet().template newDataSet<uint64_t>();
 
-    uint64_t stencil_num_ngh = uint64_t(grid.getStencil().neighbours().size());
+    Neon::set::DataSet<uint64_t> brick_dim = grid.getBackend().devSet().template newDataSet<uint64_t>();
+
+    m_data->layout = grid.getBackend().devSet().template newDataSet<dSpatialLayout>();
+
+#if !defined(NEON_USE_SPATIAL_LAYOUT)
+    if (m_data->spatialLayout != Neon::SpatialLayout::linear) {
+        NeonException exp("dFieldDev_t");
+        exp << " Spatial layout " << Neon::SpatialLayoutUtils::toString(m_data->spatialLayout)
+            << " requires Neon to be built with NEON_USE_SPATIAL_LAYOUT";
+        NEON_THROW(exp);
+    }
+#endif
+
+    std::vector<std::vector<int32_t>> brickRank(dims.size());
+    uint64_t                          stencil_num_ngh = uint64_t(grid.getStencil().neighbours().size());
     for (int64_t i = 0; i < dims.size(); ++i) {
-        dims_flat[i] = dims[i].x * dims[i].y * (dims[i].z + 2 * haloRadius) * m_data->cardinality;
+        m_data->layout[i] = dSpatialLayout::factory(m_data->spatialLayout, dims[i], haloRadius, m_data->zHaloDim);
+        if (Neon::SpatialLayoutUtils::isMorton(m_data->spatialLayout)) {
+            brickRank[i] = dSpatialLayout::mortonRank(m_data->layout[i].mNBricks);
+        }
+        dims_flat[i] = m_data->layout[i].mNCells * m_data->cardinality;
         stencil_dim[i] = stencil_num_ngh;
+        brick_dim[i] = Neon::SpatialLayoutUtils::isMorton(m_data->spatialLayout) ? m_data->layout[i].nBricks() : 0;
     }
 
     m_data->memory = grid.getBackend().devSet().template newMemDevSet<T>(m_data->devType,
@@ -752,6 +775,12 @@ auto dFieldDev<T, C>::h_init(const Neon::set::DataSet<Neon::index_3d>& dims,
                                                                                                           m_data->memAlloc,
                                                                                                           stencil_dim);
 
+    if (Neon::SpatialLayoutUtils::isMorton(m_data->spatialLayout)) {
+        m_data->brickRank = grid.getBackend().devSet().template newMemDevSet<int32_t>(m_data->devType,
+                                                                                      m_data->memAlloc,
+                                                                                      brick_dim);
+    }
+
     Neon::sys::MemDevice<typename field_t::ngh_idx> stencil_cpu(Neon::DeviceType::CPU, 0, Neon::Allocator::MALLOC, stencil_num_ngh);
 
     for (uint64_t s = 0; s < stencil_cpu.nElements(); ++s) {
@@ -777,7 +806,7 @@ auto dFieldDev<T, C>::h_init(const Neon::set::DataSet<Neon::index_3d>& dims,
                     m_data->pitch[i].x = 1;
                     m_data->pitch[i].y = m_data->pitch[i].x * dims[i].x;
                     m_data->pitch[i].z = m_data->pitch[i].y * dims[i].y;
-                    m_data->pitch[i].w = m_data->pitch[i].z * (dims[i].z + 2 * haloRadius);
+                    m_data->pitch[i].w = m_data->layout[i].mNCells;
                     break;
                 }
                 case Neon::memLayout_et::order_e::arrayOfStructs: {
@@ -797,7 +826,17 @@ auto dFieldDev<T, C>::h_init(const Neon::set::DataSet<Neon::index_3d>& dims,
 
         typename field_t::ngh_idx* stencilNgh = m_data->stencilNghIndex.mem(int(i));
 
-        const index_3d dim = dims[i];
+        if (Neon::SpatialLayoutUtils::isMorton(m_data->spatialLayout)) {
+            const std::vector<int32_t>&   rank = brickRank[i];
+            Neon::sys::MemDevice<int32_t> rank_cpu(Neon::DeviceType::CPU, 0, Neon::Allocator::MALLOC, rank.size());
+            std::copy(rank.begin(), rank.end(), rank_cpu.mem());
+            m_data->brickRank.getMemDev(int64_t(i)).copyFrom(rank_cpu);
+            m_data->layout[i].mBrickRank = m_data->brickRank.mem(int(i));
+        }
+
+        const dSpatialLayout& layout = m_data->layout[i];
+        const index_3d        dim = dims[i];
+        const int64_t         nCells = layout.mNCells;
 
         const int boundayRadius = m_data->zHaloDim;
         index_3d  origin = origin_accumulator;
@@ -807,52 +846,11 @@ auto dFieldDev<T, C>::h_init(const Neon::set::DataSet<Neon::index_3d>& dims,
                 dPartition<T, C>(dv, mem, dim, haloRadius, boundayRadius,
                                  m_data->pitch[i], int(i),
                                  origin, m_data->cardinality,
-                                 m_data->grid->getDimension(), stencilNgh);
+                                 m_data->grid->getDimension(), stencilNgh, layout);
 
             switch (dv) {
-                case Neon::DataView::STANDARD: {
-                    if (grid.getBackend().devSet().setCardinality() == 1) {
-                        m_data->startIDByView[dv_id][0][i] = 0;
-                        m_data->nElementsByView[dv_id][0][i] = int(dims_flat[i]);
-                    } else {
-                        switch (m_data->memOrder) {
-                            case Neon::memLayout_et::order_e::structOfArrays: {
-                                for (int c = 0; c < m_data->cardinality; ++c) {
-                                    m_data->startIDByView[dv_id][c][i] =
-                                        c * dims[i].x * dims[i].y * (dims[i].z + 2 * haloRadius) +
-                                        dims[i].x * dims[i].y * haloRadius;
-                                    m_data->nElementsByView[dv_id][c][i] = dims[i].x * dims[i].y * dims[i].z;
-                                }
-                                break;
-                            }
-                            case Neon::memLayout_et::order_e::arrayOfStructs: {
-                                m_data->startIDByView[dv_id][0][i] = dims[i].x * dims[i].y * haloRadius * m_data->cardinality;
-                                m_data->nElementsByView[dv_id][0][i] = dims[i].x * dims[i].y * dims[i].z * m_data->cardinality;
-                                break;
-                            }
-                        }
-                    }
-                    break;
-                }
+                case Neon::DataView::STANDARD:
                 case Neon::DataView::INTERNAL: {
-                    if (grid.getBackend().devSet().setCardinality() > 1) {
-                        switch (m_data->memOrder) {
-                            case Neon::memLayout_et::order_e::structOfArrays: {
-                                for (int c = 0; c < m_data->cardinality; ++c) {
-                                    m_data->startIDByView[dv_id][c][i] =
-                                        c * dims[i].x * dims[i].y * (dims[i].z + 2 * haloRadius) +
-                                        dims[i].x * dims[i].y * (haloRadius + boundayRadius);
-                                    m_data->nElementsByView[dv_id][c][i] = dims[i].x * dims[i].y * (dims[i].z - 2 * haloRadius);
-                                }
-                                break;
-                            }
-                            case Neon::memLayout_et::order_e::arrayOfStructs: {
-                                m_data->startIDByView[dv_id][0][i] = dims[i].x * dims[i].y * (haloRadius + boundayRadius) * m_data->cardinality;
-                                m_data->nElementsByView[dv_id][0][i] = dims[i].x * dims[i].y * (dims[i].z - 2 * haloRadius) * m_data->cardinality;
-                                break;
-                            }
-                        }
-                    }
                     break;
                 }
                 case Neon::DataView::BOUNDARY: {
@@ -862,26 +860,24 @@ auto dFieldDev<T, C>::h_init(const Neon::set::DataSet<Neon::index_3d>& dims,
                                 for (int c = 0; c < m_data->cardinality; ++c) {
                                     // up
                                     m_data->startIDByView[dv_id][2 * c][i] =
-                                        c * dims[i].x * dims[i].y * (dims[i].z + 2 * haloRadius) +
-                                        dims[i].x * dims[i].y * haloRadius;
-                                    m_data->nElementsByView[dv_id][2 * c][i] = dims[i].x * dims[i].y * boundayRadius;
+                                        c * nCells + layout.sliceOffset(haloRadius);
+                                    m_data->nElementsByView[dv_id][2 * c][i] = layout.mSliceSize * boundayRadius;
 
                                     // down
                                     m_data->startIDByView[dv_id][2 * c + 1][i] =
-                                        c * dims[i].x * dims[i].y * (dims[i].z + 2 * haloRadius) +
-                                        dims[i].x * dims[i].y * (dims[i].z + haloRadius - boundayRadius);
-                                    m_data->nElementsByView[dv_id][2 * c + 1][i] = dims[i].x * dims[i].y * boundayRadius;
+                                        c * nCells + layout.sliceOffset(dim.z + haloRadius - boundayRadius);
+                                    m_data->nElementsByView[dv_id][2 * c + 1][i] = layout.mSliceSize * boundayRadius;
                                 }
                                 break;
                             }
                             case Neon::memLayout_et::order_e::arrayOfStructs: {
                                 // up
-                                m_data->startIDByView[dv_id][0][i] = dims[i].x * dims[i].y * haloRadius * m_data->cardinality;
-                                m_data->nElementsByView[dv_id][0][i] = dims[i].x * dims[i].y * boundayRadius * m_data->cardinality;
+                                m_data->startIDByView[dv_id][0][i] = layout.sliceOffset(haloRadius) * m_data->cardinality;
+                                m_data->nElementsByView[dv_id][0][i] = layout.mSliceSize * boundayRadius * m_data->cardinality;
 
                                 // down
-                                m_data->startIDByView[dv_id][1][i] = dims[i].x * dims[i].y * (dims[i].z + haloRadius - boundayRadius) * m_data->cardinality;
-                                m_data->nElementsByView[dv_id][1][i] = dims[i].x * dims[i].y * boundayRadius * m_data->cardinality;
+                                m_data->startIDByView[dv_id][1][i] = layout.sliceOffset(dim.z + haloRadius - boundayRadius) * m_data->cardinality;
+                                m_data->nElementsByView[dv_id][1][i] = layout.mSliceSize * boundayRadius * m_data->cardinality;
                                 break;
                             }
                         }
@@ -906,6 +902,87 @@ auto dFieldDev<T, C>::h_init(const Neon::set::DataSet<Neon::index_3d>& dims,
             }
         }
     }
+
+    // BLAS slices of the STANDARD and INTERNAL views: the memory ranges of the cells of the view, padding excluded.
+    // Partitions with fewer ranges than the others get empty slices.
+    const int nSet = grid.getBackend().devSet().setCardinality();
+    for (auto dv : {Neon::DataView::STANDARD, Neon::DataView::INTERNAL}) {
+        if (dv == Neon::DataView::INTERNAL && nSet == 1) {
+            continue;
+        }
+        const int dv_id = static_cast<int>(dv);
+        const int boundaryRadius = dv == Neon::DataView::INTERNAL ? m_data->zHaloDim : 0;
+
+        std::vector<std::vector<std::pair<int64_t, int64_t>>> slices(nSet);
+        size_t                                                nSlices = 0;
+        for (int i = 0; i < nSet; ++i) {
+            const dSpatialLayout& layout = m_data->layout[i];
+            const auto            runs = layout.dataRuns(haloRadius + boundaryRadius,
+                                                         haloRadius + dims[i].z - boundaryRadius,
+                                                         brickRank[i]);
+            auto&                 slice = slices[i];
+            auto                  append = [&slice](int64_t start, int64_t count) {
+                if (!slice.empty() && slice.back().first + slice.back().second == start) {
+                    slice.back().second += count;
+                    return;
+                }
+                slice.emplace_back(start, count);
+            };
+            switch (m_data->memOrder) {
+                case Neon::memLayout_et::order_e::structOfArrays: {
+                    for (int c = 0; c < m_data->cardinality; ++c) {
+                        for (const auto& [start, count] : runs) {
+                            append(c * layout.mNCells + start, count);
+                        }
+                    }
+                    break;
+                }
+                case Neon::memLayout_et::order_e::arrayOfStructs: {
+                    for (const auto& [start, count] : runs) {
+                        append(start * m_data->cardinality, count * m_data->cardinality);
+                    }
+                    break;
+                }
+            }
+            nSlices = std::max(nSlices, slice.size());
+        }
+
+        m_data->startIDByView[dv_id].resize(nSlices);
+        m_data->nElementsByView[dv_id].resize(nSlices);
+        for (size_t s = 0; s < nSlices; ++s) {
+            m_data->startIDByView[dv_id][s] = grid.getBackend().devSet().template newDataSet<int64_t>();
+            m_data->nElementsByView[dv_id][s] = grid.getBackend().devSet().template newDataSet<int64_t>();
+            for (int i = 0; i < nSet; ++i) {
+                const bool hasSlice = s < slices[i].size();
+                m_data->startIDByView[dv_id][s][i] = hasSlice ? slices[i][s].first : 0;
+                m_data->nElementsByView[dv_id][s][i] = hasSlice ? slices[i][s].second : 0;
+            }
+        }
+    }
+
+#if defined(NEON_USE_ZERO_COPY_HALO)
+    // With zero-copy halos the partitions read the halo cells from the memory of their neighbours
+    const int nPartitions = grid.getBackend().devSet().setCardinality();
+    m_data->zeroCopyHalo = grid.getBackend().hasCpuZeroCopyHalo() &&
+                           m_data->devType == Neon::DeviceType::CPU &&
+                           haloStatus() == Neon::domain::haloStatus_et::ON &&
+                           nPartitions > 1;
+    if (m_data->zeroCopyHalo) {
+        for (auto& dv : Neon::DataViewUtil::validOptions()) {
+            auto& partitions = m_data->dFieldComputeSetByView[static_cast<int>(dv)];
+            auto& halos = m_data->zeroCopyHaloByView[static_cast<int>(dv)];
+            halos.resize(nPartitions);
+            for (int i = 0; i < nPartitions; ++i) {
+                partitions[i].enableZeroCopyHalo(i > 0 ? &partitions[i - 1] : nullptr,
+                                                 i < nPartitions - 1 ? &partitions[i + 1] : nullptr,
+                                                 halos[i]);
+            }
+        }
+    }
+#else
+    // Zero-copy halos are not compiled in (NEON_USE_ZERO_COPY_HALO): the halo is updated as usual
+    m_data->zeroCopyHalo = false;
+#endif
 }
 
 
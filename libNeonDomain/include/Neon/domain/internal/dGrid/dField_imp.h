@@ -42,6 +42,7 @@ dField<T, C>::dField(const std::string&                        fieldUserName,
                             haloStatus,
                             memoryOptions.getComputeType(),
                             Neon::memLayout_et::convert(memoryOptions.getOrder()),
+                            memoryOptions.getSpatialLayout(),
                             memoryOptions.getComputeAllocator(dataUse),
                             cardinality);
 
@@ -51,6 +52,7 @@ dField<T, C>::dField(const std::string&                        fieldUserName,
                             haloStatus,
                             memoryOptions.getIOType(),
                             Neon::memLayout_et::convert(memoryOptions.getOrder()),
+                            memoryOptions.getSpatialLayout(),
                             memoryOptions.getIOAllocator(dataUse),
                             cardinality);
 }
@@ -518,6 +520,21 @@ auto dField<T, C>::dotCUB(Neon::set::patterns::BlasSet<T>& blasSet,
     m_gpu.dotCUB(blasSet, input.field(Neon::DeviceType::CUDA), output, dataView);
 }
 
+template <typename T, int C>
+auto dField<T, C>::multiDot(Neon::set::patterns::BlasSet<T>&                   blasSet,
+                            const std::vector<std::pair<dField<T>, dField<T>>>& inputs,
+                            Neon::set::MemDevSet<T>&                           output,
+                            const Neon::DataView&                              dataView) -> std::vector<T>
+{
+    const Neon::DeviceType devType = inputs.front().first.getBackend().devType();
+
+    std::vector<std::pair<const FieldDev*, const FieldDev*>> devInputs;
+    for (const auto& [a, b] : inputs) {
+        devInputs.emplace_back(&a.field(devType), &b.field(devType));
+    }
+    return FieldDev::multiDot(blasSet, devInputs, output, dataView);
+}
+
 template <typename T, int C>
 auto dField<T, C>::norm2(Neon::set::patterns::BlasSet<T>& blasSet,
                          Neon::set::MemDevSet<T>&         output,
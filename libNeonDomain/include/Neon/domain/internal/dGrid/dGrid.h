@@ -19,6 +19,7 @@
 #include "Neon/domain/interface/Stencil.h"
 #include "Neon/domain/interface/common.h"
 #include "Neon/domain/patterns/PatternScalar.h"
+#include "Neon/domain/patterns/PatternScalarVector.h"
 
 #include "Neon/domain/internal/dGrid/dField.h"
 #include "Neon/domain/internal/dGrid/dFieldDev.h"
@@ -109,6 +110,11 @@ class dGrid : public Neon::domain::interface::GridBaseTemplate<dGrid, dCell>
         const
         -> Neon::set::Container;
 
+    /**
+     * Select the engine used by dot, norm2 and multiDot.
+     * Engine::deterministic (CPU backends only) gives bit-identical results for any number of threads and partitions.
+     * Only dGrid offers the deterministic engine: eGrid does not implement these patterns and bGrid reduces with CUB.
+     */
     auto setReduceEngine(Neon::sys::patterns::Engine eng) -> void;
 
     template <typename T>
@@ -128,6 +134,21 @@ class dGrid : public Neon::domain::interface::GridBaseTemplate<dGrid, dCell>
                Neon::template PatternScalar<T>& scalar) const
         -> Neon::set::Container;
 
+    template <typename T>
+    auto newPatternScalarVector(int nScalars) const
+        -> Neon::template PatternScalarVector<T>;
+
+    /**
+     * Dot product of each pair of fields, i.e. scalars(k) = <inputs[k].first, inputs[k].second>.
+     * All products are computed in a single traversal of the partitions with a single
+     * combine across partitions. The container is a REDUCE node for the Skeleton.
+     */
+    template <typename T>
+    auto multiDot(const std::string&                                 name,
+                  const std::vector<std::pair<dField<T>, dField<T>>>& inputs,
+                  Neon::template PatternScalarVector<T>&             scalars) const
+        -> Neon::set::Container;
+
     auto convertToNgh(const std::vector<Neon::index_3d>& stencilOffsets)
         -> std::vector<ngh_idx>;
 
@@ -224,7 +224,7 @@ auto dGrid::dot(const std::string&               name,
                 if (input1.getUid() != input2.getUid()) {
                     loader.load(input2);
                 }
-                loader.load(scalar);
+                loader.load(scalar, Neon::Compute::REDUCE);
                 return [&](int streamIdx, Neon::DataView dataView) mutable -> void {
                     if (dataView != Neon::DataView::STANDARD && getBackend().devSet().setCardinality() == 1) {
                         NeonException exc("dGrid_t");
@@ -250,7 +250,7 @@ auto dGrid::dot(const std::string&               name,
                 if (input1.getUid() != input2.getUid()) {
                     loader.load(input2);
                 }
-                loader.load(scalar);
+                loader.load(scalar, Neon::Compute::REDUCE);
 
                 return [&](int streamIdx, Neon::DataView dataView) mutable -> void {
                     if (dataView != Neon::DataView::STANDARD && getBackend().devSet().setCardinality() == 1) {
@@ -298,6 +298,65 @@ auto dGrid::dot(const std::string&               name,
     }
 }
 
+template <typename T>
+auto dGrid::newPatternScalarVector(int nScalars) const -> Neon::template PatternScalarVector<T>
+{
+    // the fused reduction always runs through the BlasSet path, so it does not need the CUB engine
+    const auto engine = m_data->reduceEngine == Neon::sys::patterns::Engine::deterministic
+                            ? Neon::sys::patterns::Engine::deterministic
+                            : Neon::sys::patterns::Engine::cuBlas;
+    return Neon::PatternScalarVector<T>(getBackend(), nScalars, engine);
+}
+
+template <typename T>
+auto dGrid::multiDot(const std::string&                                 name,
+                     const std::vector<std::pair<dField<T>, dField<T>>>& inputs,
+                     Neon::template PatternScalarVector<T>&             scalars) const -> Neon::set::Container
+{
+    if (inputs.empty() || int(inputs.size()) != scalars.size()) {
+        NeonException exc("dGrid_t");
+        exc << "multiDot expects one result per pair of fields: "
+            << inputs.size() << " pairs versus " << scalars.size() << " results";
+        NEON_THROW(exc);
+    }
+
+    return Neon::set::Container::factoryOldManaged(
+        name,
+        Neon::set::internal::ContainerAPI::DataViewSupport::on,
+        *this, [this, inputs, &scalars](Neon::set::Loader& loader) {
+            // each field is loaded once even if it shows up in several pairs
+            std::vector<Neon::set::MultiDeviceObjectUid> loaded;
+            auto                                         loadOnce = [&](const dField<T>& field) {
+                if (std::find(loaded.begin(), loaded.end(), field.getUid()) == loaded.end()) {
+                    loaded.push_back(field.getUid());
+                    loader.load(field);
+                }
+            };
+            for (const auto& [a, b] : inputs) {
+                loadOnce(a);
+                loadOnce(b);
+            }
+            loader.load(scalars, Neon::Compute::REDUCE);
+
+            return [this, inputs, &scalars](int streamIdx, Neon::DataView dataView) mutable -> void {
+                if (dataView != Neon::DataView::STANDARD && getBackend().devSet().setCardinality() == 1) {
+                    NeonException exc("dGrid_t");
+                    exc << "Reduction operation can only run on standard data view when the number of partitions/GPUs is 1";
+                    NEON_THROW(exc);
+                }
+                scalars.setStream(streamIdx, dataView);
+                scalars(dataView) = dField<T>::multiDot(scalars.getBlasSet(dataView),
+                                                        inputs, scalars.getTempMemory(dataView), dataView);
+                if (dataView == Neon::DataView::BOUNDARY) {
+                    for (int k = 0; k < scalars.size(); ++k) {
+                        scalars(Neon::DataView::STANDARD)[k] =
+                            scalars(Neon::DataView::BOUNDARY)[k] + scalars(Neon::DataView::INTERNAL)[k];
+                    }
+                }
+            };
+        });
+}
+
 template <typename T>
 auto dGrid::norm2(const std::string&               name,
                   dField<T>&                       input,
@@ -309,6 +368,7 @@ auto dGrid::norm2(const std::string&               name,
             Neon::set::internal::ContainerAPI::DataViewSupport::on,
             *this, [&](Neon::set::Loader& loader) {
                 loader.load(input);
+                loader.load(scalar, Neon::Compute::REDUCE);
 
                 return [&](int streamIdx, Neon::DataView dataView) mutable -> void {
                     if (dataView != Neon::DataView::STANDARD && getBackend().devSet().setCardinality() == 1) {
@@ -332,6 +392,7 @@ auto dGrid::norm2(const std::string&               name,
             Neon::set::internal::ContainerAPI::DataViewSupport::on,
             *this, [&](Neon::set::Loader& loader) {
                 loader.load(input);
+                loader.load(scalar, Neon::Compute::REDUCE);
 
                 return [&](int streamIdx, Neon::DataView dataView) mutable -> void {
                     if (dataView != Neon::DataView::STANDARD && getBackend().devSet().setCardinality() == 1) {
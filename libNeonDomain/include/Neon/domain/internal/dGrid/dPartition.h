@@ -1,5 +1,6 @@
 #pragma once
 #include <assert.h>
+#include <array>
 #include "Neon/core/core.h"
 #include "Neon/core/types/Macros.h"
 #include "Neon/domain/interface/NghInfo.h"
@@ -7,6 +8,7 @@
 #include "Neon/sys/memory/CudaIntrinsics.h"
 #include "Neon/sys/memory/mem3d.h"
 #include "dCell.h"
+#include "dSpatialLayout.h"
 
 namespace Neon::domain::internal::dGrid {
 
@@ -26,8 +28,25 @@ struct dPartition
     using Cell = dCell;
     using nghIdx_t = int8_3d;
     using Type = T_ta;
+    using ComputeType = Neon::ComputeTypeOf<T_ta>;
     using ePitch_t = Neon::size_4d;
 
+#if defined(NEON_USE_ZERO_COPY_HALO)
+    /**
+     * Memory of a neighbour partition, from where the values of the halo cells
+     * are read in place when zero-copy halos are enabled (see enableZeroCopyHalo)
+     */
+    struct ZeroCopyNgh
+    {
+        const T_ta*    mem = nullptr;
+        ePitch_t       pitch;
+        dSpatialLayout layout;
+        int            zShift = 0; /**< shift from the local z of a halo cell to the local z in the neighbour */
+    };
+    /** Lower and upper neighbours of a partition */
+    using ZeroCopyHalo = std::array<ZeroCopyNgh, 2>;
+#endif
+
    private:
     Neon::DataView m_dataView;
     T_ta*          m_mem;
@@ -41,6 +60,10 @@ struct dPartition
     Neon::index_3d m_fullGridSize;
     bool           mPeriodicZ;
     nghIdx_t*      mStencil;
+    dSpatialLayout mLayout;
+#if defined(NEON_USE_ZERO_COPY_HALO)
+    const ZeroCopyHalo* mZeroCopy = nullptr; /**< owned by the field, so that the partition only grows by a pointer */
+#endif
 
    public:
     dPartition() = default;
@@ -57,7 +80,8 @@ struct dPartition
                         Neon::index_3d origin,
                         int            cardinality,
                         Neon::index_3d fullGridSize,
-                        nghIdx_t*      stencil = nullptr)
+                        nghIdx_t*      stencil = nullptr,
+                        dSpatialLayout layout = dSpatialLayout())
         : m_dataView(dataView),
           m_mem(mem),
           m_dim(dim),
@@ -69,15 +93,57 @@ struct dPartition
           m_cardinality(cardinality),
           m_fullGridSize(fullGridSize),
           mPeriodicZ(false),
-          mStencil(stencil)
+          mStencil(stencil),
+          mLayout(layout)
     {
     }
 
     inline NEON_CUDA_HOST_ONLY auto enablePeriodicAlongZ() -> void
     {
+#if defined(NEON_USE_ZERO_COPY_HALO)
+        if (mZeroCopy != nullptr) {
+            NeonException exp("dPartition");
+            exp << "A periodic partition can not read its halo in place, disable the zero-copy halos of the backend";
+            NEON_THROW(exp);
+        }
+#endif
         mPeriodicZ = true;
     }
 
+#if defined(NEON_USE_ZERO_COPY_HALO)
+    /**
+     * Redirects the reads of the halo cells (nghVal, or nghIdx followed by the const accessor)
+     * to the memory of the neighbour partitions, so that the halo does not have to be updated.
+     * Only for partitions sharing one address space (CPU): the redirection is not compiled in device code.
+     * The neighbours are described in halo, which must outlive the partition and its copies.
+     * A null neighbour keeps the halo of that side. Periodic partitions are not supported.
+     */
+    inline NEON_CUDA_HOST_ONLY auto enableZeroCopyHalo(const self_t* dw,
+                                                       const self_t* up,
+                                                       ZeroCopyHalo& halo) -> void
+    {
+        if (mPeriodicZ) {
+            NeonException exp("dPartition");
+            exp << "Zero-copy halos are not supported by periodic partitions";
+            NEON_THROW(exp);
+        }
+        halo = ZeroCopyHalo();
+        if (dw != nullptr) {
+            halo[0].mem = dw->m_mem;
+            halo[0].pitch = dw->m_pitch;
+            halo[0].layout = dw->mLayout;
+            halo[0].zShift = dw->m_dim.z;
+        }
+        if (up != nullptr) {
+            halo[1].mem = up->m_mem;
+            halo[1].pitch = up->m_pitch;
+            halo[1].layout = up->mLayout;
+            halo[1].zShift = -m_dim.z;
+        }
+        mZeroCopy = &halo;
+    }
+#endif
+
     inline NEON_CUDA_HOST_DEVICE auto prtID() const -> int
     {
         return m_prtID;
@@ -96,10 +162,12 @@ struct dPartition
     inline NEON_CUDA_HOST_DEVICE int64_t elPitch(const Cell& idx,
                                                  int         cardinalityIdx = 0) const
     {
-        return idx.get().x * int64_t(m_pitch.x) +
-               idx.get().y * int64_t(m_pitch.y) +
-               idx.get().z * int64_t(m_pitch.z) +
-               cardinalityIdx * int64_t(m_pitch.w);
+        return helpElPitch(idx.get(), m_pitch, mLayout, cardinalityIdx);
+    }
+
+    inline NEON_CUDA_HOST_DEVICE auto spatialLayout() const -> const dSpatialLayout&
+    {
+        return mLayout;
     }
 
     inline NEON_CUDA_HOST_DEVICE auto dim() const -> const Neon::index_3d
@@ -256,6 +324,18 @@ struct dPartition
     NEON_CUDA_HOST_DEVICE inline auto operator()(const Cell& cell,
                                                  int         cardinalityIdx) const -> const T_ta&
     {
+#if defined(NEON_PLACE_CUDA_HOST) && defined(NEON_USE_ZERO_COPY_HALO)
+        // Halo cells are read from the neighbour partitions when zero-copy halos are enabled
+        if (mZeroCopy != nullptr) {
+            const ZeroCopyHalo& halo = *mZeroCopy;
+            if (halo[0].mem != nullptr && cell.get().z < m_zHaloRadius) {
+                return helpZeroCopyVal(halo[0], cell, cardinalityIdx);
+            }
+            if (halo[1].mem != nullptr && cell.get().z >= m_dim.z + m_zHaloRadius) {
+                return helpZeroCopyVal(halo[1], cell, cardinalityIdx);
+            }
+        }
+#endif
         int64_t p = elPitch(cell, cardinalityIdx);
         return m_mem[p];
     }
@@ -292,5 +372,36 @@ struct dPartition
         return int64_t(size_t(0xffffffffffffffff) - 1);
 #endif
     }
+
+   private:
+    /**
+     * Offset of a cell, the layout is only checked when bricked layouts are compiled in (NEON_USE_SPATIAL_LAYOUT)
+     */
+    static NEON_CUDA_HOST_DEVICE inline auto helpElPitch(const Neon::index_3d&                  idx,
+                                                         const ePitch_t&                        pitch,
+                                                         [[maybe_unused]] const dSpatialLayout& layout,
+                                                         int                                    cardinalityIdx) -> int64_t
+    {
+#if defined(NEON_USE_SPATIAL_LAYOUT)
+        if (!layout.isLinear()) {
+            return layout.elPitch(idx, pitch, cardinalityIdx);
+        }
+#endif
+        return idx.x * int64_t(pitch.x) +
+               idx.y * int64_t(pitch.y) +
+               idx.z * int64_t(pitch.z) +
+               cardinalityIdx * int64_t(pitch.w);
+    }
+
+#if defined(NEON_USE_ZERO_COPY_HALO)
+    static NEON_CUDA_HOST_ONLY inline auto helpZeroCopyVal(const ZeroCopyNgh& ngh,
+                                                           const Cell&        cellNgh,
+                                                           int                card) -> const T_ta&
+    {
+        Neon::index_3d idx = cellNgh.get();
+        idx.z += ngh.zShift;
+        return ngh.mem[helpElPitch(idx, ngh.pitch, ngh.layout, card)];
+    }
+#endif
 };
 }  // namespace Neon::domain::internal::dGrid
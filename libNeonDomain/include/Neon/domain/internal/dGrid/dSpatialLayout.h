@@ -0,0 +1,231 @@
+#pragma once
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "Neon/core/core.h"
+#include "Neon/core/types/Macros.h"
+
+namespace Neon::domain::internal::dGrid {
+
+/**
+ * Mapping between the cells of a dPartition and their position in memory (see Neon::SpatialLayout).
+ *
+ * The z slices of a partition are split in three regions:
+ * [0, mZBegin) and [mZEnd, zSize) are stored linearly (x fastest),
+ * [mZBegin, mZEnd) is stored in bricks.
+ * For multi-partition fields, the linear regions are the halo and boundary slices,
+ * therefore halo updates and data view based operations keep working on contiguous memory.
+ * Bricks on the border of the partition are padded, padding cells are never read nor written.
+ *
+ * Bricked layouts are only compiled in when NEON_USE_SPATIAL_LAYOUT is defined,
+ * otherwise dPartition addresses the cells linearly without checking the layout.
+ *
+ * All offsets stored in this class are expressed in number of cells.
+ */
+struct dSpatialLayout
+{
+    int            mBrickLog2 = 0 /**< log2 of the brick edge, 0 for the linear layout */;
+    int            mZBegin = 0 /**< first z slice stored in bricks */;
+    int            mZEnd = 0 /**< first z slice stored linearly after the bricks */;
+    Neon::index_3d mDim = Neon::index_3d(0, 0, 0) /**< partition dimension, halo excluded */;
+    Neon::index_3d mNBricks = Neon::index_3d(0, 0, 0) /**< number of bricks in each direction */;
+    int64_t        mSliceSize = 0 /**< number of cells in a z slice */;
+    int64_t        mBrickedBase = 0 /**< offset of the first brick */;
+    int64_t        mLinearHighBase = 0 /**< offset of slice mZEnd */;
+    int64_t        mNCells = 0 /**< number of cells, padding included */;
+    const int32_t* mBrickRank = nullptr /**< position of each brick when bricks are not in linear order */;
+
+    /**
+     * Creates the layout of a partition.
+     */
+    static auto factory(Neon::SpatialLayout   layout /**< [in] requested layout */,
+                        const Neon::index_3d& dim /**< [in] partition dimension, halo excluded */,
+                        int                   haloRadius /**< [in] number of halo slices on each side */,
+                        int                   boundaryRadius /**< [in] number of boundary slices on each side */)
+        -> dSpatialLayout
+    {
+        dSpatialLayout res;
+        const int      zSize = dim.z + 2 * haloRadius;
+        res.mBrickLog2 = Neon::SpatialLayoutUtils::brickLog2(layout);
+        res.mDim = dim;
+        res.mSliceSize = int64_t(dim.x) * int64_t(dim.y);
+
+        if (res.mBrickLog2 == 0) {
+            res.mZBegin = zSize;
+            res.mZEnd = zSize;
+        } else {
+            const int linearRadius = haloRadius > 0 ? haloRadius + boundaryRadius : 0;
+            res.mZBegin = linearRadius;
+            res.mZEnd = std::max(res.mZBegin, zSize - linearRadius);
+        }
+
+        const int brickEdge = 1 << res.mBrickLog2;
+        res.mNBricks = Neon::index_3d((dim.x + brickEdge - 1) >> res.mBrickLog2,
+                                      (dim.y + brickEdge - 1) >> res.mBrickLog2,
+                                      (res.mZEnd - res.mZBegin + brickEdge - 1) >> res.mBrickLog2);
+
+        res.mBrickedBase = int64_t(res.mZBegin) * res.mSliceSize;
+        res.mLinearHighBase = res.mBrickedBase + (res.nBricks() << (3 * res.mBrickLog2));
+        res.mNCells = res.mLinearHighBase + int64_t(zSize - res.mZEnd) * res.mSliceSize;
+        return res;
+    }
+
+    /**
+     * Returns for each brick (in linear order) its position along the Morton curve.
+     */
+    static auto mortonRank(const Neon::index_3d& nBricks) -> std::vector<int32_t>
+    {
+        auto spread = [](uint64_t v) -> uint64_t {
+            v &= 0x1fffff;
+            v = (v | v << 32) & 0x1f00000000ffff;
+            v = (v | v << 16) & 0x1f0000ff0000ff;
+            v = (v | v << 8) & 0x100f00f00f00f00f;
+            v = (v | v << 4) & 0x10c30c30c30c30c3;
+            v = (v | v << 2) & 0x1249249249249249;
+            return v;
+        };
+
+        const int64_t         n = nBricks.rMulTyped<int64_t>();
+        std::vector<uint64_t> code(n);
+        for (int64_t i = 0; i < n; i++) {
+            const uint64_t x = uint64_t(i % nBricks.x);
+            const uint64_t y = uint64_t((i / nBricks.x) % nBricks.y);
+            const uint64_t z = uint64_t(i / (int64_t(nBricks.x) * nBricks.y));
+            code[i] = spread(x) | (spread(y) << 1) | (spread(z) << 2);
+        }
+
+        std::vector<int32_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](int32_t a, int32_t b) { return code[a] < code[b]; });
+
+        std::vector<int32_t> rank(n);
+        for (int64_t r = 0; r < n; r++) {
+            rank[order[r]] = int32_t(r);
+        }
+        return rank;
+    }
+
+    /**
+     * Returns the total number of bricks
+     */
+    auto nBricks() const -> int64_t
+    {
+        return mNBricks.rMulTyped<int64_t>();
+    }
+
+    /**
+     * Returns the offset of the first cell of slice z.
+     * Only valid for slices that are stored linearly or that start the bricked region.
+     */
+    auto sliceOffset(int z) const -> int64_t
+    {
+        if (z <= mZBegin) {
+            return int64_t(z) * mSliceSize;
+        }
+        return mLinearHighBase + int64_t(z - mZEnd) * mSliceSize;
+    }
+
+    /**
+     * Returns the ranges of memory, as pairs (offset, number of cells), that store the cells of slices [zFirst, zLast).
+     * Padding cells are excluded and contiguous ranges are merged, so a linear layout always returns a single range.
+     */
+    auto dataRuns(int                         zFirst,
+                  int                         zLast,
+                  const std::vector<int32_t>& rank /**< [in] output of mortonRank, empty if bricks are in linear order */) const
+        -> std::vector<std::pair<int64_t, int64_t>>
+    {
+        std::vector<std::pair<int64_t, int64_t>> runs;
+        auto                                     add = [&runs](int64_t offset, int64_t count) {
+            if (count <= 0) {
+                return;
+            }
+            if (!runs.empty() && runs.back().first + runs.back().second == offset) {
+                runs.back().second += count;
+                return;
+            }
+            runs.emplace_back(offset, count);
+        };
+
+        // Linear slices before the bricks
+        add(int64_t(zFirst) * mSliceSize, int64_t(std::min(zLast, mZBegin) - zFirst) * mSliceSize);
+
+        // Bricks in the order they are stored, z is relative to the first bricked slice
+        const int zBegin = std::max(zFirst, mZBegin) - mZBegin;
+        const int zEnd = std::min(zLast, mZEnd) - mZBegin;
+        if (zEnd > zBegin) {
+            const int64_t        n = nBricks();
+            const int            edge = 1 << mBrickLog2;
+            std::vector<int64_t> brickAt(n);
+            for (int64_t b = 0; b < n; b++) {
+                brickAt[rank.empty() ? b : rank[b]] = b;
+            }
+            for (int64_t r = 0; r < n; r++) {
+                const int64_t b = brickAt[r];
+                const int     x0 = int(b % mNBricks.x) << mBrickLog2;
+                const int     y0 = int((b / mNBricks.x) % mNBricks.y) << mBrickLog2;
+                const int     z0 = int(b / (int64_t(mNBricks.x) * mNBricks.y)) << mBrickLog2;
+                const int     nx = std::min(edge, mDim.x - x0);
+                const int     ny = std::min(edge, mDim.y - y0);
+                const int     zb = std::max(z0, zBegin) - z0;
+                const int     ze = std::min(z0 + edge, zEnd) - z0;
+                const int64_t base = mBrickedBase + (r << (3 * mBrickLog2));
+                for (int z = zb; z < ze; z++) {
+                    for (int y = 0; y < ny; y++) {
+                        add(base + (int64_t(y) << mBrickLog2) + (int64_t(z) << (2 * mBrickLog2)), nx);
+                    }
+                }
+            }
+        }
+
+        // Linear slices after the bricks
+        const int zHigh = std::max(zFirst, mZEnd);
+        add(mLinearHighBase + int64_t(zHigh - mZEnd) * mSliceSize, int64_t(zLast - zHigh) * mSliceSize);
+        return runs;
+    }
+
+    NEON_CUDA_HOST_DEVICE inline auto isLinear() const -> bool
+    {
+        return mBrickLog2 == 0;
+    }
+
+    /**
+     * Returns the offset, in number of elements, of component cardinalityIdx of a cell
+     */
+    NEON_CUDA_HOST_DEVICE inline auto elPitch(const Neon::index_3d& cell,
+                                              const Neon::size_4d&  pitch,
+                                              int                   cardinalityIdx) const -> int64_t
+    {
+        const int64_t cardOffset = cardinalityIdx * int64_t(pitch.w);
+        if (cell.z < mZBegin) {
+            return cell.x * int64_t(pitch.x) +
+                   cell.y * int64_t(pitch.y) +
+                   cell.z * int64_t(pitch.z) +
+                   cardOffset;
+        }
+        if (cell.z >= mZEnd) {
+            return mLinearHighBase * int64_t(pitch.x) +
+                   cell.x * int64_t(pitch.x) +
+                   cell.y * int64_t(pitch.y) +
+                   (cell.z - mZEnd) * int64_t(pitch.z) +
+                   cardOffset;
+        }
+        const int z = cell.z - mZBegin;
+        const int mask = (1 << mBrickLog2) - 1;
+
+        int64_t brick = (cell.x >> mBrickLog2) +
+                        (cell.y >> mBrickLog2) * int64_t(mNBricks.x) +
+                        (z >> mBrickLog2) * int64_t(mNBricks.x) * int64_t(mNBricks.y);
+        if (mBrickRank != nullptr) {
+            brick = mBrickRank[brick];
+        }
+        const int64_t inBrick = (cell.x & mask) |
+                                ((cell.y & mask) << mBrickLog2) |
+                                ((z & mask) << (2 * mBrickLog2));
+
+        return (mBrickedBase + (brick << (3 * mBrickLog2)) + inBrick) * int64_t(pitch.x) + cardOffset;
+    }
+};
+
+}  // namespace Neon::domain::internal::dGrid
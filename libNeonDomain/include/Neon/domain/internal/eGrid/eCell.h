@@ -29,6 +29,12 @@ struct eCell
 
     eCell() = default;
 
+    /**
+     * Position of the cell in the storage of its partition.
+     * sGrid uses it to sort its cells following the memory layout of eGrid.
+     */
+    NEON_CUDA_HOST_DEVICE inline auto getStorageOffset() const -> Offset;
+
    private:
     Location mLocation = 0;
 
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Neon/core/core.h"
+
+namespace Neon::domain::internal::eGrid {
+
+/**
+ * Order of the local indices of the active cells of an eGrid partition.
+ * Cells are renumbered inside the internal and the boundary regions of each partition,
+ * the partitioning itself does not change.
+ *
+ * - scan: x is the fastest index, then y, then z (order of the flat partitioning).
+ * - morton: cells follow the Morton (Z-order) curve.
+ * - hilbert: cells follow the Hilbert curve.
+ * - rcm: reverse Cuthill-McKee ordering of the connectivity graph of the partition.
+ *
+ * Neighbour accesses of stencil operations on irregular domains are closer in memory
+ * with the locality preserving orderings.
+ */
+enum class CellOrdering
+{
+    scan = 0,
+    morton = 1,
+    hilbert = 2,
+    rcm = 3
+};
+
+class CellOrderingUtils
+{
+   public:
+    static constexpr int nConfig{4};
+
+    static auto toString(const CellOrdering& config) -> const char*;
+    static auto toInt(const CellOrdering& config) -> int;
+    static auto fromInt(const int& config) -> CellOrdering;
+    static auto fromString(const std::string& config) -> CellOrdering;
+
+    /**
+     * Position of a cell along the Morton curve (21 bits per axis).
+     */
+    static auto mortonCode(const Neon::index_3d& idx) -> uint64_t;
+
+    /**
+     * Position of a cell along the Hilbert curve of a cube of side 2^nBits (nBits <= 21).
+     */
+    static auto hilbertCode(const Neon::index_3d& idx, int nBits) -> uint64_t;
+
+    /**
+     * Reverse Cuthill-McKee ordering of an undirected graph in CSR format.
+     * Returns the vertices in their new order.
+     * Each connected component starts from a vertex of minimum degree,
+     * neighbours are visited by increasing degree.
+     */
+    static auto reverseCuthillMcKee(const std::vector<int64_t>& offsets /**< [in] nVertices + 1 offsets */,
+                                    const std::vector<int64_t>& neighbours /**< [in] adjacency lists */)
+        -> std::vector<int64_t>;
+};
+
+}  // namespace Neon::domain::internal::eGrid
@@ -17,4 +17,9 @@ NEON_CUDA_HOST_DEVICE inline auto eCell::get() -> const Location&
     return mLocation;
 }
 
+NEON_CUDA_HOST_DEVICE inline auto eCell::getStorageOffset() const -> Offset
+{
+    return mLocation;
+}
+
 }  // namespace Neon::domain::internal::eGrid
\ No newline at end of file
@@ -41,5 +41,37 @@ struct indexing_e
     };
 };
 
+/**
+ * Storage of the eGrid connectivity table.
+ *
+ * - full: one int32_t per neighbour per cell, the local index of the neighbour.
+ * - compact: one int16_t per neighbour per cell. For each stencil direction, the partition stores
+ *   the most frequent difference between the index of a neighbour and the index of the cell.
+ *   The table stores the remainder with respect to it, so it is zero for most of the cells.
+ *   Remainders that do not fit in 16 bits are stored in a sorted overflow table.
+ *   Neighbours are decoded on the fly by ePartition::nghIdx.
+ */
+enum class ConnectivityMode
+{
+    full = 0,
+    compact = 1
+};
+
+/**
+ * Device view of a compact connectivity table (see ConnectivityMode::compact)
+ */
+struct eCompactConnectivity
+{
+    static constexpr int16_t invalid = -32768 /**< no neighbour */;
+    static constexpr int16_t escape = -32767 /**< the neighbour is stored in the overflow table */;
+
+    const int16_t* delta = nullptr /**< remainder of each neighbour, same layout of the full table */;
+    ePitch_t       pitch /**< pitch of the delta table */;
+    const int32_t* base = nullptr /**< most frequent difference for each stencil direction */;
+    const int32_t* overflowKey = nullptr /**< sorted offsets, in the delta table, of the escaped neighbours */;
+    const int32_t* overflowVal = nullptr /**< local index of the escaped neighbours */;
+    int32_t        nOverflow = 0;
+};
+
 }  // namespace eGrid
 
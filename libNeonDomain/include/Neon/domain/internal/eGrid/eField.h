@@ -36,6 +36,7 @@ class eField : public Neon::domain::interface::FieldBaseTemplate<T,
     // Neon aliases
     using Self = eField<T, C>; /** Self */
     using Type = T;            /** type of the elements contained by the field */
+    using ComputeType = Neon::ComputeTypeOf<T>; /** type used to compute on the elements (see Neon::StorageTypeTraits) */
     static const int Cardinality = C;
 
     // GRID, FIELDS and LOCAL aliases
@@ -144,6 +145,16 @@ class eField : public Neon::domain::interface::FieldBaseTemplate<T,
 
     static auto swap(Field& A, Field& B) -> void;
 
+   protected:
+    /**
+     * Visits the active cells through the inverse mapping of the partitions instead of sweeping the bounding box
+     */
+    auto helpForEachActiveCell(const std::function<void(const Neon::index_3d&,
+                                                        const int& cardinality,
+                                                        T&)>& fun,
+                               Neon::computeMode_t::computeMode_e mode)
+        -> void final;
+
    private:
     /**
      * Construction by composition
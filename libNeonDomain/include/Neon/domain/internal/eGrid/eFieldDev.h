@@ -56,6 +56,7 @@ class eFieldDevice_t
         Neon::memLayout_et::order_e           memOrder;
         Neon::sys::MemAlignment               memAlignment;
         Neon::memLayout_et::padding_e         memPadding;
+        bool                                  zeroCopyHalo = false; /**< ghost values are read in place from the neighbour partitions */
 
         // COMPUTED
         Neon::set::MemDevSet<element_t>                                      memoryStorage;
@@ -327,6 +328,39 @@ class eFieldDevice_t
         return info.isActive();
     }
 
+    /**
+     * Runs fn(idx, cardinality, value) on the active cells of all the partitions.
+     * Cells are found through the inverse mapping (local index to 3D index) of each partition,
+     * so the work is proportional to the number of active cells, whatever the size of the bounding box.
+     * @param fn Function run on each cardinality of each active cell
+     * @param parallel Whether the cells of a partition are visited by parallel threads
+     */
+    template <typename Fn>
+    auto forEachActiveCell(Fn fn, bool parallel)
+        -> void
+    {
+        if (m_data->devType != Neon::DeviceType::CPU) {
+            NeonException exc("eField");
+            exc << "forEachActiveCell cannot be called on a GPU field.";
+            NEON_THROW(exc);
+        }
+        const auto& frame = *m_data->frame_shp;
+        const auto& inverse = frame.inverseMapping(Neon::DeviceType::CPU);
+        for (int prtIdx = 0; prtIdx < frame.nPartitions(); prtIdx++) {
+            const int64_t nElements = int64_t(frame.localIndexingInfo(prtIdx).nElements(false));
+            auto          memStorage = m_data->memoryStorage.template get<Neon::Access::readWrite>(prtIdx);
+#pragma omp parallel for if (parallel)
+            for (int64_t localIdx = 0; localIdx < nElements; localIdx++) {
+                const Neon::index_3d idx(inverse.elRef(prtIdx, localIdx, index_3d::x_axis),
+                                         inverse.elRef(prtIdx, localIdx, index_3d::y_axis),
+                                         inverse.elRef(prtIdx, localIdx, index_3d::z_axis));
+                for (int c = 0; c < m_data->cardinality; c++) {
+                    fn(idx, c, memStorage.template elRef<Neon::Access::readWrite>(localIdx, c));
+                }
+            }
+        }
+    }
+
     /**
      * Updating halo for all cardinality of the field at once.
      */
@@ -348,6 +382,16 @@ class eFieldDevice_t
             return;
         }
 
+        /**
+         * With zero-copy halos the update is only a barrier.
+         */
+        if (m_data->zeroCopyHalo) {
+            if (startWithBarrier) {
+                bk.sync(streamSetIdx);
+            }
+            return;
+        }
+
         switch (m_data->memOrder) {
             case Neon::memLayout_et::order_e::structOfArrays: {
                 {
@@ -427,7 +471,7 @@ class eFieldDevice_t
                             if (transferEl > 0) {
                                 switch (m_data->devType) {
                                     case Neon::DeviceType::CPU: {
-                                        std::memcpy(dstBuf, srcBuf, transferEl * sizeof(T_ta));
+                                        m_data->devSet.hostTransfer(dstIdx, (char*)dstBuf, srcIdx[comDirection], (const char*)srcBuf, transferEl * sizeof(T_ta));
                                         break;
                                     }
                                     case Neon::DeviceType::CUDA: {
@@ -485,6 +529,11 @@ class eFieldDevice_t
             bk.sync(opt.streamSetIdx());
         }
 
+        // Ghost values are read in place from the neighbour partitions: nothing to transfer
+        if (m_data->zeroCopyHalo) {
+            return;
+        }
+
         // Different behaviour base on the data layout
         switch (m_data->memOrder) {
             case Neon::memLayout_et::order_e::structOfArrays: {
@@ -604,6 +653,9 @@ class eFieldDevice_t
                 bk.sync(streamSetIdx);
             }
         }
+        if (m_data->zeroCopyHalo) {
+            return;
+        }
         {
             int ndevs = m_data->devSet.setCardinality();
 #pragma omp parallel for num_threads(ndevs) default(shared)
@@ -636,6 +688,16 @@ class eFieldDevice_t
             return;
         }
 
+        /**
+         * With zero-copy halos the update is only a barrier.
+         */
+        if (m_data->zeroCopyHalo) {
+            if (huOptions.startWithBarrier()) {
+                bk.sync(huOptions.streamSetIdx());
+            }
+            return;
+        }
+
         switch (m_data->memOrder) {
             case Neon::memLayout_et::order_e::structOfArrays: {
                 {
@@ -776,7 +838,7 @@ class eFieldDevice_t
             if (transferEl > 0) {
                 switch (m_data->devType) {
                     case Neon::DeviceType::CPU: {
-                        std::memcpy(dstBuf, srcBuf, transferEl * sizeof(T_ta));
+                        m_data->devSet.hostTransfer(dstIdx, (char*)dstBuf, srcIdx, (const char*)srcBuf, transferEl * sizeof(T_ta));
                         break;
                     }
                     case Neon::DeviceType::CUDA: {
@@ -1292,8 +1354,9 @@ class eFieldDevice_t
             std::array<count_t, ComDirection_e::COM_NUM> ghostCount = {indexingInfo.remoteBdrCount(ComDirection_e::COM_DW),
                                                                        indexingInfo.remoteBdrCount(ComDirection_e::COM_UP)};
 
-            int32_t*   con = m_data->frame_shp->connectivity(m_data->devType).mem(gpuIdx);
-            index64_2d conPitch = m_data->frame_shp->connectivity(m_data->devType).get(gpuIdx).pitch();
+            const bool isCompact = m_data->frame_shp->isConnectivityCompact();
+            int32_t*   con = isCompact ? nullptr : m_data->frame_shp->connectivity(m_data->devType).mem(gpuIdx);
+            index64_2d conPitch = isCompact ? index64_2d(0, 0) : m_data->frame_shp->connectivity(m_data->devType).get(gpuIdx).pitch();
             index_t*   inverseMapping = m_data->frame_shp->inverseMapping(m_data->devType).mem(gpuIdx);
 
             for (int DataViewIdx = 0; DataViewIdx < Neon::DataViewUtil::nConfig; DataViewIdx++) {
@@ -1305,6 +1368,36 @@ class eFieldDevice_t
                                                                       bdrCount, ghostCount,
                                                                       con, conPitch,
                                                                       inverseMapping);
+                if (isCompact) {
+                    m_data->localSetByView[DataViewIdx][gpuIdx].hSetCompactConnectivity(
+                        m_data->frame_shp->compactConnectivity(m_data->devType, gpuIdx));
+                }
+            }
+        }
+
+        // With zero-copy halos the partitions read the ghost cells from the boundary cells of their neighbours
+        const int nDevs = m_data->devSet.setCardinality();
+        m_data->zeroCopyHalo = m_data->grid->getBackend().hasCpuZeroCopyHalo() &&
+                               m_data->devType == Neon::DeviceType::CPU &&
+                               m_data->haloStatus == Neon::domain::haloStatus_et::ON &&
+                               nDevs > 1;
+        if (m_data->zeroCopyHalo) {
+            for (int gpuIdx = 0; gpuIdx < nDevs; gpuIdx++) {
+                const LocalIndexingInfo_t& indexingInfo = m_data->frame_shp->localIndexingInfo(gpuIdx);
+                for (const auto& comDirection : {ComDirection_e::COM_DW, ComDirection_e::COM_UP}) {
+                    // As for the SoA halo update, every direction with ghost cells is served by its neighbour:
+                    // with two partitions the ghost cells are not necessarily in the UP direction of partition 0
+                    if (indexingInfo.remoteBdrCount(comDirection) == 0) {
+                        continue;
+                    }
+                    const int srcIdx = indexingInfo.nghIdx(comDirection);
+                    for (int DataViewIdx = 0; DataViewIdx < Neon::DataViewUtil::nConfig; DataViewIdx++) {
+                        m_data->localSetByView[DataViewIdx][gpuIdx].hSetZeroCopyHalo(comDirection,
+                                                                                     m_data->userPointersSet[srcIdx],
+                                                                                     m_data->memoryStorage.get(srcIdx).pitch(),
+                                                                                     indexingInfo.remoteBdrOff(comDirection));
+                    }
+                }
             }
         }
     }
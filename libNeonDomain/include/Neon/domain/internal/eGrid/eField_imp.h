@@ -72,6 +72,21 @@ auto eField<T, C>::getReference(const Neon::index_3d& idx,
     return mCpu.eRef(idx, cardinality);
 }
 
+template <typename T, int C>
+auto eField<T, C>::helpForEachActiveCell(const std::function<void(const Neon::index_3d&,
+                                                                  const int& cardinality,
+                                                                  T&)>& fun,
+                                         Neon::computeMode_t::computeMode_e mode)
+    -> void
+{
+    if (mCpu.devType() == Neon::DeviceType::NONE) {
+        NeonException exc("eField");
+        exc << "forEachActiveCell can not be run on a GPU field.";
+        NEON_THROW(exc);
+    }
+    mCpu.forEachActiveCell(fun, mode == Neon::computeMode_t::computeMode_e::par);
+}
+
 template <typename T, int C>
 auto eField<T, C>::self() -> Self&
 {
@@ -15,6 +15,7 @@
 #include "Neon/domain/interface/LaunchConfig.h"
 #include "Neon/domain/interface/Stencil.h"
 #include "Neon/domain/interface/common.h"
+#include "Neon/domain/internal/eGrid/eCellOrdering.h"
 #include "Neon/domain/internal/eGrid/eInternals/dsBuilder.h"
 #include "Neon/domain/patterns/PatternScalar.h"
 #include "ePartition.h"
@@ -55,6 +56,8 @@ class eGrid : public Neon::domain::interface::GridBaseTemplate<eGrid, eCell>
      * @param implicitF: a sparsity map defined over the background grid. True means the element is active
      * @param stencil: stencil that will be used over the grid.
      * @param includeInveseMappingField
+     * @param cellOrdering: order of the local indices of the cells in each partition
+     * @param connectivityMode: storage of the neighbour table, see ConnectivityMode
      */
     template <typename ActiveCellLambda>
     eGrid(const Neon::Backend&         backend,
@@ -63,7 +66,33 @@ class eGrid : public Neon::domain::interface::GridBaseTemplate<eGrid, eCell>
           const Neon::domain::Stencil& stencil,
           const Vec_3d<double>&        spacingData = Vec_3d<double>(1, 1, 1) /**< Spacing, i.e. size of a voxel */,
           const Vec_3d<double>&        origin = Vec_3d<double>(0, 0, 0) /**<      Origin  */,
-          bool                         includeInveseMappingField = false);
+          bool                         includeInveseMappingField = false,
+          CellOrdering                 cellOrdering = CellOrdering::scan,
+          ConnectivityMode             connectivityMode = ConnectivityMode::full);
+
+    /**
+     * Constructor for an eGrid object defined by the list of its active cells.
+     * Memory and construction time are proportional to the number of active cells
+     * instead of the size of the background grid: no dense map of the domain is allocated.
+     * Duplicated cells are merged, cells outside cellDomain raise an exception.
+     *
+     * @param backend
+     * @param cellDomain: size of the background grid
+     * @param activeCells: 3D indices of the active cells
+     * @param stencil: stencil that will be used over the grid.
+     * @param includeInveseMappingField
+     * @param cellOrdering: order of the local indices of the cells in each partition
+     * @param connectivityMode: storage of the neighbour table, see ConnectivityMode
+     */
+    eGrid(const Neon::Backend&               backend,
+          const Neon::index_3d&              cellDomain,
+          const std::vector<Neon::index_3d>& activeCells,
+          const Neon::domain::Stencil&       stencil,
+          const Vec_3d<double>&              spacingData = Vec_3d<double>(1, 1, 1) /**< Spacing, i.e. size of a voxel */,
+          const Vec_3d<double>&              origin = Vec_3d<double>(0, 0, 0) /**<      Origin  */,
+          bool                               includeInveseMappingField = false,
+          CellOrdering                       cellOrdering = CellOrdering::scan,
+          ConnectivityMode                   connectivityMode = ConnectivityMode::full);
 
     /**
      * Returns a LaunchParameters configured for the specified inputs
@@ -133,6 +162,13 @@ class eGrid : public Neon::domain::interface::GridBaseTemplate<eGrid, eCell>
     auto getProperties(const Neon::index_3d& idx) const
         -> GridBaseTemplate::CellProperties final;
 
+    /**
+     * Returns the number of bytes used by the connectivity table and by the inverse mapping
+     * over all the partitions, excluding the halo.
+     */
+    auto getConnectivityBytes() const
+        -> size_t;
+
    private:
     using GridBaseTemplate = Neon::domain::interface::GridBaseTemplate<eGrid, eCell>;
 
@@ -194,6 +230,16 @@ class eGrid : public Neon::domain::interface::GridBaseTemplate<eGrid, eCell>
     auto setKernelConfig(Neon::domain::KernelConfig& gridKernelConfig) const
         -> void;
 
+    /**
+     * Completes the initialization once the builder has computed the partitioning
+     */
+    auto helpInitFromBuilder(const Neon::Backend&         backend,
+                             const Neon::index_3d&        cellDomain,
+                             const Neon::domain::Stencil& stencil,
+                             const Vec_3d<double>&        spacingData,
+                             const Vec_3d<double>&        origin)
+        -> void;
+
     /**
      * Private function to set the default size of CUDA blocks
      * @param blockDim
@@ -10,7 +10,9 @@ eGrid::eGrid(const Neon::Backend&         backend,
              const Neon::domain::Stencil& stencil,
              const Vec_3d<double>&        spacingData,
              const Vec_3d<double>&        origin,
-             bool                         includeInveseMappingField)
+             bool                         includeInveseMappingField,
+             CellOrdering                 cellOrdering,
+             ConnectivityMode             connectivityMode)
 {
     auto                 nElementsPerPartition = backend.devSet().template newDataSet<size_t>(0);
     const Neon::index_3d defaultsBlockDim(512, 1, 1);
@@ -35,99 +37,13 @@ eGrid::eGrid(const Neon::Backend&         backend,
                                             cellDomain,
                                             activeCellLambda,
                                             getDevSet().setCardinality(),
-                                            stencil);
+                                            stencil,
+                                            cellOrdering,
+                                            connectivityMode);
 
-    auto initCellClassification = [this, &nElementsPerPartition]() -> void {
-        m_ds->getCount(Neon::DataView::STANDARD) = getDevSet().newDataSet<count_t>();
-        m_ds->getCount(Neon::DataView::INTERNAL) = getDevSet().newDataSet<count_t>();
-        m_ds->getCount(Neon::DataView::BOUNDARY) = getDevSet().newDataSet<count_t>();
-
-        for (int i = 0; i < getDevSet().setCardinality(); i++) {
-            m_ds->getCountPerDevice(Neon::DataView::STANDARD, i) = m_ds->builder.frame()->localIndexingInfo(i).nElements(false);
-            m_ds->getCountPerDevice(Neon::DataView::INTERNAL, i) = m_ds->builder.frame()->localIndexingInfo(i).internalCount();
-            m_ds->getCountPerDevice(Neon::DataView::BOUNDARY, i) = m_ds->builder.frame()->localIndexingInfo(i).bdrCount();
-
-            nElementsPerPartition[i] = m_ds->getCountPerDevice(Neon::DataView::STANDARD, i);
-        }
-    };
-
-    auto initDefaultLaunchParameters = [this]() -> void {
-        if (getDefaultBlock().y != 1 || getDefaultBlock().z != 1) {
-            NeonException exc("eGrid");
-            exc << "CUDA block size should be 1D\n";
-            NEON_THROW(exc);
-        }
-
-        for (int i = 0; i < getDevSet().setCardinality(); i++) {
-            for (auto indexing : DataViewUtil::validOptions()) {
-
-                auto gridMode = Neon::sys::GpuLaunchInfo::mode_e::domainGridMode;
-                auto gridDim = m_ds->getCount(indexing)[i];
-                getDefaultLaunchParameters(indexing)[i].set(gridMode, gridDim, getDefaultBlock(), 0);
-            }
-        }
-    };
-
-    auto inverseMappingField = [this]() -> void {
-        Neon::Backend bk(getDevSet(), Neon::Runtime::openmp);
-        if (getDevSet().type() == Neon::DeviceType::CUDA) {
-            bk = Neon::Backend(getDevSet(), Neon::Runtime::stream);
-        }
-
-        if (m_ds->inverseMappingEnabled) {
-            //            const int cardinality = 3;
-            //            m_ds->inverseMappingFieldMirror = this->newField<index_t, cardinality>({bk,
-            //                                                                                    Neon::DataUse::IO_COMPUTE},
-            //                                                                                   haloStatus_et::OFF,
-            //                                                                                   cardinality, -1);
-            //
-            //            m_ds->inverseMappingFieldMirror.cpu().forEachActive([](const index_3d& idx3d, const int card, index_t& val) {
-            //                val = idx3d.v[card];
-            //            });
-            //            m_ds->inverseMappingFieldMirror.updateCompute(getDevSet().defaultStreamSet());
-            NEON_DEV_UNDER_CONSTRUCTION("");
-        }
-    };
-
-    auto initPartitionIndexSpace = [this]() {
-        for (auto& dw : Neon::DataViewUtil::validOptions()) {
-            m_ds->getPartitionIndexSpace(dw) = this->getDevSet().newDataSet<ePartitionIndexSpace>();
-
-            for (int gpuIdx = 0; gpuIdx < this->getDevSet().setCardinality(); gpuIdx++) {
-                const auto& indexingInfo = m_ds->builder.frame()->localIndexingInfo(gpuIdx);
-
-                std::array<Cell::Offset, ComDirection_e::COM_NUM> bdrOff = {indexingInfo.bdrOff(ComDirection_e::COM_DW),
-                                                                            indexingInfo.bdrOff(ComDirection_e::COM_UP)};
-                std::array<Cell::Offset, ComDirection_e::COM_NUM> ghostOff = {indexingInfo.ghostOff(ComDirection_e::COM_DW),
-                                                                              indexingInfo.ghostOff(ComDirection_e::COM_UP)};
-
-                m_ds->getPartitionIndexSpace(dw)[gpuIdx].hGetBoundaryOffset()[ComDirection_e::COM_UP] = bdrOff[ComDirection_e::COM_UP];
-                m_ds->getPartitionIndexSpace(dw)[gpuIdx].hGetBoundaryOffset()[ComDirection_e::COM_DW] = bdrOff[ComDirection_e::COM_DW];
-
-                m_ds->getPartitionIndexSpace(dw)[gpuIdx].hgetGhostOffset()[ComDirection_e::COM_UP] = ghostOff[ComDirection_e::COM_UP];
-                m_ds->getPartitionIndexSpace(dw)[gpuIdx].hgetGhostOffset()[ComDirection_e::COM_DW] = ghostOff[ComDirection_e::COM_DW];
-
-                m_ds->getPartitionIndexSpace(dw)[gpuIdx].hGetDataView() = dw;
-            }
-        }
-    };
-
-    initCellClassification();
-    initDefaultLaunchParameters();
-    inverseMappingField();
-    initPartitionIndexSpace();
-
-    eGrid::GridBaseTemplate::init("eGrid",
-                                  backend,
-                                  cellDomain,
-                                  stencil,
-                                  nElementsPerPartition,
-                                  defaultsBlockDim,
-                                  spacingData,
-                                  origin);
+    helpInitFromBuilder(backend, cellDomain, stencil, spacingData, origin);
 }
 
-
 template <typename T, int C>
 auto eGrid::newField(const std::string&  fieldUserName,
                      int                 cardinality,
@@ -142,6 +58,12 @@ auto eGrid::newField(const std::string&  fieldUserName,
         NeonException exception("Dynamic and static setCardinality do not match.");
         NEON_THROW(exception);
     }
+    if (memoryOptions.getSpatialLayout() != Neon::SpatialLayout::linear) {
+        NeonException exception("eGrid::newField");
+        exception << "Spatial layout " << Neon::SpatialLayoutUtils::toString(memoryOptions.getSpatialLayout())
+                  << " is not supported, only dGrid supports bricked layouts.";
+        NEON_THROW(exception);
+    }
 
     auto helpNewFieldDev = [this](Neon::sys::memConf_t           memConf,
                                   int                            cardinality,
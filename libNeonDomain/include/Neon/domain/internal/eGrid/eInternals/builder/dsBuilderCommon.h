@@ -1,7 +1,9 @@
 #pragma once
 #include <assert.h>
 
+#include <algorithm>
 #include <functional>
+#include <vector>
 
 #include "Neon/domain/interface/common.h"
 #include "Neon/domain/interface/Stencil.h"
@@ -546,6 +548,126 @@ struct elmLocalInfo_t
 };
 
 
+/**
+ * Map from the global (pitched) index of a cell of the background grid to its elmLocalInfo_t.
+ *
+ * Two storage modes are supported:
+ * 1. dense: one entry per cell of the background grid, used when the active cells are defined by a lambda.
+ * 2. sparse: one entry per active cell, stored with the sorted global indices of the active cells.
+ *    Lookups are done by binary search and the memory is proportional to the number of active cells.
+ *
+ * Cells that are not in the map are inactive.
+ */
+class GlobalToLocal_t
+{
+   public:
+    GlobalToLocal_t() = default;
+
+    /**
+     * Dense map over the whole domain, all cells are inactive
+     */
+    explicit GlobalToLocal_t(const Neon::index_3d& domain)
+        : m_domain(domain),
+          m_isSparse(false),
+          m_info(domain.rMulTyped<size_t>(), elmLocalInfo_t(global_et::inactive))
+    {
+    }
+
+    /**
+     * Sparse map, sortedActiveIds are the global indices of the active cells, sorted and without duplicates
+     */
+    GlobalToLocal_t(const Neon::index_3d& domain, std::vector<global_idx> sortedActiveIds)
+        : m_domain(domain),
+          m_isSparse(true),
+          m_activeIds(std::move(sortedActiveIds)),
+          m_info(m_activeIds.size(), elmLocalInfo_t(global_et::active))
+    {
+    }
+
+    auto isSparse() const -> bool
+    {
+        return m_isSparse;
+    }
+
+    /**
+     * Information of a cell, cells that are not in the map are inactive
+     */
+    auto operator[](global_idx globalIdx) const -> const elmLocalInfo_t&
+    {
+        if (!m_isSparse) {
+            return m_info[globalIdx];
+        }
+        auto it = std::lower_bound(m_activeIds.begin(), m_activeIds.end(), globalIdx);
+        if (it == m_activeIds.end() || *it != globalIdx) {
+            return m_inactive;
+        }
+        return m_info[it - m_activeIds.begin()];
+    }
+
+    auto elRef(const Neon::index_3d& idx) const -> const elmLocalInfo_t&
+    {
+        return (*this)[global_idx(idx.mPitch(m_domain))];
+    }
+
+    /**
+     * Writable information of a cell. In sparse mode the cell must be active.
+     */
+    auto ref(global_idx globalIdx) -> elmLocalInfo_t&
+    {
+        if (!m_isSparse) {
+            return m_info[globalIdx];
+        }
+        auto it = std::lower_bound(m_activeIds.begin(), m_activeIds.end(), globalIdx);
+        if (it == m_activeIds.end() || *it != globalIdx) {
+            NeonException exp("GlobalToLocal_t");
+            exp << "Cell " << globalIdx << " is not active.";
+            NEON_THROW(exp);
+        }
+        return m_info[it - m_activeIds.begin()];
+    }
+
+    /**
+     * Run fn(globalIdx, info) on all the active cells following the order of the global indices
+     */
+    template <typename Fn>
+    auto forEachActive(Fn fn) -> void
+    {
+        if (!m_isSparse) {
+            for (global_idx globalIdx = 0; globalIdx < global_idx(m_info.size()); globalIdx++) {
+                if (m_info[globalIdx].isActive()) {
+                    fn(globalIdx, m_info[globalIdx]);
+                }
+            }
+            return;
+        }
+        for (size_t i = 0; i < m_activeIds.size(); i++) {
+            fn(m_activeIds[i], m_info[i]);
+        }
+    }
+
+    /**
+     * Same as forEachActive but the cells are visited in parallel and in any order
+     */
+    template <typename Fn>
+    auto forEachActivePar(Fn fn) const -> void
+    {
+        const int64_t n = int64_t(m_info.size());
+#pragma omp parallel for default(shared)
+        for (int64_t i = 0; i < n; i++) {
+            if (m_info[i].isActive()) {
+                fn(m_isSparse ? m_activeIds[i] : global_idx(i), m_info[i]);
+            }
+        }
+    }
+
+   private:
+    Neon::index_3d              m_domain{0, 0, 0};
+    bool                        m_isSparse{false};
+    std::vector<global_idx>     m_activeIds; /** sparse mode: sorted global ids of the active cells */
+    std::vector<elmLocalInfo_t> m_info;      /** dense mode: one entry per cell, sparse mode: one entry per active cell */
+    elmLocalInfo_t              m_inactive{global_et::inactive};
+};
+
 struct InternalInfo_t
 {
     // TODO@Max: remove commented out code
@@ -580,7 +702,7 @@ struct InternalInfo_t
         return m_globalOrLocalNghList[internalIdx].ref(neighbourIdx);
     }
 
-    void convertNeighboursToLocal(const elmLocalInfo_t* const elmLocalInfo)
+    void convertNeighboursToLocal(const GlobalToLocal_t& elmLocalInfo)
     {
         isLocal = true;
 #pragma omp parallel for collapse(2) default(shared)
@@ -796,7 +918,7 @@ struct BoundariesInfo_t
 
 
     void convertBoundaryConnectivityFromGlobalToLocal(partition_idx                         partIdx,
-                                                      const elmLocalInfo_t*                 G2L,
+                                                      const GlobalToLocal_t&                G2L,
                                                       const DataSet<LocalIndexingInfo_t>& localIndexingInfoDataSet)
     {
         for (auto&& direction : std::vector<BdrDepClass_e::e>{BdrDepClass_e::DW, BdrDepClass_e::BOTH, BdrDepClass_e::UP}) {
@@ -1,7 +1,12 @@
 #pragma once
 #include "Neon/set/DataSet.h"
 
+#include <algorithm>
 #include <functional>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "Neon/core/tools/io/ioToVti.h"
 #include "Neon/domain/internal/haloUpdateType.h"
@@ -31,8 +36,7 @@ struct dsFrame_t
     int                   m_nPartitions{0};
     int                   m_nNeighbours{0};
 
-    Neon::sys::Mem3d_t<elmLocalInfo_t>
-        m_globalToLocal;
+    GlobalToLocal_t m_globalToLocal;
 
     DataSet<LocalIndexingInfo_t> m_localIndexingInfo; /** all information about local indexing of a partition */
     DataSet<InternalInfo_t>      m_internalToGlobal;  /** data to map from partition internal Idx to global **/
@@ -46,6 +50,16 @@ struct dsFrame_t
     Neon::set::MemDevSet<index_t> m_inverseMappingCPU;
     Neon::set::MemDevSet<index_t> m_inverseMappingGPU;
 
+    // Compact connectivity (see ConnectivityMode::compact), it replaces m_localConectivity
+    bool                          m_isConnectivityCompact{false};
+    Neon::set::MemDevSet<int16_t> m_connDeltaCPU;
+    Neon::set::MemDevSet<int16_t> m_connDeltaGPU;
+    Neon::set::MemDevSet<int32_t> m_connBaseCPU;
+    Neon::set::MemDevSet<int32_t> m_connBaseGPU;
+    Neon::set::MemDevSet<int32_t> m_connOverflowCPU; /** sorted keys followed by the values */
+    Neon::set::MemDevSet<int32_t> m_connOverflowGPU;
+    std::vector<int32_t>          m_connOverflowCount;
+
     struct dataDependencyFlag_t
     {
         bool isActive[Neon::domain::HaloUpdateMode_e::e::HALOUPDATEMODE_LEN][ComDirection_e::COM_NUM];
@@ -62,12 +76,12 @@ struct dsFrame_t
     std::vector<std::vector<dataDependencyFlag_t>> m_DependencyFlagByDestination;
 
    public:
-    auto globalToLocal() -> Neon::sys::Mem3d_t<elmLocalInfo_t>&
+    auto globalToLocal() -> GlobalToLocal_t&
     {
         return m_globalToLocal;
     }
 
-    auto globalToLocal() const -> const Neon::sys::Mem3d_t<elmLocalInfo_t>&
+    auto globalToLocal() const -> const GlobalToLocal_t&
     {
         return m_globalToLocal;
     }
@@ -152,6 +166,140 @@ struct dsFrame_t
         }
     }
 
+    auto isConnectivityCompact() const -> bool
+    {
+        return m_isConnectivityCompact;
+    }
+
+    /**
+     * Device view of the compact connectivity table of a partition
+     */
+    auto compactConnectivity(const Neon::DeviceType& devEt, partition_idx prtIdx) const
+        -> eCompactConnectivity
+    {
+        const bool           onGpu = devEt == Neon::DeviceType::CUDA;
+        const auto&          delta = onGpu ? m_connDeltaGPU : m_connDeltaCPU;
+        const auto&          base = onGpu ? m_connBaseGPU : m_connBaseCPU;
+        const auto&          overflow = onGpu ? m_connOverflowGPU : m_connOverflowCPU;
+        eCompactConnectivity res;
+        res.delta = delta.mem(prtIdx);
+        res.pitch = delta.get(prtIdx).pitch();
+        res.base = base.mem(prtIdx);
+        res.nOverflow = m_connOverflowCount[prtIdx];
+        res.overflowKey = overflow.mem(prtIdx);
+        res.overflowVal = overflow.mem(prtIdx) + res.nOverflow;
+        return res;
+    }
+
+    /**
+     * Bytes used by the connectivity table and by the inverse mapping on each device
+     */
+    auto connectivityBytes() const -> size_t
+    {
+        size_t bytes = 0;
+        for (int prtIdx = 0; prtIdx < nPartitions(); prtIdx++) {
+            const size_t nElements = m_localIndexingInfo.ref(prtIdx).nElements(false);
+            if (m_isConnectivityCompact) {
+                bytes += nElements * m_nNeighbours * sizeof(int16_t) +
+                         m_nNeighbours * sizeof(int32_t) +
+                         2 * m_connOverflowCount[prtIdx] * sizeof(int32_t);
+            } else {
+                bytes += nElements * m_nNeighbours * sizeof(int32_t);
+            }
+            bytes += nElements * index_3d::num_axis * sizeof(index_t);
+        }
+        return bytes;
+    }
+
+    /**
+     * Converts the full connectivity table into the compact one and releases the full table.
+     */
+    auto compressConnectivity() -> void
+    {
+        auto nElementSet = m_devSet.newDataSet<uint64_t>();
+        auto nBaseSet = m_devSet.newDataSet<uint64_t>();
+        for (int prtIdx = 0; prtIdx < nPartitions(); prtIdx++) {
+            nElementSet[prtIdx] = m_localIndexingInfo.ref(prtIdx).nElements(false);
+            nBaseSet[prtIdx] = m_nNeighbours;
+        }
+        m_connDeltaCPU = m_devSet.newMemDevSet<int16_t>(m_nNeighbours, Neon::DeviceType::CPU, Neon::Allocator::MALLOC, nElementSet);
+        m_connBaseCPU = m_devSet.newMemDevSet<int32_t>(Neon::DeviceType::CPU, Neon::Allocator::MALLOC, nBaseSet);
+
+        std::vector<std::vector<std::pair<int32_t, int32_t>>> overflow(nPartitions());
+        for (int prtIdx = 0; prtIdx < nPartitions(); prtIdx++) {
+            const int64_t nElements = int64_t(nElementSet[prtIdx]);
+            const auto    pitch = m_connDeltaCPU.get(prtIdx).pitch();
+
+            for (int nghIdx = 0; nghIdx < m_nNeighbours; nghIdx++) {
+                // Most frequent difference, estimated on a sample of the cells
+                std::unordered_map<int64_t, int64_t> histogram;
+                const int64_t                        stride = std::max(int64_t(1), nElements / 4096);
+                for (int64_t e = 0; e < nElements; e += stride) {
+                    const int32_t ngh = m_localConectivityCPU.elRef(prtIdx, e, nghIdx);
+                    if (ngh >= 0) {
+                        histogram[int64_t(ngh) - e]++;
+                    }
+                }
+                int64_t base = 0;
+                int64_t baseCount = 0;
+                for (const auto& kv : histogram) {
+                    if (kv.second > baseCount || (kv.second == baseCount && kv.first < base)) {
+                        base = kv.first;
+                        baseCount = kv.second;
+                    }
+                }
+                m_connBaseCPU.elRef(prtIdx, nghIdx, 0) = int32_t(base);
+
+                for (int64_t e = 0; e < nElements; e++) {
+                    const int32_t ngh = m_localConectivityCPU.elRef(prtIdx, e, nghIdx);
+                    int16_t&      delta = m_connDeltaCPU.elRef(prtIdx, e, nghIdx);
+                    if (ngh < 0) {
+                        delta = eCompactConnectivity::invalid;
+                        continue;
+                    }
+                    const int64_t remainder = int64_t(ngh) - e - base;
+                    if (remainder > eCompactConnectivity::escape && remainder <= std::numeric_limits<int16_t>::max()) {
+                        delta = int16_t(remainder);
+                        continue;
+                    }
+                    delta = eCompactConnectivity::escape;
+                    overflow[prtIdx].emplace_back(int32_t(pitch.pMain * e + pitch.pCardinality * nghIdx), ngh);
+                }
+            }
+            std::sort(overflow[prtIdx].begin(), overflow[prtIdx].end());
+        }
+
+        auto nOverflowSet = m_devSet.newDataSet<uint64_t>();
+        m_connOverflowCount = std::vector<int32_t>(nPartitions());
+        for (int prtIdx = 0; prtIdx < nPartitions(); prtIdx++) {
+            m_connOverflowCount[prtIdx] = int32_t(overflow[prtIdx].size());
+            nOverflowSet[prtIdx] = std::max(uint64_t(1), 2 * uint64_t(overflow[prtIdx].size()));
+        }
+        m_connOverflowCPU = m_devSet.newMemDevSet<int32_t>(Neon::DeviceType::CPU, Neon::Allocator::MALLOC, nOverflowSet);
+        for (int prtIdx = 0; prtIdx < nPartitions(); prtIdx++) {
+            int32_t*   mem = m_connOverflowCPU.mem(prtIdx);
+            const auto n = overflow[prtIdx].size();
+            for (size_t i = 0; i < n; i++) {
+                mem[i] = overflow[prtIdx][i].first;
+                mem[n + i] = overflow[prtIdx][i].second;
+            }
+        }
+
+        if (m_devSet.type() == Neon::DeviceType::CUDA) {
+            auto streamSet = m_devSet.newStreamSet();
+            m_connDeltaGPU = m_devSet.newMemDevSet<int16_t>(m_nNeighbours, Neon::DeviceType::CUDA, Neon::Allocator::CUDA_MEM_DEVICE, nElementSet);
+            m_connBaseGPU = m_devSet.newMemDevSet<int32_t>(Neon::DeviceType::CUDA, Neon::Allocator::CUDA_MEM_DEVICE, nBaseSet);
+            m_connOverflowGPU = m_devSet.newMemDevSet<int32_t>(Neon::DeviceType::CUDA, Neon::Allocator::CUDA_MEM_DEVICE, nOverflowSet);
+            m_connDeltaGPU.updateFrom<Neon::run_et::sync>(streamSet, m_connDeltaCPU);
+            m_connBaseGPU.updateFrom<Neon::run_et::sync>(streamSet, m_connBaseCPU);
+            m_connOverflowGPU.updateFrom<Neon::run_et::sync>(streamSet, m_connOverflowCPU);
+        }
+
+        m_localConectivityCPU = Neon::set::MemDevSet<int32_t>();
+        m_localConectivityGPU = Neon::set::MemDevSet<int32_t>();
+        m_isConnectivityCompact = true;
+    }
+
     DataSet<InternalInfo_t>& internalToGlobal()
     {
         return m_internalToGlobal;
@@ -229,13 +377,55 @@ struct dsFrame_t
           m_stencil(stencil),
           m_nPartitions(nPartitions),
           m_nNeighbours(stencil.nNeighbours()),
-          m_globalToLocal(1, Neon::DeviceType::CPU, Neon::sys::DeviceID(0), Neon::Allocator::MALLOC, domain, Neon::index_3d(0), Neon::memLayout_et::structOfArrays, Neon::sys::MemAlignment(), Neon::memLayout_et::OFF),
+          m_globalToLocal(domain),
           m_localIndexingInfo(nPartitions),
           m_internalToGlobal(m_nPartitions),
           m_boundaryToGlobal(m_nPartitions)
     {
         p_detectActiveElements(inOut);
+        p_initDependencyFlags();
+    }
+
+    /**
+     * Frame defined by the list of the active cells.
+     * Only the active cells are stored: no memory is allocated for the rest of the domain.
+     * Duplicated cells are merged, cells outside the domain raise an exception.
+     */
+    dsFrame_t(const Neon::set::DevSet&           devSet,
+              const Neon::index_3d&              domain,
+              const std::vector<Neon::index_3d>& activeCells,
+              int                                nPartitions,
+              const Neon::domain::Stencil&       stencil)
+        : m_devSet(devSet),
+          m_cellDomain(domain),
+          m_nDomainElements(domain.rMulTyped<size_t>()),
+          m_nActiveElements(0),
+          m_stencil(stencil),
+          m_nPartitions(nPartitions),
+          m_nNeighbours(stencil.nNeighbours()),
+          m_localIndexingInfo(nPartitions),
+          m_internalToGlobal(m_nPartitions),
+          m_boundaryToGlobal(m_nPartitions)
+    {
+        p_detectActiveElements(activeCells);
+        p_initDependencyFlags();
+    }
 
+    template <typename T_ta>
+    Neon::set::DataSet<T_ta> newDataSet()
+    {
+        return Neon::set::DataSet<T_ta>(this->nPartitions());
+    }
+
+    template <typename T_ta>
+    NghDataSet<T_ta> newNghDataSet() const
+    {
+        return NghDataSet<T_ta>(this->nNeighbours());
+    }
+
+   private:
+    void p_initDependencyFlags()
+    {
         std::vector<dataDependencyFlag_t> dataDependencyFlagForInternalPartitions(m_stencil.nNeighbours());
         {
             // PARSE it fro both read update or write update...
@@ -263,21 +453,8 @@ struct dsFrame_t
 
         m_DependencyFlagByDestination = std::vector<std::vector<dataDependencyFlag_t>>(m_nPartitions,
                                                                                        dataDependencyFlagForInternalPartitions);
-    }  // namespace internals
-
-    template <typename T_ta>
-    Neon::set::DataSet<T_ta> newDataSet()
-    {
-        return Neon::set::DataSet<T_ta>(this->nPartitions());
-    }
-
-    template <typename T_ta>
-    NghDataSet<T_ta> newNghDataSet() const
-    {
-        return NghDataSet<T_ta>(this->nNeighbours());
     }
 
-   private:
     void p_detectActiveElements(const std::function<bool(const Neon::index_3d&)>& inOut)
     {
         size_t numActiveElem = 0;
@@ -296,7 +473,7 @@ struct dsFrame_t
                         numActiveElem += 1;
                         status = global_et::active;
                     }
-                    m_globalToLocal.elRef(idx3d) = elmLocalInfo_t(status);
+                    m_globalToLocal.ref(global_idx(idx3d.mPitch(m_cellDomain))) = elmLocalInfo_t(status);
                 }
             }
         }
@@ -308,6 +485,31 @@ struct dsFrame_t
 #endif
     }
 
+    void p_detectActiveElements(const std::vector<Neon::index_3d>& activeCells)
+    {
+        std::vector<global_idx> activeIds;
+        activeIds.reserve(activeCells.size());
+        for (const auto& idx3d : activeCells) {
+            if (!idx3d.isInsideBox(0, m_cellDomain - 1)) {
+                NeonException exp("dsFrame_t");
+                exp << "Active cell " << idx3d.to_string() << " is outside the domain " << m_cellDomain.to_string();
+                NEON_THROW(exp);
+            }
+            activeIds.push_back(global_idx(idx3d.mPitch(m_cellDomain)));
+        }
+        std::sort(activeIds.begin(), activeIds.end());
+        activeIds.erase(std::unique(activeIds.begin(), activeIds.end()), activeIds.end());
+
+        if (activeIds.empty()) {
+            NeonException exp("dsFrame_t");
+            exp << "The list of active cells is empty.";
+            NEON_THROW(exp);
+        }
+
+        m_nActiveElements = int64_t(activeIds.size());
+        m_globalToLocal = GlobalToLocal_t(m_cellDomain, std::move(activeIds));
+    }
+
    public:
     void exportTopology_vti(const std::string& fname)
     {
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <utility>
+#include <vector>
 
 #include "dsBuilderCommon.h"
 #include "dsFrame.h"
+#include "Neon/domain/internal/eGrid/eCellOrdering.h"
 #include "Neon/domain/internal/eGrid/eInternals/Partitioning.h"
 #include "Neon/domain/interface/Stencil.h"
 #include "Neon/sys/memory/mem3d.h"
@@ -23,33 +27,34 @@ struct flatPartitioning_t
     DataSet<global_idx>       m_lastIds;
     DataSet<int64_t>          m_partitionSizes;
     ListDataSet<global_idx> m_tmpActiveToGlobal;
-
-    Neon::sys::Mem3d_t<global_idx>
-        m_globalToInternalAndBoundaryLocal;
+    CellOrdering            m_cellOrdering{CellOrdering::scan};
+    ConnectivityMode        m_connectivityMode{ConnectivityMode::full};
 
    public:
     flatPartitioning_t(const Neon::set::DevSet&                   devSet,
                        const Neon::index_3d&                      domain,
                        std::function<bool(const Neon::index_3d&)> inOut,
                        int                                        nPartitions,
-                       const Neon::domain::Stencil&               stencil)
-        : m_firstIds(nPartitions),
-          m_lastIds(nPartitions),
-          m_partitionSizes(nPartitions),
-          m_tmpActiveToGlobal(nPartitions),
-          m_globalToInternalAndBoundaryLocal(1,
-                                             Neon::DeviceType::CPU,
-                                             Neon::sys::DeviceID(0),
-                                             Neon::Allocator::MALLOC,
-                                             domain,
-                                             Neon::index_3d(0),
-                                             Neon::memLayout_et::structOfArrays,
-                                             Neon::sys::MemAlignment(),
-                                             Neon::memLayout_et::OFF)
+                       const Neon::domain::Stencil&               stencil,
+                       CellOrdering                               cellOrdering = CellOrdering::scan,
+                       ConnectivityMode                           connectivityMode = ConnectivityMode::full)
+        : flatPartitioning_t(std::make_shared<dsFrame_t>(devSet, domain, std::move(inOut), nPartitions, stencil), cellOrdering, connectivityMode)
+    {
+    }
+
+    /**
+     * Partitioning of a domain defined by the list of its active cells.
+     * Memory and work are proportional to the number of active cells.
+     */
+    flatPartitioning_t(const Neon::set::DevSet&           devSet,
+                       const Neon::index_3d&              domain,
+                       const std::vector<Neon::index_3d>& activeCells,
+                       int                                nPartitions,
+                       const Neon::domain::Stencil&       stencil,
+                       CellOrdering                       cellOrdering = CellOrdering::scan,
+                       ConnectivityMode                   connectivityMode = ConnectivityMode::full)
+        : flatPartitioning_t(std::make_shared<dsFrame_t>(devSet, domain, activeCells, nPartitions, stencil), cellOrdering, connectivityMode)
     {
-        m_frame = std::make_shared<dsFrame_t>(devSet, domain, std::move(inOut), nPartitions, stencil);
-        computeFirstLastSize();
-        setFrame();
     }
 
     std::shared_ptr<dsFrame_t> getFrame()
@@ -58,6 +63,33 @@ struct flatPartitioning_t
     }
 
    private:
+    flatPartitioning_t(std::shared_ptr<dsFrame_t> frame, CellOrdering cellOrdering, ConnectivityMode connectivityMode)
+        : m_frame(std::move(frame)),
+          m_firstIds(m_frame->nPartitions()),
+          m_lastIds(m_frame->nPartitions()),
+          m_partitionSizes(m_frame->nPartitions()),
+          m_tmpActiveToGlobal(m_frame->nPartitions()),
+          m_cellOrdering(cellOrdering),
+          m_connectivityMode(connectivityMode)
+    {
+        computeFirstLastSize();
+        reorder();
+        setFrame();
+    }
+
+    /**
+     * 3D index of a global index.
+     * 64 bit arithmetic: the number of cells of the background grid may not fit in an int
+     */
+    auto globalTo3d(global_idx globalIdx) const -> Neon::index_3d
+    {
+        const int64_t dimX = m_frame->domain().x;
+        const int64_t dimXY = dimX * m_frame->domain().y;
+        return Neon::index_3d(int(globalIdx % dimX),
+                              int((globalIdx % dimXY) / dimX),
+                              int(globalIdx / dimXY));
+    }
+
     /**
      * For each partition computes
      * 1. first global id
@@ -66,9 +98,8 @@ struct flatPartitioning_t
      */
     void computeFirstLastSize()
     {
-        dsFrame_t&      frame = *m_frame;
-        const int64_t   minimumNumber = frame.nActiveElements() / frame.nPartitions();
-        elmLocalInfo_t* frameGlobalToLocal = frame.globalToLocal().mem();
+        dsFrame_t&    frame = *m_frame;
+        const int64_t minimumNumber = frame.nActiveElements() / frame.nPartitions();
 
         {  // Computing uniform partitioning of a 1D flat vector.
             m_partitionSizes = DataSet<int64_t>(frame.nPartitions(), minimumNumber);
@@ -87,48 +118,43 @@ struct flatPartitioning_t
             int64_t    nDetectedActive = 0;
             int64_t    totalDetectedActive = 0;
 
-            const auto& globalToLocal = frame.globalToLocal().mem();
-            global_idx  globalIdx;
-
             /**
              * This loop is sequential.
              * We are creating the mapping between elements and partitions.
              * Because we don't know the distribution of the elements we do it sequentially.
+             * Only active elements are visited, following the order of their global index.
              *
              * TODO Optimizations:
              * 1. start both from top and bottom
              * 2. do a binning to help clusterng the row of elements that belongs all to one partition
              *
              */
-            for (globalIdx = 0; globalIdx < frame.nDomainElements(); globalIdx++) {
-                auto globalInfo = globalToLocal[globalIdx];
-                bool isActive = globalInfo.isActive();
-                if (isActive) {
-                    nDetectedActive++;
-                    m_tmpActiveToGlobal.append(targetPrtIdx, globalIdx);
-                    frameGlobalToLocal[globalIdx] = elmLocalInfo_t(targetPrtIdx);
-                    if (nDetectedActive == targetSize) {
-                        targetLast = globalIdx;
-                        totalDetectedActive += nDetectedActive;
-                        m_firstIds.ref<Neon::Access::readWrite>(targetPrtIdx) = targetFirst;
-                        m_lastIds.ref<Neon::Access::readWrite>(targetPrtIdx) = targetLast;
-
-                        // MOVING TO NEXT PARTITION
-                        targetPrtIdx++;
-                        if (targetPrtIdx == frame.nPartitions()) {
-                            break;
-                        }
-
-                        // RESETTING
-                        targetSize = m_partitionSizes.ref(targetPrtIdx);
-                        targetFirst = targetLast + 1;
-                        targetLast = 0;
-                        nDetectedActive = 0;
-
-                        continue;
+            frame.globalToLocal().forEachActive([&](global_idx globalIdx, elmLocalInfo_t& globalInfo) {
+                if (targetPrtIdx == frame.nPartitions()) {
+                    return;
+                }
+                nDetectedActive++;
+                m_tmpActiveToGlobal.append(targetPrtIdx, globalIdx);
+                globalInfo = elmLocalInfo_t(targetPrtIdx);
+                if (nDetectedActive == targetSize) {
+                    targetLast = globalIdx;
+                    totalDetectedActive += nDetectedActive;
+                    m_firstIds.ref<Neon::Access::readWrite>(targetPrtIdx) = targetFirst;
+                    m_lastIds.ref<Neon::Access::readWrite>(targetPrtIdx) = targetLast;
+
+                    // MOVING TO NEXT PARTITION
+                    targetPrtIdx++;
+                    if (targetPrtIdx == frame.nPartitions()) {
+                        return;
                     }
+
+                    // RESETTING
+                    targetSize = m_partitionSizes.ref(targetPrtIdx);
+                    targetFirst = targetLast + 1;
+                    targetLast = 0;
+                    nDetectedActive = 0;
                 }
-            }
+            });
 
             if (totalDetectedActive != frame.nActiveElements()) {
                 NeonException exp("Flat Partitioning");
@@ -168,7 +194,7 @@ struct flatPartitioning_t
          */
         const auto&              stencilPoints = frame.stencil().neighbours();
         NghDataSet<global_idx> nhgGIdSet = frame.newNghDataSet<global_idx>();
-        const Neon::index_3d     centerG3d = frame.domain().mapTo3dIdx(centerGIdx);
+        const Neon::index_3d     centerG3d = globalTo3d(centerGIdx);
 
         // Neon::int64_3d pitch(1, frame.domain().x, frame.domain().x * size_t(frame.domain().y));
 
@@ -181,7 +207,7 @@ struct flatPartitioning_t
             }
 
             int64_t     neighbourID = nghG3d.mPitch(frame.domain());
-            const auto& GtoL = frame.globalToLocal().mem();
+            const auto& GtoL = frame.globalToLocal();
             const auto  isAnActiveNgh = GtoL[neighbourID].isActive();
             neighbourID = isAnActiveNgh ? neighbourID : neighbour_et::invalid;
             nhgGIdSet.ref(ngIdx) = neighbourID;
@@ -383,10 +409,10 @@ struct flatPartitioning_t
                     // c. frameGlobalToLocal
                     internal_idx internalIdx = frameInternalToG.ref<Neon::Access::readWrite>(targetPrtIdx).append(globalNhgIds) - 1;
 
-                    elmLocalInfo_t* frameGlobalToLocal = frame.globalToLocal().mem();
-                    assert(targetPrtIdx == frameGlobalToLocal[targetGlbIdx].getPrtIdx());
-                    assert(!frameGlobalToLocal[targetGlbIdx].isFullySet());
-                    frameGlobalToLocal[targetGlbIdx] = elmLocalInfo_t(targetPrtIdx, local_idx(internalIdx), isDomainBoundary, Neon::DataView::INTERNAL);
+                    elmLocalInfo_t& targetInfo = frame.globalToLocal().ref(targetGlbIdx);
+                    assert(targetPrtIdx == targetInfo.getPrtIdx());
+                    assert(!targetInfo.isFullySet());
+                    targetInfo = elmLocalInfo_t(targetPrtIdx, local_idx(internalIdx), isDomainBoundary, Neon::DataView::INTERNAL);
 
                     nInternal++;
                     continue;
@@ -417,7 +443,7 @@ struct flatPartitioning_t
                                                                   BdrDepClass_e::e::BOTH,
                                                                   BdrDepClass_e::UP}) {
 
-                elmLocalInfo_t* frameGlobalToLocal = frame.globalToLocal().mem();
+                GlobalToLocal_t& frameGlobalToLocal = frame.globalToLocal();
 
                 const int64_t nBoundary = target_frameBdrToG.nGlobal(direction);
 
@@ -426,7 +452,7 @@ struct flatPartitioning_t
                     local_idx  targetLocal = target_frameBdrToG.computeLocalIdx(direction, boundaryRelativeIdx);
                     global_idx targetGlobal = target_frameBdrToG.getGlobalIdx(direction, boundaryRelativeIdx);
                     bool       isDomainBoundary = target_frameBdrToG.isDomainBoundary(direction, boundaryRelativeIdx);
-                    frameGlobalToLocal[targetGlobal] = elmLocalInfo_t(targetPrtIdx, targetLocal, isDomainBoundary, Neon::DataView::BOUNDARY);
+                    frameGlobalToLocal.ref(targetGlobal) = elmLocalInfo_t(targetPrtIdx, targetLocal, isDomainBoundary, Neon::DataView::BOUNDARY);
                 }
             }
         }
@@ -443,7 +469,7 @@ struct flatPartitioning_t
         dsFrame_t&                  frame = *m_frame;
         const BoundariesInfo_t&     boundaryToGlobal = frame.boundaryToGlobal().ref(targetPrtIdx);
         const InternalInfo_t&       internalToGlobal = frame.internalToGlobal().ref(targetPrtIdx);
-        const elmLocalInfo_t* const frameGlobalToLocal = frame.globalToLocal().mem();
+        const GlobalToLocal_t&      frameGlobalToLocal = frame.globalToLocal();
 
         {  // INTERNAL -> converting global Id to local
             InternalInfo_t& InternalInfo = frame.internalToGlobal().ref<Neon::Access::readWrite>(targetPrtIdx);
@@ -489,21 +515,75 @@ struct flatPartitioning_t
 
     auto inverseMapping() -> void
     {
-        elmLocalInfo_t* frameGlobalToLocal = m_frame->globalToLocal().mem();
-#pragma omp parallel for collapse(2) default(shared)
-        for (int z = 0; z < m_frame->domain().z; z++) {
-            for (int y = 0; y < m_frame->domain().y; y++) {
-                for (int x = 0; x < m_frame->domain().x; x++) {
-                    index_3d   xyz(x, y, z);
-                    global_idx globalIdx = xyz.mPitch(m_frame->domain());
-                    if (frameGlobalToLocal[globalIdx].isActive()) {
-                        auto prtId = frameGlobalToLocal[globalIdx].getPrtIdx();
-                        auto localId = frameGlobalToLocal[globalIdx].getLocalIdx();
-                        m_frame->inverseMapping(Neon::DeviceType::CPU).elRef(prtId, localId, index_3d::x_axis) = x;
-                        m_frame->inverseMapping(Neon::DeviceType::CPU).elRef(prtId, localId, index_3d::y_axis) = y;
-                        m_frame->inverseMapping(Neon::DeviceType::CPU).elRef(prtId, localId, index_3d::z_axis) = z;
+        auto& inverse = m_frame->inverseMapping(Neon::DeviceType::CPU);
+        m_frame->globalToLocal().forEachActivePar([&](global_idx globalIdx, const elmLocalInfo_t& info) {
+            auto       prtId = info.getPrtIdx();
+            auto       localId = info.getLocalIdx();
+            const auto xyz = globalTo3d(globalIdx);
+            inverse.elRef(prtId, localId, index_3d::x_axis) = xyz.x;
+            inverse.elRef(prtId, localId, index_3d::y_axis) = xyz.y;
+            inverse.elRef(prtId, localId, index_3d::z_axis) = xyz.z;
+        });
+    }
+
+    /**
+     * Sorts the active cells of each partition following the requested ordering.
+     * Internal and boundary local indices are assigned in this order by the classification,
+     * connectivity and inverse mapping are then computed from the resulting local indices.
+     */
+    void reorder()
+    {
+        if (m_cellOrdering == CellOrdering::scan) {
+            return;
+        }
+        const index_3d& domain = m_frame->domain();
+        int             nBits = 0;
+        while ((int64_t(1) << nBits) < int64_t(std::max(domain.x, std::max(domain.y, domain.z)))) {
+            nBits++;
+        }
+
+        for (partition_idx prtIdx = 0; prtIdx < m_frame->nPartitions(); prtIdx++) {
+            std::vector<global_idx>& cells = m_tmpActiveToGlobal.refList(prtIdx);
+
+            if (m_cellOrdering == CellOrdering::rcm) {
+                // Cells are sorted by global index: positions are found by binary search
+                std::vector<int64_t> offsets(cells.size() + 1, 0);
+                std::vector<int64_t> neighbours;
+                for (size_t i = 0; i < cells.size(); i++) {
+                    const NghDataSet<global_idx> nghIds = getNghGlobalIds(cells[i]);
+                    for (neighbour_idx nghIdx = 0; nghIdx < m_frame->nNeighbours(); nghIdx++) {
+                        const global_idx nghId = nghIds.ref(nghIdx);
+                        if (nghId == neighbour_et::invalid) {
+                            continue;
+                        }
+                        auto it = std::lower_bound(cells.begin(), cells.end(), nghId);
+                        if (it != cells.end() && *it == nghId) {
+                            neighbours.push_back(int64_t(it - cells.begin()));
+                        }
                     }
+                    offsets[i + 1] = int64_t(neighbours.size());
+                }
+                const std::vector<int64_t> order = CellOrderingUtils::reverseCuthillMcKee(offsets, neighbours);
+                std::vector<global_idx>    sorted(cells.size());
+                for (size_t i = 0; i < order.size(); i++) {
+                    sorted[i] = cells[order[i]];
                 }
+                cells = std::move(sorted);
+                continue;
+            }
+
+            std::vector<std::pair<uint64_t, global_idx>> keys(cells.size());
+#pragma omp parallel for default(shared)
+            for (int64_t i = 0; i < int64_t(cells.size()); i++) {
+                const index_3d xyz = globalTo3d(cells[i]);
+                const uint64_t key = m_cellOrdering == CellOrdering::morton
+                                         ? CellOrderingUtils::mortonCode(xyz)
+                                         : CellOrderingUtils::hilbertCode(xyz, nBits);
+                keys[i] = {key, cells[i]};
+            }
+            std::sort(keys.begin(), keys.end());
+            for (size_t i = 0; i < keys.size(); i++) {
+                cells[i] = keys[i].second;
             }
         }
     }
@@ -546,6 +626,9 @@ struct flatPartitioning_t
         connectivity();
         inverseMapping();
         m_frame->updateConnectivityAndInverseMapping();
+        if (m_connectivityMode == ConnectivityMode::compact) {
+            m_frame->compressConnectivity();
+        }
     }
 };  // namespace internals
 
@@ -1,6 +1,8 @@
 #pragma once
 #include <functional>
+#include <vector>
 
+#include "Neon/domain/internal/eGrid/eCellOrdering.h"
 #include "Neon/domain/internal/eGrid/eInternals/builder/dsFrame.h"
 #include "Partitioning.h"
 #include "Neon/domain/interface/Stencil.h"
@@ -24,7 +26,20 @@ struct dsBuilder_t
                 const Neon::index_3d&    domain,
                 const std::function<bool(const Neon::index_3d&)>&,
                 int                          nPartitions,
-                const Neon::domain::Stencil& stencil);
+                const Neon::domain::Stencil& stencil,
+                CellOrdering                 cellOrdering = CellOrdering::scan,
+                ConnectivityMode             connectivityMode = ConnectivityMode::full);
+
+    /**
+     * Builder for a domain defined by the list of its active cells
+     */
+    dsBuilder_t(const Neon::set::DevSet&           devSet,
+                const Neon::index_3d&              domain,
+                const std::vector<Neon::index_3d>& activeCells,
+                int                                nPartitions,
+                const Neon::domain::Stencil&       stencil,
+                CellOrdering                       cellOrdering = CellOrdering::scan,
+                ConnectivityMode                   connectivityMode = ConnectivityMode::full);
 
     auto frame()
         const
@@ -35,13 +50,17 @@ struct dsBuilder_t
 
    private:
     /**
-     * Compute partitioning
+     * Compute partitioning.
+     * Active cells are either defined by a lambda over the domain or by a list.
      */
-    auto p_compute_partition(const Neon::set::DevSet&                          devSet,
-                             const Neon::index_3d&                             sizeDomain,
-                             const std::function<bool(const Neon::index_3d&)>& inOut,
-                             int                                               nPartitions,
-                             const Neon::domain::Stencil&)
+    template <typename ActiveCells>
+    auto p_compute_partition(const Neon::set::DevSet&     devSet,
+                             const Neon::index_3d&        sizeDomain,
+                             const ActiveCells&           activeCells,
+                             int                          nPartitions,
+                             const Neon::domain::Stencil& stencil,
+                             CellOrdering                 cellOrdering,
+                             ConnectivityMode             connectivityMode)
         -> void;
 };
 
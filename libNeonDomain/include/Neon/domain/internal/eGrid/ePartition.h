@@ -82,6 +82,7 @@ struct ePartition
 
     using nghIdx_t = uint8_t;                                    //<- type of an index to identify a neighbour
     using Type = T;                                              //<- type of the data stored by the field
+    using ComputeType = Neon::ComputeTypeOf<T>;                  //<- type used to compute on the data (see Neon::StorageTypeTraits)
     using eJump_t = index_t;                                     //<- Type of a jump value
     using ePitch_t = ::Neon::domain::internal::eGrid::ePitch_t;  //<- Type of the pitch representation
 
@@ -104,13 +105,19 @@ struct ePartition
     Cell::Offset m_ghostCount[ComDirection_e::COM_NUM] = {-1, -1};
 
     //-- [CONNECTIVITY] ----------------------------------------------------------------------------
-    Cell::Offset* m_connRaw;
-    ePitch_t      m_connPitch;
+    Cell::Offset*        m_connRaw;
+    ePitch_t             m_connPitch;
+    eCompactConnectivity m_compactConn; /**< used instead of m_connRaw when delta is not null */
 
     //-- [INVERSE MAPPING] ----------------------------------------------------------------------------
     Neon::index_t* m_inverseMapping = {nullptr};
     int            m_prtID;
 
+    //-- [ZERO-COPY HALO] ----------------------------------------------------------------------------
+    const T*     m_zeroCopyMem[ComDirection_e::COM_NUM] = {nullptr, nullptr}; /**< memory of the neighbour partitions, null when the ghost cells are used */
+    ePitch_t     m_zeroCopyPitch[ComDirection_e::COM_NUM];
+    Cell::Offset m_zeroCopyBdrOff[ComDirection_e::COM_NUM] = {-1, -1}; /**< offset of the boundary cells in the neighbour partitions */
+
    public:
     //-- [CONSTRUCTORS] ----------------------------------------------------------------------------
 
@@ -286,6 +293,23 @@ struct ePartition
     NEON_CUDA_HOST_DEVICE inline auto
     mem() const
         -> const T*;
+
+    /**
+     * Switches the neighbour queries to a compact connectivity table
+     */
+    auto hSetCompactConnectivity(const eCompactConnectivity& compactConn)
+        -> void;
+
+    /**
+     * Redirects the reads of the ghost cells of a direction (nghVal, or nghIdx followed by the const accessor)
+     * to the boundary cells of the neighbour partition (zero-copy halo).
+     * CPU only: the redirection is not compiled in device code.
+     */
+    auto hSetZeroCopyHalo(ComDirection_e::e comDirection,
+                          const T*          nghMem,
+                          const ePitch_t&   nghPitch,
+                          Cell::Offset      nghBdrOff)
+        -> void;
 };
 }  // namespace Neon::domain::internal::eGrid
 
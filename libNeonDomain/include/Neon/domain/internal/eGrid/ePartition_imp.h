@@ -39,6 +39,19 @@ NEON_CUDA_HOST_DEVICE inline auto
 ePartition<T, C>::operator()(Cell eId, int cardinalityIdx) const
     -> T
 {
+#if defined(NEON_PLACE_CUDA_HOST)
+    // Ghost cells are read from the boundary of the neighbour partitions when zero-copy halos are enabled
+    for (int comDirection = 0; comDirection < ComDirection_e::COM_NUM; comDirection++) {
+        if (m_zeroCopyMem[comDirection] != nullptr) {
+            const Cell::Offset ghostIdx = eId.get() - m_ghostOff[comDirection];
+            if (ghostIdx >= 0 && ghostIdx < m_ghostCount[comDirection]) {
+                const eJump_t jump = eJump_t((m_zeroCopyBdrOff[comDirection] + ghostIdx) * m_zeroCopyPitch[comDirection].pMain +
+                                             cardinalityIdx * m_zeroCopyPitch[comDirection].pCardinality);
+                return m_zeroCopyMem[comDirection][jump];
+            }
+        }
+    }
+#endif
     eJump_t jump = eJump(eId, cardinalityIdx);
     return m_mem[jump];
 }
@@ -77,7 +90,33 @@ ePartition<T, C>::nghIdx(Cell     eId,
                          Cell&    neighbourIdx) const
     -> bool
 {
-    const eJump_t      connJump = eJump(eId);
+    const eJump_t connJump = eJump(eId);
+    if (m_compactConn.delta != nullptr) {
+        const Cell::Offset deltaPitch = Cell::Offset(m_compactConn.pitch.pMain * connJump +
+                                                     m_compactConn.pitch.pCardinality * nghIdx);
+        const int16_t      delta = NEON_CUDA_CONST_LOAD((m_compactConn.delta + deltaPitch));
+        if (delta == eCompactConnectivity::invalid) {
+            neighbourIdx.set() = -1;
+            return false;
+        }
+        if (delta != eCompactConnectivity::escape) {
+            neighbourIdx.set() = connJump + NEON_CUDA_CONST_LOAD((m_compactConn.base + nghIdx)) + delta;
+            return true;
+        }
+        // Binary search in the sorted overflow table
+        int32_t first = 0;
+        int32_t last = m_compactConn.nOverflow - 1;
+        while (first < last) {
+            const int32_t middle = (first + last) / 2;
+            if (NEON_CUDA_CONST_LOAD((m_compactConn.overflowKey + middle)) < deltaPitch) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
+        }
+        neighbourIdx.set() = NEON_CUDA_CONST_LOAD((m_compactConn.overflowVal + first));
+        return true;
+    }
     const Cell::Offset connectivityPitch = m_connPitch.pMain * connJump +
                                            m_connPitch.pCardinality * nghIdx;
     neighbourIdx.set() = NEON_CUDA_CONST_LOAD((m_connRaw + connectivityPitch));
@@ -85,6 +124,26 @@ ePartition<T, C>::nghIdx(Cell     eId,
     return isValidNeighbour;
 }
 
+template <typename T,
+          int C>
+auto ePartition<T, C>::hSetCompactConnectivity(const eCompactConnectivity& compactConn)
+    -> void
+{
+    m_compactConn = compactConn;
+}
+
+template <typename T,
+          int C>
+auto ePartition<T, C>::hSetZeroCopyHalo(ComDirection_e::e comDirection,
+                                        const T*          nghMem,
+                                        const ePitch_t&   nghPitch,
+                                        Cell::Offset      nghBdrOff)
+    -> void
+{
+    m_zeroCopyMem[comDirection] = nghMem;
+    m_zeroCopyPitch[comDirection] = nghPitch;
+    m_zeroCopyBdrOff[comDirection] = nghBdrOff;
+}
 
 template <typename T,
           int C>
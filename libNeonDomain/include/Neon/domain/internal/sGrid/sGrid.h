@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 #include "Neon/core/core.h"
 #include "Neon/core/types/Macros.h"
 
@@ -26,6 +30,19 @@ namespace Neon::domain::internal::sGrid {
 template <typename OuterGridT, typename T, int C>
 class sField;
 
+/**
+ * True when an outer cell exposes its position in the storage of the outer grid (see eCell::getStorageOffset)
+ */
+template <typename OuterCell, typename = void>
+struct HasStorageOffset : std::false_type
+{
+};
+
+template <typename OuterCell>
+struct HasStorageOffset<OuterCell, std::void_t<decltype(std::declval<const OuterCell&>().getStorageOffset())>> : std::true_type
+{
+};
+
 template <typename OuterGridT>
 class sGrid : public Neon::domain::interface::GridBaseTemplate<sGrid<OuterGridT>,
                                                                sCell>
@@ -54,6 +71,9 @@ class sGrid : public Neon::domain::interface::GridBaseTemplate<sGrid<OuterGridT>
 
     /**
      * Main constructor for the grid.
+     * The cells of each partition and data view are sorted by their position in the storage of the outer grid,
+     * so sGrid cells that are close in memory map to outer cells that are close in memory.
+     * Duplicated points are merged.
      */
     sGrid(OuterGridT const&                  outerGrid /**< A reference to the target outer grid */,
           std::vector<Neon::index_3d> const& subGridPoints /**< Points of the outer grid that will be represented by sGrid */);
@@ -113,6 +133,27 @@ class sGrid : public Neon::domain::interface::GridBaseTemplate<sGrid<OuterGridT>
         const
         -> Neon::set::Container;
 
+    /**
+     * Creates a container that copies the values of an outer grid field into a sGrid field.
+     * As sGrid cells are sorted by their storage position in the outer grid,
+     * the outer field is read with an almost streaming access pattern.
+     */
+    template <typename OuterField, typename T, int C>
+    auto getGatherContainer(const OuterField& outerField /**< Source field, defined over the outer grid */,
+                            Field<T, C>&      field /**< Destination field */)
+        const
+        -> Neon::set::Container;
+
+    /**
+     * Creates a container that copies the values of a sGrid field into an outer grid field.
+     * Values of outer cells that are not part of the sGrid are not modified.
+     */
+    template <typename OuterField, typename T, int C>
+    auto getScatterContainer(const Field<T, C>& field /**< Source field */,
+                             OuterField&        outerField /**< Destination field, defined over the outer grid */)
+        const
+        -> Neon::set::Container;
+
     /**
      * Returns true if the specified point is in the domain
      */
@@ -153,6 +194,25 @@ class sGrid : public Neon::domain::interface::GridBaseTemplate<sGrid<OuterGridT>
         typename OuterGridT::Cell::OuterCell outerCell;
     };
 
+    /**
+     * A cell of the sub-grid during the construction
+     */
+    struct SortedCell
+    {
+        Neon::index_3d                       point;
+        int64_t                              storageKey;
+        typename OuterGridT::Cell::OuterCell outerCell;
+    };
+
+    /**
+     * Sorting key of a cell: its storage offset in the outer grid when the outer cell provides it,
+     * the position of the point in a x-y-z scan of the domain otherwise.
+     */
+    static auto helpGetStorageKey(const typename OuterGridT::Cell::OuterCell& outerCell,
+                                  const Neon::index_3d&                       point,
+                                  const Neon::index_3d&                       dim)
+        -> int64_t;
+
     struct sStorage
     {
         /** init storage stricture */
@@ -46,53 +46,85 @@ sGrid<OuterGridT>::sGrid(const OuterGridT&                  outerGrid,
     mStorage = std::make_shared<sStorage>();
     mStorage->init(outerGrid);
 
+    // Cells of each partition and data view, sorted by their position in the outer grid storage.
+    // Index of a partition and data view: 2 * setIdx + {0: internal, 1: boundary}
+    const int                               nDevices = this->getDevSet().setCardinality();
+    std::vector<std::vector<SortedCell>>    sortedCells(2 * nDevices);
+    auto                                    helpBucket = [](int setIdx, Neon::DataView dw) {
+        return 2 * setIdx + (dw == Neon::DataView::INTERNAL ? 0 : 1);
+    };
+
     auto initMapTable = [&]() {
         // Add points into hashTable
-        // .A retrieve cell information
-        // .B add point and metadata to the hashtable
-
-        for (auto const& point : subGridPoints) {
-            // A
-            auto const& cellProperties = outerGrid.getProperties(point);
-            bool        isInside = cellProperties.isInside();
-            if (!isInside) {
-                NEON_THROW_UNSUPPORTED_OPERATION("sGrid");
+        // .A retrieve cell information, in parallel
+        // .B group points by partition and data view and sort them by storage order of the outer grid
+        // .C assign the sGrid offsets and add point and metadata to the hashtable
+
+        // A
+        const int64_t           nPoints = int64_t(subGridPoints.size());
+        const Neon::index_3d    dim = outerGrid.getDimension();
+        std::vector<SortedCell> cells(nPoints);
+        std::vector<int>        cellBucket(nPoints);
+        bool                    allInside = true;
+#pragma omp parallel for reduction(&& : allInside)
+        for (int64_t i = 0; i < nPoints; i++) {
+            const Neon::index_3d& point = subGridPoints[i];
+            auto const&           cellProperties = outerGrid.getProperties(point);
+            if (!cellProperties.isInside()) {
+                allInside = false;
+                continue;
             }
+            cells[i].point = point;
+            cells[i].outerCell = cellProperties.getOuterCell();
+            cells[i].storageKey = helpGetStorageKey(cells[i].outerCell, point, dim);
+            cellBucket[i] = helpBucket(cellProperties.getSetIdx().idx(), cellProperties.getDataView());
+        }
+        if (!allInside) {
+            NEON_THROW_UNSUPPORTED_OPERATION("sGrid");
+        }
 
-            // B
-            Meta meta(-1, cellProperties.getOuterCell());
-            mStorage->map.addPoint(point,
-                                   meta,
-                                   cellProperties.getSetIdx(),
-                                   cellProperties.getDataView());
+        // B
+        for (int64_t i = 0; i < nPoints; i++) {
+            sortedCells[cellBucket[i]].push_back(cells[i]);
+        }
+#pragma omp parallel for schedule(dynamic)
+        for (int bucket = 0; bucket < 2 * nDevices; bucket++) {
+            auto& bucketCells = sortedCells[bucket];
+            std::sort(bucketCells.begin(), bucketCells.end(), [&](const SortedCell& a, const SortedCell& b) {
+                if (a.storageKey != b.storageKey) {
+                    return a.storageKey < b.storageKey;
+                }
+                return a.point.mPitch(dim) < b.point.mPitch(dim);
+            });
+            // Duplicated points are next to each other
+            auto last = std::unique(bucketCells.begin(), bucketCells.end(), [](const SortedCell& a, const SortedCell& b) {
+                return a.point == b.point;
+            });
+            bucketCells.erase(last, bucketCells.end());
         }
-    };
 
+        // C
+#pragma omp parallel for schedule(dynamic)
+        for (int bucket = 0; bucket < 2 * nDevices; bucket++) {
+            const int            setIdx = bucket / 2;
+            const Neon::DataView dw = (bucket % 2 == 0) ? Neon::DataView::INTERNAL : Neon::DataView::BOUNDARY;
+            const int32_t        firstOffset = (dw == Neon::DataView::INTERNAL) ? 0 : int32_t(sortedCells[bucket - 1].size());
+            const auto&          bucketCells = sortedCells[bucket];
+            mStorage->map.reserve(setIdx, dw, bucketCells.size());
+            for (size_t i = 0; i < bucketCells.size(); i++) {
+                Meta meta(firstOffset + int32_t(i), bucketCells[i].outerCell);
+                mStorage->map.addPoint(bucketCells[i].point, meta, setIdx, dw);
+            }
+        }
+    };
 
-    auto initCellClassification = [this]() -> void {
-        // Associating each point to an idx
-        // A. target internals
-        // B. target boundaries
+    auto initCellClassification = [&]() -> void {
+        // Internal cells come first, then boundary cells
         for (const auto& setIdx : this->getDevSet().getRange()) {
-            int32_t idxInPartition = 0;
-
-            mStorage->map.forEach(setIdx,
-                                  Neon::DataView::INTERNAL,
-                                  [&](const Neon::index_3d&, Meta& m) {
-                                      m.cellOffset = idxInPartition;
-                                      idxInPartition++;
-                                  });
-            const int32_t nInternal = idxInPartition + 1;
-            mStorage->map.forEach(setIdx,
-                                  Neon::DataView::BOUNDARY,
-                                  [&](const Neon::index_3d&, Meta& m) {
-                                      m.cellOffset = idxInPartition;
-                                      idxInPartition++;
-                                  });
-            const int32_t cellsPerPartition = idxInPartition;
-            const int32_t nBoundary = cellsPerPartition - nInternal;
-
-            mStorage->getCount(Neon::DataView::STANDARD)[setIdx.idx()] = cellsPerPartition;
+            const size_t nInternal = sortedCells[helpBucket(setIdx.idx(), Neon::DataView::INTERNAL)].size();
+            const size_t nBoundary = sortedCells[helpBucket(setIdx.idx(), Neon::DataView::BOUNDARY)].size();
+
+            mStorage->getCount(Neon::DataView::STANDARD)[setIdx.idx()] = nInternal + nBoundary;
             mStorage->getCount(Neon::DataView::INTERNAL)[setIdx.idx()] = nInternal;
             mStorage->getCount(Neon::DataView::BOUNDARY)[setIdx.idx()] = nBoundary;
         }
@@ -129,16 +161,15 @@ sGrid<OuterGridT>::sGrid(const OuterGridT&                  outerGrid,
                                                                                               Neon::MemoryOptions(),
                                                                                               mStorage->getCount(Neon::DataView::STANDARD));
         for (const auto& setIdx : this->getDevSet().getRange()) {
-            mStorage->map.forEach(setIdx,
-                                  Neon::DataView::INTERNAL,
-                                  [&](const Neon::index_3d&, Meta& m) {
-                                      this->mStorage->tableToOuterCell.eRef(setIdx, m.cellOffset) = m.outerCell;
-                                  });
-            mStorage->map.forEach(setIdx,
-                                  Neon::DataView::BOUNDARY,
-                                  [&](const Neon::index_3d&, Meta& m) {
-                                      this->mStorage->tableToOuterCell.eRef(setIdx, m.cellOffset) = m.outerCell;
-                                  });
+            const auto&   internalCells = sortedCells[helpBucket(setIdx.idx(), Neon::DataView::INTERNAL)];
+            const auto&   boundaryCells = sortedCells[helpBucket(setIdx.idx(), Neon::DataView::BOUNDARY)];
+            const int64_t nInternal = int64_t(internalCells.size());
+            const int64_t nCells = nInternal + int64_t(boundaryCells.size());
+#pragma omp parallel for
+            for (int64_t i = 0; i < nCells; i++) {
+                const auto& cell = (i < nInternal) ? internalCells[i] : boundaryCells[i - nInternal];
+                this->mStorage->tableToOuterCell.eRef(setIdx, i) = cell.outerCell;
+            }
         }
 
         if (this->getDevSet().type() != Neon::DeviceType::CPU && this->getDevSet().type() != Neon::DeviceType::OMP) {
@@ -192,6 +223,12 @@ auto sGrid<OuterGridT>::newField(const std::string   fieldUserName,
         NeonException exception("Dynamic and static cardinality values do not match.");
         NEON_THROW(exception);
     }
+    if (memoryOptions.getSpatialLayout() != Neon::SpatialLayout::linear) {
+        NeonException exception("sGrid::newField");
+        exception << "Spatial layout " << Neon::SpatialLayoutUtils::toString(memoryOptions.getSpatialLayout())
+                  << " is not supported, only dGrid supports bricked layouts.";
+        NEON_THROW(exception);
+    }
     sField<OuterGridT, T, C> field(fieldUserName, *this, cardinality, inactiveValue,
                                    haloStatus, dataUse, memoryOptions, mStorage->tableToOuterCell);
     return field;
@@ -235,6 +272,61 @@ auto sGrid<OuterGridT>::getContainer(const std::string& name,
     return kContainer;
 }
 
+template <typename OuterGridT>
+template <typename OuterField, typename T, int C>
+auto sGrid<OuterGridT>::getGatherContainer(const OuterField& outerField,
+                                           Field<T, C>&      field)
+    const
+    -> Neon::set::Container
+{
+    return getContainer("sGridGather", [&outerField, &field](Neon::set::Loader& loader) {
+        const auto outer = loader.load(outerField);
+        auto       local = loader.load(field);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) mutable {
+            const auto& outerCell = local.mapToOuterGrid(cell);
+            for (int c = 0; c < local.cardinality(); c++) {
+                local(cell, c) = outer(outerCell, c);
+            }
+        };
+    });
+}
+
+template <typename OuterGridT>
+template <typename OuterField, typename T, int C>
+auto sGrid<OuterGridT>::getScatterContainer(const Field<T, C>& field,
+                                            OuterField&        outerField)
+    const
+    -> Neon::set::Container
+{
+    return getContainer("sGridScatter", [&outerField, &field](Neon::set::Loader& loader) {
+        auto       outer = loader.load(outerField);
+        const auto local = loader.load(field);
+
+        return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) mutable {
+            const auto& outerCell = local.mapToOuterGrid(cell);
+            for (int c = 0; c < local.cardinality(); c++) {
+                outer(outerCell, c) = local(cell, c);
+            }
+        };
+    });
+}
+
+template <typename OuterGridT>
+auto sGrid<OuterGridT>::helpGetStorageKey(const typename OuterGridT::Cell::OuterCell& outerCell,
+                                          const Neon::index_3d&                       point,
+                                          const Neon::index_3d&                       dim)
+    -> int64_t
+{
+    using OuterCell = typename OuterGridT::Cell::OuterCell;
+    if constexpr (HasStorageOffset<OuterCell>::value) {
+        return int64_t(outerCell.getStorageOffset());
+    } else {
+        (void)outerCell;
+        return (int64_t(point.z) * dim.y + point.y) * dim.x + point.x;
+    }
+}
+
 template <typename OuterGridT>
 auto sGrid<OuterGridT>::isInsideDomain(const index_3d& idx) const -> bool
 {
@@ -0,0 +1,120 @@
+#pragma once
+#include "Neon/set/Backend.h"
+#include "Neon/set/MultiDeviceObjectInterface.h"
+#include "Neon/set/dist/Transport.h"
+
+namespace Neon {
+
+/**
+ * Result of a user defined reduction (see the grid reduce method).
+ * Unlike PatternScalar, T can be any copyable type (e.g. a value/index pair for an argmax)
+ * since no Blas engine is attached to it.
+ */
+template <typename T>
+class PatternReduction
+    : public set::interface::MultiDeviceObjectInterface<PatternReduction<T>, int>
+{
+
+   public:
+    using Partition = PatternReduction<T>;
+    using Type = T;
+
+    PatternReduction() = default;
+
+    PatternReduction(const PatternReduction& other) = default;
+
+    /**
+     * Constructor. The results are initialized with the given value
+     */
+    explicit PatternReduction(const T& init);
+
+    /**
+     * Accessing the result of the pattern
+     */
+    auto operator()() -> T&;
+
+    /**
+     * Accessing the result of the pattern
+     */
+    auto operator()() const -> const T&;
+
+    /**
+     * Accessing the result of the pattern based on the data view
+     */
+    auto operator()(const Neon::DataView& dataView) -> T&;
+
+    auto getPartition(const Neon::DeviceType& devType,
+                      const Neon::SetIdx&     idx,
+                      const Neon::DataView&   dataView = Neon::DataView::STANDARD) const
+        -> const Partition&;
+
+    auto getPartition(const Neon::DeviceType& devType,
+                      const Neon::SetIdx&     idx,
+                      const Neon::DataView&   dataView = Neon::DataView::STANDARD)
+        -> Partition&;
+
+    auto getPartition(Neon::Execution       execution,
+                      Neon::SetIdx          setIdx,
+                      const Neon::DataView& dataView = Neon::DataView::STANDARD) const
+        -> const Partition& final;
+
+    auto getPartition(Neon::Execution       execution,
+                      Neon::SetIdx          setIdx,
+                      const Neon::DataView& dataView = Neon::DataView::STANDARD)
+        -> Partition& final;
+
+   private:
+    auto updateIO(int streamId = 0)
+        -> void final;
+
+    auto updateCompute(int streamId = 0)
+        -> void final;
+
+    T boundaryResult;
+    T internalResult;
+    T standardResult;
+};
+
+namespace reduceOp {
+
+/**
+ * Associative operators to be used as combine operator of the grid reduce method.
+ * transportOp is the matching operation used to combine the results of the ranks of a distributed backend.
+ */
+template <typename T>
+struct Sum
+{
+    static constexpr Neon::set::dist::ReduceOp transportOp = Neon::set::dist::ReduceOp::sum;
+
+    NEON_CUDA_HOST_DEVICE inline auto operator()(const T& a, const T& b) const -> T
+    {
+        return a + b;
+    }
+};
+
+template <typename T>
+struct Min
+{
+    static constexpr Neon::set::dist::ReduceOp transportOp = Neon::set::dist::ReduceOp::min;
+
+    NEON_CUDA_HOST_DEVICE inline auto operator()(const T& a, const T& b) const -> T
+    {
+        return b < a ? b : a;
+    }
+};
+
+template <typename T>
+struct Max
+{
+    static constexpr Neon::set::dist::ReduceOp transportOp = Neon::set::dist::ReduceOp::max;
+
+    NEON_CUDA_HOST_DEVICE inline auto operator()(const T& a, const T& b) const -> T
+    {
+        return a < b ? b : a;
+    }
+};
+
+}  // namespace reduceOp
+}  // namespace Neon
+
+#include "Neon/domain/patterns/PatternReduction_imp.h"
@@ -0,0 +1,90 @@
+#pragma once
+#include "Neon/domain/patterns/PatternReduction.h"
+
+namespace Neon {
+
+template <typename T>
+PatternReduction<T>::PatternReduction(const T& init)
+    : boundaryResult(init),
+      internalResult(init),
+      standardResult(init)
+{
+}
+
+template <typename T>
+auto PatternReduction<T>::operator()() -> T&
+{
+    return standardResult;
+}
+
+template <typename T>
+auto PatternReduction<T>::operator()() const -> const T&
+{
+    return standardResult;
+}
+
+template <typename T>
+auto PatternReduction<T>::operator()(const Neon::DataView& dataView) -> T&
+{
+    if (dataView == Neon::DataView::STANDARD) {
+        return standardResult;
+
+    } else if (dataView == Neon::DataView::INTERNAL) {
+        return internalResult;
+
+    } else if (dataView == Neon::DataView::BOUNDARY) {
+        return boundaryResult;
+    } else {
+        NeonException exc("PatternReduction");
+        exc << "Unsupported dataView " << Neon::DataViewUtil::toString(dataView);
+        NEON_THROW(exc);
+    }
+}
+
+template <typename T>
+auto PatternReduction<T>::getPartition(
+    [[maybe_unused]] const Neon::DeviceType& devType,
+    [[maybe_unused]] const Neon::SetIdx&     idx,
+    [[maybe_unused]] const Neon::DataView&   dataView) const -> const Partition&
+{
+    return *this;
+}
+
+template <typename T>
+auto PatternReduction<T>::getPartition([[maybe_unused]] const DeviceType& devType,
+                                       [[maybe_unused]] const SetIdx&     idx,
+                                       [[maybe_unused]] const DataView&   dataView) -> PatternReduction::Partition&
+{
+    return *this;
+}
+
+template <typename T>
+auto PatternReduction<T>::getPartition([[maybe_unused]] Neon::Execution execution,
+                                       [[maybe_unused]] Neon::SetIdx    setIdx,
+                                       [[maybe_unused]] const DataView& dataView) const -> const PatternReduction::Partition&
+{
+    NEON_DEV_UNDER_CONSTRUCTION("");
+}
+
+template <typename T>
+auto PatternReduction<T>::getPartition([[maybe_unused]] Neon::Execution execution,
+                                       [[maybe_unused]] Neon::SetIdx    setIdx,
+                                       [[maybe_unused]] const DataView& dataView)
+    -> PatternReduction::Partition&
+{
+    NEON_DEV_UNDER_CONSTRUCTION("");
+}
+
+template <typename T>
+auto PatternReduction<T>::updateIO([[maybe_unused]] int streamId) -> void
+{
+    NEON_DEV_UNDER_CONSTRUCTION("");
+}
+
+template <typename T>
+auto PatternReduction<T>::updateCompute([[maybe_unused]] int streamId) -> void
+{
+    NEON_DEV_UNDER_CONSTRUCTION("");
+}
+
+}  // namespace Neon
@@ -0,0 +1,126 @@
+#pragma once
+#include <vector>
+
+#include "Neon/set/Backend.h"
+#include "Neon/set/MultiDeviceObjectInterface.h"
+#include "Neon/set/patterns/BlasSet.h"
+
+namespace Neon {
+
+/**
+ * Vector valued version of PatternScalar. It stores the results of several reductions
+ * that are computed by a single container (e.g. the grid multiDot pattern).
+ * When loaded into a container it is tagged as a REDUCE so that the Skeleton
+ * dependency analysis treats the container as a reduction node.
+ */
+template <typename T>
+class PatternScalarVector
+    : public set::interface::MultiDeviceObjectInterface<PatternScalarVector<T>, int>
+{
+
+   public:
+    using Partition = PatternScalarVector<T>;
+
+    PatternScalarVector() = default;
+
+    PatternScalarVector(const PatternScalarVector& other) = default;
+
+    /**
+     * Constructor which initializes internal data. Should be called by the grid
+     */
+    PatternScalarVector(Neon::Backend               backend /**< backend for allocating temp memory*/,
+                        int                         nScalars /**< number of results */,
+                        Neon::sys::patterns::Engine engine = Neon::sys::patterns::Engine::cuBlas);
+
+    /**
+     * Number of results stored in the pattern
+     */
+    auto size() const -> int;
+
+    /**
+     * Accessing the i-th result of the pattern
+     */
+    auto operator()(int i) -> T&;
+
+    /**
+     * Accessing the i-th result of the pattern
+     */
+    auto operator()(int i) const -> const T&;
+
+    /**
+     * Returns a unique identifier to be used for the loading process
+     */
+    auto uid() const -> Neon::set::MultiDeviceObjectUid;
+
+    auto getPartition(const Neon::DeviceType& devType,
+                      const Neon::SetIdx&     idx,
+                      const Neon::DataView&   dataView = Neon::DataView::STANDARD) const
+        -> const Partition&;
+
+    auto getPartition(const Neon::DeviceType& devType,
+                      const Neon::SetIdx&     idx,
+                      const Neon::DataView&   dataView = Neon::DataView::STANDARD)
+        -> Partition&;
+
+    auto getPartition(Neon::Execution       execution,
+                      Neon::SetIdx          setIdx,
+                      const Neon::DataView& dataView = Neon::DataView::STANDARD) const
+        -> const Partition& final;
+
+    auto getPartition(Neon::Execution       execution,
+                      Neon::SetIdx          setIdx,
+                      const Neon::DataView& dataView = Neon::DataView::STANDARD)
+        -> Partition& final;
+
+    /**
+     * Set what stream the computation will run on
+     */
+    auto setStream(int                   streamIdx,
+                   const Neon::DataView& dataView) const -> void;
+
+    /**
+     * Return temporary host memory used internally during the computation.
+     * Each device has one entry per result.
+     */
+    auto getTempMemory(const Neon::DataView& dataView) -> Neon::set::MemDevSet<T>&;
+
+    /**
+     * Return Blas handle to be used internally for the computation
+     */
+    auto getBlasSet(const Neon::DataView& dataView) -> Neon::set::patterns::BlasSet<T>&;
+
+    /**
+     * Accessing the results of the pattern based on the data view
+     */
+    auto operator()(const Neon::DataView& dataView) -> std::vector<T>&;
+
+   private:
+    auto updateIO(int streamId = 0)
+        -> void final;
+
+    auto updateCompute(int streamId = 0)
+        -> void final;
+
+    struct Data
+    {
+        // Host memory where each device stores its partial results for boundary, internal, and standard data view
+        Neon::set::MemDevSet<T>         hostTempBoundary;
+        Neon::set::MemDevSet<T>         hostTempInternal;
+        Neon::set::MemDevSet<T>         hostTempStandard;
+        Neon::set::patterns::BlasSet<T> blasSetBoundary;
+        Neon::set::patterns::BlasSet<T> blasSetInternal;
+        Neon::set::patterns::BlasSet<T> blasSetStandard;
+        Neon::DeviceType                devType;
+        Neon::Backend                   backend;
+        int                             nScalars = 0;
+    };
+    std::shared_ptr<Data> mData;
+
+    std::vector<T> boundaryResult;
+    std::vector<T> internalResult;
+    std::vector<T> standardResult;
+};
+
+}  // namespace Neon
+
+#include "Neon/domain/patterns/PatternScalarVector_imp.h"
@@ -0,0 +1,194 @@
+#pragma once
+#include "Neon/domain/patterns/PatternScalarVector.h"
+#include "Neon/set/DevSet.h"
+#include "Neon/set/patterns/BlasSet.h"
+
+namespace Neon {
+
+template <typename T>
+PatternScalarVector<T>::PatternScalarVector(Neon::Backend               backend,
+                                            int                         nScalars,
+                                            Neon::sys::patterns::Engine engine)
+{
+    if (nScalars <= 0) {
+        NeonException exc("PatternScalarVector");
+        exc << "Invalid number of results " << nScalars;
+        NEON_THROW(exc);
+    }
+    mData = std::make_shared<Data>();
+    mData->backend = backend;
+    mData->nScalars = nScalars;
+    mData->blasSetBoundary = Neon::set::patterns::BlasSet<T>(mData->backend.devSet(), engine);
+    mData->blasSetInternal = Neon::set::patterns::BlasSet<T>(mData->backend.devSet(), engine);
+    mData->blasSetStandard = Neon::set::patterns::BlasSet<T>(mData->backend.devSet(), engine);
+    mData->devType = backend.devType();
+
+    mData->hostTempBoundary = backend.devSet().template newMemDevSet<T>(Neon::DeviceType::CPU,
+                                                                        Neon::Allocator::CUDA_MEM_HOST, nScalars);
+    mData->hostTempInternal = backend.devSet().template newMemDevSet<T>(Neon::DeviceType::CPU,
+                                                                        Neon::Allocator::CUDA_MEM_HOST, nScalars);
+    mData->hostTempStandard = backend.devSet().template newMemDevSet<T>(Neon::DeviceType::CPU,
+                                                                        Neon::Allocator::CUDA_MEM_HOST, nScalars);
+
+    boundaryResult.assign(nScalars, T(0));
+    internalResult.assign(nScalars, T(0));
+    standardResult.assign(nScalars, T(0));
+}
+
+template <typename T>
+auto PatternScalarVector<T>::size() const -> int
+{
+    return static_cast<int>(standardResult.size());
+}
+
+template <typename T>
+auto PatternScalarVector<T>::operator()(int i) -> T&
+{
+    return standardResult[i];
+}
+
+template <typename T>
+auto PatternScalarVector<T>::operator()(int i) const -> const T&
+{
+    return standardResult[i];
+}
+
+template <typename T>
+auto PatternScalarVector<T>::uid() const -> Neon::set::MultiDeviceObjectUid
+{
+    void*                           addr = static_cast<void*>(mData.get());
+    Neon::set::MultiDeviceObjectUid uidRes = (size_t)addr;
+    return uidRes;
+}
+
+template <typename T>
+auto PatternScalarVector<T>::getPartition(
+    [[maybe_unused]] const Neon::DeviceType& devType,
+    [[maybe_unused]] const Neon::SetIdx&     idx,
+    [[maybe_unused]] const Neon::DataView&   dataView) const -> const Partition&
+{
+    return *this;
+}
+
+template <typename T>
+auto PatternScalarVector<T>::getPartition([[maybe_unused]] const DeviceType& devType,
+                                          [[maybe_unused]] const SetIdx&     idx,
+                                          [[maybe_unused]] const DataView&   dataView) -> PatternScalarVector::Partition&
+{
+    return *this;
+}
+
+template <typename T>
+auto PatternScalarVector<T>::getPartition([[maybe_unused]] Neon::Execution execution,
+                                          [[maybe_unused]] Neon::SetIdx    setIdx,
+                                          [[maybe_unused]] const DataView& dataView) const -> const PatternScalarVector::Partition&
+{
+    NEON_DEV_UNDER_CONSTRUCTION("");
+}
+
+template <typename T>
+auto PatternScalarVector<T>::getPartition([[maybe_unused]] Neon::Execution execution,
+                                          [[maybe_unused]] Neon::SetIdx    setIdx,
+                                          [[maybe_unused]] const DataView& dataView)
+    -> PatternScalarVector::Partition&
+{
+    NEON_DEV_UNDER_CONSTRUCTION("");
+}
+
+template <typename T>
+auto PatternScalarVector<T>::updateIO([[maybe_unused]] int streamId) -> void
+{
+    NEON_DEV_UNDER_CONSTRUCTION("");
+}
+
+template <typename T>
+auto PatternScalarVector<T>::updateCompute([[maybe_unused]] int streamId) -> void
+{
+    NEON_DEV_UNDER_CONSTRUCTION("");
+}
+
+template <typename T>
+auto PatternScalarVector<T>::operator()(const Neon::DataView& dataView) -> std::vector<T>&
+{
+    if (dataView == Neon::DataView::STANDARD) {
+        return standardResult;
+
+    } else if (dataView == Neon::DataView::INTERNAL) {
+        return internalResult;
+
+    } else if (dataView == Neon::DataView::BOUNDARY) {
+        return boundaryResult;
+    } else {
+        NeonException exc("PatternScalarVector");
+        exc << "Unsupported dataView " << Neon::DataViewUtil::toString(dataView);
+        NEON_THROW(exc);
+    }
+}
+
+template <typename T>
+auto PatternScalarVector<T>::setStream(int                   streamIdx,
+                                       const Neon::DataView& dataView) const -> void
+{
+    auto streams = mData->backend.streamSet(streamIdx);
+
+    if (mData->devType == Neon::DeviceType::CUDA) {
+        if (dataView == Neon::DataView::STANDARD) {
+            mData->blasSetStandard.setStream(streams);
+
+        } else if (dataView == Neon::DataView::INTERNAL) {
+            mData->blasSetInternal.setStream(streams);
+
+        } else if (dataView == Neon::DataView::BOUNDARY) {
+            mData->blasSetBoundary.setStream(streams);
+
+        } else {
+            NeonException exc("PatternScalarVector");
+            exc << "Unsupported dataView " << Neon::DataViewUtil::toString(dataView);
+            NEON_THROW(exc);
+        }
+    }
+}
+
+template <typename T>
+auto PatternScalarVector<T>::getTempMemory(const Neon::DataView& dataView) -> Neon::set::MemDevSet<T>&
+{
+    if (dataView == Neon::DataView::STANDARD) {
+        return mData->hostTempStandard;
+
+    } else if (dataView == Neon::DataView::INTERNAL) {
+        return mData->hostTempInternal;
+
+    } else if (dataView == Neon::DataView::BOUNDARY) {
+        return mData->hostTempBoundary;
+
+    } else {
+        NeonException exc("PatternScalarVector::tempMemory");
+        exc << "Unsupported dataView " << Neon::DataViewUtil::toString(dataView);
+        NEON_THROW(exc);
+    }
+}
+
+template <typename T>
+auto PatternScalarVector<T>::getBlasSet(const Neon::DataView& dataView) -> Neon::set::patterns::BlasSet<T>&
+{
+    if (dataView == Neon::DataView::STANDARD) {
+        return mData->blasSetStandard;
+
+    } else if (dataView == Neon::DataView::INTERNAL) {
+        return mData->blasSetInternal;
+
+    } else if (dataView == Neon::DataView::BOUNDARY) {
+        return mData->blasSetBoundary;
+
+    } else {
+        NeonException exc("PatternScalarVector::getBlasSet");
+        exc << "Unsupported dataView " << Neon::DataViewUtil::toString(dataView);
+        NEON_THROW(exc);
+    }
+}
+
+
+extern template class PatternScalarVector<float>;
+extern template class PatternScalarVector<double>;
+
+}  // namespace Neon
@@ -50,6 +50,12 @@ class PointHashTable
                   Meta const&)
         -> void;
 
+    /**
+     * Reserve space for at least the specified number of points
+     */
+    auto reserve(size_t nPoints)
+        -> void;
+
     /**
      * Execute a function for each element in the hash table
      */
@@ -37,6 +37,15 @@ class PointHashTableSet
                   const DataView&)
         -> void;
 
+    /**
+     * Reserve space for at least nPoints in the table of a partition and data view.
+     * Tables of different partitions or data views can be filled concurrently.
+     */
+    auto reserve(const SetIdx& setIdx,
+                 const DataView&,
+                 size_t nPoints)
+        -> void;
+
     template <typename UserLambda>
     auto forEach(const UserLambda&);
 
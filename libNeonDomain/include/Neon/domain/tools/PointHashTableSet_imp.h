@@ -103,6 +103,14 @@ auto PointHashTableSet<IntegerT, MetaT>::addPoint(const PointHashTableSet::Point
     mTablesSetDw[setIdx][HelpFromDataViewToLocalNaming(dw)].addPoint(p, meta);
 }
 
+template <typename IntegerT, typename MetaT>
+auto PointHashTableSet<IntegerT, MetaT>::reserve(const SetIdx&   setIdx,
+                                                 const DataView& dw,
+                                                 size_t          nPoints) -> void
+{
+    mTablesSetDw[setIdx][HelpFromDataViewToLocalNaming(dw)].reserve(nPoints);
+}
+
 template <typename IntegerT, typename MetaT>
 template <typename UserLambda>
 auto PointHashTableSet<IntegerT, MetaT>::forEach(const UserLambda& userLambda)
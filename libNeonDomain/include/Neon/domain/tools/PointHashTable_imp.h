@@ -50,6 +50,13 @@ auto PointHashTable<IntegerT, MetaT>::addPoint(const Point& point,
     mMap.insert({key, data});
 }
 
+template <typename IntegerT, typename MetaT>
+auto PointHashTable<IntegerT, MetaT>::reserve(size_t nPoints)
+    -> void
+{
+    mMap.reserve(nPoints);
+}
+
 template <typename IntegerT, typename MetaT>
 auto PointHashTable<IntegerT, MetaT>::helpGetKey(const Point& point) -> Key
 {
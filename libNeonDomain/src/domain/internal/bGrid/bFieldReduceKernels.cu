@@ -6,66 +6,73 @@
 
 namespace Neon::domain::internal::bGrid {
 
-template <typename T, int C>
-auto bField<T, C>::dot(Neon::set::patterns::BlasSet<T>& blasSet,
-                       const bField<T>&                 input,
-                       Neon::set::MemDevSet<T>&         output,
-                       const Neon::DataView&            dataView) -> void
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::dot(Neon::set::patterns::BlasSet<T>& blasSet,
+                                  const bField<T, 0, BlockSize>&   input,
+                                  Neon::set::MemDevSet<T>&         output,
+                                  const Neon::DataView&            dataView) -> void
 {
     //TODO this only works for a  single GPU
     if (dataView != Neon::DataView::STANDARD) {
         NEON_DEV_UNDER_CONSTRUCTION("bField::dot");
     }
 
-    Neon::domain::internal::dotCUB<T,
-                                   Cell::sBlockSizeX,
-                                   Cell::sBlockSizeY,
-                                   Cell::sBlockSizeZ>(blasSet,
-                                                      *mData->mGrid,
-                                                      *this,
-                                                      input,
-                                                      output,
-                                                      dataView);
+    if constexpr (Cell::sBlockVolume > 1024) {
+        NEON_THROW_UNSUPPORTED_OPTION("bField::dot on CUDA requires blocks of at most 1024 voxels");
+    } else {
+        Neon::domain::internal::dotCUB<T,
+                                       Cell::sBlockSizeX,
+                                       Cell::sBlockSizeY,
+                                       Cell::sBlockSizeZ>(blasSet,
+                                                          *mData->mGrid,
+                                                          *this,
+                                                          input,
+                                                          output,
+                                                          dataView);
+    }
 }
 
 
-template <typename T, int C>
-auto bField<T, C>::norm2(Neon::set::patterns::BlasSet<T>& blasSet,
-                         Neon::set::MemDevSet<T>&         output,
-                         const Neon::DataView&            dataView) -> void
+template <typename T, int C, int BlockSize>
+auto bField<T, C, BlockSize>::norm2(Neon::set::patterns::BlasSet<T>& blasSet,
+                                    Neon::set::MemDevSet<T>&         output,
+                                    const Neon::DataView&            dataView) -> void
 {
     //TODO this only works for a  single GPU
     if (dataView != Neon::DataView::STANDARD) {
         NEON_DEV_UNDER_CONSTRUCTION("bField::norm2");
     }
 
-    Neon::domain::internal::norm2CUB<T,
-                                     Cell::sBlockSizeX,
-                                     Cell::sBlockSizeY,
-                                     Cell::sBlockSizeZ>(blasSet,
-                                                        *mData->mGrid,
-                                                        *this,
-                                                        output,
-                                                        dataView);
+    if constexpr (Cell::sBlockVolume > 1024) {
+        NEON_THROW_UNSUPPORTED_OPTION("bField::norm2 on CUDA requires blocks of at most 1024 voxels");
+    } else {
+        Neon::domain::internal::norm2CUB<T,
+                                         Cell::sBlockSizeX,
+                                         Cell::sBlockSizeY,
+                                         Cell::sBlockSizeZ>(blasSet,
+                                                            *mData->mGrid,
+                                                            *this,
+                                                            output,
+                                                            dataView);
+    }
 }
 
-template void bField<double, 0>::dot(Neon::set::patterns::BlasSet<double>&,
-                                     const bField<double>&,
-                                     Neon::set::MemDevSet<double>&,
-                                     const Neon::DataView&);
-
-template void bField<float, 0>::dot(Neon::set::patterns::BlasSet<float>&,
-                                    const bField<float>&,
-                                    Neon::set::MemDevSet<float>&,
-                                    const Neon::DataView&);
-
-template void bField<double, 0>::norm2(Neon::set::patterns::BlasSet<double>&,
-                                       Neon::set::MemDevSet<double>&,
-                                       const Neon::DataView&);
+#define NEON_BFIELD_REDUCE_INSTANTIATION(TYPE, BLOCK_SIZE)                                 \
+    template void bField<TYPE, 0, BLOCK_SIZE>::dot(Neon::set::patterns::BlasSet<TYPE>&,    \
+                                                   const bField<TYPE, 0, BLOCK_SIZE>&,     \
+                                                   Neon::set::MemDevSet<TYPE>&,            \
+                                                   const Neon::DataView&);                 \
+    template void bField<TYPE, 0, BLOCK_SIZE>::norm2(Neon::set::patterns::BlasSet<TYPE>&,  \
+                                                     Neon::set::MemDevSet<TYPE>&,          \
+                                                     const Neon::DataView&);
 
-template void bField<float, 0>::norm2(Neon::set::patterns::BlasSet<float>&,
-                                      Neon::set::MemDevSet<float>&,
-                                      const Neon::DataView&);
+NEON_BFIELD_REDUCE_INSTANTIATION(double, 4)
+NEON_BFIELD_REDUCE_INSTANTIATION(float, 4)
+NEON_BFIELD_REDUCE_INSTANTIATION(double, 8)
+NEON_BFIELD_REDUCE_INSTANTIATION(float, 8)
+NEON_BFIELD_REDUCE_INSTANTIATION(double, 16)
+NEON_BFIELD_REDUCE_INSTANTIATION(float, 16)
 
+#undef NEON_BFIELD_REDUCE_INSTANTIATION
 
-}  // namespace Neon::domain::internal::bGrid
\ No newline at end of file
+}  // namespace Neon::domain::internal::bGrid
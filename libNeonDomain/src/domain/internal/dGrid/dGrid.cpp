@@ -19,6 +19,9 @@ auto dGrid::flattenedLengthSet(Neon::DataView dataView) const -> const Neon::set
 
 auto dGrid::setReduceEngine(Neon::sys::patterns::Engine eng) -> void
 {
+    if (eng == Neon::sys::patterns::Engine::deterministic && getBackend().devType() != Neon::DeviceType::CPU) {
+        NEON_THROW_UNSUPPORTED_OPTION("The deterministic reduction engine is only supported on CPU backends");
+    }
     m_data->reduceEngine = eng;
 }
 
@@ -208,8 +211,9 @@ auto dGrid::getProperties(const index_3d& idx) const -> GridBaseTemplate::CellPr
         Neon::SetIdx   setIdx;
         Neon::DataView dataView = DataView::BOUNDARY;
         for (int i = 0; i < this->getDevSet().setCardinality(); i++) {
+            const int zCounterBegin = zCounter;
             zCounter += m_data->partitionDims[i].z;
-            if (idx.z < zCounter) {
+            if (zCounterBegin <= idx.z && idx.z < zCounter) {
                 setIdx = i;
             }
             if ((zCounterPrevious + m_data->halo.z >= idx.z) &&
@@ -0,0 +1,158 @@
+#include "Neon/domain/internal/eGrid/eCellOrdering.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace Neon::domain::internal::eGrid {
+
+auto CellOrderingUtils::toString(const CellOrdering& config) -> const char*
+{
+    switch (config) {
+        case CellOrdering::scan: {
+            return "scan";
+        }
+        case CellOrdering::morton: {
+            return "morton";
+        }
+        case CellOrdering::hilbert: {
+            return "hilbert";
+        }
+        case CellOrdering::rcm: {
+            return "rcm";
+        }
+        default: {
+            NEON_THROW_UNSUPPORTED_OPTION("");
+        }
+    }
+}
+
+auto CellOrderingUtils::toInt(const CellOrdering& config) -> int
+{
+    return static_cast<int>(config);
+}
+
+auto CellOrderingUtils::fromInt(const int& config) -> CellOrdering
+{
+    for (int i = 0; i < nConfig; i++) {
+        if (config == i) {
+            return static_cast<CellOrdering>(i);
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto CellOrderingUtils::fromString(const std::string& config) -> CellOrdering
+{
+    for (int i = 0; i < nConfig; i++) {
+        const CellOrdering ordering = static_cast<CellOrdering>(i);
+        if (config == toString(ordering)) {
+            return ordering;
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto CellOrderingUtils::mortonCode(const Neon::index_3d& idx) -> uint64_t
+{
+    auto spread = [](uint64_t v) -> uint64_t {
+        v &= 0x1fffff;
+        v = (v | v << 32) & 0x1f00000000ffff;
+        v = (v | v << 16) & 0x1f0000ff0000ff;
+        v = (v | v << 8) & 0x100f00f00f00f00f;
+        v = (v | v << 4) & 0x10c30c30c30c30c3;
+        v = (v | v << 2) & 0x1249249249249249;
+        return v;
+    };
+    return spread(uint64_t(idx.x)) | (spread(uint64_t(idx.y)) << 1) | (spread(uint64_t(idx.z)) << 2);
+}
+
+auto CellOrderingUtils::hilbertCode(const Neon::index_3d& idx, int nBits) -> uint64_t
+{
+    // J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707 (2004).
+    // Coordinates are converted in place to the transposed Hilbert index.
+    if (nBits <= 0) {
+        return 0;
+    }
+    uint32_t       X[3] = {uint32_t(idx.x), uint32_t(idx.y), uint32_t(idx.z)};
+    const uint32_t M = 1u << (nBits - 1);
+
+    for (uint32_t Q = M; Q > 1; Q >>= 1) {
+        const uint32_t P = Q - 1;
+        for (int i = 0; i < 3; i++) {
+            if (X[i] & Q) {
+                X[0] ^= P;
+            } else {
+                const uint32_t t = (X[0] ^ X[i]) & P;
+                X[0] ^= t;
+                X[i] ^= t;
+            }
+        }
+    }
+    for (int i = 1; i < 3; i++) {
+        X[i] ^= X[i - 1];
+    }
+    uint32_t t = 0;
+    for (uint32_t Q = M; Q > 1; Q >>= 1) {
+        if (X[2] & Q) {
+            t ^= Q - 1;
+        }
+    }
+    for (int i = 0; i < 3; i++) {
+        X[i] ^= t;
+    }
+
+    uint64_t code = 0;
+    for (int bit = nBits - 1; bit >= 0; bit--) {
+        for (int i = 0; i < 3; i++) {
+            code = (code << 1) | ((X[i] >> bit) & 1u);
+        }
+    }
+    return code;
+}
+
+auto CellOrderingUtils::reverseCuthillMcKee(const std::vector<int64_t>& offsets,
+                                            const std::vector<int64_t>& neighbours)
+    -> std::vector<int64_t>
+{
+    const int64_t n = int64_t(offsets.size()) - 1;
+    if (n <= 0) {
+        return {};
+    }
+    auto degree = [&](int64_t v) { return offsets[v + 1] - offsets[v]; };
+    auto byDegree = [&](int64_t a, int64_t b) {
+        return degree(a) < degree(b) || (degree(a) == degree(b) && a < b);
+    };
+
+    std::vector<int64_t> candidates(n);
+    std::iota(candidates.begin(), candidates.end(), 0);
+    std::sort(candidates.begin(), candidates.end(), byDegree);
+
+    std::vector<bool>    visited(n, false);
+    std::vector<int64_t> order;
+    std::vector<int64_t> next;
+    order.reserve(n);
+    for (int64_t start : candidates) {
+        if (visited[start]) {
+            continue;
+        }
+        visited[start] = true;
+        order.push_back(start);
+        for (size_t head = order.size() - 1; head < order.size(); head++) {
+            const int64_t v = order[head];
+            next.clear();
+            for (int64_t e = offsets[v]; e < offsets[v + 1]; e++) {
+                const int64_t ngh = neighbours[e];
+                if (!visited[ngh]) {
+                    visited[ngh] = true;
+                    next.push_back(ngh);
+                }
+            }
+            std::sort(next.begin(), next.end(), byDegree);
+            order.insert(order.end(), next.begin(), next.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+}  // namespace Neon::domain::internal::eGrid
@@ -7,17 +7,34 @@ dsBuilder_t::dsBuilder_t(const Neon::set::DevSet&                          devSe
                          const Neon::index_3d&                             sizeDomain,
                          const std::function<bool(const Neon::index_3d&)>& inOut,
                          int                                               nPartitions,
-                         const Neon::domain::Stencil&                      stencil)
+                         const Neon::domain::Stencil&                      stencil,
+                         CellOrdering                                      cellOrdering,
+                         ConnectivityMode                                  connectivityMode)
 {
-    p_compute_partition(devSet, sizeDomain, inOut, nPartitions, stencil);
+    p_compute_partition(devSet, sizeDomain, inOut, nPartitions, stencil, cellOrdering, connectivityMode);
+}
+
+dsBuilder_t::dsBuilder_t(const Neon::set::DevSet&           devSet,
+                         const Neon::index_3d&              sizeDomain,
+                         const std::vector<Neon::index_3d>& activeCells,
+                         int                                nPartitions,
+                         const Neon::domain::Stencil&       stencil,
+                         CellOrdering                       cellOrdering,
+                         ConnectivityMode                   connectivityMode)
+{
+    p_compute_partition(devSet, sizeDomain, activeCells, nPartitions, stencil, cellOrdering, connectivityMode);
 }
 
 
-void dsBuilder_t::p_compute_partition(const Neon::set::DevSet&                          devSet,
-                                      const Neon::index_3d&                             sizeDomain,
-                                      const std::function<bool(const Neon::index_3d&)>& inOut,
-                                      int                                               nPartitions,
-                                      const Neon::domain::Stencil&                      stencil)
+template <typename ActiveCells>
+auto dsBuilder_t::p_compute_partition(const Neon::set::DevSet&     devSet,
+                                      const Neon::index_3d&        sizeDomain,
+                                      const ActiveCells&           activeCells,
+                                      int                          nPartitions,
+                                      const Neon::domain::Stencil& stencil,
+                                      CellOrdering                 cellOrdering,
+                                      ConnectivityMode             connectivityMode)
+    -> void
 {
 
     switch (m_schema.schema) {
@@ -29,7 +46,7 @@ void dsBuilder_t::p_compute_partition(const Neon::set::DevSet&
                        partitioning_et                            prtSchema,
                        const Neon::domain::stencil_t&                           stencil)
              */
-            flatPartitioning_t flat(devSet, sizeDomain, inOut, nPartitions, stencil);
+            flatPartitioning_t flat(devSet, sizeDomain, activeCells, nPartitions, stencil, cellOrdering, connectivityMode);
             m_frame = flat.getFrame();
             // m_frame->exportTopology_vti("frame_test.vti");
             return;
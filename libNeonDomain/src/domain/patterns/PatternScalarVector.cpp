@@ -0,0 +1,6 @@
+#include "Neon/domain/patterns/PatternScalarVector.h"
+
+namespace Neon {
+template class PatternScalarVector<float>;
+template class PatternScalarVector<double>;
+}  // namespace Neon
\ No newline at end of file
@@ -0,0 +1,270 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Neon/Neon.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/dist/ShmTransport.h"
+#include "Neon/set/dist/TcpTransport.h"
+#include "Neon/skeleton/Skeleton.h"
+
+using Type = double;
+using TransportFactory = std::function<std::shared_ptr<Neon::set::dist::Transport>(int rank, int nRanks)>;
+
+template <typename Field>
+auto laplace(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Laplace",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                for (int card = 0; card < xLocal.cardinality(); card++) {
+                    Type res = 0;
+                    for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                        auto neighbor = xLocal.nghVal(cell, nghIdx, card, Type(0));
+                        if (neighbor.isValid) {
+                            res += neighbor.value;
+                        }
+                    }
+                    yLocal(cell, card) = res - 6 * xLocal(cell, card);
+                }
+            };
+        });
+}
+
+struct LaplaceResult
+{
+    std::vector<Type> values /**< value of every cell of the partitions owned by the rank, -1 elsewhere */;
+    std::vector<Type> dots /**< dot product of each run of the sequence */;
+    std::vector<Type> reductions /**< sum, min and max of the first output for each run of the sequence */;
+};
+
+/**
+ * User defined reduction of the values of a field
+ */
+template <typename Field, typename CombineOp>
+auto reduceValues(const Field& y, CombineOp combine, Type identity, Neon::PatternReduction<Type>& result) -> Neon::set::Container
+{
+    return y.getGrid().reduce(
+        "Reduce",
+        [&](Neon::set::Loader& loader) {
+            const auto& yLocal = loader.load(y);
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) -> Type {
+                Type res = identity;
+                for (int card = 0; card < yLocal.cardinality(); card++) {
+                    res = combine(res, yLocal(cell, card));
+                }
+                return res;
+            };
+        },
+        combine, identity, result);
+}
+
+/**
+ * Runs a stencil and dot product sequence on nPartitions partitions.
+ * When distributed, the partitions are shared among the ranks of the transport,
+ * otherwise the rank computes all of them. In both cases only the values of
+ * the partitions owned by the rank are returned.
+ */
+template <typename Grid>
+auto runLaplace(const std::shared_ptr<Neon::set::dist::Transport>& transport,
+                bool                                               distributed,
+                int                                                nPartitions,
+                Neon::skeleton::Occ                                occ,
+                Neon::MemoryLayout                                 memoryLayout,
+                bool                                               withDot) -> LaplaceResult
+{
+    Neon::Backend backend(nPartitions, Neon::Runtime::openmp);
+    if (distributed) {
+        backend.setTransport(transport);
+    }
+
+    const Neon::index_3d dim(14, 11, 32);
+    auto                 isInSphere = [&](const Neon::index_3d& idx) {
+        const double cx = idx.x - dim.x / 2.0;
+        const double cy = idx.y - dim.y / 2.0;
+        const double cz = idx.z - dim.z / 2.0;
+        return std::sqrt(cx * cx + cy * cy + cz * cz) < 11;
+    };
+    Grid grid(backend, dim, isInSphere, Neon::domain::Stencil::s7_Laplace_t());
+
+    const int           cardinality = 2;
+    Neon::MemoryOptions memoryOptions = backend.getMemoryOptions(memoryLayout);
+    auto                X = grid.template newField<Type>("X", cardinality, 0, Neon::DataUse::IO_COMPUTE, memoryOptions);
+    auto                Y = grid.template newField<Type>("Y", cardinality, 0, Neon::DataUse::IO_COMPUTE, memoryOptions);
+    auto                dot = grid.template newPatternScalar<Type>();
+
+    Neon::PatternReduction<Type> sum(0);
+    Neon::PatternReduction<Type> min(0);
+    Neon::PatternReduction<Type> max(0);
+
+    X.forEachActiveCell([](const Neon::index_3d& idx, const int& card, Type& val) {
+        val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29 + card * 5) % 11);
+    });
+    Y.forEachActiveCell([](const Neon::index_3d&, const int&, Type& val) { val = 0; });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+    dot() = 0;
+
+    std::vector<Neon::set::Container> ops{laplace(X, Y),
+                                          reduceValues(Y, Neon::reduceOp::Sum<Type>(), Type(0), sum),
+                                          reduceValues(Y, Neon::reduceOp::Min<Type>(), Type(1e30), min),
+                                          reduceValues(Y, Neon::reduceOp::Max<Type>(), Type(-1e30), max)};
+    if (withDot) {
+        ops.push_back(grid.dot("Dot", Y, Y, dot));
+    }
+    ops.push_back(laplace(Y, X));
+
+    LaplaceResult            res;
+    Neon::skeleton::Skeleton skl(backend);
+    Neon::skeleton::Options  opt(occ, Neon::set::TransferMode::get);
+    skl.sequence(ops, "domainUt_distributed", opt);
+    for (int i = 0; i < 2; i++) {
+        skl.run();
+        backend.syncAll();
+        res.dots.push_back(dot());
+        res.reductions.insert(res.reductions.end(), {sum(), min(), max()});
+    }
+    X.updateIO(0);
+    backend.syncAll();
+
+    res.values.assign(dim.rMulTyped<size_t>() * cardinality, -1);
+    X.forEachActiveCell([&](const Neon::index_3d& idx, const int& card, Type& val) {
+        const int setIdx = grid.getProperties(idx).getSetIdx().idx();
+        if (transport->ownerRank(setIdx, nPartitions) == transport->rank()) {
+            res.values[idx.mPitch(dim) * cardinality + card] = val;
+        }
+    });
+    return res;
+}
+
+/**
+ * Runs the sequence distributed over the ranks and on this rank only,
+ * and compares the values of the partitions owned by the rank
+ */
+template <typename Grid>
+auto rankMain(Neon::set::dist::Transport&             transport,
+              const std::vector<Neon::MemoryLayout>& memoryLayouts,
+              bool                                    withDot) -> bool
+{
+    // The transport is owned by the caller
+    std::shared_ptr<Neon::set::dist::Transport> transportPtr(&transport, [](Neon::set::dist::Transport*) {});
+
+    const int nPartitions = 4;
+    bool      isOk = true;
+    for (auto occ : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard, Neon::skeleton::Occ::extended}) {
+        for (auto memoryLayout : memoryLayouts) {
+            const auto distributed = runLaplace<Grid>(transportPtr, true, nPartitions, occ, memoryLayout, withDot);
+            const auto local = runLaplace<Grid>(transportPtr, false, nPartitions, occ, memoryLayout, withDot);
+            isOk = isOk && distributed.values == local.values;
+            for (size_t i = 0; i < local.dots.size(); i++) {
+                isOk = isOk && std::abs(distributed.dots[i] - local.dots[i]) <= 1e-12 * std::abs(local.dots[i]);
+            }
+            // Every rank holds the reduction over all the partitions
+            for (size_t i = 0; i < local.reductions.size(); i++) {
+                isOk = isOk && std::abs(distributed.reductions[i] - local.reductions[i]) <= 1e-12 * std::abs(local.reductions[i]);
+            }
+        }
+    }
+    transport.barrier();
+    return isOk;
+}
+
+/**
+ * Runs rankMain in nRanks forked processes and returns true if all of them succeed
+ */
+auto runRanks(int                                                     nRanks,
+              const TransportFactory&                                 factory,
+              const std::function<bool(Neon::set::dist::Transport&)>& rankMain) -> bool
+{
+    std::vector<pid_t> children;
+    for (int rank = 0; rank < nRanks; rank++) {
+        const pid_t pid = fork();
+        if (pid == 0) {
+            bool isOk = false;
+            try {
+                auto transport = factory(rank, nRanks);
+                isOk = rankMain(*transport);
+            } catch (...) {
+                isOk = false;
+            }
+            _exit(isOk ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+    bool isOk = true;
+    for (pid_t pid : children) {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        isOk = isOk && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    return isOk;
+}
+
+auto shmFactory(const std::string& testName) -> TransportFactory
+{
+    const std::string name = "domainUt_distributed_" + testName + "_" + std::to_string(getpid());
+    return [name](int rank, int nRanks) {
+        return std::make_shared<Neon::set::dist::ShmTransport>(name, rank, nRanks);
+    };
+}
+
+TEST(distributed, dGrid)
+{
+    Neon::init();
+    for (int nRanks : {2, 3}) {
+        ASSERT_TRUE(runRanks(nRanks, shmFactory("dGrid" + std::to_string(nRanks)), [](Neon::set::dist::Transport& transport) {
+            return rankMain<Neon::domain::dGrid>(transport, {Neon::MemoryLayout::structOfArrays, Neon::MemoryLayout::arrayOfStructs}, true);
+        })) << "nRanks " << nRanks;
+    }
+}
+
+TEST(distributed, eGrid)
+{
+    Neon::init();
+    // eGrid does not support the dot pattern, only user defined reductions
+    for (int nRanks : {2, 3}) {
+        ASSERT_TRUE(runRanks(nRanks, shmFactory("eGrid" + std::to_string(nRanks)), [](Neon::set::dist::Transport& transport) {
+            return rankMain<Neon::domain::eGrid>(transport, {Neon::MemoryLayout::structOfArrays}, false);
+        })) << "nRanks " << nRanks;
+    }
+}
+
+TEST(distributed, dGridTcp)
+{
+    Neon::init();
+    const int basePort = 20000 + int(getpid() % 20000);
+    ASSERT_TRUE(runRanks(
+        2, [basePort](int rank, int nRanks) { return std::make_shared<Neon::set::dist::TcpTransport>(rank, nRanks, basePort); },
+        [](Neon::set::dist::Transport& transport) {
+            return rankMain<Neon::domain::dGrid>(transport, {Neon::MemoryLayout::structOfArrays}, true);
+        }));
+}
+
+TEST(distributed, backendOptions)
+{
+    Neon::init();
+    auto transport = std::make_shared<Neon::set::dist::ShmTransport>("domainUt_distributed_options_" + std::to_string(getpid()), 0, 1);
+
+    Neon::Backend backend(2, Neon::Runtime::openmp);
+    backend.setTransport(transport);
+    ASSERT_TRUE(backend.transport() != nullptr);
+    ASSERT_ANY_THROW(backend.setCpuStreams(true));
+    ASSERT_ANY_THROW(backend.setCpuZeroCopyHalo(true));
+
+    backend.setTransport(nullptr);
+    backend.setCpuStreams(true);
+    ASSERT_ANY_THROW(backend.setTransport(transport));
+}
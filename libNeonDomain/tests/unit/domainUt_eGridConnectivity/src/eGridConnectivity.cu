@@ -0,0 +1,128 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+#include "Neon/Neon.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+using Grid = Neon::domain::eGrid;
+using Type = int64_t;
+using Neon::domain::internal::eGrid::CellOrdering;
+using Neon::domain::internal::eGrid::ConnectivityMode;
+
+/**
+ * Weighted sum over all the neighbours of the stencil.
+ * The weight depends on the direction, so swapped neighbours change the result.
+ */
+template <typename Field>
+auto stencilSum(const Field& x, Field& y, int nNeighbours) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "StencilSum",
+        [&, nNeighbours](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                Type res = 0;
+                for (int8_t nghIdx = 0; nghIdx < nNeighbours; ++nghIdx) {
+                    auto neighbor = xLocal.nghVal(cell, nghIdx, 0, Type(0));
+                    if (neighbor.isValid) {
+                        res += (nghIdx + 1) * neighbor.value;
+                    } else {
+                        res -= nghIdx + 1;
+                    }
+                }
+                yLocal(cell, 0) = res % 1000003 - xLocal(cell, 0);
+            };
+        });
+}
+
+/**
+ * Irregular domain: a ball with holes
+ */
+auto isActive(const Neon::index_3d& dim, const Neon::index_3d& idx) -> bool
+{
+    const double cx = idx.x - dim.x / 2.0;
+    const double cy = idx.y - dim.y / 2.0;
+    const double cz = idx.z - dim.z / 2.0;
+    const double r = std::sqrt(cx * cx + cy * cy + cz * cz);
+    return r < dim.x / 2.0 && (idx.x * 3 + idx.y * 5 + idx.z * 7) % 11 != 0;
+}
+
+/**
+ * Runs two stencil iterations and returns the result for every cell of the domain
+ */
+auto runStencil(const Neon::index_3d&        dim,
+                int                          nPartitions,
+                const Neon::domain::Stencil& stencil,
+                CellOrdering                 ordering,
+                ConnectivityMode             mode,
+                size_t&                      connectivityBytes) -> std::vector<Type>
+{
+    Neon::Backend backend(nPartitions, Neon::Runtime::openmp);
+
+    Grid grid(
+        backend, dim, [&](const Neon::index_3d& idx) { return isActive(dim, idx); },
+        stencil, Neon::Vec_3d<double>(1, 1, 1), Neon::Vec_3d<double>(0, 0, 0), false, ordering, mode);
+    connectivityBytes = grid.getConnectivityBytes();
+
+    auto X = grid.newField<Type>("X", 1, 0);
+    auto Y = grid.newField<Type>("Y", 1, 0);
+
+    X.forEachActiveCell([](const Neon::index_3d& idx, const int&, Type& val) {
+        val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29) % 101);
+    });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+
+    const int                nNeighbours = stencil.nNeighbours();
+    Neon::skeleton::Skeleton skl(backend);
+    skl.sequence({stencilSum(X, Y, nNeighbours), stencilSum(Y, X, nNeighbours)}, "domainUt_eGridConnectivity");
+    skl.run();
+    backend.syncAll();
+    X.updateIO(0);
+    backend.syncAll();
+
+    std::vector<Type> res(dim.rMulTyped<size_t>(), -1);
+    X.forEachActiveCell([&](const Neon::index_3d& idx, const int&, Type& val) {
+        res[idx.mPitch(dim)] = val;
+    });
+    return res;
+}
+
+void runCompactVsFull(const Neon::index_3d& dim, const Neon::domain::Stencil& stencil)
+{
+    for (int nPartitions : {1, 3}) {
+        for (auto ordering : {CellOrdering::scan, CellOrdering::morton, CellOrdering::rcm}) {
+            size_t     fullBytes = 0;
+            size_t     compactBytes = 0;
+            const auto golden = runStencil(dim, nPartitions, stencil, ordering, ConnectivityMode::full, fullBytes);
+            const auto compact = runStencil(dim, nPartitions, stencil, ordering, ConnectivityMode::compact, compactBytes);
+            ASSERT_EQ(golden, compact);
+            ASSERT_LT(compactBytes, fullBytes);
+        }
+    }
+}
+
+TEST(eGridConnectivity, s7)
+{
+    Neon::init();
+    runCompactVsFull(Neon::index_3d(20, 22, 31), Neon::domain::Stencil::s7_Laplace_t());
+}
+
+TEST(eGridConnectivity, s27)
+{
+    Neon::init();
+    runCompactVsFull(Neon::index_3d(20, 22, 31), Neon::domain::Stencil::s27_t());
+}
+
+TEST(eGridConnectivity, overflow)
+{
+    Neon::init();
+    // On a 64^3 domain the Morton order places some neighbours more than 2^15 cells apart,
+    // so part of the connectivity goes through the overflow table
+    runCompactVsFull(Neon::index_3d(64, 64, 64), Neon::domain::Stencil::s7_Laplace_t());
+}
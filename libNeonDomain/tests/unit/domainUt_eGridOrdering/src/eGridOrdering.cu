@@ -0,0 +1,133 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <map>
+
+#include "Neon/Neon.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+using Grid = Neon::domain::eGrid;
+using Type = int64_t;
+using Neon::domain::internal::eGrid::CellOrdering;
+using Neon::domain::internal::eGrid::CellOrderingUtils;
+
+template <typename Field>
+auto laplace(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Laplace",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                Type res = 0;
+                for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                    auto neighbor = xLocal.nghVal(cell, nghIdx, 0, Type(0));
+                    if (neighbor.isValid) {
+                        res += neighbor.value;
+                    }
+                }
+                yLocal(cell, 0) = res - 6 * xLocal(cell, 0);
+            };
+        });
+}
+
+/**
+ * Irregular domain: a ball with holes
+ */
+auto isActive(const Neon::index_3d& dim, const Neon::index_3d& idx) -> bool
+{
+    const double cx = idx.x - dim.x / 2.0;
+    const double cy = idx.y - dim.y / 2.0;
+    const double cz = idx.z - dim.z / 2.0;
+    const double r = std::sqrt(cx * cx + cy * cy + cz * cz);
+    return r < dim.x / 2.0 && (idx.x * 3 + idx.y * 5 + idx.z * 7) % 11 != 0;
+}
+
+/**
+ * Runs two Laplacian iterations and returns the result for every cell of the domain
+ */
+auto runLaplace(int nPartitions, CellOrdering ordering) -> std::vector<Type>
+{
+    Neon::Backend        backend(nPartitions, Neon::Runtime::openmp);
+    const Neon::index_3d dim(20, 22, 31);
+
+    Grid grid(
+        backend, dim, [&](const Neon::index_3d& idx) { return isActive(dim, idx); },
+        Neon::domain::Stencil::s7_Laplace_t(), Neon::Vec_3d<double>(1, 1, 1), Neon::Vec_3d<double>(0, 0, 0), false, ordering);
+
+    auto X = grid.newField<Type>("X", 1, 0);
+    auto Y = grid.newField<Type>("Y", 1, 0);
+
+    X.forEachActiveCell([](const Neon::index_3d& idx, const int&, Type& val) {
+        val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29) % 101);
+    });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+
+    Neon::skeleton::Skeleton skl(backend);
+    skl.sequence({laplace(X, Y), laplace(Y, X)}, "domainUt_eGridOrdering");
+    skl.run();
+    backend.syncAll();
+    X.updateIO(0);
+    backend.syncAll();
+
+    std::vector<Type> res(dim.rMulTyped<size_t>(), -1);
+    X.forEachActiveCell([&](const Neon::index_3d& idx, const int&, Type& val) {
+        res[idx.mPitch(dim)] = val;
+    });
+    return res;
+}
+
+TEST(eGridOrdering, utils)
+{
+    Neon::init();
+    for (int i = 0; i < CellOrderingUtils::nConfig; i++) {
+        auto ordering = CellOrderingUtils::fromInt(i);
+        ASSERT_EQ(CellOrderingUtils::toInt(ordering), i);
+        ASSERT_EQ(CellOrderingUtils::fromString(CellOrderingUtils::toString(ordering)), ordering);
+    }
+}
+
+TEST(eGridOrdering, hilbertCurve)
+{
+    Neon::init();
+    // Consecutive cells along the curve are face neighbours
+    const int                          nBits = 3;
+    const int                          n = 1 << nBits;
+    std::map<uint64_t, Neon::index_3d> curve;
+    Neon::index_3d::forEach(Neon::index_3d(n, n, n), [&](const Neon::index_3d& idx) {
+        curve[CellOrderingUtils::hilbertCode(idx, nBits)] = idx;
+    });
+    ASSERT_EQ(curve.size(), size_t(n * n * n));
+    ASSERT_EQ(curve.rbegin()->first, uint64_t(n * n * n - 1));
+
+    for (auto it = std::next(curve.begin()); it != curve.end(); ++it) {
+        const Neon::index_3d d = it->second - std::prev(it)->second;
+        ASSERT_EQ(std::abs(d.x) + std::abs(d.y) + std::abs(d.z), 1);
+    }
+}
+
+TEST(eGridOrdering, reverseCuthillMcKee)
+{
+    Neon::init();
+    // Path 0 - 2 - 1 - 3 and the isolated vertex 4
+    const std::vector<int64_t> offsets{0, 1, 3, 5, 6, 6};
+    const std::vector<int64_t> neighbours{2, 2, 3, 0, 1, 1};
+    const auto                 order = CellOrderingUtils::reverseCuthillMcKee(offsets, neighbours);
+    ASSERT_EQ(order, (std::vector<int64_t>{3, 1, 2, 0, 4}));
+}
+
+TEST(eGridOrdering, stencil)
+{
+    Neon::init();
+    for (int nPartitions : {1, 3}) {
+        const auto golden = runLaplace(nPartitions, CellOrdering::scan);
+        for (auto ordering : {CellOrdering::morton, CellOrdering::hilbert, CellOrdering::rcm}) {
+            ASSERT_EQ(golden, runLaplace(nPartitions, ordering)) << CellOrderingUtils::toString(ordering);
+        }
+    }
+}
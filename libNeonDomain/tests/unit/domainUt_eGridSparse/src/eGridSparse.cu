@@ -0,0 +1,174 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Neon/Neon.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+using Grid = Neon::domain::eGrid;
+using Type = int64_t;
+
+template <typename Field>
+auto laplace(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Laplace",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                Type res = 0;
+                for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                    auto neighbor = xLocal.nghVal(cell, nghIdx, 0, Type(0));
+                    if (neighbor.isValid) {
+                        res += neighbor.value;
+                    }
+                }
+                yLocal(cell, 0) = res - 6 * xLocal(cell, 0);
+            };
+        });
+}
+
+/**
+ * Thin spherical shell, a surface-like domain
+ */
+auto isInShell(const Neon::index_3d& dim, const Neon::index_3d& idx) -> bool
+{
+    const double cx = idx.x - dim.x / 2.0;
+    const double cy = idx.y - dim.y / 2.0;
+    const double cz = idx.z - dim.z / 2.0;
+    const double r = std::sqrt(cx * cx + cy * cy + cz * cz);
+    const double radius = std::min(dim.x, std::min(dim.y, dim.z)) / 2.0 - 2;
+    return r >= radius - 3 && r <= radius;
+}
+
+/**
+ * Applies the Laplacian to a field initialized from the cell coordinates
+ * and returns the result for every cell of the domain
+ */
+auto runLaplace(Grid& grid, const Neon::Backend& backend) -> std::vector<Type>
+{
+    auto X = grid.newField<Type>("X", 1, 0);
+    auto Y = grid.newField<Type>("Y", 1, 0);
+
+    X.forEachActiveCell([](const Neon::index_3d& idx, const int&, Type& val) {
+        val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29) % 101);
+    });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+
+    Neon::skeleton::Skeleton skl(backend);
+    skl.sequence({laplace(X, Y)}, "domainUt_eGridSparse");
+    skl.run();
+    backend.syncAll();
+    Y.updateIO(0);
+    backend.syncAll();
+
+    const Neon::index_3d dim = grid.getDimension();
+    std::vector<Type>    res(dim.rMulTyped<size_t>(), -1);
+    Y.forEachActiveCell([&](const Neon::index_3d& idx, const int&, Type& val) {
+        res[idx.mPitch(dim)] = val;
+    });
+    return res;
+}
+
+/**
+ * Builds the same grid from a lambda and from a shuffled list of active cells with duplicates,
+ * then compares sparsity, partitioning and the result of a stencil operation.
+ */
+void runSparseConstruction(int nPartitions)
+{
+    Neon::Backend        backend(nPartitions, Neon::Runtime::openmp);
+    const Neon::index_3d dim(24, 21, 30);
+
+    std::vector<Neon::index_3d> activeCells;
+    Neon::index_3d::forEach(dim, [&](const Neon::index_3d& idx) {
+        if (isInShell(dim, idx)) {
+            activeCells.push_back(idx);
+        }
+    });
+    const size_t nActive = activeCells.size();
+    std::reverse(activeCells.begin(), activeCells.end());
+    const std::vector<Neon::index_3d> duplicates(activeCells.begin(), activeCells.begin() + nActive / 3);
+    activeCells.insert(activeCells.end(), duplicates.begin(), duplicates.end());
+
+    Grid dense(
+        backend, dim, [&](const Neon::index_3d& idx) { return isInShell(dim, idx); },
+        Neon::domain::Stencil::s7_Laplace_t());
+    Grid sparse(backend, dim, activeCells, Neon::domain::Stencil::s7_Laplace_t());
+
+    Neon::index_3d::forEach(dim, [&](const Neon::index_3d& idx) {
+        ASSERT_EQ(dense.isInsideDomain(idx), sparse.isInsideDomain(idx));
+        if (dense.isInsideDomain(idx)) {
+            const auto denseProp = dense.getProperties(idx);
+            const auto sparseProp = sparse.getProperties(idx);
+            ASSERT_EQ(denseProp.getSetIdx(), sparseProp.getSetIdx());
+            ASSERT_EQ(Neon::DataViewUtil::toString(denseProp.getDataView()), Neon::DataViewUtil::toString(sparseProp.getDataView()));
+        }
+    });
+
+    ASSERT_EQ(runLaplace(dense, backend), runLaplace(sparse, backend));
+}
+
+TEST(eGridSparse, construction)
+{
+    Neon::init();
+    for (int nPartitions : {1, 2, 3}) {
+        runSparseConstruction(nPartitions);
+    }
+}
+
+TEST(eGridSparse, outsideDomain)
+{
+    Neon::init();
+    Neon::Backend               backend(2, Neon::Runtime::openmp);
+    const Neon::index_3d        dim(10, 10, 10);
+    std::vector<Neon::index_3d> activeCells{{1, 1, 1}, {1, 1, 2}, {1, 1, 10}};
+
+    auto build = [&]() {
+        Grid grid(backend, dim, activeCells, Neon::domain::Stencil::s7_Laplace_t());
+    };
+    ASSERT_ANY_THROW(build());
+}
+
+/**
+ * A few active cells in a 4096^3 bounding box: visiting the active cells
+ * must not sweep the box, which would take minutes.
+ */
+TEST(eGridSparse, largeBoundingBox)
+{
+    Neon::init();
+    for (int nPartitions : {1, 2}) {
+        Neon::Backend        backend(nPartitions, Neon::Runtime::openmp);
+        const Neon::index_3d dim(4096, 4096, 4096);
+
+        // A rod of 4x4 cells along z close to the far corner of the box
+        std::vector<Neon::index_3d> activeCells;
+        for (int z = 4000; z < 4064; z++) {
+            for (int y = 4090; y < 4094; y++) {
+                for (int x = 4090; x < 4094; x++) {
+                    activeCells.emplace_back(x, y, z);
+                }
+            }
+        }
+        Grid grid(backend, dim, activeCells, Neon::domain::Stencil::s7_Laplace_t());
+        auto X = grid.newField<Type>("X", 2, 0);
+
+        X.forEachActiveCell([](const Neon::index_3d& idx, const int& card, Type& val) {
+            val = Type(idx.x) + Type(idx.y) * 4096 + Type(idx.z) * 4096 * 4096 + card;
+        });
+
+        size_t nVisited = 0;
+        X.forEachActiveCell<Neon::computeMode_t::computeMode_e::seq>([&](const Neon::index_3d& idx, const int& card, Type& val) {
+            ASSERT_TRUE(grid.isInsideDomain(idx));
+            ASSERT_EQ(val, Type(idx.x) + Type(idx.y) * 4096 + Type(idx.z) * 4096 * 4096 + card);
+            nVisited++;
+        });
+        ASSERT_EQ(nVisited, 2 * activeCells.size());
+        ASSERT_EQ(X(activeCells.back(), 1), X.getReference(activeCells.back(), 0) + 1);
+    }
+}
@@ -13,6 +13,7 @@
 #include "Neon/domain/tools/Geometries.h"
 #include "Neon/domain/tools/TestData.h"
 
+#include <algorithm>
 #include <cctype>
 #include <string>
 
@@ -311,6 +312,72 @@ void sGridTestSkeleton(TestData<G, T, C>& data)
     ASSERT_TRUE(isOk);
     //    std::cout<<"Done"<<std::endl;
 }
+
+/**
+ * Same computation as sGridTestContainerRun, with the bulk gather and scatter containers of sGrid.
+ * The sub-grid points are listed in reverse order and twice, sGrid sorts and merges them.
+ */
+template <typename G, typename T, int C>
+void sGridTestGatherScatter(TestData<G, T, C>& data)
+{
+    using Type = typename TestData<G, T, C>::Type;
+    auto& grid = data.getGrid();
+
+    NEON_INFO(grid.toString());
+
+    data.resetValuesToLinear(1, 100);
+
+    {  // NEON
+        const index_3d        dim = grid.getDimension();
+        std::vector<index_3d> elements;
+
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+
+        dim.template forEach<Neon::computeMode_t::seq>([&](int x, int y, int z) {
+            index_3d newE(x, y, z);
+            if (X.isInsideDomain(newE)) {
+                if (X(newE, 0) % 2 == 0) {
+                    elements.push_back(newE);
+                }
+            }
+        });
+        std::reverse(elements.begin(), elements.end());
+        const std::vector<index_3d> duplicates(elements);
+        elements.insert(elements.end(), duplicates.begin(), duplicates.end());
+
+        Neon::domain::sGrid<G> sGrid(grid, elements);
+        auto                   sX = sGrid.template newField<int>("sX", 1, 11);
+        auto                   sY = sGrid.template newField<int>("sY", 1, 11);
+
+        sGrid.getGatherContainer(X, sX).run(0);
+        scale(2, sX, sY).run(0);
+        sGrid.getScatterContainer(sY, Y).run(0);
+
+        data.getBackend().sync(0);
+        Y.updateIO(0);
+    }
+
+    {  // Golden data
+        auto& X = data.getIODomain(FieldNames::X);
+        auto& Y = data.getIODomain(FieldNames::Y);
+
+        data.forEachActiveIODomain([&](const Neon::index_3d&,
+                                       int,
+                                       Type& a,
+                                       Type& b) {
+            if (a % 2 == 0) {
+                b = 2 * a;
+            }
+        },
+                                   X, Y);
+    }
+
+    bool isOk = data.compare(FieldNames::Y);
+    isOk = isOk && data.compare(FieldNames::X);
+
+    ASSERT_TRUE(isOk);
+}
 }  // namespace help
 
 template <typename G, typename T, int C>
@@ -351,6 +418,16 @@ TEST(domainUnitTests, sGrid_eGrid_skeleton)
     runAllTestConfiguration<Grid, Type, 0>("sGrid", help::sGridTestSkeleton<Grid, Type, 0>, nGpus, 1);
 }
 
+TEST(domainUnitTests, sGrid_eGrid_gatherScatter)
+{
+    Neon::init();
+    int nGpus = getNGpus();
+    NEON_INFO("sGrid_eGrid");
+    using Grid = Neon::domain::eGrid;
+    using Type = int32_t;
+    runAllTestConfiguration<Grid, Type, 0>("sGrid", help::sGridTestGatherScatter<Grid, Type, 0>, nGpus, 1);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
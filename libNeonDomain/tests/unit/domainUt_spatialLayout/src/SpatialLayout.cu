@@ -0,0 +1,219 @@
+#include "gtest/gtest.h"
+
+#include "Neon/Neon.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/domain/tools/TestData.h"
+#include "Neon/skeleton/Skeleton.h"
+
+using namespace Neon::domain::tool::testing;
+
+template <typename Field>
+auto map(const Field&                input_field,
+         Field&                      output_field,
+         const typename Field::Type& alpha) -> Neon::set::Container
+{
+    return input_field.getGrid().getContainer(
+        "MAP",
+        [&](Neon::set::Loader& loader) {
+            const auto& inp = loader.load(input_field);
+            auto&       out = loader.load(output_field);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& e) mutable {
+                for (int i = 0; i < inp.cardinality(); i++) {
+                    out(e, i) = inp(e, i) + alpha;
+                }
+            };
+        });
+}
+
+template <typename Field>
+auto laplace(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Laplace",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                Type res = 0;
+                for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                    auto neighbor = xLocal.nghVal(cell, nghIdx, 0, Type(0));
+                    if (neighbor.isValid) {
+                        res += neighbor.value;
+                    }
+                }
+                yLocal(cell, 0) = -6 * res;
+            };
+        });
+}
+
+using Grid = Neon::domain::dGrid;
+using Type = int64_t;
+
+/**
+ * Runs a map and a stencil operation on fields with the requested spatial layout
+ * and compares the results with the dense golden data.
+ */
+void runSpatialLayout(Neon::SpatialLayout layout,
+                      Neon::MemoryLayout  order,
+                      int                 nPartitions,
+                      int                 cardinality)
+{
+    Neon::Backend       backend(nPartitions, Neon::Runtime::openmp);
+    Neon::MemoryOptions memoryOptions = backend.getMemoryOptions(order);
+    memoryOptions.setSpatialLayout(layout);
+
+    // Dimensions are not multiples of the brick size to exercise the padding
+    TestData<Grid, Type, 0> data(backend,
+                                 Neon::index_3d(19, 13, 29),
+                                 cardinality,
+                                 memoryOptions,
+                                 Neon::domain::tool::Geometry::FullDomain);
+
+    data.resetValuesToRandom(1, 50);
+    ASSERT_TRUE(data.compare(FieldNames::X));
+
+    const Type alpha = 7;
+    {  // Map
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+        map(X, Y, alpha).run(0);
+        backend.sync(0);
+        Y.updateIO(0);
+        backend.sync(0);
+
+        data.forEachActiveIODomain([&](const Neon::index_3d&, int, Type& a, Type& b) { b = a + alpha; },
+                                   data.getIODomain(FieldNames::X),
+                                   data.getIODomain(FieldNames::Y));
+        ASSERT_TRUE(data.compare(FieldNames::Y));
+    }
+
+    {  // Dot product, the BLAS slices of the data views must skip the padding of the bricks
+        auto& X = data.getField(FieldNames::X);
+        auto  dot = data.getGrid().template newPatternScalar<Type>();
+        dot() = 0;
+
+        Neon::skeleton::Skeleton skl(backend);
+        Neon::skeleton::Options  opt(Neon::skeleton::Occ::standard, Neon::set::TransferMode::get);
+        skl.sequence({laplace(X, data.getField(FieldNames::Z)), data.getGrid().dot("Dot", X, X, dot)}, "domainUt_spatialLayoutDot", opt);
+        skl.run();
+        backend.syncAll();
+
+        // TestData::dot only visits the first cardinality
+        Type  golden = 0;
+        auto& xIO = data.getIODomain(FieldNames::X);
+        data.forEachActiveIODomain([&](const Neon::index_3d& idx, int, Type&) {
+            Type sum = 0;
+            for (int card = 0; card < cardinality; card++) {
+                const Type val = xIO.nghVal(idx, Neon::int8_3d(0, 0, 0), card);
+                sum += val * val;
+            }
+#pragma omp atomic
+            golden += sum;
+        },
+                                   xIO);
+        ASSERT_EQ(dot(), golden);
+    }
+
+    if (cardinality == 1) {  // Stencil, halo update included
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+
+        Neon::skeleton::Skeleton skl(backend);
+        skl.sequence({laplace(X, Y)}, "domainUt_spatialLayout");
+        skl.run();
+        backend.syncAll();
+        Y.updateIO(0);
+        backend.sync(0);
+
+        data.laplace(data.getIODomain(FieldNames::X), data.getIODomain(FieldNames::Y));
+        ASSERT_TRUE(data.compare(FieldNames::Y));
+    }
+}
+
+TEST(SpatialLayout, utils)
+{
+    for (int i = 0; i < Neon::SpatialLayoutUtils::nConfig; i++) {
+        auto layout = Neon::SpatialLayoutUtils::fromInt(i);
+        ASSERT_EQ(Neon::SpatialLayoutUtils::toInt(layout), i);
+        ASSERT_EQ(Neon::SpatialLayoutUtils::fromString(Neon::SpatialLayoutUtils::toString(layout)), layout);
+    }
+}
+
+TEST(SpatialLayout, dataRuns)
+{
+    const Neon::index_3d dim(19, 13, 29);
+    for (int i = 0; i < Neon::SpatialLayoutUtils::nConfig; i++) {
+        auto layout = Neon::SpatialLayoutUtils::fromInt(i);
+        for (int haloRadius : {0, 1}) {
+            using Neon::domain::internal::dGrid::dSpatialLayout;
+            const auto spatialLayout = dSpatialLayout::factory(layout, dim, haloRadius, 1);
+            const auto rank = Neon::SpatialLayoutUtils::isMorton(layout) ? dSpatialLayout::mortonRank(spatialLayout.mNBricks)
+                                                                         : std::vector<int32_t>();
+            const int  zFirst = haloRadius + 1;
+            const int  zLast = haloRadius + dim.z - 1;
+            const auto runs = spatialLayout.dataRuns(zFirst, zLast, rank);
+            int64_t    nCells = 0;
+            int64_t    end = 0;
+            for (const auto& [start, count] : runs) {
+                ASSERT_GE(start, end);
+                ASSERT_GT(count, 0);
+                end = start + count;
+                nCells += count;
+            }
+            ASSERT_LE(end, spatialLayout.mNCells);
+            ASSERT_EQ(nCells, int64_t(dim.x) * dim.y * (zLast - zFirst)) << Neon::SpatialLayoutUtils::toString(layout);
+            if (layout == Neon::SpatialLayout::linear) {
+                ASSERT_EQ(runs.size(), size_t(1));
+            }
+        }
+    }
+}
+
+TEST(SpatialLayout, dGrid)
+{
+    for (int i = 0; i < Neon::SpatialLayoutUtils::nConfig; i++) {
+        auto layout = Neon::SpatialLayoutUtils::fromInt(i);
+#if !defined(NEON_USE_SPATIAL_LAYOUT)
+        if (layout != Neon::SpatialLayout::linear) {
+            // Bricked layouts are not compiled in
+            Neon::Backend       backend(1, Neon::Runtime::openmp);
+            Neon::MemoryOptions memoryOptions = backend.getMemoryOptions();
+            memoryOptions.setSpatialLayout(layout);
+            Grid grid(
+                backend, {8, 8, 8}, [](const Neon::index_3d&) { return true; }, Neon::domain::Stencil::s7_Laplace_t());
+            ASSERT_ANY_THROW(grid.newField<Type>("X", 1, 0, Neon::DataUse::IO_COMPUTE, memoryOptions));
+            continue;
+        }
+#endif
+        for (auto order : {Neon::MemoryLayout::structOfArrays, Neon::MemoryLayout::arrayOfStructs}) {
+            for (int nPartitions : {1, 3}) {
+                for (int cardinality : {1, 3}) {
+                    NEON_INFO("SpatialLayout {} nPartitions {} cardinality {}",
+                              Neon::SpatialLayoutUtils::toString(layout), nPartitions, cardinality);
+                    runSpatialLayout(layout, order, nPartitions, cardinality);
+                }
+            }
+        }
+    }
+}
+
+TEST(SpatialLayout, unsupportedGrid)
+{
+    Neon::Backend       backend(1, Neon::Runtime::openmp);
+    Neon::MemoryOptions memoryOptions = backend.getMemoryOptions();
+    memoryOptions.setSpatialLayout(Neon::SpatialLayout::tiled4);
+    Neon::domain::eGrid grid(
+        backend, {8, 8, 8}, [](const Neon::index_3d&) { return true; }, Neon::domain::Stencil::s7_Laplace_t());
+    ASSERT_ANY_THROW(grid.newField<Type>("X", 1, 0, Neon::DataUse::IO_COMPUTE, memoryOptions));
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    Neon::init();
+    return RUN_ALL_TESTS();
+}
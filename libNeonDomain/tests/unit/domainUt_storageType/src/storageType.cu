@@ -0,0 +1,215 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <type_traits>
+
+#include "Neon/Neon.h"
+#include "Neon/core/types/StorageType.h"
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+/**
+ * Value of the cell of a dense field, a multiple of 1/4 in [0, 4)
+ * which is represented exactly by all the storage types
+ */
+inline auto denseValue(const Neon::index_3d& idx, int card) -> float
+{
+    return float((idx.x * 3 + idx.y * 5 + idx.z * 7 + card) % 16) * 0.25f;
+}
+
+/**
+ * y = a * x + y, computed in the compute type of the fields
+ */
+template <typename Field>
+auto axpy(typename Field::ComputeType a, const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "AXPY",
+        [&, a](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                for (int card = 0; card < yLocal.cardinality(); card++) {
+                    yLocal(cell, card) += a * xLocal(cell, card);
+                }
+            };
+        });
+}
+
+/**
+ * y = 1/8 of the sum of the face neighbours of x, the neighbour values are read through nghVal
+ */
+template <typename Field>
+auto faceSum(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "FaceSum",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                using ComputeType = typename Field::ComputeType;
+                for (int card = 0; card < yLocal.cardinality(); card++) {
+                    ComputeType res = 0;
+                    if constexpr (std::is_same_v<typename Field::Grid, Neon::domain::eGrid>) {
+                        for (uint8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                            const auto ngh = xLocal.nghVal(cell, nghIdx, card, Type(0));
+                            if (ngh.isValid) {
+                                res += ngh.value;
+                            }
+                        }
+                    } else {
+                        for (int dir = 0; dir < 6; ++dir) {
+                            typename Field::Partition::nghIdx_t offset(0, 0, 0);
+                            offset.v[dir / 2] = dir % 2 == 0 ? 1 : -1;
+                            const auto ngh = xLocal.nghVal(cell, offset, card, Type(0));
+                            if (ngh.isValid) {
+                                res += ngh.value;
+                            }
+                        }
+                    }
+                    yLocal(cell, card) = 0.125f * res;
+                }
+            };
+        });
+}
+
+template <typename Grid, typename T>
+void runStorageType(int nPartitions, int cardinality, Neon::MemoryLayout memoryLayout)
+{
+    static_assert(std::is_same_v<typename Grid::template Field<T, 0>::ComputeType, float>);
+
+    Neon::Backend backend(nPartitions, Neon::Runtime::openmp);
+
+    const Neon::index_3d dim(14, 11, 24);
+    auto                 isInSphere = [&](const Neon::index_3d& idx) {
+        const double cx = idx.x - dim.x / 2.0;
+        const double cy = idx.y - dim.y / 2.0;
+        const double cz = idx.z - dim.z / 2.0;
+        return std::sqrt(cx * cx + cy * cy + cz * cz) < 9;
+    };
+    Grid grid(backend, dim, isInSphere, Neon::domain::Stencil::s7_Laplace_t());
+
+    // Allocation
+    Neon::MemoryOptions memoryOptions = backend.getMemoryOptions(memoryLayout);
+    auto                X = grid.template newField<T>("X", cardinality, 0, Neon::DataUse::IO_COMPUTE, memoryOptions);
+    auto                Y = grid.template newField<T>("Y", cardinality, 0, Neon::DataUse::IO_COMPUTE, memoryOptions);
+    ASSERT_EQ(X.getCardinality(), cardinality);
+
+    // IO round-trip through the compute type
+    Neon::IODense<float> dense(dim, cardinality);
+    dense.forEach([](const Neon::index_3d& idx, int card, float& val) { val = denseValue(idx, card); });
+    X.ioFromDense(dense);
+    Y.forEachActiveCell([](const Neon::index_3d&, const int& card, T& val) { val = float(card); });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+    X.updateIO(0);
+    backend.syncAll();
+
+    const auto xDense = X.template ioToDense<float>();
+    X.forEachActiveCell([&](const Neon::index_3d& idx, const int& card, T&) {
+        ASSERT_EQ(xDense(idx, card), denseValue(idx, card)) << idx.to_string() << " card " << card;
+    });
+
+    // Map kernel on the compressed values
+    const float a = 0.5f;
+    axpy(a, X, Y).run(0);
+    backend.syncAll();
+    Y.updateIO(0);
+    backend.syncAll();
+
+    Y.forEachActiveCell([&](const Neon::index_3d& idx, const int& card, T& val) {
+        const float expected = float(T(float(card) + a * denseValue(idx, card)));
+        ASSERT_EQ(float(val), expected) << idx.to_string() << " card " << card;
+    });
+
+    // Stencil kernel, the halo update moves the compressed values
+    Neon::skeleton::Skeleton skl(backend);
+    skl.sequence({faceSum(X, Y)}, "domainUt_storageType");
+    skl.run();
+    backend.syncAll();
+    Y.updateIO(0);
+    backend.syncAll();
+
+    Y.forEachActiveCell([&](const Neon::index_3d& idx, const int& card, T& val) {
+        float sum = 0;
+        for (int dir = 0; dir < 6; ++dir) {
+            Neon::index_3d ngh = idx;
+            ngh.v[dir / 2] += dir % 2 == 0 ? 1 : -1;
+            if (grid.isInsideDomain(ngh)) {
+                sum += denseValue(ngh, card);
+            }
+        }
+        ASSERT_EQ(float(val), float(T(0.125f * sum))) << idx.to_string() << " card " << card;
+    });
+
+    // Values that are not representable are rounded as by the scalar conversion
+    Y.forEachActiveCell([](const Neon::index_3d&, const int&, T& val) { val = 0.1f; });
+    Y.updateCompute(0);
+    Y.updateIO(0);
+    backend.syncAll();
+    Y.forEachActiveCell([](const Neon::index_3d&, const int&, T& val) {
+        ASSERT_EQ(float(val), float(T(0.1f)));
+    });
+}
+
+template <typename Grid, typename T>
+void runStorageTypeConfigurations(const std::vector<Neon::MemoryLayout>& memoryLayouts,
+                                  const std::vector<int>&                partitions = {1, 3})
+{
+    for (int nPartitions : partitions) {
+        for (auto memoryLayout : memoryLayouts) {
+            for (int cardinality : {1, 3}) {
+                runStorageType<Grid, T>(nPartitions, cardinality, memoryLayout);
+            }
+        }
+    }
+}
+
+TEST(storageType, dGridHalf)
+{
+    Neon::init();
+    runStorageTypeConfigurations<Neon::domain::dGrid, Neon::Half>({Neon::MemoryLayout::structOfArrays, Neon::MemoryLayout::arrayOfStructs});
+}
+
+TEST(storageType, dGridBFloat16)
+{
+    Neon::init();
+    runStorageTypeConfigurations<Neon::domain::dGrid, Neon::BFloat16>({Neon::MemoryLayout::structOfArrays, Neon::MemoryLayout::arrayOfStructs});
+}
+
+TEST(storageType, dGridScaledInt)
+{
+    Neon::init();
+    runStorageTypeConfigurations<Neon::domain::dGrid, Neon::ScaledInt<int16_t, 12>>({Neon::MemoryLayout::structOfArrays});
+}
+
+TEST(storageType, eGridHalf)
+{
+    Neon::init();
+    runStorageTypeConfigurations<Neon::domain::eGrid, Neon::Half>({Neon::MemoryLayout::structOfArrays});
+}
+
+TEST(storageType, eGridBFloat16)
+{
+    Neon::init();
+    runStorageTypeConfigurations<Neon::domain::eGrid, Neon::BFloat16>({Neon::MemoryLayout::structOfArrays});
+}
+
+TEST(storageType, bGridHalf)
+{
+    Neon::init();
+    // bGrid runs on a single partition
+    runStorageTypeConfigurations<Neon::domain::bGrid, Neon::Half>({Neon::MemoryLayout::structOfArrays}, {1});
+}
+
+TEST(storageType, bGridBFloat16)
+{
+    Neon::init();
+    runStorageTypeConfigurations<Neon::domain::bGrid, Neon::BFloat16>({Neon::MemoryLayout::structOfArrays}, {1});
+}
@@ -0,0 +1,207 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include "Neon/Neon.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+using Type = int64_t;
+
+template <typename Field>
+auto laplace(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Laplace",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                for (int card = 0; card < xLocal.cardinality(); card++) {
+                    Type res = 0;
+                    for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                        auto neighbor = xLocal.nghVal(cell, nghIdx, card, Type(0));
+                        if (neighbor.isValid) {
+                            res += neighbor.value;
+                        }
+                    }
+                    yLocal(cell, card) = (res - 6 * xLocal(cell, card)) % 1009;
+                }
+            };
+        });
+}
+
+/**
+ * Neighbour of index i of the Laplacian stencil in the convention of the partition:
+ * an offset for dGrid, an index in the grid stencil for eGrid
+ */
+template <typename Partition>
+NEON_CUDA_HOST_DEVICE inline auto stencilNgh(int i) -> typename Partition::nghIdx_t
+{
+    if constexpr (std::is_same_v<typename Partition::nghIdx_t, uint8_t>) {
+        return uint8_t(i);
+    } else {
+        const int8_t sign = i % 2 == 0 ? 1 : -1;
+        return typename Partition::nghIdx_t(i / 2 == 0 ? sign : 0,
+                                            i / 2 == 1 ? sign : 0,
+                                            i / 2 == 2 ? sign : 0);
+    }
+}
+
+/**
+ * Same Laplacian reading the neighbours through nghIdx and the partition accessor
+ */
+template <typename Field>
+auto laplaceNghIdx(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "LaplaceNghIdx",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                using Partition = typename Field::Partition;
+                for (int card = 0; card < xLocal.cardinality(); card++) {
+                    Type res = 0;
+                    for (int i = 0; i < 6; ++i) {
+                        typename Field::Cell nghCell;
+                        if (xLocal.nghIdx(cell, stencilNgh<Partition>(i), nghCell)) {
+                            res += xLocal(nghCell, card);
+                        }
+                    }
+                    yLocal(cell, card) = (res - 6 * xLocal(cell, card)) % 1009;
+                }
+            };
+        });
+}
+
+/**
+ * Applies the Laplacian several times, ping-ponging between two fields,
+ * and returns the result for every cell and cardinality of the domain
+ */
+template <typename Grid>
+auto runLaplace(int                 nPartitions,
+                bool                zeroCopy,
+                bool                withNghIdx,
+                Neon::skeleton::Occ occ,
+                int                 cardinality,
+                Neon::MemoryLayout  memoryLayout) -> std::vector<Type>
+{
+    Neon::Backend backend(nPartitions, Neon::Runtime::openmp);
+    backend.setCpuZeroCopyHalo(zeroCopy);
+
+    const Neon::index_3d dim(14, 11, 24);
+    auto                 isInSphere = [&](const Neon::index_3d& idx) {
+        const double cx = idx.x - dim.x / 2.0;
+        const double cy = idx.y - dim.y / 2.0;
+        const double cz = idx.z - dim.z / 2.0;
+        return std::sqrt(cx * cx + cy * cy + cz * cz) < 9;
+    };
+    Grid grid(backend, dim, isInSphere, Neon::domain::Stencil::s7_Laplace_t());
+
+    Neon::MemoryOptions memoryOptions = backend.getMemoryOptions(memoryLayout);
+    auto                X = grid.template newField<Type>("X", cardinality, 0, Neon::DataUse::IO_COMPUTE, memoryOptions);
+    auto                Y = grid.template newField<Type>("Y", cardinality, 0, Neon::DataUse::IO_COMPUTE, memoryOptions);
+
+    X.forEachActiveCell([](const Neon::index_3d& idx, const int& card, Type& val) {
+        val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29 + card * 5) % 101);
+    });
+    Y.forEachActiveCell([](const Neon::index_3d&, const int&, Type& val) { val = 0; });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+
+    Neon::skeleton::Skeleton skl(backend);
+    Neon::skeleton::Options  opt(occ, Neon::set::TransferMode::get);
+    if (withNghIdx) {
+        skl.sequence({laplaceNghIdx(X, Y), laplaceNghIdx(Y, X)}, "domainUt_zeroCopyHalo", opt);
+    } else {
+        skl.sequence({laplace(X, Y), laplace(Y, X)}, "domainUt_zeroCopyHalo", opt);
+    }
+    const uint64_t bytes = backend.devSet().transferredBytes();
+    for (int i = 0; i < 3; i++) {
+        skl.run();
+    }
+    backend.syncAll();
+    // dGrid only reads its halo in place when zero-copy halos are compiled in
+#if defined(NEON_USE_ZERO_COPY_HALO)
+    const bool inPlace = zeroCopy;
+#else
+    const bool inPlace = zeroCopy && !std::is_same_v<Grid, Neon::domain::dGrid>;
+#endif
+    if (inPlace) {
+        // The halo updates do not move any data
+        EXPECT_EQ(backend.devSet().transferredBytes(), bytes);
+    }
+    X.updateIO(0);
+    backend.syncAll();
+
+    std::vector<Type> res(dim.rMulTyped<size_t>() * cardinality, -1);
+    X.forEachActiveCell([&](const Neon::index_3d& idx, const int& card, Type& val) {
+        res[idx.mPitch(dim) * cardinality + card] = val;
+    });
+    return res;
+}
+
+/**
+ * Compares the result of a stencil sequence with and without zero-copy halos
+ */
+template <typename Grid>
+void runZeroCopyHalo(const std::vector<Neon::MemoryLayout>& memoryLayouts)
+{
+    for (int nPartitions : {2, 3}) {
+        for (auto occ : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard, Neon::skeleton::Occ::extended}) {
+            for (auto memoryLayout : memoryLayouts) {
+                for (int cardinality : {1, 2}) {
+                    for (bool withNghIdx : {false, true}) {
+                        const auto copy = runLaplace<Grid>(nPartitions, false, withNghIdx, occ, cardinality, memoryLayout);
+                        const auto zeroCopy = runLaplace<Grid>(nPartitions, true, withNghIdx, occ, cardinality, memoryLayout);
+                        ASSERT_EQ(copy, zeroCopy) << "nPartitions " << nPartitions << " occ " << Neon::skeleton::OccUtils::toString(occ)
+                                                  << " cardinality " << cardinality << " nghIdx " << withNghIdx;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(zeroCopyHalo, dGrid)
+{
+    Neon::init();
+    runZeroCopyHalo<Neon::domain::dGrid>({Neon::MemoryLayout::structOfArrays, Neon::MemoryLayout::arrayOfStructs});
+}
+
+TEST(zeroCopyHalo, eGrid)
+{
+    Neon::init();
+    runZeroCopyHalo<Neon::domain::eGrid>({Neon::MemoryLayout::structOfArrays});
+}
+
+TEST(zeroCopyHalo, backendOptions)
+{
+    Neon::init();
+    Neon::Backend backend(2, Neon::Runtime::openmp);
+    backend.setCpuZeroCopyHalo(true);
+    ASSERT_TRUE(backend.hasCpuZeroCopyHalo());
+    ASSERT_ANY_THROW(backend.setCpuStreams(true));
+
+    // The graph level executor runs the partitions without synchronizing them with their neighbours
+    Neon::domain::dGrid grid(
+        backend, {8, 8, 8}, [](const Neon::index_3d&) { return true; }, Neon::domain::Stencil::s7_Laplace_t());
+    auto                     X = grid.newField<Type>("X", 1, 0);
+    auto                     Y = grid.newField<Type>("Y", 1, 0);
+    Neon::skeleton::Skeleton skl(backend);
+    Neon::skeleton::Options  opt;
+    opt.setExecutor(Neon::skeleton::Executor::ompAtGraphLevel);
+    ASSERT_ANY_THROW(skl.sequence({laplace(X, Y)}, "domainUt_zeroCopyHalo", opt));
+
+    backend.setCpuZeroCopyHalo(false);
+    backend.setCpuStreams(true);
+    ASSERT_ANY_THROW(backend.setCpuZeroCopyHalo(true));
+}
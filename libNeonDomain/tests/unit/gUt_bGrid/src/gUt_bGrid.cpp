@@ -1,3 +1,6 @@
+#include <array>
+#include <cmath>
+
 #include "gtest/gtest.h"
 
 #include "Neon/Neon.h"
@@ -35,6 +38,92 @@ TEST(bGrid, activeCell)
     }
 }
 
+template <typename Grid>
+void runBlockSize(const Neon::index_3d& dim)
+{
+    using Type = int64_t;
+
+    Neon::Backend bk(1, Neon::Runtime::openmp);
+
+    // Sparse spherical shell that does not align with any of the block sizes
+    auto activeCell = [&](const Neon::index_3d& id) -> bool {
+        const double   r = 0.4 * double(dim.x);
+        Neon::double_3d p(double(id.x) - 0.5 * double(dim.x),
+                          double(id.y) - 0.5 * double(dim.y),
+                          double(id.z) - 0.5 * double(dim.z));
+        const double   d = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+        return d < r && d > r - 3;
+    };
+
+    Grid grid(bk, dim, activeCell, Neon::domain::Stencil::s7_Laplace_t());
+
+    auto X = grid.template newField<Type>("X", 1, 0);
+    auto Y = grid.template newField<Type>("Y", 1, 0);
+
+    int64_t nActive = 0;
+    X.template forEachActiveCell<Neon::computeMode_t::computeMode_e::seq>(
+        [&](const Neon::int32_3d id, const int, Type& val) {
+            EXPECT_TRUE(activeCell(id));
+            val = id.x + 100 * id.y + 10000 * id.z;
+            nActive++;
+        });
+
+    int64_t nExpected = 0;
+    for (int z = 0; z < dim.z; z++) {
+        for (int y = 0; y < dim.y; y++) {
+            for (int x = 0; x < dim.x; x++) {
+                nExpected += activeCell({x, y, z}) ? 1 : 0;
+            }
+        }
+    }
+    EXPECT_EQ(nActive, nExpected);
+
+    X.updateCompute(0);
+
+    auto container = grid.getContainer("SumNgh", [&](Neon::set::Loader& loader) {
+        const auto& x = loader.load(X, Neon::Compute::STENCIL);
+        auto&       y = loader.load(Y);
+        return [=] NEON_CUDA_HOST_DEVICE(const typename Grid::Cell& cell) mutable {
+            Type res = 0;
+            for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                auto ngh = x.nghVal(cell, nghIdx, 0, Type(0));
+                if (ngh.isValid) {
+                    res += ngh.value;
+                }
+            }
+            y(cell, 0) = res;
+        };
+    });
+    container.run(0);
+    bk.syncAll();
+    Y.updateIO(0);
+    bk.syncAll();
+
+    const std::array<Neon::index_3d, 6> offsets{Neon::index_3d(1, 0, 0), Neon::index_3d(-1, 0, 0),
+                                                Neon::index_3d(0, 1, 0), Neon::index_3d(0, -1, 0),
+                                                Neon::index_3d(0, 0, 1), Neon::index_3d(0, 0, -1)};
+    Y.template forEachActiveCell<Neon::computeMode_t::computeMode_e::seq>(
+        [&](const Neon::int32_3d id, const int, Type& val) {
+            Type expected = 0;
+            for (const auto& offset : offsets) {
+                const Neon::index_3d ngh = id + offset;
+                const bool inBox = ngh >= Neon::index_3d(0, 0, 0) && ngh < dim;
+                if (inBox && grid.isInsideDomain(ngh)) {
+                    expected += X(ngh, 0);
+                }
+            }
+            EXPECT_EQ(val, expected);
+        });
+}
+
+TEST(bGrid, blockSize)
+{
+    const Neon::index_3d dim(37, 37, 37);
+    runBlockSize<Neon::domain::bGrid4>(dim);
+    runBlockSize<Neon::domain::bGrid8>(dim);
+    runBlockSize<Neon::domain::bGrid16>(dim);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
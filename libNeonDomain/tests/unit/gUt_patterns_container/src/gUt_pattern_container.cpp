@@ -132,6 +132,41 @@ void patternNorm2Test(const Neon::index64_3d            dim,
     ASSERT_NEAR(scalar(), ground_truth, 0.001);
 }
 
+template <typename GridT, typename T>
+void patternMultiDotTest(const Neon::index64_3d            dim,
+                         const int                         nGPU,
+                         const int                         cardinality,
+                         const Neon::Runtime&              backendType,
+                         const Neon::MemoryLayout&         layout,
+                         const Neon::sys::patterns::Engine eng)
+{
+    if (std::is_same_v<GridT, Neon::domain::bGrid> && backendType != Neon::Runtime::openmp) {
+        NEON_INFO("Skipped");
+        return;
+    }
+
+    Storage<GridT, T> storage(dim, nGPU, cardinality, backendType, layout);
+    storage.m_grid.setReduceEngine(eng);
+    storage.initLinearly();
+
+    auto scalars = storage.m_grid.template newPatternScalarVector<T>(3);
+
+    auto multiDotContainer = storage.m_grid.multiDot("GridMultiDot",
+                                                     {{storage.Xf, storage.Yf},
+                                                      {storage.Xf, storage.Xf},
+                                                      {storage.Yf, storage.Zf}},
+                                                     scalars);
+    multiDotContainer.run(Neon::Backend::mainStreamIdx);
+
+    const T groundTruth[3] = {storage.dot(storage.Xd, storage.Yd),
+                              storage.dot(storage.Xd, storage.Xd),
+                              storage.dot(storage.Yd, storage.Zd)};
+
+    for (int k = 0; k < 3; ++k) {
+        ASSERT_NEAR(scalars(k), groundTruth[k], 0.001 * std::abs(groundTruth[k])) << groundTruth[k] << " versus " << scalars(k);
+    }
+}
+
 
 TEST(PatternContainerDot, bGrid)
 {
@@ -161,6 +196,20 @@ TEST(PatternContainerNorm2, dGrid)
     runAllTestConfiguration(patternNorm2Test<dGrid_t, double>, nGpus);
 }
 
+TEST(PatternContainerMultiDot, bGrid)
+{
+    NEON_INFO("bGrid");
+    int nGpus = 1;
+    runAllTestConfiguration(patternMultiDotTest<bGrid_t, double>, nGpus);
+}
+
+TEST(PatternContainerMultiDot, dGrid)
+{
+    NEON_INFO("dGrid");
+    int nGpus = 3;
+    runAllTestConfiguration(patternMultiDotTest<dGrid_t, double>, nGpus);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,190 @@
+#include <cmath>
+#include <limits>
+
+#include "Neon/Neon.h"
+
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+
+#include "gtest/gtest.h"
+
+struct ValueAndId
+{
+    double  value;
+    int64_t id;
+};
+
+/**
+ * Largest value, ties are broken by the smallest id so that the result does not depend on the traversal order
+ */
+struct ArgMax
+{
+    NEON_CUDA_HOST_DEVICE inline auto operator()(const ValueAndId& a, const ValueAndId& b) const -> ValueAndId
+    {
+        if (a.value > b.value || (a.value == b.value && a.id < b.id)) {
+            return a;
+        }
+        return b;
+    }
+};
+
+template <typename Grid>
+auto reduceTest(const Neon::Backend& backend) -> void
+{
+    using Cell = typename Grid::Cell;
+
+    const Neon::index_3d dim(24, 19, 31);
+    const double         radius = 11.0;
+
+    Grid grid(
+        backend, dim,
+        [&](const Neon::index_3d& idx) {
+            const double x = idx.x - 12.0;
+            const double y = idx.y - 9.0;
+            const double z = idx.z - 15.0;
+            return x * x + y * y + z * z <= radius * radius;
+        },
+        Neon::domain::Stencil::s7_Laplace_t());
+
+    auto u = grid.template newField<double>("u", 1, 0);
+    auto ids = grid.template newField<int64_t>("ids", 1, -1);
+
+    double     sumGolden = 0;
+    double     maxAbsGolden = 0;
+    double     minGolden = std::numeric_limits<double>::max();
+    int        countGolden = 0;
+    ValueAndId argMaxGolden{-std::numeric_limits<double>::max(), -1};
+
+    u.forEachActiveCell([&](const Neon::index_3d& idx, const int&, double& val) {
+        val = std::sin(0.3 * idx.x) * std::cos(0.2 * idx.y) + 0.01 * idx.z;
+    });
+    ids.forEachActiveCell([&](const Neon::index_3d& idx, const int&, int64_t& val) {
+        val = idx.x + dim.x * (idx.y + int64_t(dim.y) * idx.z);
+    });
+    u.template forEachActiveCell<Neon::computeMode_t::computeMode_e::seq>([&](const Neon::index_3d& idx, const int&, double& val) {
+        const int64_t id = idx.x + dim.x * (idx.y + int64_t(dim.y) * idx.z);
+        sumGolden += val;
+        maxAbsGolden = std::max(maxAbsGolden, std::abs(val));
+        minGolden = std::min(minGolden, val);
+        countGolden += val > 0 ? 1 : 0;
+        argMaxGolden = ArgMax()(argMaxGolden, ValueAndId{val, id});
+    });
+    u.updateCompute(0);
+    ids.updateCompute(0);
+    backend.syncAll();
+
+    Neon::PatternReduction<double>     sum(0.0);
+    Neon::PatternReduction<double>     maxAbs(0.0);
+    Neon::PatternReduction<double>     minVal(0.0);
+    Neon::PatternReduction<int>        count(0);
+    Neon::PatternReduction<ValueAndId> argMax(ValueAndId{0, -1});
+
+    auto sumContainer = grid.reduce(
+        "sum",
+        [&](Neon::set::Loader& loader) {
+            const auto& uLocal = loader.load(u);
+            return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) -> double {
+                return uLocal(cell, 0);
+            };
+        },
+        Neon::reduceOp::Sum<double>(), 0.0, sum);
+
+    auto maxAbsContainer = grid.reduce(
+        "maxAbs",
+        [&](Neon::set::Loader& loader) {
+            const auto& uLocal = loader.load(u);
+            return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) -> double {
+                const double v = uLocal(cell, 0);
+                return v < 0 ? -v : v;
+            };
+        },
+        Neon::reduceOp::Max<double>(), 0.0, maxAbs);
+
+    auto minContainer = grid.reduce(
+        "min",
+        [&](Neon::set::Loader& loader) {
+            const auto& uLocal = loader.load(u);
+            return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) -> double {
+                return uLocal(cell, 0);
+            };
+        },
+        Neon::reduceOp::Min<double>(), std::numeric_limits<double>::max(), minVal);
+
+    auto countContainer = grid.reduce(
+        "countPositive",
+        [&](Neon::set::Loader& loader) {
+            const auto& uLocal = loader.load(u);
+            return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) -> int {
+                return uLocal(cell, 0) > 0 ? 1 : 0;
+            };
+        },
+        Neon::reduceOp::Sum<int>(), 0, count);
+
+    auto argMaxContainer = grid.reduce(
+        "argMax",
+        [&](Neon::set::Loader& loader) {
+            const auto& uLocal = loader.load(u);
+            const auto& idsLocal = loader.load(ids);
+            return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) -> ValueAndId {
+                return ValueAndId{uLocal(cell, 0), idsLocal(cell, 0)};
+            };
+        },
+        ArgMax(), ValueAndId{-std::numeric_limits<double>::max(), -1}, argMax);
+
+    for (auto* container : {&sumContainer, &maxAbsContainer, &minContainer, &countContainer, &argMaxContainer}) {
+        container->run(0);
+    }
+
+    ASSERT_NEAR(sum(), sumGolden, 1e-9 * std::abs(sumGolden));
+    ASSERT_EQ(maxAbs(), maxAbsGolden);
+    ASSERT_EQ(minVal(), minGolden);
+    ASSERT_EQ(count(), countGolden);
+    ASSERT_EQ(argMax().value, argMaxGolden.value);
+    ASSERT_EQ(argMax().id, argMaxGolden.id);
+
+    if (backend.devSet().setCardinality() > 1) {
+        // The STANDARD result is combined once both views ran, whatever their order
+        for (auto* container : {&sumContainer, &maxAbsContainer, &argMaxContainer}) {
+            container->run(0, Neon::DataView::BOUNDARY);
+        }
+        sum() = 0;
+        maxAbs() = 0;
+        argMax() = ValueAndId{0, -1};
+        for (auto* container : {&sumContainer, &maxAbsContainer, &argMaxContainer}) {
+            container->run(0, Neon::DataView::INTERNAL);
+        }
+        ASSERT_EQ(sum(), sum(Neon::DataView::INTERNAL) + sum(Neon::DataView::BOUNDARY));
+        ASSERT_NEAR(sum(), sumGolden, 1e-9 * std::abs(sumGolden));
+        ASSERT_EQ(maxAbs(), maxAbsGolden);
+        ASSERT_EQ(argMax().value, argMaxGolden.value);
+        ASSERT_EQ(argMax().id, argMaxGolden.id);
+    }
+}
+
+TEST(gUt_reduce, dGridOpenmp)
+{
+    Neon::Backend backend(2, Neon::Runtime::openmp);
+    reduceTest<Neon::domain::dGrid>(backend);
+}
+
+TEST(gUt_reduce, bGridOpenmp)
+{
+    Neon::Backend backend(1, Neon::Runtime::openmp);
+    reduceTest<Neon::domain::bGrid>(backend);
+}
+
+TEST(gUt_reduce, dGridStream)
+{
+    if (Neon::sys::globalSpace::gpuSysObjStorage.numDevs() > 0) {
+        Neon::Backend backend(1, Neon::Runtime::stream);
+        reduceTest<Neon::domain::dGrid>(backend);
+    }
+}
+
+TEST(gUt_reduce, bGridStream)
+{
+    if (Neon::sys::globalSpace::gpuSysObjStorage.numDevs() > 0) {
+        Neon::Backend backend(1, Neon::Runtime::stream);
+        reduceTest<Neon::domain::bGrid>(backend);
+    }
+}
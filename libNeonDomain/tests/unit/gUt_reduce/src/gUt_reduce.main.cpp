@@ -0,0 +1,12 @@
+#include "gtest/gtest.h"
+
+#include "Neon/Neon.h"
+
+#include <map>
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    Neon::init();
+    return RUN_ALL_TESTS();
+}
@@ -3,6 +3,7 @@
 #include <functional>
 #include <future>
 #include <iostream>
+#include <memory>
 #include <thread>
 #include <tuple>
 #include <vector>
@@ -11,6 +12,7 @@
 #include "Neon/core/core.h"
 #include "Neon/set/MemoryOptions.h"
 #include "Neon/set/Runtime.h"
+#include "Neon/sys/devices/cpu/CpuTopology.h"
 //#include "Neon/core/types/mode.h"
 //#include "Neon/core/types/devType.h"
 
@@ -21,6 +23,10 @@ namespace set {
 class DevSet;
 class StreamSet;
 class GpuEventSet;
+class CpuAutotuner;
+namespace dist {
+class Transport;
+}
 }  // namespace set
 class Backend
 {
@@ -38,12 +44,24 @@ class Backend
         std::vector<Neon::set::GpuEventSet> userEventSetVec;
 
         std::shared_ptr<Neon::set::DevSet> devSet;
+
+        bool cpuStreams{false} /*! True when the streams of the openmp runtime are asynchronous CPU work queues */;
+        bool cpuZeroCopyHalo{false} /*! True when the fields of the openmp runtime read halo values directly from the neighbour partitions */;
+        int64_t cpuSerialLaunchThreshold{0} /*! Kernels of the openmp runtime on partitions with fewer cells run on the calling thread */;
+
+        std::shared_ptr<Neon::set::CpuAutotuner> cpuAutotuner /*! Tunes the loop configuration of the containers of the openmp runtime, if not null */;
     };
     auto selfData() -> Data_t&;
     auto selfData() const -> const Data_t&;
 
     std::shared_ptr<Data_t> m_data;
 
+    /**
+     * Creates a stream set (or an event set) of the type used by the backend
+     */
+    auto h_newStreamSet() const -> Neon::set::StreamSet;
+    auto h_newEventSet() const -> Neon::set::GpuEventSet;
+
    public:
     //--------------------------------------------------------------------------
     // INITIALIZATION
@@ -178,6 +196,134 @@ class Backend
     auto setAvailableUserEvents(int nUserEventSets)
         -> void;
 
+    /**
+     * Openmp runtime only.
+     * When enabled, every stream of the backend becomes an asynchronous CPU work queue
+     * served by one worker thread per partition, and events become CPU events.
+     * Kernels are then enqueued instead of being run by the calling thread, so that work on
+     * different streams (e.g. internal and boundary computations of an OCC skeleton) and on different
+     * partitions overlaps as it does with CUDA streams.
+     * As with CUDA streams, host accesses to the field data require a sync first.
+     * By default the openmp runtime runs every kernel synchronously.
+     */
+    auto setCpuStreams(bool enable)
+        -> void;
+
+    /**
+     * Returns true if the streams of the backend are asynchronous CPU work queues (see setCpuStreams)
+     */
+    auto hasCpuStreams()
+        const
+        -> bool;
+
+    /**
+     * Openmp runtime only.
+     * When enabled, fields created afterwards on this backend do not copy their halos:
+     * the partitions share one address space, so the stencil accessors of a partition
+     * (nghVal, or nghIdx followed by the const accessor) read the values of the halo cells directly from the memory of the neighbour partitions.
+     * A halo update then reduces to a barrier, removing all the halo memory traffic while
+     * keeping the partitioning (and its memory locality) of the grid.
+     * The mode is fixed for a field when the field is created.
+     * It can not be combined with CPU streams (see setCpuStreams) or with the graph level executor
+     * of the skeleton, as the partitions would then read memory that their neighbours may be writing concurrently.
+     * Periodic partitions are not supported. Disabling the mode is a no-op on the other runtimes.
+     * dGrid fields only honour the mode when built with NEON_USE_ZERO_COPY_HALO, otherwise they keep updating their halo.
+     */
+    auto setCpuZeroCopyHalo(bool enable)
+        -> void;
+
+    /**
+     * Returns true if new fields read their halo values directly from the neighbour partitions (see setCpuZeroCopyHalo)
+     */
+    auto hasCpuZeroCopyHalo()
+        const
+        -> bool;
+
+    /**
+     * Openmp runtime only.
+     * Kernels on partitions with fewer than nCells cells run on the calling thread instead of
+     * an OpenMP parallel region. For tiny partitions the fork/join of the thread team costs more
+     * than the kernel itself, which dominates skeletons made of many small containers.
+     * The default, 0, runs every kernel in parallel.
+     */
+    auto setCpuSerialLaunchThreshold(int64_t nCells)
+        -> void;
+
+    /**
+     * Returns the number of cells below which the kernels of a partition run on the calling thread (see setCpuSerialLaunchThreshold)
+     */
+    auto cpuSerialLaunchThreshold()
+        const
+        -> int64_t;
+
+    /**
+     * Openmp runtime only.
+     * Returns the number of threads a kernel launched on a stream set can use in each partition:
+     * the OpenMP team of the CPU stream workers (see setCpuStreams and setCpuBinding), or all the threads
+     * of the OpenMP runtime without CPU streams. The smallest team is returned when the partitions differ.
+     */
+    auto cpuThreadBudget(int streamIdx)
+        const
+        -> int;
+
+    /**
+     * Openmp runtime only.
+     * The containers run on this backend time their first runs over the candidate loop configurations
+     * of the autotuner (see Neon::set::CpuAutotuner) and then keep the fastest one.
+     * The autotuner can be shared by several backends. A null autotuner disables the tuning.
+     */
+    auto setCpuAutotuner(std::shared_ptr<Neon::set::CpuAutotuner> autotuner)
+        -> void;
+
+    /**
+     * Returns the autotuner of the loop configurations, null if none (see setCpuAutotuner)
+     */
+    auto cpuAutotuner()
+        const
+        -> const std::shared_ptr<Neon::set::CpuAutotuner>&;
+
+    /**
+     * Openmp runtime only.
+     * Maps each partition to a socket or to a range of cores of the machine
+     * (see Neon::sys::CpuTopology::partitionCpus): the CPU stream workers of a partition
+     * (see setCpuStreams), and therefore their OpenMP teams, are bound to its cores, and the
+     * memory of the fields created afterwards is placed on the NUMA node of those cores.
+     * The binding should be set before the grids and fields are created; the mapping is
+     * reported by toReport().
+     * Without CPU streams the kernels run on the calling thread's team, which is not bound,
+     * so only the memory placement applies.
+     */
+    auto setCpuBinding(Neon::sys::CpuBinding binding)
+        -> void;
+
+    /**
+     * Returns how the partitions are mapped to the cores (see setCpuBinding)
+     */
+    auto cpuBinding()
+        const
+        -> Neon::sys::CpuBinding;
+
+    /**
+     * Openmp runtime only.
+     * Distributes the partitions of the backend over the processes connected by the transport.
+     * All the processes run the same program (SPMD): each one allocates every partition,
+     * but it computes only the partitions it owns (see Neon::set::dist::Transport::ownerRank).
+     * Halo updates between partitions of different processes go through the transport
+     * and reductions are combined across the processes.
+     * The values of the partitions owned by other processes are not kept up to date.
+     * The transport must be set before any grid is created on the backend and it can not be
+     * combined with CPU streams or zero-copy halos.
+     */
+    auto setTransport(std::shared_ptr<Neon::set::dist::Transport> transport)
+        -> void;
+
+    /**
+     * Returns the transport to the other processes, null when the backend is not distributed (see setTransport)
+     */
+    auto transport()
+        const
+        -> const std::shared_ptr<Neon::set::dist::Transport>&;
+
     /**
      *
      */
@@ -222,6 +368,15 @@ class Backend
      */
     auto streamEventBarrier(const std::vector<int>& streamIdxVec) -> void;
 
+    /**
+     * Orders all the work enqueued so far on the streams of streamIdxVec, on all the partitions,
+     * before any work enqueued afterwards on the same streams, without blocking the host.
+     * The fence uses the user events from firstEventIdx to firstEventIdx + streamIdxVec.size() included
+     * (see setAvailableUserEvents). It is a no-op on the openmp runtime without CPU streams.
+     */
+    auto streamFence(const std::vector<int>& streamIdxVec,
+                     int                     firstEventIdx) -> void;
+
     auto getMemoryOptions(Neon::MemoryLayout order) const
         -> Neon::MemoryOptions;
 
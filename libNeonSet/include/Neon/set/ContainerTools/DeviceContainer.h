@@ -3,6 +3,7 @@
 
 #include "Neon/set/ContainerTools/ContainerAPI.h"
 #include "Neon/set/ContainerTools/Loader.h"
+#include "Neon/set/CpuAutotuner.h"
 
 namespace Neon {
 namespace set {
@@ -48,6 +49,25 @@ struct DeviceContainer : ContainerAPI
                         DataView::BOUNDARY,
                         DataView::INTERNAL}) {
             this->setLaunchParameters(dw) = dataIteratorContainer.getLaunchParameters(dw, blockSize, sharedMem);
+            m_kernelConfigs[DataViewUtil::toInt(dw)] = Neon::set::KernelConfig(dw,
+                                                                                dataIteratorContainer.getBackend(),
+                                                                                0,
+                                                                                this->getLaunchParameters(dw));
+
+            // Key of the kernel for the autotuner: name, data view and dimensions of the partitions
+            std::string& key = m_tuningKeys[DataViewUtil::toInt(dw)];
+            key = this->getName() + "_" + DataViewUtil::toString(dw);
+            for (int i = 0; i < this->getLaunchParameters(dw).cardinality(); i++) {
+                key += "_" + this->getLaunchParameters(dw)[i].domainGrid().to_stringForComposedNames();
+            }
+
+            // One loader per partition, reused by every launch
+            const Neon::Backend& bk = dataIteratorContainer.getBackend();
+            auto&                loaders = m_loaders[DataViewUtil::toInt(dw)];
+            loaders.clear();
+            for (int i = 0; i < bk.devSet().setCardinality(); i++) {
+                loaders.emplace_back(*this, bk.devType(), Neon::SetIdx(i), dw, LoadingMode_e::EXTRACT_LAMBDA);
+            }
         }
     }
 
@@ -98,18 +118,14 @@ struct DeviceContainer : ContainerAPI
     virtual auto run(int streamIdx = 0, Neon::DataView dataView = Neon::DataView::STANDARD) -> void override
     {
 
-        const Neon::Backend&    bk = m_dataIteratorContainer.getBackend();
-        Neon::set::KernelConfig kernelConfig(dataView, bk, streamIdx, this->getLaunchParameters(dataView));
+        const Neon::Backend&           bk = m_dataIteratorContainer.getBackend();
+        const Neon::set::KernelConfig& kernelConfig = helpGetKernelConfig(dataView);
 
         if (ContainerType::device == this->getContainerType()) {
-            bk.devSet().template kernelLambdaWithIterator<DataIteratorContainerT, UserComputeLambdaT>(
-                kernelConfig,
-                m_dataIteratorContainer,
-                [&](Neon::DeviceType devE, Neon::SetIdx setIdx, Neon::DataView dataView) -> UserComputeLambdaT {
-                    Loader             loader = this->newLoader(devE, setIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
-                    UserComputeLambdaT userLambda = this->m_loadingLambda(loader);
-                    return userLambda;
-                });
+            if (helpRunAutotuning(bk, kernelConfig, streamIdx)) {
+                return;
+            }
+            helpLaunch(bk, kernelConfig, streamIdx);
             return;
         }
 
@@ -124,18 +140,19 @@ struct DeviceContainer : ContainerAPI
     virtual auto run(Neon::SetIdx setIdx, int streamIdx, Neon::DataView dataView) -> void override
     {
 
-        const Neon::Backend&    bk = m_dataIteratorContainer.getBackend();
-        Neon::set::KernelConfig kernelConfig(dataView, bk, streamIdx, this->getLaunchParameters(dataView));
+        const Neon::Backend&           bk = m_dataIteratorContainer.getBackend();
+        const Neon::set::KernelConfig& kernelConfig = helpGetKernelConfig(dataView);
 
         if (ContainerType::device == this->getContainerType()) {
+            // Partitions are run one at a time: they use the tuned configuration but are not timed
             bk.devSet().template kernelLambdaWithIterator<DataIteratorContainerT, UserComputeLambdaT>(
                 setIdx,
                 kernelConfig,
+                streamIdx,
+                helpTunedLaunch(bk, dataView),
                 m_dataIteratorContainer,
-                [&](Neon::DeviceType devE, Neon::SetIdx setIdx, Neon::DataView dataView) -> UserComputeLambdaT {
-                    Loader             loader = this->newLoader(devE, setIdx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
-                    UserComputeLambdaT userLambda = this->m_loadingLambda(loader);
-                    return userLambda;
+                [this](Neon::DeviceType, Neon::SetIdx setIdx, Neon::DataView dataView) -> UserComputeLambdaT {
+                    return this->m_loadingLambda(helpGetLoader(setIdx, dataView));
                 });
             return;
         }
@@ -144,12 +161,124 @@ struct DeviceContainer : ContainerAPI
     }
 
    private:
+    /**
+     * Returns the kernel configuration of the data view, cached at construction
+     * so that a launch does not copy the launch parameters of all partitions.
+     * The configuration is never modified: the stream and the loop configuration are given with each launch.
+     */
+    auto helpGetKernelConfig(Neon::DataView dataView) const -> const Neon::set::KernelConfig&
+    {
+        return m_kernelConfigs[DataViewUtil::toInt(dataView)];
+    }
+
+    /**
+     * Returns the loader of a partition, created at construction.
+     * The loading lambda is still called at every launch, so the user lambda sees the current partitions.
+     */
+    auto helpGetLoader(Neon::SetIdx setIdx, Neon::DataView dataView) -> Loader&
+    {
+        return m_loaders[DataViewUtil::toInt(dataView)][setIdx.idx()];
+    }
+
+    auto helpLaunch(const Neon::Backend&           bk,
+                    const Neon::set::KernelConfig& kernelConfig,
+                    int                            streamIdx,
+                    const CpuLaunchConfig&         cpuLaunch) -> void
+    {
+        bk.devSet().template kernelLambdaWithIterator<DataIteratorContainerT, UserComputeLambdaT>(
+            kernelConfig,
+            streamIdx,
+            cpuLaunch,
+            m_dataIteratorContainer,
+            [this](Neon::DeviceType, Neon::SetIdx setIdx, Neon::DataView dataView) -> UserComputeLambdaT {
+                return this->m_loadingLambda(helpGetLoader(setIdx, dataView));
+            });
+    }
+
+    auto helpLaunch(const Neon::Backend& bk, const Neon::set::KernelConfig& kernelConfig, int streamIdx) -> void
+    {
+        helpLaunch(bk, kernelConfig, streamIdx, m_cpuLaunches[DataViewUtil::toInt(kernelConfig.dataView())]);
+    }
+
+    /**
+     * Dimension of the loop of the kernels on the openmp runtime, as seen by the autotuner
+     */
+    static constexpr auto helpLoopDim() -> int
+    {
+        using PartitionIndexSpace = typename DataIteratorContainerT::PartitionIndexSpace;
+        if constexpr (HasBlockExecution<PartitionIndexSpace>::value) {
+            return 1;
+        } else {
+            return PartitionIndexSpace::SpaceDim;
+        }
+    }
+
+    /**
+     * Key of the kernel for the autotuner: name, data view and dimensions of the partitions
+     */
+    auto helpTuningKey(Neon::DataView dataView) const -> const std::string&
+    {
+        return m_tuningKeys[DataViewUtil::toInt(dataView)];
+    }
+
+    /**
+     * Runs the container with the next configuration of the autotuner of the backend, if any (see Backend::setCpuAutotuner).
+     * Returns false, without running the container, when there is no autotuner or the container is tuned:
+     * the tuned configuration is then used by the following launches of the data view.
+     */
+    auto helpRunAutotuning(const Neon::Backend& bk, const Neon::set::KernelConfig& kernelConfig, int streamIdx) -> bool
+    {
+        const int dwIdx = DataViewUtil::toInt(kernelConfig.dataView());
+        if (m_isTuned[dwIdx] || !bk.cpuAutotuner()) {
+            return false;
+        }
+        Neon::set::CpuAutotuner&   autotuner = *bk.cpuAutotuner();
+        const std::string&         key = helpTuningKey(kernelConfig.dataView());
+        Neon::set::CpuLaunchConfig launch;
+        const bool                 isTuned = autotuner.next(key, helpLoopDim(), bk.cpuThreadBudget(streamIdx), launch);
+        if (isTuned) {
+            m_cpuLaunches[dwIdx] = launch;
+            m_isTuned[dwIdx] = true;
+            return false;
+        }
+
+        // The previous work on the stream is not part of the timing
+        bk.sync(streamIdx);
+        Neon::Timer_ms timer;
+        timer.start();
+        helpLaunch(bk, kernelConfig, streamIdx, launch);
+        bk.sync(streamIdx);
+        timer.stop();
+        autotuner.record(key, launch, timer.time());
+        return true;
+    }
+
+    /**
+     * Returns the tuned configuration of the data view, if known, or the default one.
+     * The container is not modified, as the partitions may be run concurrently by several threads.
+     */
+    auto helpTunedLaunch(const Neon::Backend& bk, Neon::DataView dataView) const -> Neon::set::CpuLaunchConfig
+    {
+        const int                  dwIdx = DataViewUtil::toInt(dataView);
+        Neon::set::CpuLaunchConfig launch = m_cpuLaunches[dwIdx];
+        if (!m_isTuned[dwIdx] && bk.cpuAutotuner()) {
+            bk.cpuAutotuner()->winner(helpTuningKey(dataView), launch);
+        }
+        return launch;
+    }
+
     std::function<UserComputeLambdaT(Loader&)> m_loadingLambda;
     /**
      * This is the container on which the function will be called
      * Most probably, this is going to be one of the grids: dGrid, eGrid
      */
     DataIteratorContainerT m_dataIteratorContainer;
+
+    std::array<Neon::set::KernelConfig, Neon::DataViewUtil::nConfig>    m_kernelConfigs;
+    std::array<std::vector<Loader>, Neon::DataViewUtil::nConfig>        m_loaders;
+    std::array<Neon::set::CpuLaunchConfig, Neon::DataViewUtil::nConfig> m_cpuLaunches /**< loop configuration of the openmp runtime, set by the autotuner */;
+    std::array<std::string, Neon::DataViewUtil::nConfig>                m_tuningKeys /**< keys of the autotuner */;
+    std::array<bool, Neon::DataViewUtil::nConfig>                       m_isTuned{};
 };
 
 }  // namespace internal
@@ -0,0 +1,298 @@
+#pragma once
+#include <mutex>
+
+#include "Neon/core/core.h"
+
+#include "Neon/set/ContainerTools/ContainerAPI.h"
+#include "Neon/set/ContainerTools/Loader.h"
+#include "Neon/set/LambdaExecutor.h"
+#include "Neon/set/dist/Transport.h"
+
+namespace Neon {
+namespace set {
+namespace internal {
+
+/**
+ * Detects the combine operators that declare the matching Transport reduction (e.g. Neon::reduceOp::Sum)
+ */
+template <typename CombineOpT, typename = void>
+struct HasTransportOp : std::false_type
+{
+};
+
+template <typename CombineOpT>
+struct HasTransportOp<CombineOpT, std::void_t<decltype(CombineOpT::transportOp)>> : std::true_type
+{
+};
+
+/**
+ * Container for user defined reductions.
+ * The loading lambda returns a per-cell map lambda (Cell -> T) and the values are folded
+ * with an associative combine operator. Each partition produces one partial
+ * (per-thread partials and a tree combine on the CPU, per-block partials on the GPU)
+ * and the partials are combined on the host in partition order.
+ * With a distributed backend each rank reduces the partitions it owns and the rank results
+ * are combined by the transport, which requires a combine operator declaring its transportOp.
+ * The final value is handed to the result sink together with the data view.
+ * When the skeleton splits the reduction into its INTERNAL and BOUNDARY views, the STANDARD
+ * value is handed to the sink once both views of the run are done, as combine(INTERNAL, BOUNDARY),
+ * so the result does not depend on the order in which the views are scheduled.
+ *
+ * @tparam DataIteratorContainerT: the grid
+ * @tparam UserComputeLambdaT: the per-cell map lambda
+ * @tparam T: type of the reduced value
+ * @tparam CombineOpT: associative operator (T, T) -> T
+ */
+template <typename DataIteratorContainerT,
+          typename UserComputeLambdaT,
+          typename T,
+          typename CombineOpT>
+struct DeviceReduceContainer : ContainerAPI
+{
+   public:
+    using ResultSink = std::function<void(Neon::DataView, T)>;
+
+    virtual ~DeviceReduceContainer() override = default;
+
+    DeviceReduceContainer(const std::string&                            name,
+                          ContainerAPI::DataViewSupport                 dataViewSupport,
+                          const DataIteratorContainerT&                 dataIteratorContainer,
+                          std::function<UserComputeLambdaT(Loader&)>    loadingLambda,
+                          const Neon::index_3d&                         blockSize,
+                          std::function<int(const index_3d& blockSize)> shMemSizeFun,
+                          T                                             identity,
+                          CombineOpT                                    combine,
+                          ResultSink                                    resultSink)
+        : m_loadingLambda(loadingLambda),
+          m_dataIteratorContainer(dataIteratorContainer),
+          m_identity(identity),
+          m_combine(combine),
+          m_resultSink(resultSink),
+          m_viewResults{identity, identity}
+    {
+        setName(name);
+        setContainerType(ContainerType::deviceManaged);
+        setDataViewSupport(dataViewSupport);
+
+        // The GPU kernel uses one T of dynamic shared memory per thread on top of what the user requested
+        const size_t sharedMem = shMemSizeFun(blockSize) + blockSize.rMul() * sizeof(T);
+        for (auto dw : {DataView::STANDARD,
+                        DataView::BOUNDARY,
+                        DataView::INTERNAL}) {
+            this->setLaunchParameters(dw) = dataIteratorContainer.getLaunchParameters(dw, blockSize, sharedMem);
+        }
+
+        const Neon::Backend& bk = m_dataIteratorContainer.getBackend();
+        if (bk.devType() == Neon::DeviceType::CUDA) {
+            for (auto dw : {DataView::STANDARD,
+                            DataView::BOUNDARY,
+                            DataView::INTERNAL}) {
+                const auto& launchParameters = this->getLaunchParameters(dw);
+                auto        nBlocks = bk.devSet().template newDataSet<uint64_t>();
+                for (int i = 0; i < nBlocks.cardinality(); i++) {
+                    const dim3 grid = launchParameters[i].cudaGrid();
+                    nBlocks[i] = std::max(uint64_t(1), uint64_t(grid.x) * grid.y * grid.z);
+                }
+                const int dwIdx = Neon::DataViewUtil::toInt(dw);
+                m_deviceBlockResults[dwIdx] = bk.devSet().template newMemDevSet<T>(Neon::DeviceType::CUDA,
+                                                                                   Neon::Allocator::CUDA_MEM_DEVICE,
+                                                                                   nBlocks);
+                m_hostBlockResults[dwIdx] = bk.devSet().template newMemDevSet<T>(Neon::DeviceType::CPU,
+                                                                                 Neon::Allocator::CUDA_MEM_HOST,
+                                                                                 nBlocks);
+            }
+        }
+    }
+
+    auto newLoader(Neon::DeviceType devE,
+                   Neon::SetIdx     setIdx,
+                   Neon::DataView   dataView,
+                   LoadingMode_e::e loadingMode) -> Loader
+    {
+        auto loader = Loader(*this,
+                             devE,
+                             setIdx,
+                             dataView,
+                             loadingMode);
+        return loader;
+    }
+
+    auto newParser() -> Loader
+    {
+        auto parser = Loader(*this,
+                             Neon::DeviceType::CPU,
+                             Neon::SetIdx(0),
+                             Neon::DataView::STANDARD,
+                             Neon::set::internal::LoadingMode_e::PARSE_AND_EXTRACT_LAMBDA);
+        return parser;
+    }
+
+    auto parse() -> const std::vector<Neon::set::internal::dependencyTools::DataToken>& override
+    {
+        auto parser = newParser();
+        this->m_loadingLambda(parser);
+        return getTokens();
+    }
+
+    auto getHostContainer() -> std::shared_ptr<ContainerAPI> final
+    {
+        NEON_THROW_UNSUPPORTED_OPTION("This Container type can not be decoupled.");
+    }
+
+    virtual auto getDeviceContainer() -> std::shared_ptr<ContainerAPI> final
+    {
+        NEON_THROW_UNSUPPORTED_OPTION("This Container type can not be decoupled.");
+    }
+
+    /**
+     * Run the reduction on all partitions and combine the partition results on the host
+     * @param streamIdx
+     * @param dataView
+     */
+    virtual auto run(int streamIdx = 0, Neon::DataView dataView = Neon::DataView::STANDARD) -> void override
+    {
+        const Neon::Backend& bk = m_dataIteratorContainer.getBackend();
+        const int            nPartitions = bk.devSet().setCardinality();
+        std::vector<T>       partitionResults(nPartitions, m_identity);
+
+        if (bk.devType() == Neon::DeviceType::CPU) {
+            // With CPU streams the reduction is run by the calling thread once the stream is idle
+            bk.sync(streamIdx);
+            const auto& launchParameters = this->getLaunchParameters(dataView);
+            for (int idx = 0; idx < nPartitions; idx++) {
+                if (!bk.devSet().isLocal(idx)) {
+                    continue;
+                }
+                auto               iterator = m_dataIteratorContainer.getPartitionIndexSpace(Neon::DeviceType::CPU, idx, dataView);
+                Loader             loader = this->newLoader(Neon::DeviceType::CPU, idx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
+                UserComputeLambdaT userLambda = this->m_loadingLambda(loader);
+                partitionResults[idx] = execReduceWithIterator_omp<DataIteratorContainerT, UserComputeLambdaT, T, CombineOpT>(
+                    launchParameters[idx].domainGrid(), iterator, userLambda, m_identity, m_combine, bk.cpuSerialLaunchThreshold());
+            }
+        } else {
+            runCuda(streamIdx, dataView, partitionResults);
+        }
+
+        T result = m_identity;
+        for (int idx = 0; idx < nPartitions; idx++) {
+            result = m_combine(result, partitionResults[idx]);
+        }
+        if (const auto& transport = bk.devSet().transport()) {
+            if constexpr (HasTransportOp<CombineOpT>::value) {
+                result = transport->allreduce(result, CombineOpT::transportOp);
+            } else {
+                NeonException exp("DeviceReduceContainer");
+                exp << "The combine operator of " << this->getName() << " can not be used with a distributed backend, "
+                    << "use one of Neon::reduceOp::Sum, Min or Max";
+                NEON_THROW(exp);
+            }
+        }
+        m_resultSink(dataView, result);
+        if (dataView != Neon::DataView::STANDARD) {
+            h_combineViews(dataView, result);
+        }
+    }
+
+    virtual auto run(Neon::SetIdx   setIdx,
+                     int            streamIdx,
+                     Neon::DataView dataView) -> void override
+    {
+        (void)setIdx;
+        (void)streamIdx;
+        (void)dataView;
+        NEON_THROW_UNSUPPORTED_OPTION("A reduction container runs on all partitions at once.");
+    }
+
+   private:
+    /**
+     * Records the result of one of the two views and hands the STANDARD result to the sink
+     * when the other view of the same run is done too.
+     */
+    auto h_combineViews(Neon::DataView dataView, const T& result) -> void
+    {
+        std::lock_guard<std::mutex> lock(m_viewMutex);
+        const int                   viewIdx = dataView == Neon::DataView::INTERNAL ? 0 : 1;
+        m_viewResults[viewIdx] = result;
+        m_viewDone[viewIdx] = true;
+        if (m_viewDone[0] && m_viewDone[1]) {
+            m_viewDone = {false, false};
+            m_resultSink(Neon::DataView::STANDARD, m_combine(m_viewResults[0], m_viewResults[1]));
+        }
+    }
+
+    auto runCuda([[maybe_unused]] int             streamIdx,
+                 [[maybe_unused]] Neon::DataView  dataView,
+                 [[maybe_unused]] std::vector<T>& partitionResults) -> void
+    {
+#ifdef NEON_COMPILER_CUDA
+        const Neon::Backend&    bk = m_dataIteratorContainer.getBackend();
+        const StreamSet&        gpuStreamSet = bk.streamSet(streamIdx);
+        const LaunchParameters& launchInfoSet = this->getLaunchParameters(dataView);
+        const int               nGpus = bk.devSet().setCardinality();
+        const int               dwIdx = Neon::DataViewUtil::toInt(dataView);
+
+        for (int idx = 0; idx < nGpus; idx++) {
+            if (!bk.devSet().isLocal(idx)) {
+                continue;
+            }
+            const Neon::sys::GpuDevice& dev = Neon::sys::globalSpace::gpuSysObj().dev(bk.devSet().devId(idx));
+
+            auto               iterator = m_dataIteratorContainer.getPartitionIndexSpace(Neon::DeviceType::CUDA, idx, dataView);
+            Loader             loader = this->newLoader(Neon::DeviceType::CUDA, idx, dataView, LoadingMode_e::EXTRACT_LAMBDA);
+            UserComputeLambdaT lambda = this->m_loadingLambda(loader);
+            T                  identity = m_identity;
+            CombineOpT         combine = m_combine;
+            T*                 blockResults = m_deviceBlockResults[dwIdx].mem(idx);
+            void*              untypedParams[5] = {&iterator, &lambda, &identity, &combine, &blockResults};
+            void*              executor = (void*)execReduceWithIterator_cuda<DataIteratorContainerT, UserComputeLambdaT, T, CombineOpT>;
+
+            dev.kernel.template cudaLaunchKernel<Neon::run_et::async>(gpuStreamSet[idx],
+                                                                      launchInfoSet[idx],
+                                                                      executor,
+                                                                      untypedParams);
+        }
+        m_hostBlockResults[dwIdx].template updateFrom<Neon::run_et::et::async>(gpuStreamSet, m_deviceBlockResults[dwIdx]);
+        gpuStreamSet.sync();
+
+        for (int idx = 0; idx < nGpus; idx++) {
+            if (!bk.devSet().isLocal(idx)) {
+                continue;
+            }
+            const auto& blocks = m_hostBlockResults[dwIdx].getMemDev(idx);
+            const T*    values = blocks.mem();
+            T           partial = m_identity;
+            for (size_t b = 0; b < blocks.nElements(); b++) {
+                partial = m_combine(partial, values[b]);
+            }
+            partitionResults[idx] = partial;
+        }
+#else
+        NeonException exp("DeviceReduceContainer");
+        exp << "A lambda with CUDA device code must be compiled within a .cu file.";
+        NEON_THROW(exp);
+#endif
+    }
+
+    std::function<UserComputeLambdaT(Loader&)> m_loadingLambda;
+    /**
+     * This is the container on which the function will be called
+     * Most probably, this is going to be one of the grids: dGrid, eGrid
+     */
+    DataIteratorContainerT m_dataIteratorContainer;
+    T                      m_identity;
+    CombineOpT             m_combine;
+    ResultSink             m_resultSink;
+
+    // results of the INTERNAL and BOUNDARY views of the current run
+    std::array<T, 2>    m_viewResults;
+    std::array<bool, 2> m_viewDone{false, false};
+    std::mutex          m_viewMutex;
+
+    // per-block partial results of the GPU kernel, one set per data view
+    std::array<Neon::set::MemDevSet<T>, Neon::DataViewUtil::nConfig> m_deviceBlockResults;
+    std::array<Neon::set::MemDevSet<T>, Neon::DataViewUtil::nConfig> m_hostBlockResults;
+};
+
+}  // namespace internal
+}  // namespace set
+}  // namespace Neon
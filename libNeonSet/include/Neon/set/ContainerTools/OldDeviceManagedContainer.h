@@ -85,6 +85,12 @@ struct OldDeviceManagedContainer : ContainerAPI
     {
         const Neon::Backend& bk = mDataContainer.getBackend();
 
+        // On the CPU the managed lambda runs on the calling thread,
+        // with CPU streams it has to wait for the work already enqueued on the stream
+        if (bk.hasCpuStreams()) {
+            bk.sync(streamIdx);
+        }
+
         // We use device 0 as a dummy setIdx to create a loader.
         // The actual value is not important as the managed container will take care of launching on all devices.
         SetIdx         dummyTargetSetIdx = 0;
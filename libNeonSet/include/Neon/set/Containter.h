@@ -7,6 +7,7 @@
 
 #include "Neon/set/ContainerTools/DeviceContainer.h"
 #include "Neon/set/ContainerTools/DeviceManagedContainer.h"
+#include "Neon/set/ContainerTools/DeviceReduceContainer.h"
 #include "Neon/set/ContainerTools/DeviceThenHostManagedContainer.h"
 #include "Neon/set/ContainerTools/HostManagedContainer.h"
 #include "Neon/set/ContainerTools/OldDeviceManagedContainer.h"
@@ -58,6 +59,33 @@ struct Container
         return Container(tmp);
     }
 
+    /**
+     * Factory function for a user defined reduction.
+     * The loading lambda returns a per-cell map lambda (Cell -> T), values are folded with
+     * the associative combine operator starting from identity, and the result of the
+     * reduction over all partitions is handed to resultSink.
+     */
+    template <typename DataContainerT, typename UserLoadingLambdaT, typename T, typename CombineOpT>
+    static auto factoryReduce(const std::string&                                 name,
+                              Neon::set::internal::ContainerAPI::DataViewSupport dataViewSupport,
+                              const DataContainerT&                              a,
+                              const UserLoadingLambdaT&                          f,
+                              const index_3d&                                    blockSize,
+                              std::function<int(const index_3d& blockSize)>      shMemSizeFun,
+                              T                                                  identity,
+                              CombineOpT                                         combine,
+                              std::function<void(Neon::DataView, T)>             resultSink) -> Container
+    {
+        using LoadingLambda = typename std::invoke_result<decltype(f), Neon::set::Loader&>::type;
+        auto k = new Neon::set::internal::DeviceReduceContainer<DataContainerT, LoadingLambda, T, CombineOpT>(name, dataViewSupport,
+                                                                                                             a, f,
+                                                                                                             blockSize, shMemSizeFun,
+                                                                                                             identity, combine, resultSink);
+
+        std::shared_ptr<Neon::set::internal::ContainerAPI> tmp(k);
+        return Container(tmp);
+    }
+
     /**
      * Factory function to generate a kContainer object.
      * @tparam A: the type of the structure managing the iterator
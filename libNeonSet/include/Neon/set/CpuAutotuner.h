@@ -0,0 +1,89 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Neon/set/CpuLaunchConfig.h"
+
+namespace Neon {
+namespace set {
+
+/**
+ * Autotuner of the loop configuration (see CpuLaunchConfig) of the kernels of the openmp runtime.
+ * Once set on a backend (see Backend::setCpuAutotuner), the first runs of each container time
+ * a list of candidate configurations, each one nTrials times, and the fastest one is then used by all
+ * the following runs. Winners are identified by a key made of the container name, the data view and
+ * the dimensions of the partitions, so that containers with the same name and size share them.
+ * With a cache file the winners are loaded when the autotuner is created and saved as soon as they are found,
+ * so that the following executions of the program do not tune again.
+ *
+ * The cache file is a text file with one line per key: the key, a tab and the configuration (see CpuLaunchConfig::toString).
+ */
+class CpuAutotuner
+{
+   public:
+    /**
+     * @param cacheFile file storing the winners, none if empty
+     * @param nTrials runs per candidate, the fastest run of a candidate is its time
+     */
+    explicit CpuAutotuner(std::string cacheFile = "", int nTrials = 3);
+
+    /**
+     * Candidate configurations for kernels on a loopDim dimensional iteration space (1, 2 or 3).
+     * The default configuration is always the first candidate.
+     */
+    static auto candidates(int loopDim, int maxThreads) -> std::vector<CpuLaunchConfig>;
+
+    /**
+     * Returns the configuration for the next run of the kernel identified by the key.
+     * The candidates use at most maxThreads threads per partition: the budget of the stream
+     * the kernel runs on (see Backend::cpuThreadBudget), never the whole machine.
+     * Returns true if the configuration is the winner, false if it is a candidate whose run must be timed (see record).
+     */
+    auto next(const std::string& key, int loopDim, int maxThreads, CpuLaunchConfig& config) -> bool;
+
+    /**
+     * Records the time of a run of the candidate returned by next
+     */
+    auto record(const std::string& key, const CpuLaunchConfig& config, double timeMs) -> void;
+
+    /**
+     * Returns true and the winner if the kernel identified by the key is tuned
+     */
+    auto winner(const std::string& key, CpuLaunchConfig& config) const -> bool;
+
+    /**
+     * Number of tuned kernels
+     */
+    auto nWinners() const -> int;
+
+    auto cacheFile() const -> const std::string&;
+
+    /**
+     * Writes the winners to the cache file
+     */
+    auto save() const -> void;
+
+   private:
+    struct Tuning
+    {
+        std::vector<CpuLaunchConfig> candidates;
+        std::vector<double>          bestMs /**< fastest run of each candidate */;
+        int                          current{0} /**< candidate being timed */;
+        int                          trial{0} /**< runs of the current candidate */;
+    };
+
+    auto helpLoad() -> void;
+    auto helpSave() const -> void;
+
+    std::string                            mCacheFile;
+    int                                    mNTrials;
+    std::map<std::string, CpuLaunchConfig> mWinners;
+    std::map<std::string, Tuning>          mTunings /**< kernels being tuned */;
+    mutable std::mutex                     mMutex;
+};
+
+}  // namespace set
+}  // namespace Neon
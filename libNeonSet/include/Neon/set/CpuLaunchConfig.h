@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+
+namespace Neon {
+namespace set {
+
+/**
+ * Loop configuration of a kernel on the openmp runtime.
+ * The default configuration distributes the cells of a partition with a collapsed static loop.
+ * Otherwise the rows of cells along x are grouped in tiles of tileY x tileZ rows and the tiles are
+ * distributed over nThreads threads with the given schedule, chunk tiles at a time; each row is a SIMD loop.
+ * On one dimensional iteration spaces (and on block execution) the cells (or the blocks) are distributed directly.
+ */
+struct CpuLaunchConfig
+{
+    enum class Schedule
+    {
+        ompStatic = 0,
+        ompDynamic = 1,
+        ompGuided = 2
+    };
+
+    int      nThreads{0} /*! Threads per partition, 0 for all the threads of the OpenMP runtime */;
+    Schedule schedule{Schedule::ompStatic};
+    int      chunk{0} /*! Iterations per chunk, 0 for the default of the schedule */;
+    int      tileY{0} /*! Rows along y per tile, 0 counts as 1 */;
+    int      tileZ{0} /*! Rows along z per tile, 0 counts as 1 */;
+
+    /**
+     * True for the default configuration
+     */
+    auto isDefault() const -> bool;
+
+    auto operator==(const CpuLaunchConfig& other) const -> bool;
+
+    /**
+     * Returns the configuration as "nThreads schedule chunk tileY tileZ"
+     */
+    auto toString() const -> std::string;
+
+    /**
+     * Parses a configuration written by toString
+     */
+    static auto fromString(const std::string& str) -> CpuLaunchConfig;
+
+    static auto toString(Schedule schedule) -> std::string;
+    static auto fromString(const std::string& str, Schedule& schedule) -> bool;
+};
+
+}  // namespace set
+}  // namespace Neon
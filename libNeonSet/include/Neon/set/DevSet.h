@@ -5,9 +5,13 @@
 #include "Neon/set/Capture.h"
 #include "Neon/set/MemoryOptions.h"
 
+#include <atomic>
 #include <functional>
 #include <future>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <tuple>
 #include <type_traits>
@@ -23,8 +27,10 @@
 #include "Neon/set/LaunchParameters.h"
 #include "Neon/set/SingletonSet.h"
 #include "Neon/set/Transfer.h"
+#include "Neon/set/dist/Transport.h"
 #include "Neon/set/memory/memDevSet.h"
 #include "Neon/set/memory/memSet.h"
+#include "Neon/sys/devices/cpu/CpuTopology.h"
 #include "Neon/sys/global/GpuSysGlobal.h"
 #include "Neon/sys/memory/memConf.h"
 
@@ -37,11 +43,34 @@ namespace set {
 class DevSet
 {
    private:
-    DataSet<Neon::sys::DeviceID> m_devIds;                /** DataSet of device ids */
-    Neon::DeviceType             m_devType;               /** Types of the device */
-    bool                         m_fullyConnected{false}; /** true if any device can communicate with the others in the set */
-    Neon::set::StreamSet         m_defaultStream;         /** a default stream used by the device set */
-    std::vector<Neon::SetIdx>    m_idxRange;
+    DataSet<Neon::sys::DeviceID>     m_devIds;                /** DataSet of device ids */
+    Neon::DeviceType                 m_devType;               /** Types of the device */
+    bool                             m_fullyConnected{false}; /** true if any device can communicate with the others in the set */
+    Neon::set::StreamSet             m_defaultStream;         /** a default stream used by the device set */
+    std::vector<Neon::SetIdx>        m_idxRange;
+    std::shared_ptr<dist::Transport> m_transport; /** transport to the other processes, null when the partitions are not distributed */
+    std::shared_ptr<std::atomic<uint64_t>> m_transferredBytes{std::make_shared<std::atomic<uint64_t>>(0)}; /** bytes moved by the transfers of the set and of its copies */
+    Neon::sys::CpuBinding                  m_cpuBinding{Neon::sys::CpuBinding::none}; /** how the partitions of a CPU set are mapped to the cores */
+    std::vector<std::vector<int>>          m_partitionCpus;                           /** logical CPUs of each partition, empty when not bound */
+    std::vector<int>                       m_partitionNodes;                          /** NUMA node of each partition, empty when not bound */
+
+    /**
+     * Remote host transfers recorded between beginHostTransferBatch and endHostTransferBatch,
+     * grouped by (source, destination) partition
+     */
+    struct HostTransferBatch
+    {
+        struct Pending
+        {
+            char*       dstBuf;
+            const char* srcBuf;
+            size_t      numBytes;
+        };
+        std::mutex                                       mutex;
+        bool                                             isOpen{false};
+        std::map<std::pair<int, int>, std::vector<Pending>> pending;
+    };
+    std::shared_ptr<HostTransferBatch> m_hostTransferBatch{std::make_shared<HostTransferBatch>()}; /** shared by the copies of the set */
 
    public:
     //--------------------------------------------------------------------------
@@ -157,6 +186,95 @@ class DevSet
         const
         -> const std::vector<int>;
 
+    //--------------------------------------------------------------------------
+    // DISTRIBUTION
+    //--------------------------------------------------------------------------
+
+    /**
+     * Distributes the partitions of the set over the processes connected by the transport.
+     * Each process still allocates all the partitions, but it only computes the partitions it owns
+     * (see dist::Transport::ownerRank). A null transport reverts to a single process.
+     */
+    auto setTransport(std::shared_ptr<dist::Transport> transport)
+        -> void;
+
+    /**
+     * Returns the transport to the other processes, null when the set is not distributed
+     */
+    auto transport() const
+        -> const std::shared_ptr<dist::Transport>&;
+
+    /**
+     * Returns true if the partition is computed by this process
+     */
+    auto isLocal(SetIdx setIdx) const
+        -> bool;
+
+    /**
+     * Host to host transfer between two partitions.
+     * Without a transport it is a memcpy, otherwise the owner of the source sends the buffer
+     * to the owner of the destination. The call is ignored if neither partition is local.
+     */
+    auto hostTransfer(SetIdx      dstSetIdx,
+                      char*       dstBuf,
+                      SetIdx      srcSetIdx,
+                      const char* srcBuf,
+                      size_t      numBytes) const
+        -> void;
+
+    /**
+     * Starts recording the host transfers between partitions owned by different processes.
+     * Local transfers are still done right away.
+     * Nested batches are not supported.
+     */
+    auto beginHostTransferBatch() const
+        -> void;
+
+    /**
+     * Sends the transfers recorded since beginHostTransferBatch with one message per
+     * (source, destination) pair of partitions, then receives and unpacks the messages
+     * for the local partitions. All the processes must record the transfers of a pair in the same order.
+     */
+    auto endHostTransferBatch() const
+        -> void;
+
+    /**
+     * Closes the open host transfer batch dropping the recorded transfers, nothing is sent or received.
+     * Used to recover from an error, the destination buffers of the remote transfers are left unchanged.
+     */
+    auto discardHostTransferBatch() const
+        -> void;
+
+    /**
+     * Host transfer batch bound to a scope.
+     * The batch is opened by the constructor and sent by commit().
+     * If the scope is left without a commit (e.g. by an exception) the batch is discarded,
+     * so that the set, which shares the batch with all its copies, can still be used.
+     */
+    class HostTransferBatchScope
+    {
+       public:
+        explicit HostTransferBatchScope(const DevSet& devSet);
+        ~HostTransferBatchScope();
+
+        HostTransferBatchScope(const HostTransferBatchScope&) = delete;
+        auto operator=(const HostTransferBatchScope&) -> HostTransferBatchScope& = delete;
+
+        auto commit() -> void;
+
+       private:
+        const DevSet* mDevSet;
+        bool          mIsOpen{true};
+    };
+
+    /**
+     * Total number of bytes moved between partitions (peerTransfer and hostTransfer)
+     * by this set and by its copies since their creation.
+     * Transfers received from other processes are not counted.
+     */
+    auto transferredBytes() const
+        -> uint64_t;
+
     template <typename ta_Lambda>
     auto forEachSetIdx(const ta_Lambda& lambda) const
         -> void
@@ -205,6 +323,34 @@ class DevSet
      */
     auto sync() -> void;
 
+    //--------------------------------------------------------------------------
+    // CPU BINDING
+    //--------------------------------------------------------------------------
+
+    /**
+     * Maps the partitions of a CPU set to the cores of the machine (see Neon::sys::CpuTopology::partitionCpus).
+     * The worker threads of the streams returned by newCpuStreamSet are bound to the cores of their partition
+     * and the CPU memory allocated afterwards by newMemDevSet is placed on the NUMA node of its partition.
+     * Only supported by a CPU DevSet.
+     */
+    auto setCpuBinding(Neon::sys::CpuBinding binding)
+        -> void;
+
+    auto cpuBinding() const
+        -> Neon::sys::CpuBinding;
+
+    /**
+     * Returns the logical CPUs of a partition, empty when the set is not bound
+     */
+    auto partitionCpus(SetIdx setIdx) const
+        -> std::vector<int>;
+
+    /**
+     * Returns the NUMA node of the cores of a partition, -1 when the set is not bound
+     */
+    auto partitionNode(SetIdx setIdx) const
+        -> int;
+
     /**
      * Creates a new cuda event for each GPU
      * @param disableTiming
@@ -213,6 +359,24 @@ class DevSet
     auto newEventSet(bool disableTiming) const
         -> GpuEventSet;
 
+    /**
+     * Creates a new streamSet backed by CPU work queues (see Neon::sys::CpuStream),
+     * one worker thread per partition.
+     * Each worker opens OpenMP teams of nThreadsPerStream threads (all the available threads when zero).
+     * When the set is bound (see setCpuBinding) the workers are bound to the CPUs of their partition
+     * and their teams are limited to the number of those CPUs.
+     * Only supported by a CPU DevSet.
+     */
+    auto newCpuStreamSet(int nThreadsPerStream) const
+        -> StreamSet;
+
+    /**
+     * Creates a new event set for the streams returned by newCpuStreamSet.
+     * Only supported by a CPU DevSet.
+     */
+    auto newCpuEventSet() const
+        -> GpuEventSet;
+
     /**
      * Calls cudaDeviceSynchronize on all device in the set effectively syncing
      * all devices on the set
@@ -226,12 +390,19 @@ class DevSet
     auto newLaunchParameters() const
         -> LaunchParameters;
 
+    /**
+     * Runs the lambda of every partition on the stream streamIdx.
+     * The kernel configuration is only read, so that containers can cache it:
+     * the stream and the loop configuration of the openmp runtime are given with each launch.
+     */
     template <typename DataSetContainer_ta, typename Lambda_ta>
     inline auto kernelLambdaWithIterator(const Neon::set::KernelConfig&           kernelConfig,
+                                         int                                      streamIdx,
+                                         const CpuLaunchConfig&                   cpuLaunch,
                                          DataSetContainer_ta&                     dataSetContainer,
-                                         std::function<Lambda_ta(Neon::DeviceType,
-                                                                 SetIdx,
-                                                                 Neon::DataView)> lambdaHolder) const -> void
+                                         const std::function<Lambda_ta(Neon::DeviceType,
+                                                                       SetIdx,
+                                                                       Neon::DataView)>& lambdaHolder) const -> void
     {
         Neon::Runtime mode = kernelConfig.backend().runtime();
         // ORDER is IMPORTANT
@@ -239,12 +410,15 @@ class DevSet
         switch (mode) {
             case Neon::Runtime::stream: {
                 this->template h_kLambdaWithIterator_cudaStreams<DataSetContainer_ta, Lambda_ta>(kernelConfig,
+                                                                                                 streamIdx,
                                                                                                  dataSetContainer,
                                                                                                  lambdaHolder);
                 return;
             };
             case Neon::Runtime::openmp: {
                 this->template h_kLambdaWithIterator_openmp<DataSetContainer_ta, Lambda_ta>(kernelConfig,
+                                                                                            streamIdx,
+                                                                                            cpuLaunch,
                                                                                             dataSetContainer,
                                                                                             lambdaHolder);
                 return;
@@ -260,10 +434,12 @@ class DevSet
     template <typename DataSetContainer_ta, typename Lambda_ta>
     inline auto kernelLambdaWithIterator(Neon::SetIdx                             setIdx,
                                          const Neon::set::KernelConfig&           kernelConfig,
+                                         int                                      streamIdx,
+                                         const CpuLaunchConfig&                   cpuLaunch,
                                          DataSetContainer_ta&                     dataSetContainer,
-                                         std::function<Lambda_ta(Neon::DeviceType,
-                                                                 SetIdx,
-                                                                 Neon::DataView)> lambdaHolder) const -> void
+                                         const std::function<Lambda_ta(Neon::DeviceType,
+                                                                       SetIdx,
+                                                                       Neon::DataView)>& lambdaHolder) const -> void
     {
         Neon::Runtime mode = kernelConfig.backend().runtime();
         // ORDER is IMPORTANT
@@ -272,6 +448,7 @@ class DevSet
             case Neon::Runtime::stream: {
                 this->template h_kLambdaWithIterator_cudaStreams<DataSetContainer_ta, Lambda_ta>(setIdx,
                                                                                                  kernelConfig,
+                                                                                                 streamIdx,
                                                                                                  dataSetContainer,
                                                                                                  lambdaHolder);
                 return;
@@ -279,6 +456,8 @@ class DevSet
             case Neon::Runtime::openmp: {
                 this->template h_kLambdaWithIterator_openmp<DataSetContainer_ta, Lambda_ta>(setIdx,
                                                                                             kernelConfig,
+                                                                                            streamIdx,
+                                                                                            cpuLaunch,
                                                                                             dataSetContainer,
                                                                                             lambdaHolder);
                 return;
@@ -294,6 +473,7 @@ class DevSet
 
     template <typename DataSetContainer_ta, typename Lambda_ta>
     inline auto h_kLambdaWithIterator_cudaStreams([[maybe_unused]] const Neon::set::KernelConfig&           kernelConfig,
+                                                  [[maybe_unused]] int                                      streamIdx,
                                                   [[maybe_unused]] DataSetContainer_ta&                     dataSetContainer,
                                                   [[maybe_unused]] std::function<Lambda_ta(Neon::DeviceType,
                                                                                            SetIdx,
@@ -307,7 +487,7 @@ class DevSet
         }
 #ifdef NEON_COMPILER_CUDA
 
-        const StreamSet&        gpuStreamSet = kernelConfig.streamSet();
+        const StreamSet&        gpuStreamSet = kernelConfig.backend().streamSet(streamIdx);
         const LaunchParameters& launchInfoSet = kernelConfig.launchInfoSet();
         const int               nGpus = int(m_devIds.size());
         {
@@ -342,6 +522,7 @@ class DevSet
     template <typename DataSetContainer_ta, typename Lambda_ta>
     inline auto h_kLambdaWithIterator_cudaStreams([[maybe_unused]] Neon::SetIdx                             setIdx,
                                                   [[maybe_unused]] const Neon::set::KernelConfig&           kernelConfig,
+                                                  [[maybe_unused]] int                                      streamIdx,
                                                   [[maybe_unused]] DataSetContainer_ta&                     dataSetContainer,
                                                   [[maybe_unused]] std::function<Lambda_ta(Neon::DeviceType,
                                                                                            SetIdx,
@@ -355,7 +536,7 @@ class DevSet
         }
 #ifdef NEON_COMPILER_CUDA
 
-        const StreamSet&        gpuStreamSet = kernelConfig.streamSet();
+        const StreamSet&        gpuStreamSet = kernelConfig.backend().streamSet(streamIdx);
         const LaunchParameters& launchInfoSet = kernelConfig.launchInfoSet();
         const int               nGpus = int(m_devIds.size());
         {
@@ -388,10 +569,12 @@ class DevSet
 
     template <typename DataSetContainer_ta, typename Lambda_ta>
     inline auto h_kLambdaWithIterator_openmp([[maybe_unused]] const Neon::set::KernelConfig&           kernelConfig,
+                                             int                                                       streamIdx,
+                                             const CpuLaunchConfig&                                    cpuLaunch,
                                              [[maybe_unused]] DataSetContainer_ta&                     dataSetContainer,
-                                             [[maybe_unused]] std::function<Lambda_ta(Neon::DeviceType,
-                                                                                      SetIdx,
-                                                                                      Neon::DataView)> lambdaHolder)
+                                             [[maybe_unused]] const std::function<Lambda_ta(Neon::DeviceType,
+                                                                                            SetIdx,
+                                                                                            Neon::DataView)>& lambdaHolder)
         const -> void
     {
         if (m_devType != Neon::DeviceType::CPU) {
@@ -401,13 +584,28 @@ class DevSet
         }
         const LaunchParameters& launchInfoSet = kernelConfig.launchInfoSet();
         const int               nGpus = static_cast<int>(m_devIds.size());
+        if (kernelConfig.backend().hasCpuStreams()) {
+            for (int idx = 0; idx < nGpus; idx++) {
+                h_kLambdaWithIterator_cpuStream<DataSetContainer_ta, Lambda_ta>(idx, kernelConfig, streamIdx, cpuLaunch, dataSetContainer, lambdaHolder);
+            }
+            if (kernelConfig.runMode() == Neon::run_et::sync) {
+                kernelConfig.backend().streamSet(streamIdx).sync();
+            }
+            return;
+        }
         {
             for (int idx = 0; idx < nGpus; idx++) {
+                if (!isLocal(idx)) {
+                    // The partition is computed by another process
+                    continue;
+                }
                 auto      iterator = dataSetContainer.getPartitionIndexSpace(Neon::DeviceType::CPU,
                                                                         idx,
                                                                         kernelConfig.dataView());
                 Lambda_ta lambda = lambdaHolder(Neon::DeviceType::CPU, idx, kernelConfig.dataView());
-                Neon::set::internal::execLambdaWithIterator_omp<DataSetContainer_ta, Lambda_ta>(launchInfoSet[idx].domainGrid(), iterator, lambda);
+                Neon::set::internal::execLambdaWithIterator_omp<DataSetContainer_ta, Lambda_ta>(launchInfoSet[idx].domainGrid(), iterator, lambda,
+                                                                                                kernelConfig.backend().cpuSerialLaunchThreshold(),
+                                                                                            cpuLaunch);
             }
         }
         return;
@@ -416,10 +614,12 @@ class DevSet
     template <typename DataSetContainer_ta, typename Lambda_ta>
     inline auto h_kLambdaWithIterator_openmp(Neon::SetIdx                                              setIdx,
                                              [[maybe_unused]] const Neon::set::KernelConfig&           kernelConfig,
+                                             int                                                       streamIdx,
+                                             const CpuLaunchConfig&                                    cpuLaunch,
                                              [[maybe_unused]] DataSetContainer_ta&                     dataSetContainer,
-                                             [[maybe_unused]] std::function<Lambda_ta(Neon::DeviceType,
-                                                                                      SetIdx,
-                                                                                      Neon::DataView)> lambdaHolder)
+                                             [[maybe_unused]] const std::function<Lambda_ta(Neon::DeviceType,
+                                                                                            SetIdx,
+                                                                                            Neon::DataView)>& lambdaHolder)
         const -> void
     {
         if (m_devType != Neon::DeviceType::CPU) {
@@ -428,16 +628,56 @@ class DevSet
             NEON_THROW(exp);
         }
         const LaunchParameters& launchInfoSet = kernelConfig.launchInfoSet();
+        if (kernelConfig.backend().hasCpuStreams()) {
+            h_kLambdaWithIterator_cpuStream<DataSetContainer_ta, Lambda_ta>(setIdx, kernelConfig, streamIdx, cpuLaunch, dataSetContainer, lambdaHolder);
+            if (kernelConfig.runMode() == Neon::run_et::sync) {
+                kernelConfig.backend().streamSet(streamIdx).sync(setIdx.idx());
+            }
+            return;
+        }
+        if (!isLocal(setIdx)) {
+            return;
+        }
         {
             auto      iterator = dataSetContainer.getPartitionIndexSpace(Neon::DeviceType::CPU,
                                                                          setIdx.idx(),
                                                                          kernelConfig.dataView());
             Lambda_ta lambda = lambdaHolder(Neon::DeviceType::CPU, setIdx.idx(), kernelConfig.dataView());
-            Neon::set::internal::execLambdaWithIterator_omp<DataSetContainer_ta, Lambda_ta>(launchInfoSet[setIdx.idx()].domainGrid(), iterator, lambda);
+            Neon::set::internal::execLambdaWithIterator_omp<DataSetContainer_ta, Lambda_ta>(launchInfoSet[setIdx.idx()].domainGrid(), iterator, lambda,
+                                                                                            kernelConfig.backend().cpuSerialLaunchThreshold(),
+                                                                                            cpuLaunch);
         }
         return;
     }
 
+    /**
+     * Enqueues the kernel of one partition on the CPU stream of the partition (see Backend::setCpuStreams).
+     * The partition lambda is extracted by the calling thread, the worker thread of the stream only runs it.
+     */
+    template <typename DataSetContainer_ta, typename Lambda_ta>
+    inline auto h_kLambdaWithIterator_cpuStream(Neon::SetIdx                                              setIdx,
+                                                const Neon::set::KernelConfig&                            kernelConfig,
+                                                int                                                       streamIdx,
+                                                const CpuLaunchConfig&                                    cpuLaunch,
+                                                DataSetContainer_ta&                                      dataSetContainer,
+                                                const std::function<Lambda_ta(Neon::DeviceType,
+                                                                              SetIdx,
+                                                                              Neon::DataView)>& lambdaHolder)
+        const -> void
+    {
+        auto                  iterator = dataSetContainer.getPartitionIndexSpace(Neon::DeviceType::CPU,
+                                                                                 setIdx.idx(),
+                                                                                 kernelConfig.dataView());
+        Lambda_ta             lambda = lambdaHolder(Neon::DeviceType::CPU, setIdx.idx(), kernelConfig.dataView());
+        Neon::int64_3d        gridDim = kernelConfig.launchInfoSet()[setIdx.idx()].domainGrid();
+        const int64_t         serialThreshold = kernelConfig.backend().cpuSerialLaunchThreshold();
+        const CpuLaunchConfig launch = cpuLaunch;
+        const StreamSet&      streamSet = kernelConfig.backend().streamSet(streamIdx);
+        streamSet[setIdx].cpuStream().enqueue([gridDim, iterator, lambda, serialThreshold, launch]() {
+            Neon::set::internal::execLambdaWithIterator_omp<DataSetContainer_ta, Lambda_ta>(gridDim, iterator, lambda, serialThreshold, launch);
+        });
+    }
+
    public:
     //--------------------------------------------------------------------------
     // MEMORY MANAGEMENT
@@ -520,7 +760,9 @@ class DevSet
             }
             case Neon::DeviceType::CPU: {
                 std::vector<Neon::sys::DeviceID> idVec(this->setCardinality(), 0);
-                return MemDevSet<T_ta>(devType, idVec, allocType, nElementVec, alignment);
+                MemDevSet<T_ta>                  out(devType, idVec, allocType, nElementVec, alignment);
+                h_bindCpuMemory(out);
+                return out;
             }
             default: {
                 Neon::NeonException exp("GpuSet");
@@ -574,14 +816,16 @@ class DevSet
             }
             case Neon::DeviceType::CPU: {
                 std::vector<Neon::sys::DeviceID> idVec(this->setCardinality(), 0);
-                return MemDevSet<T_ta>(cardinality,
-                                       order,
-                                       padding,
-                                       devType,
-                                       idVec,
-                                       std::forward<const Neon::Allocator>(allocType),
-                                       nElementVec,
-                                       alignment);
+                auto                             out = MemDevSet<T_ta>(cardinality,
+                                                                       order,
+                                                                       padding,
+                                                                       devType,
+                                                                       idVec,
+                                                                       std::forward<const Neon::Allocator>(allocType),
+                                                                       nElementVec,
+                                                                       alignment);
+                h_bindCpuMemory(out);
+                return out;
             }
             default: {
                 Neon::NeonException exp("GpuSet");
@@ -745,6 +989,25 @@ class DevSet
 
     auto h_init_defaultStreamSet() -> void;
 
+    /**
+     * Places the buffer of each partition on the NUMA node of the partition (see setCpuBinding)
+     */
+    template <typename T_ta>
+    auto h_bindCpuMemory(MemDevSet<T_ta>& memSet) const -> void
+    {
+        if (m_partitionNodes.empty()) {
+            return;
+        }
+        for (int i = 0; i < memSet.setCardinality() && i < int(m_partitionNodes.size()); i++) {
+            T_ta*        mem = memSet.mem(i);
+            const size_t bytes = memSet.count(i) * sizeof(T_ta);
+            if (mem == nullptr || bytes == 0) {
+                continue;
+            }
+            Neon::sys::CpuTopology::bindMemory(mem, bytes, m_partitionNodes[i]);
+        }
+    }
+
 };  // namespace set
 
 extern template auto Neon::set::DevSet::peerTransfer<Neon::set::TransferMode::put>(const StreamSet& streamSet,
@@ -1,5 +1,11 @@
 #pragma once
+#include <omp.h>
+#include <algorithm>
 #include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "Neon/set/CpuLaunchConfig.h"
 
 namespace Neon {
 namespace set {
@@ -38,19 +44,220 @@ NEON_CUDA_KERNEL auto execLambdaWithIterator_cuda(typename DataSetContainer_ta::
         }
     }
 }
+
+/**
+ * Reduction kernel: each thread maps its cell to a value (identity for inactive cells),
+ * the block combines the values with a tree in dynamic shared memory (one T per thread)
+ * and thread 0 stores the block result in blockResults.
+ */
+template <typename DataSetContainer_ta,
+          typename UserLambda_ta,
+          typename T,
+          typename CombineOp_ta>
+NEON_CUDA_KERNEL auto execReduceWithIterator_cuda(typename DataSetContainer_ta::PartitionIndexSpace i,
+                                                  UserLambda_ta                                     userLambdaTa,
+                                                  T                                                 identity,
+                                                  CombineOp_ta                                      combine,
+                                                  T*                                                blockResults)
+    -> void
+{
+    extern __shared__ unsigned char reduceSharedMem[];
+    T*                              partials = reinterpret_cast<T*>(reduceSharedMem);
+
+    const unsigned int tid = threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z);
+    const unsigned int nThreads = blockDim.x * blockDim.y * blockDim.z;
+
+    typename DataSetContainer_ta::PartitionIndexSpace::Cell e;
+    bool                                                    isValid = false;
+    if constexpr (DataSetContainer_ta::PartitionIndexSpace::SpaceDim == 1) {
+        isValid = i.setAndValidate(e,
+                                   threadIdx.x + blockIdx.x * blockDim.x,
+                                   0,
+                                   0);
+    }
+    if constexpr (DataSetContainer_ta::PartitionIndexSpace::SpaceDim == 2) {
+        isValid = i.setAndValidate(e,
+                                   threadIdx.x + blockIdx.x * blockDim.x,
+                                   threadIdx.y + blockIdx.y * blockDim.y,
+                                   0);
+    }
+    if constexpr (DataSetContainer_ta::PartitionIndexSpace::SpaceDim == 3) {
+        isValid = i.setAndValidate(e,
+                                   threadIdx.x + blockIdx.x * blockDim.x,
+                                   threadIdx.y + blockIdx.y * blockDim.y,
+                                   threadIdx.z + blockIdx.z * blockDim.z);
+    }
+    partials[tid] = isValid ? userLambdaTa(e) : identity;
+    __syncthreads();
+
+    for (unsigned int stride = 1; stride < nThreads; stride *= 2) {
+        if (tid % (2 * stride) == 0 && tid + stride < nThreads) {
+            partials[tid] = combine(partials[tid], partials[tid + stride]);
+        }
+        __syncthreads();
+    }
+    if (tid == 0) {
+        blockResults[blockIdx.x + gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z)] = partials[0];
+    }
+}
 #endif
 
 
+/**
+ * True when the partition index space can run all the cells of a block in one call
+ * (i.e., it defines sBlockExecution, numBlocks() and forEachActiveCellInBlock()).
+ */
+template <typename PartitionIndexSpace_ta, typename = void>
+struct HasBlockExecution : std::false_type
+{
+};
+
+template <typename PartitionIndexSpace_ta>
+struct HasBlockExecution<PartitionIndexSpace_ta, std::void_t<decltype(PartitionIndexSpace_ta::sBlockExecution)>>
+    : std::integral_constant<bool, PartitionIndexSpace_ta::sBlockExecution>
+{
+};
+
+inline auto toOmpSchedule(CpuLaunchConfig::Schedule schedule) -> omp_sched_t
+{
+    switch (schedule) {
+        case CpuLaunchConfig::Schedule::ompDynamic: {
+            return omp_sched_dynamic;
+        }
+        case CpuLaunchConfig::Schedule::ompGuided: {
+            return omp_sched_guided;
+        }
+        default: {
+            return omp_sched_static;
+        }
+    }
+}
+
+/**
+ * Sets the OpenMP runtime schedule of the calling thread and restores the previous one when it goes out of scope
+ */
+class OmpScheduleScope
+{
+   public:
+    OmpScheduleScope(omp_sched_t kind, int chunk)
+    {
+        omp_get_schedule(&mKind, &mChunk);
+        omp_set_schedule(kind, chunk);
+    }
+
+    ~OmpScheduleScope()
+    {
+        omp_set_schedule(mKind, mChunk);
+    }
+
+    OmpScheduleScope(const OmpScheduleScope&) = delete;
+    auto operator=(const OmpScheduleScope&) -> OmpScheduleScope& = delete;
+
+   private:
+    omp_sched_t mKind;
+    int         mChunk;
+};
+
+/**
+ * Runs the user lambda on the cells of a partition with a non default loop configuration (see CpuLaunchConfig).
+ * The schedule is the runtime schedule of the calling thread during the launch, the previous one is then restored.
+ */
+template <typename DataSetContainer_ta, typename UserLambda_ta>
+void execLambdaWithIterator_ompTuned(const Neon::int64_3d&                             gridDim,
+                                     typename DataSetContainer_ta::PartitionIndexSpace partitionIndexSpace,
+                                     UserLambda_ta                                     userLambdaTa,
+                                     bool                                              isParallel,
+                                     const CpuLaunchConfig&                            launch)
+{
+    using PartitionIndexSpace = typename DataSetContainer_ta::PartitionIndexSpace;
+
+    const int        nThreads = launch.nThreads > 0 ? launch.nThreads : omp_get_max_threads();
+    OmpScheduleScope scheduleScope(toOmpSchedule(launch.schedule), launch.chunk);
+
+    if constexpr (HasBlockExecution<PartitionIndexSpace>::value) {
+        const int64_t numBlocks = int64_t(partitionIndexSpace.numBlocks());
+#pragma omp parallel for schedule(runtime) num_threads(nThreads) default(shared) if (isParallel)
+        for (int64_t b = 0; b < numBlocks; b++) {
+            partitionIndexSpace.forEachActiveCellInBlock(uint32_t(b), userLambdaTa);
+        }
+        return;
+    }
+
+    if constexpr (PartitionIndexSpace::SpaceDim == 1) {
+#pragma omp parallel for schedule(runtime) num_threads(nThreads) default(shared) if (isParallel)
+        for (int64_t x = 0; x < gridDim.x; x++) {
+            typename PartitionIndexSpace::Cell e;
+            if (partitionIndexSpace.setAndValidate(e, x, 0, 0)) {
+                userLambdaTa(e);
+            }
+        }
+    }
+
+    if constexpr (PartitionIndexSpace::SpaceDim == 2 || PartitionIndexSpace::SpaceDim == 3) {
+        // Tiles of tileY x tileZ rows, each row is a SIMD loop along x
+        const int64_t depth = PartitionIndexSpace::SpaceDim == 3 ? gridDim.z : 1;
+        const int64_t tileY = std::max(1, launch.tileY);
+        const int64_t tileZ = PartitionIndexSpace::SpaceDim == 3 ? std::max(1, launch.tileZ) : 1;
+        const int64_t nTilesY = (gridDim.y + tileY - 1) / tileY;
+        const int64_t nTiles = nTilesY * ((depth + tileZ - 1) / tileZ);
+#pragma omp parallel for schedule(runtime) num_threads(nThreads) default(shared) if (isParallel)
+        for (int64_t t = 0; t < nTiles; t++) {
+            const int64_t y0 = (t % nTilesY) * tileY;
+            const int64_t z0 = (t / nTilesY) * tileZ;
+            const int64_t y1 = std::min(y0 + tileY, gridDim.y);
+            const int64_t z1 = std::min(z0 + tileZ, depth);
+            for (int64_t z = z0; z < z1; z++) {
+                for (int64_t y = y0; y < y1; y++) {
+#ifndef NEON_OS_WINDOWS
+#pragma omp simd
+#endif
+                    for (int64_t x = 0; x < gridDim.x; x++) {
+                        typename PartitionIndexSpace::Cell e;
+                        if (partitionIndexSpace.setAndValidate(e, x, y, z)) {
+                            userLambdaTa(e);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Runs the user lambda on the cells of a partition.
+ * Partitions with fewer than serialThreshold cells run on the calling thread:
+ * the if clause turns the parallel region into an inactive one, skipping the fork/join of the thread team.
+ * Launch configurations other than the default one are run by execLambdaWithIterator_ompTuned.
+ */
 template <typename DataSetContainer_ta, typename UserLambda_ta>
 void execLambdaWithIterator_omp(const Neon::int64_3d&                             gridDim,
                                 typename DataSetContainer_ta::PartitionIndexSpace partitionIndexSpace,
-                                UserLambda_ta                                     userLambdaTa)
+                                UserLambda_ta                                     userLambdaTa,
+                                int64_t                                           serialThreshold = 0,
+                                const CpuLaunchConfig&                            launch = CpuLaunchConfig())
 {
+    const bool isParallel = gridDim.rMulTyped<int64_t>() >= serialThreshold;
+
+    if (!launch.isDefault()) {
+        execLambdaWithIterator_ompTuned<DataSetContainer_ta, UserLambda_ta>(gridDim, partitionIndexSpace, userLambdaTa, isParallel, launch);
+        return;
+    }
+
+    if constexpr (HasBlockExecution<typename DataSetContainer_ta::PartitionIndexSpace>::value) {
+        // One block per iteration: the block iterates its cells row by row
+        const int64_t numBlocks = int64_t(partitionIndexSpace.numBlocks());
+#pragma omp parallel for schedule(static) default(shared) if (isParallel)
+        for (int64_t b = 0; b < numBlocks; b++) {
+            partitionIndexSpace.forEachActiveCellInBlock(uint32_t(b), userLambdaTa);
+        }
+        return;
+    }
+
     if constexpr (DataSetContainer_ta::PartitionIndexSpace::SpaceDim == 1) {
 #ifdef NEON_OS_WINDOWS
-#pragma omp parallel for default(shared)
+#pragma omp parallel for default(shared) if (isParallel)
 #else
-#pragma omp parallel for simd default(shared)
+#pragma omp parallel for simd default(shared) if (parallel : isParallel)
 #endif
         for (int64_t x = 0; x < gridDim.x; x++) {
             typename DataSetContainer_ta::PartitionIndexSpace::Cell e;
@@ -63,9 +270,9 @@ void execLambdaWithIterator_omp(const Neon::int64_3d&
 
     if constexpr (DataSetContainer_ta::PartitionIndexSpace::SpaceDim == 2) {
 #ifdef NEON_OS_WINDOWS
-#pragma omp parallel for default(shared)
+#pragma omp parallel for default(shared) if (isParallel)
 #else
-#pragma omp parallel for simd collapse(2) default(shared)
+#pragma omp parallel for simd collapse(2) default(shared) if (parallel : isParallel)
 #endif
         for (int64_t y = 0; y < gridDim.y; y++) {
             for (int64_t x = 0; x < gridDim.x; x++) {
@@ -79,9 +286,9 @@ void execLambdaWithIterator_omp(const Neon::int64_3d&
 
     if constexpr (DataSetContainer_ta::PartitionIndexSpace::SpaceDim == 3) {
 #ifdef NEON_OS_WINDOWS
-#pragma omp parallel for default(shared)
+#pragma omp parallel for default(shared) if (isParallel)
 #else
-#pragma omp parallel for simd collapse(3) default(shared)
+#pragma omp parallel for simd collapse(3) default(shared) if (parallel : isParallel)
 #endif
         for (int64_t z = 0; z < gridDim.z; z++) {
             for (int64_t y = 0; y < gridDim.y; y++) {
@@ -96,6 +303,77 @@ void execLambdaWithIterator_omp(const Neon::int64_3d&
     }
 }
 
+/**
+ * Reduction over the cells of a partition: each thread folds the values of its cells into a private
+ * partial, the partials are then combined with a pairwise tree in thread order.
+ * Block execution (forEachActiveCellInBlock) is not used here since its SIMD rows
+ * assume the user lambda has no loop carried dependency.
+ * As in execLambdaWithIterator_omp, partitions with fewer than serialThreshold cells run on the calling thread.
+ */
+template <typename DataSetContainer_ta, typename UserLambda_ta, typename T, typename CombineOp_ta>
+auto execReduceWithIterator_omp(const Neon::int64_3d&                             gridDim,
+                                typename DataSetContainer_ta::PartitionIndexSpace partitionIndexSpace,
+                                UserLambda_ta                                     userLambdaTa,
+                                T                                                 identity,
+                                CombineOp_ta                                      combine,
+                                int64_t                                           serialThreshold = 0)
+    -> T
+{
+    using Cell = typename DataSetContainer_ta::PartitionIndexSpace::Cell;
+
+    const bool     isParallel = gridDim.rMulTyped<int64_t>() >= serialThreshold;
+    const int      nThreads = isParallel ? omp_get_max_threads() : 1;
+    std::vector<T> partials(nThreads, identity);
+
+#pragma omp parallel num_threads(nThreads) default(shared) if (isParallel)
+    {
+        T partial = identity;
+
+        if constexpr (DataSetContainer_ta::PartitionIndexSpace::SpaceDim == 1) {
+#pragma omp for schedule(static)
+            for (int64_t x = 0; x < gridDim.x; x++) {
+                Cell e;
+                if (partitionIndexSpace.setAndValidate(e, x, 0, 0)) {
+                    partial = combine(partial, userLambdaTa(e));
+                }
+            }
+        }
+
+        if constexpr (DataSetContainer_ta::PartitionIndexSpace::SpaceDim == 2) {
+#pragma omp for schedule(static) collapse(2)
+            for (int64_t y = 0; y < gridDim.y; y++) {
+                for (int64_t x = 0; x < gridDim.x; x++) {
+                    Cell e;
+                    if (partitionIndexSpace.setAndValidate(e, x, y, 0)) {
+                        partial = combine(partial, userLambdaTa(e));
+                    }
+                }
+            }
+        }
+
+        if constexpr (DataSetContainer_ta::PartitionIndexSpace::SpaceDim == 3) {
+#pragma omp for schedule(static) collapse(3)
+            for (int64_t z = 0; z < gridDim.z; z++) {
+                for (int64_t y = 0; y < gridDim.y; y++) {
+                    for (int64_t x = 0; x < gridDim.x; x++) {
+                        Cell e;
+                        if (partitionIndexSpace.setAndValidate(e, x, y, z)) {
+                            partial = combine(partial, userLambdaTa(e));
+                        }
+                    }
+                }
+            }
+        }
+        partials[omp_get_thread_num()] = partial;
+    }
+
+    for (int stride = 1; stride < nThreads; stride *= 2) {
+        for (int t = 0; t + stride < nThreads; t += 2 * stride) {
+            partials[t] = combine(partials[t], partials[t + stride]);
+        }
+    }
+    return partials[0];
+}
 
 }  // namespace internal
 }  // namespace set
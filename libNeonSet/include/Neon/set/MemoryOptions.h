@@ -1,5 +1,6 @@
 #pragma once
 #include <vector>
+#include "Neon/core/types/SpatialLayout.h"
 #include "Neon/set/Transfer.h"
 
 namespace Neon {
@@ -68,6 +69,19 @@ struct MemoryOptions
     auto setOrder(Neon::MemoryLayout)
         -> void;
 
+    /**
+     * Returns the order in which cells are stored in memory
+     */
+    auto getSpatialLayout() const
+        -> Neon::SpatialLayout;
+
+    /**
+     * Set the order in which cells are stored in memory.
+     * The option is supported by dGrid, other grids use a linear order.
+     */
+    auto setSpatialLayout(Neon::SpatialLayout)
+        -> void;
+
    private:
     /**
      * Helper method to check if the object was initialized by the backend
@@ -102,6 +116,7 @@ struct MemoryOptions
     Neon::DeviceType   mComputeType = Neon::DeviceType::NONE /** Compute device type */;
     Neon::DeviceType   mIOType = Neon::DeviceType::NONE /** IO device type */;
     Neon::Allocator    mIOAllocator = Neon::Allocator::NULL_MEM /** IO allocator type */;
-    Neon::MemoryLayout mMemOrder = Neon::MemoryLayout::structOfArrays /** Memory order */;
+    Neon::MemoryLayout  mMemOrder = Neon::MemoryLayout::structOfArrays /** Memory order */;
+    Neon::SpatialLayout mSpatialLayout = Neon::SpatialLayout::linear /** Order of the cells */;
 };
 }  // namespace Neon
\ No newline at end of file
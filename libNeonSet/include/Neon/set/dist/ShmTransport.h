@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Neon/set/dist/Transport.h"
+
+namespace Neon::set::dist {
+
+/**
+ * Transport between processes of the same node through a POSIX shared memory segment.
+ *
+ * The segment holds one single-producer single-consumer ring buffer for each ordered pair of ranks.
+ * All the ranks open the segment with the same name: the first rank creates it
+ * and the segment is unlinked once all the ranks are attached.
+ * The name must be unique for each run (e.g. include the pid of the launcher).
+ * A receiver thread drains the rings into the mailbox of the transport, so a sender
+ * only waits when the ring towards a rank is full.
+ */
+class ShmTransport : public Transport
+{
+   public:
+    ShmTransport(const std::string& segmentName /**< name of the shared memory segment, common to all the ranks */,
+                 int                rank /**< rank of this process */,
+                 int                nRanks /**< number of processes */,
+                 size_t             ringBytes = size_t(1) << 20 /**< capacity of each ring buffer */);
+
+    ~ShmTransport() override;
+
+    auto name() const -> std::string override;
+
+   protected:
+    auto helpSend(int         dstRank,
+                  uint64_t    tag,
+                  const void* buf,
+                  size_t      bytes) -> void override;
+
+   private:
+    struct Ring;
+
+    /**
+     * Ring where srcRank writes the messages for dstRank
+     */
+    auto helpRing(int srcRank,
+                  int dstRank) -> Ring&;
+
+    /**
+     * Writes bytes in a ring, waiting for free space when needed
+     */
+    auto helpWrite(Ring&       ring,
+                   const void* buf,
+                   size_t      bytes) -> void;
+
+    /**
+     * Reads bytes from a ring, waiting for data when needed
+     */
+    auto helpRead(Ring&  ring,
+                  void*  buf,
+                  size_t bytes) -> void;
+
+    auto helpReceiverLoop() -> void;
+
+    std::string                   mSegmentName;
+    size_t                        mRingBytes{0};
+    size_t                        mRingStride{0};
+    size_t                        mSegmentBytes{0};
+    char*                         mSegment{nullptr};
+    std::unique_ptr<std::mutex[]> mSendMutex /**< one mutex per destination, the threads of a rank share a ring */;
+    std::atomic<bool>             mStop{false};
+    std::thread                   mReceiver;
+};
+
+}  // namespace Neon::set::dist
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Neon/set/dist/Transport.h"
+
+namespace Neon::set::dist {
+
+/**
+ * Transport between processes through TCP sockets.
+ *
+ * Rank r listens on basePort + r. The ranks are connected all-to-all:
+ * each rank connects to the lower ranks and accepts the connections of the higher ones.
+ * A receiver thread per peer reads the incoming messages into the mailbox of the transport.
+ * With the default host ("127.0.0.1") all the ranks run on the local machine.
+ */
+class TcpTransport : public Transport
+{
+   public:
+    TcpTransport(int                rank /**< rank of this process */,
+                 int                nRanks /**< number of processes */,
+                 int                basePort /**< rank r listens on basePort + r */,
+                 const std::string& host = "127.0.0.1" /**< address of the host where the ranks listen */);
+
+    ~TcpTransport() override;
+
+    auto name() const -> std::string override;
+
+   protected:
+    auto helpSend(int         dstRank,
+                  uint64_t    tag,
+                  const void* buf,
+                  size_t      bytes) -> void override;
+
+   private:
+    auto helpReceiverLoop(int srcRank) -> void;
+
+    std::vector<int>              mSockets /**< socket connected to each rank, -1 for this rank */;
+    std::unique_ptr<std::mutex[]> mSendMutex /**< one mutex per destination, the threads of a rank share a socket */;
+    std::vector<std::thread>      mReceivers;
+};
+
+}  // namespace Neon::set::dist
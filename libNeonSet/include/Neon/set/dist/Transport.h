@@ -0,0 +1,216 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Neon/core/core.h"
+
+namespace Neon::set::dist {
+
+/**
+ * Reduction operations supported by Transport::allreduce
+ */
+enum class ReduceOp
+{
+    sum = 0,
+    max = 1,
+    min = 2
+};
+
+/**
+ * Communication layer of a multi-process backend (see Neon::Backend::setTransport).
+ *
+ * The processes (ranks) run the same program (SPMD): every rank builds the same grids and fields
+ * and calls the same operations, but each rank computes only the partitions it owns.
+ * Partitions are assigned to ranks in contiguous blocks (see ownerRank).
+ *
+ * Point to point messages are identified by the source rank and a tag.
+ * Messages with the same source and tag are received in the order they were sent.
+ * Sends are buffered: send() never waits for the matching recv(), so that two ranks
+ * can exchange halos in any order without deadlocks.
+ *
+ * Collective operations (barrier, allreduce) must be called by all the ranks in the same order,
+ * from one thread per rank.
+ *
+ * Derived classes implement the delivery of the messages (send) and hand the incoming messages
+ * to the base class (helpDeliver), usually from a dedicated receiver thread.
+ */
+class Transport
+{
+   public:
+    virtual ~Transport() = default;
+
+    Transport(const Transport&) = delete;
+    Transport& operator=(const Transport&) = delete;
+
+    /**
+     * Rank of this process
+     */
+    auto rank() const -> int;
+
+    /**
+     * Number of processes
+     */
+    auto nRanks() const -> int;
+
+    /**
+     * Name of the transport (e.g. "shm" or "tcp")
+     */
+    virtual auto name() const -> std::string = 0;
+
+    /**
+     * Sends a message. The buffer can be reused as soon as the call returns.
+     */
+    auto send(int         dstRank,
+              uint64_t    tag,
+              const void* buf,
+              size_t      bytes) -> void;
+
+    /**
+     * Blocks until the message with the given source and tag has been received and copies it into buf.
+     * The size of the message must match.
+     */
+    auto recv(int      srcRank,
+              uint64_t tag,
+              void*    buf,
+              size_t   bytes) -> void;
+
+    /**
+     * Blocks until all the ranks have reached the barrier
+     */
+    auto barrier() -> void;
+
+    /**
+     * Element-wise reduction of the data of all the ranks.
+     * On return every rank holds the result.
+     * The values are combined in rank order, so the result does not depend on the arrival order of the messages.
+     */
+    template <typename T>
+    auto allreduce(T*       data,
+                   int      count,
+                   ReduceOp op) -> void;
+
+    /**
+     * Element-wise reduction of a single value (see allreduce)
+     */
+    template <typename T>
+    auto allreduce(T        value,
+                   ReduceOp op) -> T;
+
+    /**
+     * Combines two values with a reduction operation
+     */
+    template <typename T>
+    static auto combine(ReduceOp op,
+                        const T& a,
+                        const T& b) -> T;
+
+    /**
+     * Rank that owns a partition when nPartitions partitions are distributed in contiguous blocks
+     */
+    auto ownerRank(int setIdx,
+                   int nPartitions) const -> int;
+
+    /**
+     * Tag used for the data of a transfer between two partitions
+     */
+    static auto transferTag(int srcSetIdx,
+                            int dstSetIdx) -> uint64_t;
+
+   protected:
+    Transport(int rank,
+              int nRanks);
+
+    /**
+     * Delivers a message to another rank. Called by send() for remote destinations.
+     */
+    virtual auto helpSend(int         dstRank,
+                          uint64_t    tag,
+                          const void* buf,
+                          size_t      bytes) -> void = 0;
+
+    /**
+     * Stores an incoming message until it is received
+     */
+    auto helpDeliver(int                 srcRank,
+                     uint64_t            tag,
+                     std::vector<char>&& message) -> void;
+
+   private:
+    /**
+     * Returns a new tag for a collective operation
+     */
+    auto helpCollectiveTag() -> uint64_t;
+
+    int      mRank{0};
+    int      mNRanks{1};
+    uint64_t mCollectiveCount{0};
+
+    std::mutex                                                         mMailboxMutex;
+    std::condition_variable                                            mMailboxArrival;
+    std::map<std::pair<int, uint64_t>, std::deque<std::vector<char>>> mMailbox;
+};
+
+template <typename T>
+auto Transport::allreduce(T*       data,
+                          int      count,
+                          ReduceOp op) -> void
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Transport::allreduce requires trivially copyable types");
+    if (nRanks() == 1) {
+        return;
+    }
+    const uint64_t tag = helpCollectiveTag();
+    const size_t   bytes = sizeof(T) * size_t(count);
+    if (rank() == 0) {
+        std::vector<T> other(count);
+        for (int r = 1; r < nRanks(); r++) {
+            recv(r, tag, other.data(), bytes);
+            for (int i = 0; i < count; i++) {
+                data[i] = combine(op, data[i], other[i]);
+            }
+        }
+        for (int r = 1; r < nRanks(); r++) {
+            send(r, tag, data, bytes);
+        }
+        return;
+    }
+    send(0, tag, data, bytes);
+    recv(0, tag, data, bytes);
+}
+
+template <typename T>
+auto Transport::allreduce(T        value,
+                          ReduceOp op) -> T
+{
+    allreduce(&value, 1, op);
+    return value;
+}
+
+template <typename T>
+auto Transport::combine(ReduceOp op,
+                        const T& a,
+                        const T& b) -> T
+{
+    switch (op) {
+        case ReduceOp::sum: {
+            return a + b;
+        }
+        case ReduceOp::max: {
+            return a < b ? b : a;
+        }
+        case ReduceOp::min: {
+            return b < a ? b : a;
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+}  // namespace Neon::set::dist
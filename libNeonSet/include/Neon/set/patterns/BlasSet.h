@@ -1,14 +1,21 @@
 #pragma once
 #include "Neon/sys/patterns/Blas.h"
 
+#include <memory>
+#include <vector>
+
 #include "Neon/set/GpuStreamSet.h"
+#include "Neon/set/dist/Transport.h"
 #include "Neon/set/memory/memDevSet.h"
 #include "Neon/sys/patterns/Blas.h"
+#include "Neon/sys/patterns/ReproducibleSum.h"
 
 namespace Neon::set::patterns {
 /**
  * Collection of computational patterns computed using Blas from the libNeonSys. 
  This class is not thread safe as it assumes only a single host thread to call it while it allow parallelization via steams (using StreamSet)
+ When the device set is distributed over several processes (see DevSet::setTransport), each process computes
+ its own partitions and the results are combined across the processes.
 */
 template <typename T>
 class BlasSet
@@ -40,6 +47,11 @@ class BlasSet
     */
     Neon::sys::patterns::template Blas<T>& getBlas(size_t i);
 
+    /**
+     * Return the backend engine
+    */
+    Neon::sys::patterns::Engine getEngine() const;
+
     /**
      * Compute the absolute sum of the input buffer i.e. sum_{i=0}^{n-1}(abs(input[i]))
      * where n is the input size over all devices.
@@ -48,8 +60,8 @@ class BlasSet
     */
     T absoluteSum(const Neon::set::MemDevSet<T>& input /**< input buffers for each device. Should be allocated on the device */,
                   Neon::set::MemDevSet<T>&       output /**< output buffer for each device. Its size should be >=1 for each device and it should be allocated on the device */,
-                  Neon::set::DataSet<int>&       start_id /**< starting id in input where computation should be done for each MemDev_t in input*/,
-                  Neon::set::DataSet<int>&       num_elements /**< number of elements in each MemDev_t in input where computation should be done starting from the corresponding start_id*/);
+                  Neon::set::DataSet<int64_t>&   start_id /**< starting id in input where computation should be done for each MemDev_t in input*/,
+                  Neon::set::DataSet<int64_t>&   num_elements /**< number of elements in each MemDev_t in input where computation should be done starting from the corresponding start_id*/);
 
     /**
      * Compute the dot product of the input buffers i.e. sum_{i=0}^{n-1}(input1[i]*input2[i])
@@ -59,8 +71,8 @@ class BlasSet
     T dot(const Neon::set::MemDevSet<T>& input1 /**< first input buffers for each device. Should be allocated on the device */,
           const Neon::set::MemDevSet<T>& input2 /**< second input buffers for each device. Should be allocated on the device */,
           Neon::set::MemDevSet<T>&       output /**< output buffer for each device. Its size should be >=1 for each device and it should be allocated on the device */,
-          Neon::set::DataSet<int>&       start_id /**< starting id in input where computation should be done for each MemDev_t in input1 and input2*/,
-          Neon::set::DataSet<int>&       num_elements /**< number of elements in each MemDev_t in input1 and input2 where computation should be done starting from the corresponding start_id*/);
+          Neon::set::DataSet<int64_t>&   start_id /**< starting id in input where computation should be done for each MemDev_t in input1 and input2*/,
+          Neon::set::DataSet<int64_t>&   num_elements /**< number of elements in each MemDev_t in input1 and input2 where computation should be done starting from the corresponding start_id*/);
 
     /**
      * Compute the norm2 of the input buffer i.e. sum_{i=0}^{n-1}(sqrt(input[i]*input[i]))
@@ -69,26 +81,99 @@ class BlasSet
     */
     T norm2(const Neon::set::MemDevSet<T>& input /**< input buffers for each device. Should be allocated on the device */,
             Neon::set::MemDevSet<T>&       output /**< output buffer for each device. Its size should be >=1 for each device and it should be allocated on the device */,
-            Neon::set::DataSet<int>&       start_id /**< starting id in input where computation should be done for each MemDev_t in input*/,
-            Neon::set::DataSet<int>&       num_elements /**< number of elements in each MemDev_t in input where computation should be done starting from the corresponding start_id*/);
+            Neon::set::DataSet<int64_t>&   start_id /**< starting id in input where computation should be done for each MemDev_t in input*/,
+            Neon::set::DataSet<int64_t>&   num_elements /**< number of elements in each MemDev_t in input where computation should be done starting from the corresponding start_id*/);
+
+    /**
+     * Compute several dot products at once i.e. result[k] = sum_{i=0}^{n-1}(inputs1[k][i]*inputs2[k][i])
+     * where n is the input size over all devices. On each device all products are computed in one pass
+     * (on the host) and the per-device results are combined once on the host.
+     * @return the final results (by value) on the host, one per product
+    */
+    std::vector<T> multiDot(const std::vector<const Neon::set::MemDevSet<T>*>& inputs1 /**< first input buffers of each product. Should be allocated on the device */,
+                            const std::vector<const Neon::set::MemDevSet<T>*>& inputs2 /**< second input buffers of each product. Should be allocated on the device */,
+                            Neon::set::MemDevSet<T>&                           output /**< output buffer for each device. Its size should be >= the number of products for each device and it should be allocated on the host */,
+                            Neon::set::DataSet<int64_t>&                       start_id /**< starting id in the inputs where computation should be done for each device*/,
+                            Neon::set::DataSet<int64_t>&                       num_elements /**< number of elements in the inputs where computation should be done starting from the corresponding start_id*/);
+
+    /**
+     * Same as absoluteSum but over several slices of the inputs i.e., the s-th slice on each device
+     * starts at start_id[s] and has num_elements[s] elements.
+     * With the deterministic engine the result does not depend on the number of slices, devices or threads.
+    */
+    T absoluteSum(const Neon::set::MemDevSet<T>&            input /**< input buffers for each device. Should be allocated on the device */,
+                  Neon::set::MemDevSet<T>&                  output /**< output buffer for each device. Its size should be >=1 for each device and it should be allocated on the device */,
+                  std::vector<Neon::set::DataSet<int64_t>>& start_id /**< starting id of each slice for each device*/,
+                  std::vector<Neon::set::DataSet<int64_t>>& num_elements /**< number of elements of each slice for each device*/);
+
+    /**
+     * Same as dot but over several slices of the inputs i.e., the s-th slice on each device
+     * starts at start_id[s] and has num_elements[s] elements.
+     * With the deterministic engine the result does not depend on the number of slices, devices or threads.
+    */
+    T dot(const Neon::set::MemDevSet<T>&            input1 /**< first input buffers for each device. Should be allocated on the device */,
+          const Neon::set::MemDevSet<T>&            input2 /**< second input buffers for each device. Should be allocated on the device */,
+          Neon::set::MemDevSet<T>&                  output /**< output buffer for each device. Its size should be >=1 for each device and it should be allocated on the device */,
+          std::vector<Neon::set::DataSet<int64_t>>& start_id /**< starting id of each slice for each device*/,
+          std::vector<Neon::set::DataSet<int64_t>>& num_elements /**< number of elements of each slice for each device*/);
+
+    /**
+     * Same as norm2 but over several slices of the input i.e., the s-th slice on each device
+     * starts at start_id[s] and has num_elements[s] elements.
+     * With the deterministic engine the result does not depend on the number of slices, devices or threads.
+    */
+    T norm2(const Neon::set::MemDevSet<T>&            input /**< input buffers for each device. Should be allocated on the device */,
+            Neon::set::MemDevSet<T>&                  output /**< output buffer for each device. Its size should be >=1 for each device and it should be allocated on the device */,
+            std::vector<Neon::set::DataSet<int64_t>>& start_id /**< starting id of each slice for each device*/,
+            std::vector<Neon::set::DataSet<int64_t>>& num_elements /**< number of elements of each slice for each device*/);
+
+    /**
+     * Same as multiDot but over several slices of the inputs i.e., the s-th slice on each device
+     * starts at start_id[s] and has num_elements[s] elements.
+     * With the deterministic engine each product is computed on its own and
+     * does not depend on the number of slices, devices or threads.
+    */
+    std::vector<T> multiDot(const std::vector<const Neon::set::MemDevSet<T>*>& inputs1 /**< first input buffers of each product. Should be allocated on the device */,
+                            const std::vector<const Neon::set::MemDevSet<T>*>& inputs2 /**< second input buffers of each product. Should be allocated on the device */,
+                            Neon::set::MemDevSet<T>&                           output /**< output buffer for each device. Its size should be >= the number of products for each device and it should be allocated on the host */,
+                            std::vector<Neon::set::DataSet<int64_t>>&          start_id /**< starting id of each slice for each device*/,
+                            std::vector<Neon::set::DataSet<int64_t>>&          num_elements /**< number of elements of each slice for each device*/);
 
     virtual ~BlasSet() = default;
 
    private:
     /**
-     * Apply final aggregation on the host by collecting intermediate results on each device
+     * Apply final aggregation on the host by collecting intermediate results on each device.
+     * The partials of the partitions, and then of the ranks, are combined with op.
+    */
+    template <typename IntermediateTransform, typename FinalTransform>
+    void aggregator(Neon::set::MemDevSet<T>&  output,
+                    IntermediateTransform     intermedFunc,
+                    Neon::set::dist::ReduceOp op,
+                    FinalTransform            finalFunc,
+                    T                         neutralValue);
+
+    /**
+     * Returns true if the i-th device is computed by this process
+    */
+    bool helpIsLocal(int i) const;
+
+    /**
+     * Order independent sum of term(setIdx, i) over all the slices of all the devices (deterministic engine)
+     * @return the sum in double precision
     */
-    template <typename IntermediateTransform, typename Aggregate, typename FinalTransform>
-    void aggregator(Neon::set::MemDevSet<T>& output,
-                    IntermediateTransform    intermedFunc,
-                    Aggregate                aggFunc,
-                    FinalTransform           finalFunc,
-                    T                        neutralValue);
+    template <typename TermMaker>
+    double reproducibleSum(const Neon::set::MemDevSet<T>&                  input,
+                           TermMaker                                       termMaker,
+                           const std::vector<Neon::set::DataSet<int64_t>>& start_id,
+                           const std::vector<Neon::set::DataSet<int64_t>>& num_elements);
 
 
     std::shared_ptr<std::vector<Neon::sys::patterns::template Blas<T>>> mBlasVec;
     T                                                                   mAggregate;
     Neon::set::StreamSet                                                mStreams;
+    Neon::sys::patterns::Engine                                         mEngine = Neon::sys::patterns::Engine::cuBlas;
+    std::shared_ptr<Neon::set::dist::Transport>                         mTransport;
 };
 
 }  // namespace Neon::set::patterns
@@ -8,6 +8,8 @@ template <typename T>
 BlasSet<T>::BlasSet(const Neon::set::DevSet&          devSet,
                     const Neon::sys::patterns::Engine engine)
 {
+    mEngine = engine;
+    mTransport = devSet.transport();
     mBlasVec = std::make_shared<std::vector<Neon::sys::patterns::template Blas<T>>>(devSet.setCardinality());
 
     devSet.forEachSetIdxSeq([&](Neon::SetIdx& setIdx) {
@@ -37,15 +39,33 @@ Neon::sys::patterns::template Blas<T>& BlasSet<T>::getBlas(size_t i)
     return (*mBlasVec)[i];
 }
 
+template <typename T>
+Neon::sys::patterns::Engine BlasSet<T>::getEngine() const
+{
+    return mEngine;
+}
+
+template <typename T>
+bool BlasSet<T>::helpIsLocal(int i) const
+{
+    if (!mTransport) {
+        return true;
+    }
+    return mTransport->ownerRank(i, static_cast<int>((*mBlasVec).size())) == mTransport->rank();
+}
+
 template <typename T>
 T BlasSet<T>::absoluteSum(const Neon::set::MemDevSet<T>& input,
                           Neon::set::MemDevSet<T>&       output,
-                          Neon::set::DataSet<int>&       start_id,
-                          Neon::set::DataSet<int>&       num_elements)
+                          Neon::set::DataSet<int64_t>&   start_id,
+                          Neon::set::DataSet<int64_t>&   num_elements)
 {
     const int32_t numSet = static_cast<int>((*mBlasVec).size());
 #pragma omp parallel for num_threads(numSet)
     for (int i = 0; i < numSet; ++i) {
+        if (!helpIsLocal(i)) {
+            continue;
+        }
         (*mBlasVec)[i].absoluteSum(input.getMemDev(i), output.getMemDev(i), start_id[i], num_elements[i]);
     }
 
@@ -53,7 +73,7 @@ T BlasSet<T>::absoluteSum(const Neon::set::MemDevSet<T>& input,
     aggregator(
         output,
         [](T in) { return in; },
-        [](T in1, T in2) { return in1 + in2; },
+        Neon::set::dist::ReduceOp::sum,
         [](T in) { return in; },
         T(0));
 
@@ -64,34 +84,91 @@ template <typename T>
 T BlasSet<T>::dot(const Neon::set::MemDevSet<T>& input1,
                   const Neon::set::MemDevSet<T>& input2,
                   Neon::set::MemDevSet<T>&       output,
-                  Neon::set::DataSet<int>&       start_id,
-                  Neon::set::DataSet<int>&       num_elements)
+                  Neon::set::DataSet<int64_t>&   start_id,
+                  Neon::set::DataSet<int64_t>&   num_elements)
 {
     const int32_t numSet = static_cast<int>((*mBlasVec).size());
 #pragma omp parallel for num_threads(numSet)
     for (int i = 0; i < numSet; ++i) {
+        if (!helpIsLocal(i)) {
+            continue;
+        }
         (*mBlasVec)[i].dot(input1.getMemDev(i), input2.getMemDev(i), output.getMemDev(i), start_id[i], num_elements[i]);
     }
 
     aggregator(
         output,
         [](T in) { return in; },
-        [](T in1, T in2) { return in1 + in2; },
+        Neon::set::dist::ReduceOp::sum,
         [](T in) { return in; },
         T(0));
 
     return mAggregate;
 }
 
+template <typename T>
+std::vector<T> BlasSet<T>::multiDot(const std::vector<const Neon::set::MemDevSet<T>*>& inputs1,
+                                    const std::vector<const Neon::set::MemDevSet<T>*>& inputs2,
+                                    Neon::set::MemDevSet<T>&                           output,
+                                    Neon::set::DataSet<int64_t>&                       start_id,
+                                    Neon::set::DataSet<int64_t>&                       num_elements)
+{
+    if (output.allocType() == Neon::Allocator::CUDA_MEM_DEVICE ||
+        output.allocType() == Neon::Allocator::CUDA_MEM_UNIFIED) {
+        NeonException exc;
+        exc << "Unsupported allocator for the output with type "
+            << Neon::AllocatorUtils::toString(output.getMemDev(0).allocType());
+        NEON_THROW(exc);
+    }
+    if (inputs1.size() != inputs2.size()) {
+        NeonException exc;
+        exc << "multiDot expects the same number of first and second inputs";
+        NEON_THROW(exc);
+    }
+
+    const int32_t numSet = static_cast<int>((*mBlasVec).size());
+    const size_t  nProducts = inputs1.size();
+#pragma omp parallel for num_threads(numSet)
+    for (int i = 0; i < numSet; ++i) {
+        if (!helpIsLocal(i)) {
+            continue;
+        }
+        std::vector<const Neon::sys::MemDevice<T>*> in1(nProducts);
+        std::vector<const Neon::sys::MemDevice<T>*> in2(nProducts);
+        for (size_t k = 0; k < nProducts; ++k) {
+            in1[k] = &inputs1[k]->getMemDev(i);
+            in2[k] = &inputs2[k]->getMemDev(i);
+        }
+        (*mBlasVec)[i].multiDot(in1, in2, output.getMemDev(i), start_id[i], num_elements[i]);
+    }
+
+    std::vector<T> results(nProducts, T(0));
+    for (int i = 0; i < numSet; ++i) {
+        if (!helpIsLocal(i)) {
+            continue;
+        }
+        for (size_t k = 0; k < nProducts; ++k) {
+            results[k] += output.mem(i)[k];
+        }
+    }
+    if (mTransport) {
+        mTransport->allreduce(results.data(), static_cast<int>(nProducts), Neon::set::dist::ReduceOp::sum);
+    }
+    return results;
+}
+
 template <typename T>
 T BlasSet<T>::norm2(const Neon::set::MemDevSet<T>& input,
                     Neon::set::MemDevSet<T>&       output,
-                    Neon::set::DataSet<int>&       start_id,
-                    Neon::set::DataSet<int>&       num_elements)
+                    Neon::set::DataSet<int64_t>&   start_id,
+                    Neon::set::DataSet<int64_t>&   num_elements)
 {
     const int32_t numSet = static_cast<int>((*mBlasVec).size());
 #pragma omp parallel for num_threads(numSet)
     for (int i = 0; i < numSet; ++i) {
+        if (!helpIsLocal(i)) {
+            continue;
+        }
         (*mBlasVec)[i].norm2(input.getMemDev(i), output.getMemDev(i), start_id[i], num_elements[i]);
     }
 
@@ -99,7 +176,7 @@ T BlasSet<T>::norm2(const Neon::set::MemDevSet<T>& input,
     aggregator(
         output,
         [](T in) { return in * in; },
-        [](T in1, T in2) { return in1 + in2; },
+        Neon::set::dist::ReduceOp::sum,
         [](T in) { return static_cast<T>(std::sqrt(in)); },
         T(0));
 
@@ -107,12 +184,164 @@ T BlasSet<T>::norm2(const Neon::set::MemDevSet<T>& input,
 }
 
 template <typename T>
-template <typename IntermediateTransform, typename Aggregate, typename FinalTransform>
-void BlasSet<T>::aggregator(Neon::set::MemDevSet<T>& output,
-                            IntermediateTransform    intermedFunc,
-                            Aggregate                aggFunc,
-                            FinalTransform           finalFunc,
-                            T                        neutralValue)
+T BlasSet<T>::absoluteSum(const Neon::set::MemDevSet<T>&            input,
+                          Neon::set::MemDevSet<T>&                  output,
+                          std::vector<Neon::set::DataSet<int64_t>>& start_id,
+                          std::vector<Neon::set::DataSet<int64_t>>& num_elements)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        if (mEngine == Neon::sys::patterns::Engine::deterministic) {
+            const double ret = reproducibleSum(
+                input, [&](int i) {
+                    const T* in = input.mem(i);
+                    return [in](int64_t j) { return std::abs(double(in[j])); };
+                },
+                start_id, num_elements);
+            return static_cast<T>(ret);
+        }
+    }
+    T ret = 0;
+    for (size_t s = 0; s < start_id.size(); ++s) {
+        ret += absoluteSum(input, output, start_id[s], num_elements[s]);
+    }
+    return ret;
+}
+
+template <typename T>
+T BlasSet<T>::dot(const Neon::set::MemDevSet<T>&            input1,
+                  const Neon::set::MemDevSet<T>&            input2,
+                  Neon::set::MemDevSet<T>&                  output,
+                  std::vector<Neon::set::DataSet<int64_t>>& start_id,
+                  std::vector<Neon::set::DataSet<int64_t>>& num_elements)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        if (mEngine == Neon::sys::patterns::Engine::deterministic) {
+            const double ret = reproducibleSum(
+                input1, [&](int i) {
+                    const T* in1 = input1.mem(i);
+                    const T* in2 = input2.mem(i);
+                    return [in1, in2](int64_t j) { return double(in1[j]) * double(in2[j]); };
+                },
+                start_id, num_elements);
+            return static_cast<T>(ret);
+        }
+    }
+    T ret = 0;
+    for (size_t s = 0; s < start_id.size(); ++s) {
+        ret += dot(input1, input2, output, start_id[s], num_elements[s]);
+    }
+    return ret;
+}
+
+template <typename T>
+T BlasSet<T>::norm2(const Neon::set::MemDevSet<T>&            input,
+                    Neon::set::MemDevSet<T>&                  output,
+                    std::vector<Neon::set::DataSet<int64_t>>& start_id,
+                    std::vector<Neon::set::DataSet<int64_t>>& num_elements)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        if (mEngine == Neon::sys::patterns::Engine::deterministic) {
+            const double ret = reproducibleSum(
+                input, [&](int i) {
+                    const T* in = input.mem(i);
+                    return [in](int64_t j) { return double(in[j]) * double(in[j]); };
+                },
+                start_id, num_elements);
+            return static_cast<T>(std::sqrt(ret));
+        }
+    }
+    T ret = 0;
+    for (size_t s = 0; s < start_id.size(); ++s) {
+        T temp = norm2(input, output, start_id[s], num_elements[s]);
+        ret += temp * temp;
+    }
+    return static_cast<T>(std::sqrt(ret));
+}
+
+template <typename T>
+std::vector<T> BlasSet<T>::multiDot(const std::vector<const Neon::set::MemDevSet<T>*>& inputs1,
+                                    const std::vector<const Neon::set::MemDevSet<T>*>& inputs2,
+                                    Neon::set::MemDevSet<T>&                           output,
+                                    std::vector<Neon::set::DataSet<int64_t>>&          start_id,
+                                    std::vector<Neon::set::DataSet<int64_t>>&          num_elements)
+{
+    if (inputs1.size() != inputs2.size()) {
+        NeonException exc;
+        exc << "multiDot expects the same number of first and second inputs";
+        NEON_THROW(exc);
+    }
+    std::vector<T> ret(inputs1.size(), T(0));
+    if constexpr (std::is_floating_point_v<T>) {
+        if (mEngine == Neon::sys::patterns::Engine::deterministic) {
+            for (size_t k = 0; k < ret.size(); ++k) {
+                ret[k] = dot(*inputs1[k], *inputs2[k], output, start_id, num_elements);
+            }
+            return ret;
+        }
+    }
+    for (size_t s = 0; s < start_id.size(); ++s) {
+        auto sliceRes = multiDot(inputs1, inputs2, output, start_id[s], num_elements[s]);
+        for (size_t k = 0; k < ret.size(); ++k) {
+            ret[k] += sliceRes[k];
+        }
+    }
+    return ret;
+}
+
+template <typename T>
+template <typename TermMaker>
+double BlasSet<T>::reproducibleSum(const Neon::set::MemDevSet<T>&                  input,
+                                   TermMaker                                       termMaker,
+                                   const std::vector<Neon::set::DataSet<int64_t>>& start_id,
+                                   const std::vector<Neon::set::DataSet<int64_t>>& num_elements)
+{
+    if (input.allocType() != Neon::Allocator::CUDA_MEM_HOST && input.allocType() != Neon::Allocator::MALLOC) {
+        NeonException exc("BlasSet");
+        exc << "The deterministic engine only supports inputs allocated on the host. Input allocator is "
+            << Neon::AllocatorUtils::toString(input.allocType());
+        NEON_THROW(exc);
+    }
+    const int32_t numSet = static_cast<int>((*mBlasVec).size());
+    const size_t  numSlices = start_id.size();
+
+    // Single pass: one parallel region over all the slices of all the devices,
+    // every thread accumulates its share in its own superaccumulator and the merge is exact,
+    // so neither the partitioning nor the number of threads (or processes) changes the result
+    Neon::sys::patterns::ReproducibleSum sum;
+#pragma omp parallel
+    {
+        Neon::sys::patterns::ReproducibleSum local;
+        for (int i = 0; i < numSet; ++i) {
+            if (!helpIsLocal(i)) {
+                continue;
+            }
+            auto term = termMaker(i);
+            for (size_t s = 0; s < numSlices; ++s) {
+                const int64_t begin = start_id[s][i];
+                const int64_t end = begin + num_elements[s][i];
+#pragma omp for nowait
+                for (int64_t j = begin; j < end; ++j) {
+                    local.add(term(j));
+                }
+            }
+        }
+#pragma omp critical
+        sum.merge(local);
+    }
+    if (mTransport) {
+        auto& words = sum.words();
+        mTransport->allreduce(words.data(), static_cast<int>(words.size()), Neon::set::dist::ReduceOp::sum);
+    }
+    return sum.result();
+}
+
+template <typename T>
+template <typename IntermediateTransform, typename FinalTransform>
+void BlasSet<T>::aggregator(Neon::set::MemDevSet<T>&  output,
+                            IntermediateTransform     intermedFunc,
+                            Neon::set::dist::ReduceOp op,
+                            FinalTransform            finalFunc,
+                            T                         neutralValue)
 {
     const int32_t numSet = static_cast<int>((*mBlasVec).size());
 
@@ -124,15 +353,22 @@ void BlasSet<T>::aggregator(Neon::set::MemDevSet<T>& output,
         NEON_THROW(exc);
     }
 
-    if (numSet == 1) {
+    if (numSet == 1 && !mTransport) {
         mAggregate = output.mem(0)[0];
         return;
     }
     T temp = neutralValue;
     for (int i = 0; i < numSet; ++i) {
+        if (!helpIsLocal(i)) {
+            continue;
+        }
         T val = output.mem(i)[0];
         val = intermedFunc(val);
-        temp = aggFunc(val, temp);
+        temp = Neon::set::dist::Transport::combine(op, val, temp);
+    }
+    if (mTransport) {
+        // The ranks combine their partials with the same operation as the partitions
+        temp = mTransport->allreduce(temp, op);
     }
 
     mAggregate = finalFunc(temp);
@@ -1,4 +1,5 @@
 #include "Neon/set/Backend.h"
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <future>
@@ -6,8 +7,11 @@
 #include <thread>
 #include <tuple>
 #include <vector>
+#include "Neon/set/CpuAutotuner.h"
 #include "Neon/set/DevSet.h"
 
+#include <omp.h>
+
 namespace Neon {
 
 auto Backend::selfData() -> Data_t&
@@ -190,7 +194,10 @@ auto Backend::pushEventOnStream(int eventId, int streamId)
 {
     switch (selfData().runtime) {
         case Neon::Runtime::openmp: {
-            return;
+            if (!hasCpuStreams()) {
+                return;
+            }
+            break;
         }
         case Neon::Runtime::stream: {
             break;
@@ -225,7 +232,10 @@ auto Backend::pushEventOnStream(Neon::SetIdx setIdx,
 {
     switch (selfData().runtime) {
         case Neon::Runtime::openmp: {
-            return;
+            if (!hasCpuStreams()) {
+                return;
+            }
+            break;
         }
         case Neon::Runtime::stream: {
             break;
@@ -258,7 +268,10 @@ auto Backend::waitEventOnStream(int eventId, int streamId)
 {
     switch (selfData().runtime) {
         case Neon::Runtime::openmp: {
-            return;
+            if (!hasCpuStreams()) {
+                return;
+            }
+            break;
         }
         case Neon::Runtime::stream: {
             break;
@@ -281,7 +294,10 @@ auto Backend::waitEventOnStream(Neon::SetIdx setIdx, int eventId, int streamId)
 {
     switch (selfData().runtime) {
         case Neon::Runtime::openmp: {
-            return;
+            if (!hasCpuStreams()) {
+                return;
+            }
+            break;
         }
         case Neon::Runtime::stream: {
             break;
@@ -303,7 +319,10 @@ auto Backend::streamEventBarrier(const std::vector<int>& streamIdxVec) -> void
 {
     switch (selfData().runtime) {
         case Neon::Runtime::openmp: {
-            return;
+            if (!hasCpuStreams()) {
+                return;
+            }
+            break;
         }
         case Neon::Runtime::stream: {
             break;
@@ -357,42 +376,293 @@ auto Backend::streamEventBarrier(const std::vector<int>& streamIdxVec) -> void
     return;
 }
 
+auto Backend::streamFence(const std::vector<int>& streamIdxVec,
+                          int                     firstEventIdx) -> void
+{
+    switch (selfData().runtime) {
+        case Neon::Runtime::openmp: {
+            if (!hasCpuStreams()) {
+                // The work runs on the host thread, it is already ordered
+                return;
+            }
+            break;
+        }
+        case Neon::Runtime::stream: {
+            break;
+        }
+        default: {
+            NEON_THROW_UNSUPPORTED_OPTION("");
+        }
+    }
+    if (streamIdxVec.empty()) {
+        return;
+    }
+    const int nStreams = int(streamIdxVec.size());
+    const int nSets = selfData().devSet->setCardinality();
+    const int joinEventIdx = firstEventIdx + nStreams;
+    if (int(selfData().userEventSetVec.size()) <= joinEventIdx) {
+        NeonException exp("streamFence");
+        exp << "The fence needs the user events " << firstEventIdx << " to " << joinEventIdx << ", only "
+            << selfData().userEventSetVec.size() << " are available";
+        NEON_THROW(exp);
+    }
+
+    // Every stream marks the end of its work on every partition
+    for (int k = 0; k < nStreams; k++) {
+        selfData().streamSetVec.at(streamIdxVec[k]).enqueueEvent(selfData().userEventSetVec.at(firstEventIdx + k));
+    }
+    // The first stream of each partition joins all the streams of all the partitions,
+    // as the next operations (e.g. halo updates) may touch the memory of any partition...
+    auto& joinStreamSet = selfData().streamSetVec.at(streamIdxVec[0]);
+    for (int p = 0; p < nSets; p++) {
+        const auto& joinStream = joinStreamSet.get(p);
+        for (int k = 0; k < nStreams; k++) {
+            auto& eventSet = selfData().userEventSetVec.at(firstEventIdx + k);
+            for (int q = 0; q < nSets; q++) {
+                joinStream.waitForEvent(eventSet.event(q));
+            }
+        }
+    }
+    // ... and the other streams of the partition wait for the join
+    auto& joinEventSet = selfData().userEventSetVec.at(joinEventIdx);
+    joinStreamSet.enqueueEvent(joinEventSet);
+    for (int k = 1; k < nStreams; k++) {
+        selfData().streamSetVec.at(streamIdxVec[k]).waitForEvent(joinEventSet);
+    }
+}
+
 auto Backend::setAvailableStreamSet(int nStreamSets) -> void
 {
-    if (runtime() == Neon::Runtime::openmp) {
+    if (runtime() == Neon::Runtime::openmp && !hasCpuStreams()) {
         selfData().streamSetVec = std::vector<Neon::set::StreamSet>(nStreamSets);
         selfData().eventSetVec = std::vector<Neon::set::GpuEventSet>(nStreamSets);
         return;
     }
     const int streamsToAdd = nStreamSets - int(selfData().streamSetVec.size());
     for (int i = 0; i < streamsToAdd; i++) {
-        selfData().streamSetVec.push_back(selfData().devSet->newStreamSet());
-        const bool disableTimingOption = true;
-        selfData().eventSetVec.push_back(selfData().devSet->newEventSet(disableTimingOption));
+        selfData().streamSetVec.push_back(h_newStreamSet());
+        selfData().eventSetVec.push_back(h_newEventSet());
     }
     assert(selfData().eventSetVec.size() == selfData().streamSetVec.size());
 }
 
 auto Backend::setAvailableUserEvents(int nUserEventSets) -> void
 {
-    if (runtime() == Neon::Runtime::openmp) {
+    if (runtime() == Neon::Runtime::openmp && !hasCpuStreams()) {
         selfData().userEventSetVec = std::vector<Neon::set::GpuEventSet>(nUserEventSets);
         return;
     }
     const int eventToAdd = nUserEventSets - int(selfData().userEventSetVec.size());
     for (int i = 0; i < eventToAdd; i++) {
-        const bool disableTimingOption = true;
-        selfData().userEventSetVec.push_back(selfData().devSet->newEventSet(disableTimingOption));
+        selfData().userEventSetVec.push_back(h_newEventSet());
+    }
+}
+
+auto Backend::h_newStreamSet() const -> Neon::set::StreamSet
+{
+    if (hasCpuStreams()) {
+        // The partitions share the cores: each worker opens OpenMP teams of nThreads / nPartitions threads
+        const int nThreadsPerStream = std::max(1, omp_get_max_threads() / selfData().devSet->setCardinality());
+        return selfData().devSet->newCpuStreamSet(nThreadsPerStream);
+    }
+    return selfData().devSet->newStreamSet();
+}
+
+auto Backend::h_newEventSet() const -> Neon::set::GpuEventSet
+{
+    if (hasCpuStreams()) {
+        return selfData().devSet->newCpuEventSet();
     }
+    const bool disableTimingOption = true;
+    return selfData().devSet->newEventSet(disableTimingOption);
+}
+
+auto Backend::setCpuStreams(bool enable) -> void
+{
+    if (runtime() != Neon::Runtime::openmp) {
+        NeonException exp("Backend");
+        exp << "CPU streams are supported only by the openmp runtime, not by a "
+            << Neon::RuntimeUtils::toString(runtime()) << " backend";
+        NEON_THROW(exp);
+    }
+    if (enable == hasCpuStreams()) {
+        return;
+    }
+    if (enable && hasCpuZeroCopyHalo()) {
+        NeonException exp("Backend");
+        exp << "CPU streams can not be enabled on a backend with zero-copy halos";
+        NEON_THROW(exp);
+    }
+    if (enable && transport()) {
+        NeonException exp("Backend");
+        exp << "CPU streams can not be enabled on a backend with distributed partitions";
+        NEON_THROW(exp);
+    }
+    // Pending work is completed before the streams are replaced
+    syncAll();
+
+    const int nStreamSets = int(selfData().streamSetVec.size());
+    const int nUserEventSets = int(selfData().userEventSetVec.size());
+    selfData().cpuStreams = enable;
+    selfData().streamSetVec.clear();
+    selfData().eventSetVec.clear();
+    selfData().userEventSetVec.clear();
+    setAvailableStreamSet(nStreamSets);
+    setAvailableUserEvents(nUserEventSets);
+}
+
+auto Backend::hasCpuStreams() const -> bool
+{
+    return selfData().cpuStreams;
+}
+
+auto Backend::setCpuZeroCopyHalo(bool enable) -> void
+{
+    if (!enable) {
+        // Nothing to disable on the other runtimes
+        selfData().cpuZeroCopyHalo = false;
+        return;
+    }
+    if (runtime() != Neon::Runtime::openmp) {
+        NeonException exp("Backend");
+        exp << "Zero-copy halos are supported only by the openmp runtime, not by a "
+            << Neon::RuntimeUtils::toString(runtime()) << " backend";
+        NEON_THROW(exp);
+    }
+    if (hasCpuStreams()) {
+        NeonException exp("Backend");
+        exp << "Zero-copy halos can not be enabled on a backend with CPU streams";
+        NEON_THROW(exp);
+    }
+    if (transport()) {
+        NeonException exp("Backend");
+        exp << "Zero-copy halos can not be enabled on a backend with distributed partitions";
+        NEON_THROW(exp);
+    }
+    selfData().cpuZeroCopyHalo = true;
+}
+
+auto Backend::hasCpuZeroCopyHalo() const -> bool
+{
+    return selfData().cpuZeroCopyHalo;
+}
+
+auto Backend::setCpuSerialLaunchThreshold(int64_t nCells) -> void
+{
+    if (runtime() != Neon::Runtime::openmp) {
+        NeonException exp("Backend");
+        exp << "Serial launches are supported only by the openmp runtime, not by a "
+            << Neon::RuntimeUtils::toString(runtime()) << " backend";
+        NEON_THROW(exp);
+    }
+    selfData().cpuSerialLaunchThreshold = std::max(int64_t(0), nCells);
+}
+
+auto Backend::cpuSerialLaunchThreshold() const -> int64_t
+{
+    return selfData().cpuSerialLaunchThreshold;
+}
+
+auto Backend::cpuThreadBudget(int streamIdx) const -> int
+{
+    const int maxThreads = omp_get_max_threads();
+    if (!hasCpuStreams()) {
+        return maxThreads;
+    }
+    int         budget = maxThreads;
+    const auto& streams = streamSet(streamIdx);
+    for (int i = 0; i < streams.cardinality(); i++) {
+        const Neon::sys::GpuStream& stream = streams[i];
+        if (stream.isCpuStream() && stream.cpuStream().nThreads() > 0) {
+            budget = std::min(budget, stream.cpuStream().nThreads());
+        }
+    }
+    return budget;
+}
+
+auto Backend::setCpuAutotuner(std::shared_ptr<Neon::set::CpuAutotuner> autotuner) -> void
+{
+    if (autotuner && runtime() != Neon::Runtime::openmp) {
+        NeonException exp("Backend");
+        exp << "Autotuning is supported only by the openmp runtime, not by a "
+            << Neon::RuntimeUtils::toString(runtime()) << " backend";
+        NEON_THROW(exp);
+    }
+    selfData().cpuAutotuner = std::move(autotuner);
+}
+
+auto Backend::cpuAutotuner() const -> const std::shared_ptr<Neon::set::CpuAutotuner>&
+{
+    return selfData().cpuAutotuner;
+}
+
+auto Backend::setCpuBinding(Neon::sys::CpuBinding binding) -> void
+{
+    if (runtime() != Neon::Runtime::openmp) {
+        NeonException exp("Backend");
+        exp << "CPU binding is supported only by the openmp runtime, not by a "
+            << Neon::RuntimeUtils::toString(runtime()) << " backend";
+        NEON_THROW(exp);
+    }
+    if (binding == cpuBinding()) {
+        return;
+    }
+    selfData().devSet->setCpuBinding(binding);
+    if (hasCpuStreams()) {
+        // The workers are bound when they start: pending work is completed and the streams are replaced
+        syncAll();
+
+        const int nStreamSets = int(selfData().streamSetVec.size());
+        const int nUserEventSets = int(selfData().userEventSetVec.size());
+        selfData().streamSetVec.clear();
+        selfData().eventSetVec.clear();
+        selfData().userEventSetVec.clear();
+        setAvailableStreamSet(nStreamSets);
+        setAvailableUserEvents(nUserEventSets);
+    }
+}
+
+auto Backend::cpuBinding() const -> Neon::sys::CpuBinding
+{
+    return selfData().devSet->cpuBinding();
+}
+
+auto Backend::setTransport(std::shared_ptr<Neon::set::dist::Transport> transport) -> void
+{
+    if (transport) {
+        if (runtime() != Neon::Runtime::openmp) {
+            NeonException exp("Backend");
+            exp << "Distributed partitions are supported only by the openmp runtime, not by a "
+                << Neon::RuntimeUtils::toString(runtime()) << " backend";
+            NEON_THROW(exp);
+        }
+        if (hasCpuStreams() || hasCpuZeroCopyHalo()) {
+            NeonException exp("Backend");
+            exp << "Distributed partitions can not be combined with CPU streams or zero-copy halos";
+            NEON_THROW(exp);
+        }
+        if (transport->nRanks() > devSet().setCardinality()) {
+            NeonException exp("Backend");
+            exp << "The " << devSet().setCardinality() << " partitions of the backend can not be distributed over "
+                << transport->nRanks() << " processes";
+            NEON_THROW(exp);
+        }
+    }
+    selfData().devSet->setTransport(std::move(transport));
+}
+
+auto Backend::transport() const -> const std::shared_ptr<Neon::set::dist::Transport>&
+{
+    return selfData().devSet->transport();
 }
 
 
 auto Backend::sync() const -> void
 {
-    if (runtime() == Neon::Runtime::openmp) {
+    if (runtime() == Neon::Runtime::openmp && !hasCpuStreams()) {
         return;
     }
-    if (runtime() == Neon::Runtime::stream) {
+    if (runtime() == Neon::Runtime::stream || hasCpuStreams()) {
         return selfData().streamSetVec[0].sync();
     }
     NeonException exp("BackendConfig_t");
@@ -402,10 +672,10 @@ auto Backend::sync() const -> void
 
 auto Backend::syncAll() const -> void
 {
-    if (runtime() == Neon::Runtime::openmp) {
+    if (runtime() == Neon::Runtime::openmp && !hasCpuStreams()) {
         return;
     }
-    if (runtime() == Neon::Runtime::stream) {
+    if (runtime() == Neon::Runtime::stream || hasCpuStreams()) {
         int nStreamSetVec = int(selfData().streamSetVec.size());
         for (int i = 0; i < nStreamSetVec; i++) {
             selfData().streamSetVec[i].sync();
@@ -419,10 +689,10 @@ auto Backend::syncAll() const -> void
 
 auto Backend::sync(int idx) const -> void
 {
-    if (runtime() == Neon::Runtime::openmp) {
+    if (runtime() == Neon::Runtime::openmp && !hasCpuStreams()) {
         return;
     }
-    if (runtime() == Neon::Runtime::stream) {
+    if (runtime() == Neon::Runtime::stream || hasCpuStreams()) {
         selfData().streamSetVec[idx].sync();
         return;
     }
@@ -433,10 +703,10 @@ auto Backend::sync(int idx) const -> void
 
 auto Backend::sync(Neon::SetIdx setIdx, int idx) const -> void
 {
-    if (runtime() == Neon::Runtime::openmp) {
+    if (runtime() == Neon::Runtime::openmp && !hasCpuStreams()) {
         return;
     }
-    if (runtime() == Neon::Runtime::stream) {
+    if (runtime() == Neon::Runtime::stream || hasCpuStreams()) {
         selfData().streamSetVec[idx].sync(setIdx.idx());
         return;
     }
@@ -542,6 +812,24 @@ auto Backend::toReport(Neon::Report& report, Report::SubBlock* subdocAPI) const
     report.addMember("Runtime", Neon::RuntimeUtils::toString(runtime()), targetSubDoc);
     report.addMember("DeviceType", Neon::DeviceTypeUtil::toString(devType()), targetSubDoc);
     report.addMember("NumberOfDevices", devSet().setCardinality(), targetSubDoc);
+    if (runtime() == Neon::Runtime::openmp) {
+        report.addMember("CpuStreams", hasCpuStreams(), targetSubDoc);
+        report.addMember("CpuZeroCopyHalo", hasCpuZeroCopyHalo(), targetSubDoc);
+        report.addMember("CpuSerialLaunchThreshold", cpuSerialLaunchThreshold(), targetSubDoc);
+        report.addMember("CpuAutotuning", cpuAutotuner() != nullptr, targetSubDoc);
+        report.addMember("CpuBinding", Neon::sys::CpuBindingUtils::toString(cpuBinding()), targetSubDoc);
+        if (cpuBinding() != Neon::sys::CpuBinding::none) {
+            for (int i = 0; i < devSet().setCardinality(); i++) {
+                report.addMember("Partition " + std::to_string(i) + " CPUs",
+                                 Neon::sys::CpuTopology::toCpuList(devSet().partitionCpus(i)), targetSubDoc);
+                report.addMember("Partition " + std::to_string(i) + " NUMA Node", devSet().partitionNode(i), targetSubDoc);
+            }
+        }
+        if (transport()) {
+            report.addMember("Transport", transport()->name(), targetSubDoc);
+            report.addMember("Ranks", transport()->nRanks(), targetSubDoc);
+        }
+    }
     report.addMember(
         "Devices", [&] {
             std::vector<int> idsList;
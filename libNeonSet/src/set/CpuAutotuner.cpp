@@ -0,0 +1,197 @@
+#include "Neon/set/CpuAutotuner.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <utility>
+
+#include "Neon/core/core.h"
+
+namespace Neon {
+namespace set {
+
+CpuAutotuner::CpuAutotuner(std::string cacheFile, int nTrials)
+    : mCacheFile(std::move(cacheFile)),
+      mNTrials(nTrials)
+{
+    if (nTrials < 1) {
+        NeonException exp("CpuAutotuner");
+        exp << "The number of trials per candidate must be positive, not " << nTrials;
+        NEON_THROW(exp);
+    }
+    helpLoad();
+}
+
+auto CpuAutotuner::candidates(int loopDim, int maxThreads) -> std::vector<CpuLaunchConfig>
+{
+    using Schedule = CpuLaunchConfig::Schedule;
+
+    std::vector<CpuLaunchConfig> ret{CpuLaunchConfig()};
+
+    std::vector<int> threads{std::max(1, maxThreads)};
+    if (maxThreads >= 2) {
+        threads.push_back(maxThreads / 2);
+    }
+
+    // Schedules with their chunk: in cells for one dimensional spaces, in tiles otherwise
+    const std::vector<std::pair<Schedule, int>> schedules =
+        loopDim == 1 ? std::vector<std::pair<Schedule, int>>{{Schedule::ompStatic, 0}, {Schedule::ompStatic, 256}, {Schedule::ompDynamic, 256}, {Schedule::ompGuided, 0}}
+                     : std::vector<std::pair<Schedule, int>>{{Schedule::ompStatic, 0}, {Schedule::ompDynamic, 1}};
+
+    std::vector<std::pair<int, int>> tiles;
+    switch (loopDim) {
+        case 1: {
+            tiles = {{0, 0}};
+            break;
+        }
+        case 2: {
+            tiles = {{1, 0}, {4, 0}, {16, 0}};
+            break;
+        }
+        case 3: {
+            tiles = {{1, 1}, {4, 4}, {8, 8}, {16, 1}};
+            break;
+        }
+        default: {
+            NeonException exp("CpuAutotuner");
+            exp << "Unsupported loop dimension " << loopDim;
+            NEON_THROW(exp);
+        }
+    }
+
+    for (const auto& [tileY, tileZ] : tiles) {
+        for (const auto& [schedule, chunk] : schedules) {
+            for (int nThreads : threads) {
+                CpuLaunchConfig config;
+                config.nThreads = nThreads;
+                config.schedule = schedule;
+                config.chunk = chunk;
+                config.tileY = tileY;
+                config.tileZ = tileZ;
+                if (loopDim == 1 && nThreads == threads[0] && schedule == Schedule::ompStatic && chunk == 0) {
+                    // Same loop as the default configuration
+                    continue;
+                }
+                ret.push_back(config);
+            }
+        }
+    }
+    return ret;
+}
+
+auto CpuAutotuner::next(const std::string& key, int loopDim, int maxThreads, CpuLaunchConfig& config) -> bool
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto winnerIt = mWinners.find(key);
+    if (winnerIt != mWinners.end()) {
+        config = winnerIt->second;
+        return true;
+    }
+    auto tuningIt = mTunings.find(key);
+    if (tuningIt == mTunings.end()) {
+        Tuning tuning;
+        tuning.candidates = candidates(loopDim, maxThreads);
+        tuning.bestMs.assign(tuning.candidates.size(), std::numeric_limits<double>::max());
+        tuningIt = mTunings.emplace(key, std::move(tuning)).first;
+    }
+    config = tuningIt->second.candidates[tuningIt->second.current];
+    return false;
+}
+
+auto CpuAutotuner::record(const std::string& key, const CpuLaunchConfig& config, double timeMs) -> void
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto tuningIt = mTunings.find(key);
+    if (tuningIt == mTunings.end() || !(tuningIt->second.candidates[tuningIt->second.current] == config)) {
+        NeonException exp("CpuAutotuner");
+        exp << "The configuration " << config.toString() << " of " << key << " is not the candidate being timed";
+        NEON_THROW(exp);
+    }
+    Tuning& tuning = tuningIt->second;
+    tuning.bestMs[tuning.current] = std::min(tuning.bestMs[tuning.current], timeMs);
+    tuning.trial++;
+    if (tuning.trial < mNTrials) {
+        return;
+    }
+    tuning.trial = 0;
+    tuning.current++;
+    if (tuning.current < int(tuning.candidates.size())) {
+        return;
+    }
+
+    const auto best = std::min_element(tuning.bestMs.begin(), tuning.bestMs.end()) - tuning.bestMs.begin();
+    mWinners[key] = tuning.candidates[best];
+    NEON_INFO("CpuAutotuner: {} -> {} ({} ms, default {} ms)", key, tuning.candidates[best].toString(),
+              tuning.bestMs[best], tuning.bestMs[0]);
+    mTunings.erase(tuningIt);
+    if (!mCacheFile.empty()) {
+        helpSave();
+    }
+}
+
+auto CpuAutotuner::winner(const std::string& key, CpuLaunchConfig& config) const -> bool
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto winnerIt = mWinners.find(key);
+    if (winnerIt == mWinners.end()) {
+        return false;
+    }
+    config = winnerIt->second;
+    return true;
+}
+
+auto CpuAutotuner::nWinners() const -> int
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return int(mWinners.size());
+}
+
+auto CpuAutotuner::cacheFile() const -> const std::string&
+{
+    return mCacheFile;
+}
+
+auto CpuAutotuner::save() const -> void
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    helpSave();
+}
+
+auto CpuAutotuner::helpSave() const -> void
+{
+    std::ofstream out(mCacheFile);
+    if (!out) {
+        NeonException exp("CpuAutotuner");
+        exp << "Unable to write the cache file " << mCacheFile;
+        NEON_THROW(exp);
+    }
+    for (const auto& [key, config] : mWinners) {
+        out << key << "\t" << config.toString() << "\n";
+    }
+}
+
+auto CpuAutotuner::helpLoad() -> void
+{
+    if (mCacheFile.empty()) {
+        return;
+    }
+    std::ifstream in(mCacheFile);
+    if (!in) {
+        // Nothing tuned yet
+        return;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        const auto tab = line.rfind('\t');
+        if (line.empty() || tab == std::string::npos) {
+            continue;
+        }
+        mWinners[line.substr(0, tab)] = CpuLaunchConfig::fromString(line.substr(tab + 1));
+    }
+}
+
+}  // namespace set
+}  // namespace Neon
@@ -0,0 +1,74 @@
+#include "Neon/set/CpuLaunchConfig.h"
+
+#include <sstream>
+
+#include "Neon/core/core.h"
+
+namespace Neon {
+namespace set {
+
+auto CpuLaunchConfig::isDefault() const -> bool
+{
+    return *this == CpuLaunchConfig();
+}
+
+auto CpuLaunchConfig::operator==(const CpuLaunchConfig& other) const -> bool
+{
+    return nThreads == other.nThreads &&
+           schedule == other.schedule &&
+           chunk == other.chunk &&
+           tileY == other.tileY &&
+           tileZ == other.tileZ;
+}
+
+auto CpuLaunchConfig::toString(Schedule s) -> std::string
+{
+    switch (s) {
+        case Schedule::ompStatic: {
+            return "static";
+        }
+        case Schedule::ompDynamic: {
+            return "dynamic";
+        }
+        case Schedule::ompGuided: {
+            return "guided";
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto CpuLaunchConfig::fromString(const std::string& str, Schedule& s) -> bool
+{
+    for (auto option : {Schedule::ompStatic, Schedule::ompDynamic, Schedule::ompGuided}) {
+        if (str == toString(option)) {
+            s = option;
+            return true;
+        }
+    }
+    return false;
+}
+
+auto CpuLaunchConfig::toString() const -> std::string
+{
+    std::ostringstream os;
+    os << nThreads << " " << toString(schedule) << " " << chunk << " " << tileY << " " << tileZ;
+    return os.str();
+}
+
+auto CpuLaunchConfig::fromString(const std::string& str) -> CpuLaunchConfig
+{
+    CpuLaunchConfig    config;
+    std::istringstream is(str);
+    std::string        scheduleName;
+    is >> config.nThreads >> scheduleName >> config.chunk >> config.tileY >> config.tileZ;
+    if (is.fail() || !fromString(scheduleName, config.schedule) ||
+        config.nThreads < 0 || config.chunk < 0 || config.tileY < 0 || config.tileZ < 0) {
+        NeonException exp("CpuLaunchConfig");
+        exp << "Invalid CPU launch configuration: " << str;
+        NEON_THROW(exp);
+    }
+    return config;
+}
+
+}  // namespace set
+}  // namespace Neon
@@ -1,8 +1,11 @@
 #include "Neon/set/DevSet.h"
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 
 #include "Neon/core/types/Exceptions.h"
+#include "Neon/sys/global/CpuSysGlobal.h"
 #include "Neon/sys/global/GpuSysGlobal.h"
 
 #if defined(_OPENMP)
@@ -130,6 +133,201 @@ auto DevSet::setCardinality()
     return int(m_devIds.size());
 }
 
+auto DevSet::setTransport(std::shared_ptr<dist::Transport> transport)
+    -> void
+{
+    m_transport = std::move(transport);
+}
+
+auto DevSet::transport() const
+    -> const std::shared_ptr<dist::Transport>&
+{
+    return m_transport;
+}
+
+auto DevSet::setCpuBinding(Neon::sys::CpuBinding binding)
+    -> void
+{
+    if (m_devType != Neon::DeviceType::CPU) {
+        Neon::NeonException exp("DevSet");
+        exp << "Error, DevSet::setCpuBinding invalid operation on a non CPU type of device.\n";
+        NEON_THROW(exp);
+    }
+    m_cpuBinding = binding;
+    m_partitionCpus.clear();
+    m_partitionNodes.clear();
+    if (binding == Neon::sys::CpuBinding::none) {
+        return;
+    }
+    const auto& topology = Neon::sys::globalSpace::cpuSysObj().topology();
+    m_partitionCpus = topology.partitionCpus(setCardinality(), binding);
+    for (const auto& cpus : m_partitionCpus) {
+        m_partitionNodes.push_back(topology.nodeOf(cpus));
+    }
+}
+
+auto DevSet::cpuBinding() const
+    -> Neon::sys::CpuBinding
+{
+    return m_cpuBinding;
+}
+
+auto DevSet::partitionCpus(SetIdx setIdx) const
+    -> std::vector<int>
+{
+    if (m_partitionCpus.empty()) {
+        return {};
+    }
+    return m_partitionCpus.at(setIdx.idx());
+}
+
+auto DevSet::partitionNode(SetIdx setIdx) const
+    -> int
+{
+    if (m_partitionNodes.empty()) {
+        return -1;
+    }
+    return m_partitionNodes.at(setIdx.idx());
+}
+
+auto DevSet::isLocal(SetIdx setIdx) const
+    -> bool
+{
+    if (!m_transport) {
+        return true;
+    }
+    return m_transport->ownerRank(setIdx.idx(), setCardinality()) == m_transport->rank();
+}
+
+auto DevSet::hostTransfer(SetIdx      dstSetIdx,
+                          char*       dstBuf,
+                          SetIdx      srcSetIdx,
+                          const char* srcBuf,
+                          size_t      numBytes) const
+    -> void
+{
+    const bool isSrcLocal = isLocal(srcSetIdx);
+    const bool isDstLocal = isLocal(dstSetIdx);
+    if (isSrcLocal) {
+        m_transferredBytes->fetch_add(numBytes, std::memory_order_relaxed);
+    }
+    if (isSrcLocal && isDstLocal) {
+        std::memcpy(dstBuf, srcBuf, numBytes);
+        return;
+    }
+    if (!isSrcLocal && !isDstLocal) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_hostTransferBatch->mutex);
+        if (m_hostTransferBatch->isOpen) {
+            m_hostTransferBatch->pending[{srcSetIdx.idx(), dstSetIdx.idx()}].push_back({dstBuf, srcBuf, numBytes});
+            return;
+        }
+    }
+    const int      nPartitions = setCardinality();
+    const uint64_t tag = dist::Transport::transferTag(srcSetIdx.idx(), dstSetIdx.idx());
+    if (isSrcLocal) {
+        m_transport->send(m_transport->ownerRank(dstSetIdx.idx(), nPartitions), tag, srcBuf, numBytes);
+    } else if (isDstLocal) {
+        m_transport->recv(m_transport->ownerRank(srcSetIdx.idx(), nPartitions), tag, dstBuf, numBytes);
+    }
+}
+
+auto DevSet::beginHostTransferBatch() const
+    -> void
+{
+    std::lock_guard<std::mutex> lock(m_hostTransferBatch->mutex);
+    if (m_hostTransferBatch->isOpen) {
+        NeonException exp("DevSet");
+        exp << "A host transfer batch is already open";
+        NEON_THROW(exp);
+    }
+    m_hostTransferBatch->isOpen = true;
+}
+
+auto DevSet::endHostTransferBatch() const
+    -> void
+{
+    std::map<std::pair<int, int>, std::vector<HostTransferBatch::Pending>> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_hostTransferBatch->mutex);
+        if (!m_hostTransferBatch->isOpen) {
+            NeonException exp("DevSet");
+            exp << "No host transfer batch is open";
+            NEON_THROW(exp);
+        }
+        m_hostTransferBatch->isOpen = false;
+        std::swap(pending, m_hostTransferBatch->pending);
+    }
+
+    const int         nPartitions = setCardinality();
+    std::vector<char> packed;
+    // All the sends first: they never block, so the receives below can not dead-lock
+    for (const auto& [pair, transfers] : pending) {
+        const auto [src, dst] = pair;
+        if (!isLocal(src)) {
+            continue;
+        }
+        packed.clear();
+        for (const auto& transfer : transfers) {
+            packed.insert(packed.end(), transfer.srcBuf, transfer.srcBuf + transfer.numBytes);
+        }
+        m_transport->send(m_transport->ownerRank(dst, nPartitions), dist::Transport::transferTag(src, dst), packed.data(), packed.size());
+    }
+    for (const auto& [pair, transfers] : pending) {
+        const auto [src, dst] = pair;
+        if (isLocal(src)) {
+            continue;
+        }
+        size_t numBytes = 0;
+        for (const auto& transfer : transfers) {
+            numBytes += transfer.numBytes;
+        }
+        packed.resize(numBytes);
+        m_transport->recv(m_transport->ownerRank(src, nPartitions), dist::Transport::transferTag(src, dst), packed.data(), numBytes);
+        size_t offset = 0;
+        for (const auto& transfer : transfers) {
+            std::memcpy(transfer.dstBuf, packed.data() + offset, transfer.numBytes);
+            offset += transfer.numBytes;
+        }
+    }
+}
+
+auto DevSet::discardHostTransferBatch() const
+    -> void
+{
+    std::lock_guard<std::mutex> lock(m_hostTransferBatch->mutex);
+    m_hostTransferBatch->isOpen = false;
+    m_hostTransferBatch->pending.clear();
+}
+
+DevSet::HostTransferBatchScope::HostTransferBatchScope(const DevSet& devSet)
+    : mDevSet(&devSet)
+{
+    mDevSet->beginHostTransferBatch();
+}
+
+DevSet::HostTransferBatchScope::~HostTransferBatchScope()
+{
+    if (mIsOpen) {
+        mDevSet->discardHostTransferBatch();
+    }
+}
+
+auto DevSet::HostTransferBatchScope::commit() -> void
+{
+    // The batch is closed by endHostTransferBatch even if one of its transfers fails
+    mIsOpen = false;
+    mDevSet->endHostTransferBatch();
+}
+
+auto DevSet::transferredBytes() const
+    -> uint64_t
+{
+    return m_transferredBytes->load(std::memory_order_relaxed);
+}
+
 auto DevSet::type() const
     -> const Neon::DeviceType&
 {
@@ -312,6 +510,44 @@ auto DevSet::newEventSet(bool disableTiming)
     return GpuEventSet();
 }
 
+auto DevSet::newCpuStreamSet(int nThreadsPerStream)
+    const
+    -> StreamSet
+{
+    if (m_devType == Neon::DeviceType::CPU) {
+        StreamSet streamSet(this->setCardinality());
+        this->forEachSetIdx([&](const Neon::SetIdx& setIdx) {
+            auto cpus = partitionCpus(setIdx);
+            int  nThreads = nThreadsPerStream;
+            if (!cpus.empty()) {
+                // A bound worker does not open more threads than its partition has CPUs
+                nThreads = nThreads > 0 ? std::min(nThreads, int(cpus.size())) : int(cpus.size());
+            }
+            streamSet.set(setIdx.idx(), Neon::sys::GpuStream(std::make_shared<Neon::sys::CpuStream>(nThreads, std::move(cpus))));
+        });
+        return streamSet;
+    }
+    Neon::NeonException exp("DevSet");
+    exp << "Error, DevSet::newCpuStreamSet invalid operation on a non CPU type of device.\n";
+    NEON_THROW(exp);
+}
+
+auto DevSet::newCpuEventSet()
+    const
+    -> GpuEventSet
+{
+    if (m_devType == Neon::DeviceType::CPU) {
+        GpuEventSet eventSet(this->setCardinality());
+        this->forEachSetIdx([&](const Neon::SetIdx& setIdx) {
+            eventSet.event<Neon::Access::readWrite>(setIdx.idx()) = Neon::sys::GpuEvent(std::make_shared<Neon::sys::CpuEvent>());
+        });
+        return eventSet;
+    }
+    Neon::NeonException exp("DevSet");
+    exp << "Error, DevSet::newCpuEventSet invalid operation on a non CPU type of device.\n";
+    NEON_THROW(exp);
+}
+
 
 auto DevSet::newLaunchParameters()
     const
@@ -411,6 +647,7 @@ template <Neon::set::TransferMode transferMode_ta>
     if (m_devType == Neon::DeviceType::CUDA) {
         Neon::sys::ComputeID dstGpuIdx = this->devId(dstSetId);
         Neon::sys::ComputeID srcGpuIdx = this->devId(srcSetIdx);
+        m_transferredBytes->fetch_add(numBytes, std::memory_order_relaxed);
 
         switch (transferMode_ta) {
             case Neon::set::TransferMode::put: {
@@ -454,6 +691,7 @@ auto DevSet::peerTransfer(PeerTransferOption&          opt,
         case Neon::DeviceType::CUDA: {
             Neon::sys::ComputeID dstGpuIdx = this->devId(dstIdx);
             Neon::sys::ComputeID srcGpuIdx = this->devId(srcIdx);
+            m_transferredBytes->fetch_add(numBytes, std::memory_order_relaxed);
 
             switch (transfer.mode()) {
                 case Neon::set::TransferMode::put: {
@@ -472,7 +710,7 @@ auto DevSet::peerTransfer(PeerTransferOption&          opt,
             }
         }
         case (Neon::DeviceType::CPU): {
-            std::memcpy(dstBuf, srcBuf, numBytes);
+            hostTransfer(dstIdx, dstBuf, srcIdx, srcBuf, numBytes);
             return;
         }
         default: {
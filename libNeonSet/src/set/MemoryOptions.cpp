@@ -102,6 +102,20 @@ auto MemoryOptions::setOrder(Neon::MemoryLayout order)
     mMemOrder = order;
 }
 
+auto MemoryOptions::getSpatialLayout() const
+    -> Neon::SpatialLayout
+{
+    helpThrowExceptionIfInitNotCompleted();
+    return mSpatialLayout;
+}
+
+auto MemoryOptions::setSpatialLayout(Neon::SpatialLayout layout)
+    -> void
+{
+    helpThrowExceptionIfInitNotCompleted();
+    mSpatialLayout = layout;
+}
+
 auto MemoryOptions::helpWasInitCompleted() const -> bool
 {
     const bool check1 = mComputeAllocator == Neon::Allocator::NULL_MEM;
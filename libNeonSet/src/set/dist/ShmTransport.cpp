@@ -0,0 +1,222 @@
+#include "Neon/set/dist/ShmTransport.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#if defined(NEON_OS_LINUX) || defined(NEON_OS_MAC)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Neon::set::dist {
+
+/**
+ * Header of a ring buffer in the shared memory segment, the data of the ring follows the header.
+ * head and tail count the bytes written and read since the creation of the ring.
+ */
+struct ShmTransport::Ring
+{
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+
+    auto data() -> char*
+    {
+        return reinterpret_cast<char*>(this) + sizeof(Ring);
+    }
+};
+
+namespace {
+struct SegmentHeader
+{
+    alignas(64) std::atomic<int> nAttached;
+};
+
+struct MessageHeader
+{
+    uint64_t tag;
+    uint64_t bytes;
+};
+}  // namespace
+
+#if defined(NEON_OS_LINUX) || defined(NEON_OS_MAC)
+
+ShmTransport::ShmTransport(const std::string& segmentName,
+                           int                rank,
+                           int                nRanks,
+                           size_t             ringBytes)
+    : Transport(rank, nRanks),
+      mSegmentName(segmentName[0] == '/' ? segmentName : "/" + segmentName),
+      mRingBytes(ringBytes),
+      mSendMutex(std::make_unique<std::mutex[]>(nRanks))
+{
+    mRingStride = (sizeof(Ring) + mRingBytes + 63) / 64 * 64;
+    mSegmentBytes = sizeof(SegmentHeader) + mRingStride * size_t(nRanks) * size_t(nRanks);
+
+    const int fd = shm_open(mSegmentName.c_str(), O_CREAT | O_RDWR, 0600);
+    if (fd < 0) {
+        NeonException exp("ShmTransport");
+        exp << "Unable to open the shared memory segment " << mSegmentName << ": " << std::strerror(errno);
+        NEON_THROW(exp);
+    }
+    // All the ranks request the same size, the new pages are zero-filled
+    if (ftruncate(fd, off_t(mSegmentBytes)) != 0) {
+        close(fd);
+        NeonException exp("ShmTransport");
+        exp << "Unable to size the shared memory segment " << mSegmentName << ": " << std::strerror(errno);
+        NEON_THROW(exp);
+    }
+    void* segment = mmap(nullptr, mSegmentBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED) {
+        NeonException exp("ShmTransport");
+        exp << "Unable to map the shared memory segment " << mSegmentName << ": " << std::strerror(errno);
+        NEON_THROW(exp);
+    }
+    mSegment = static_cast<char*>(segment);
+
+    // Wait for all the ranks, then the name is not needed anymore
+    auto* header = reinterpret_cast<SegmentHeader*>(mSegment);
+    header->nAttached.fetch_add(1);
+    while (header->nAttached.load() < nRanks) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    if (rank == 0) {
+        shm_unlink(mSegmentName.c_str());
+    }
+
+    mReceiver = std::thread([this] { helpReceiverLoop(); });
+}
+
+ShmTransport::~ShmTransport()
+{
+    mStop = true;
+    if (mReceiver.joinable()) {
+        mReceiver.join();
+    }
+    if (mSegment != nullptr) {
+        munmap(mSegment, mSegmentBytes);
+    }
+}
+
+#else
+
+ShmTransport::ShmTransport(const std::string& segmentName,
+                           int                rank,
+                           int                nRanks,
+                           size_t             ringBytes)
+    : Transport(rank, nRanks),
+      mSegmentName(segmentName),
+      mRingBytes(ringBytes)
+{
+    NEON_THROW_UNSUPPORTED_OPTION("ShmTransport requires POSIX shared memory");
+}
+
+ShmTransport::~ShmTransport() = default;
+
+#endif
+
+auto ShmTransport::name() const -> std::string
+{
+    return "shm";
+}
+
+auto ShmTransport::helpRing(int srcRank,
+                            int dstRank) -> Ring&
+{
+    const size_t ringIdx = size_t(srcRank) * size_t(nRanks()) + size_t(dstRank);
+    return *reinterpret_cast<Ring*>(mSegment + sizeof(SegmentHeader) + ringIdx * mRingStride);
+}
+
+auto ShmTransport::helpSend(int         dstRank,
+                            uint64_t    tag,
+                            const void* buf,
+                            size_t      bytes) -> void
+{
+    std::lock_guard<std::mutex> lock(mSendMutex[dstRank]);
+    Ring&                       ring = helpRing(rank(), dstRank);
+    const MessageHeader         header{tag, bytes};
+    helpWrite(ring, &header, sizeof(header));
+    helpWrite(ring, buf, bytes);
+}
+
+auto ShmTransport::helpWrite(Ring&       ring,
+                             const void* buf,
+                             size_t      bytes) -> void
+{
+    const char* src = static_cast<const char*>(buf);
+    uint64_t    head = ring.head.load(std::memory_order_relaxed);
+    while (bytes > 0) {
+        const uint64_t tail = ring.tail.load(std::memory_order_acquire);
+        const size_t   free = mRingBytes - size_t(head - tail);
+        if (free == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        const size_t offset = size_t(head % mRingBytes);
+        const size_t chunk = std::min({bytes, free, mRingBytes - offset});
+        std::memcpy(ring.data() + offset, src, chunk);
+        head += chunk;
+        src += chunk;
+        bytes -= chunk;
+        ring.head.store(head, std::memory_order_release);
+    }
+}
+
+auto ShmTransport::helpRead(Ring&  ring,
+                            void*  buf,
+                            size_t bytes) -> void
+{
+    char*    dst = static_cast<char*>(buf);
+    uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    while (bytes > 0) {
+        const uint64_t head = ring.head.load(std::memory_order_acquire);
+        const size_t   available = size_t(head - tail);
+        if (available == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        const size_t offset = size_t(tail % mRingBytes);
+        const size_t chunk = std::min({bytes, available, mRingBytes - offset});
+        std::memcpy(dst, ring.data() + offset, chunk);
+        tail += chunk;
+        dst += chunk;
+        bytes -= chunk;
+        ring.tail.store(tail, std::memory_order_release);
+    }
+}
+
+auto ShmTransport::helpReceiverLoop() -> void
+{
+    int idleRounds = 0;
+    while (!mStop) {
+        bool received = false;
+        for (int src = 0; src < nRanks(); src++) {
+            if (src == rank()) {
+                continue;
+            }
+            Ring& ring = helpRing(src, rank());
+            if (ring.head.load(std::memory_order_acquire) == ring.tail.load(std::memory_order_relaxed)) {
+                continue;
+            }
+            // A message is always written completely, so once its first byte is there the rest follows
+            MessageHeader header{};
+            helpRead(ring, &header, sizeof(header));
+            std::vector<char> message(header.bytes);
+            helpRead(ring, message.data(), header.bytes);
+            helpDeliver(src, header.tag, std::move(message));
+            received = true;
+        }
+        if (received) {
+            idleRounds = 0;
+        } else if (++idleRounds > 1000) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+}  // namespace Neon::set::dist
@@ -0,0 +1,230 @@
+#include "Neon/set/dist/TcpTransport.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#if defined(NEON_OS_LINUX) || defined(NEON_OS_MAC)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace Neon::set::dist {
+
+namespace {
+struct MessageHeader
+{
+    uint64_t tag;
+    uint64_t bytes;
+};
+
+#if defined(NEON_OS_LINUX) || defined(NEON_OS_MAC)
+auto throwSocketError(const std::string& what) -> void
+{
+    NeonException exp("TcpTransport");
+    exp << what << ": " << std::strerror(errno);
+    NEON_THROW(exp);
+}
+
+/**
+ * Writes the whole buffer, returns false if the connection is closed
+ */
+auto writeAll(int socket, const void* buf, size_t bytes) -> bool
+{
+    const char* src = static_cast<const char*>(buf);
+    while (bytes > 0) {
+        const ssize_t n = ::send(socket, src, bytes, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        src += n;
+        bytes -= size_t(n);
+    }
+    return true;
+}
+
+/**
+ * Reads the whole buffer, returns false if the connection is closed
+ */
+auto readAll(int socket, void* buf, size_t bytes) -> bool
+{
+    char* dst = static_cast<char*>(buf);
+    while (bytes > 0) {
+        const ssize_t n = ::recv(socket, dst, bytes, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        dst += n;
+        bytes -= size_t(n);
+    }
+    return true;
+}
+
+auto address(const std::string& host, int port) -> sockaddr_in
+{
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(uint16_t(port));
+    if (inet_pton(AF_INET, host.c_str(), &addr.sin_addr) != 1) {
+        NeonException exp("TcpTransport");
+        exp << "Invalid host address " << host;
+        NEON_THROW(exp);
+    }
+    return addr;
+}
+#endif
+}  // namespace
+
+#if defined(NEON_OS_LINUX) || defined(NEON_OS_MAC)
+
+TcpTransport::TcpTransport(int                rank,
+                           int                nRanks,
+                           int                basePort,
+                           const std::string& host)
+    : Transport(rank, nRanks),
+      mSockets(nRanks, -1),
+      mSendMutex(std::make_unique<std::mutex[]>(nRanks))
+{
+    // The listening socket is ready before any rank tries to connect to it
+    const int listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener < 0) {
+        throwSocketError("Unable to create a socket");
+    }
+    const int reuse = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in listenAddr = address(host, basePort + rank);
+    if (bind(listener, reinterpret_cast<sockaddr*>(&listenAddr), sizeof(listenAddr)) != 0 ||
+        listen(listener, nRanks) != 0) {
+        close(listener);
+        throwSocketError("Unable to listen on port " + std::to_string(basePort + rank));
+    }
+
+    // Connections to the lower ranks, retrying until they are listening
+    for (int peer = 0; peer < rank; peer++) {
+        sockaddr_in peerAddr = address(host, basePort + peer);
+        while (true) {
+            const int s = socket(AF_INET, SOCK_STREAM, 0);
+            if (s < 0) {
+                close(listener);
+                throwSocketError("Unable to create a socket");
+            }
+            if (connect(s, reinterpret_cast<sockaddr*>(&peerAddr), sizeof(peerAddr)) == 0) {
+                const int32_t myRank = rank;
+                writeAll(s, &myRank, sizeof(myRank));
+                mSockets[peer] = s;
+                break;
+            }
+            close(s);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    // Connections from the higher ranks, which introduce themselves with their rank
+    for (int i = rank + 1; i < nRanks; i++) {
+        const int s = accept(listener, nullptr, nullptr);
+        int32_t   peer = -1;
+        if (s < 0 || !readAll(s, &peer, sizeof(peer)) || peer <= rank || peer >= nRanks) {
+            close(listener);
+            throwSocketError("Unable to accept a connection");
+        }
+        mSockets[peer] = s;
+    }
+    close(listener);
+
+    for (int peer = 0; peer < nRanks; peer++) {
+        if (peer == rank) {
+            continue;
+        }
+        const int noDelay = 1;
+        setsockopt(mSockets[peer], IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        mReceivers.emplace_back([this, peer] { helpReceiverLoop(peer); });
+    }
+}
+
+TcpTransport::~TcpTransport()
+{
+    // Closing the write side lets the receiver threads of the peers terminate
+    for (int s : mSockets) {
+        if (s >= 0) {
+            shutdown(s, SHUT_WR);
+        }
+    }
+    for (auto& receiver : mReceivers) {
+        receiver.join();
+    }
+    for (int s : mSockets) {
+        if (s >= 0) {
+            close(s);
+        }
+    }
+}
+
+auto TcpTransport::helpSend(int         dstRank,
+                            uint64_t    tag,
+                            const void* buf,
+                            size_t      bytes) -> void
+{
+    std::lock_guard<std::mutex> lock(mSendMutex[dstRank]);
+    const MessageHeader         header{tag, bytes};
+    if (!writeAll(mSockets[dstRank], &header, sizeof(header)) ||
+        !writeAll(mSockets[dstRank], buf, bytes)) {
+        throwSocketError("Unable to send a message to rank " + std::to_string(dstRank));
+    }
+}
+
+auto TcpTransport::helpReceiverLoop(int srcRank) -> void
+{
+    while (true) {
+        MessageHeader header{};
+        if (!readAll(mSockets[srcRank], &header, sizeof(header))) {
+            return;
+        }
+        std::vector<char> message(header.bytes);
+        if (!readAll(mSockets[srcRank], message.data(), header.bytes)) {
+            return;
+        }
+        helpDeliver(srcRank, header.tag, std::move(message));
+    }
+}
+
+#else
+
+TcpTransport::TcpTransport(int rank,
+                           int nRanks,
+                           int /*basePort*/,
+                           const std::string& /*host*/)
+    : Transport(rank, nRanks)
+{
+    NEON_THROW_UNSUPPORTED_OPTION("TcpTransport requires POSIX sockets");
+}
+
+TcpTransport::~TcpTransport() = default;
+
+auto TcpTransport::helpSend(int /*dstRank*/,
+                            uint64_t /*tag*/,
+                            const void* /*buf*/,
+                            size_t /*bytes*/) -> void
+{
+}
+
+auto TcpTransport::helpReceiverLoop(int /*srcRank*/) -> void
+{
+}
+
+#endif
+
+auto TcpTransport::name() const -> std::string
+{
+    return "tcp";
+}
+
+}  // namespace Neon::set::dist
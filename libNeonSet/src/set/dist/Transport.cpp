@@ -0,0 +1,111 @@
+#include "Neon/set/dist/Transport.h"
+
+#include <cstring>
+
+namespace Neon::set::dist {
+
+namespace {
+// Collective operations use the upper half of the tag space
+constexpr uint64_t collectiveTagBit = uint64_t(1) << 63;
+}  // namespace
+
+Transport::Transport(int rank,
+                     int nRanks)
+    : mRank(rank),
+      mNRanks(nRanks)
+{
+    if (nRanks < 1 || rank < 0 || rank >= nRanks) {
+        NeonException exp("Transport");
+        exp << "Invalid rank " << rank << " for " << nRanks << " ranks";
+        NEON_THROW(exp);
+    }
+}
+
+auto Transport::rank() const -> int
+{
+    return mRank;
+}
+
+auto Transport::nRanks() const -> int
+{
+    return mNRanks;
+}
+
+auto Transport::send(int         dstRank,
+                     uint64_t    tag,
+                     const void* buf,
+                     size_t      bytes) -> void
+{
+    if (dstRank == mRank) {
+        std::vector<char> message(bytes);
+        std::memcpy(message.data(), buf, bytes);
+        helpDeliver(mRank, tag, std::move(message));
+        return;
+    }
+    helpSend(dstRank, tag, buf, bytes);
+}
+
+auto Transport::recv(int      srcRank,
+                     uint64_t tag,
+                     void*    buf,
+                     size_t   bytes) -> void
+{
+    std::vector<char> message;
+    {
+        std::unique_lock<std::mutex> lock(mMailboxMutex);
+        const auto                   key = std::make_pair(srcRank, tag);
+        mMailboxArrival.wait(lock, [&] {
+            auto it = mMailbox.find(key);
+            return it != mMailbox.end() && !it->second.empty();
+        });
+        auto& queue = mMailbox[key];
+        message = std::move(queue.front());
+        queue.pop_front();
+        if (queue.empty()) {
+            mMailbox.erase(key);
+        }
+    }
+    if (message.size() != bytes) {
+        NeonException exp("Transport");
+        exp << "Received " << message.size() << " bytes from rank " << srcRank
+            << " while " << bytes << " bytes were expected";
+        NEON_THROW(exp);
+    }
+    std::memcpy(buf, message.data(), bytes);
+}
+
+auto Transport::barrier() -> void
+{
+    char token = 0;
+    allreduce(&token, 1, ReduceOp::max);
+}
+
+auto Transport::ownerRank(int setIdx,
+                          int nPartitions) const -> int
+{
+    return int((int64_t(setIdx) * mNRanks) / nPartitions);
+}
+
+auto Transport::transferTag(int srcSetIdx,
+                            int dstSetIdx) -> uint64_t
+{
+    return (uint64_t(uint32_t(srcSetIdx)) << 31) | uint64_t(uint32_t(dstSetIdx));
+}
+
+auto Transport::helpDeliver(int                 srcRank,
+                            uint64_t            tag,
+                            std::vector<char>&& message) -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(mMailboxMutex);
+        mMailbox[std::make_pair(srcRank, tag)].push_back(std::move(message));
+    }
+    mMailboxArrival.notify_all();
+}
+
+auto Transport::helpCollectiveTag() -> uint64_t
+{
+    return collectiveTagBit | mCollectiveCount++;
+}
+
+}  // namespace Neon::set::dist
@@ -0,0 +1,93 @@
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Neon/set/CpuAutotuner.h"
+
+using Neon::set::CpuAutotuner;
+using Neon::set::CpuLaunchConfig;
+
+TEST(CpuAutotuner, launchConfig)
+{
+    CpuLaunchConfig config;
+    ASSERT_TRUE(config.isDefault());
+
+    config.nThreads = 8;
+    config.schedule = CpuLaunchConfig::Schedule::ompGuided;
+    config.chunk = 4;
+    config.tileY = 16;
+    config.tileZ = 2;
+    ASSERT_FALSE(config.isDefault());
+    ASSERT_EQ(config.toString(), "8 guided 4 16 2");
+    ASSERT_TRUE(CpuLaunchConfig::fromString(config.toString()) == config);
+
+    ASSERT_ANY_THROW(CpuLaunchConfig::fromString("8 sometimes 4 16 2"));
+    ASSERT_ANY_THROW(CpuLaunchConfig::fromString("8 static"));
+    ASSERT_ANY_THROW(CpuLaunchConfig::fromString("-1 static 0 0 0"));
+}
+
+TEST(CpuAutotuner, candidates)
+{
+    for (int loopDim : {1, 2, 3}) {
+        const auto candidates = CpuAutotuner::candidates(loopDim, 8);
+        ASSERT_GT(candidates.size(), size_t(1));
+        ASSERT_TRUE(candidates[0].isDefault());
+        for (size_t i = 1; i < candidates.size(); i++) {
+            ASSERT_FALSE(candidates[i].isDefault());
+            for (size_t j = 0; j < i; j++) {
+                ASSERT_FALSE(candidates[i] == candidates[j]) << "Duplicated candidate " << candidates[i].toString();
+            }
+        }
+    }
+    ASSERT_ANY_THROW(CpuAutotuner::candidates(4, 8));
+}
+
+TEST(CpuAutotuner, tuning)
+{
+    const std::string cacheFile("setUt_cpuAutotuner_cache.txt");
+    std::remove(cacheFile.c_str());
+
+    const std::string key("Laplace_standard_64_64_32");
+    const int         nTrials = 2;
+    const int         maxThreads = 4;
+    CpuLaunchConfig   expected;
+    {
+        CpuAutotuner autotuner(cacheFile, nTrials);
+
+        // The last candidate is the fastest one; the first trial of each candidate is the slowest
+        int             nRuns = 0;
+        CpuLaunchConfig config;
+        while (!autotuner.next(key, 3, maxThreads, config)) {
+            // The candidates stay within the thread budget of the stream
+            ASSERT_LE(config.nThreads, maxThreads);
+            const int candidateIdx = nRuns / nTrials;
+            const int trial = nRuns % nTrials;
+            autotuner.record(key, config, 100.0 - candidateIdx - (trial == 0 ? 0 : 0.5));
+            expected = config;
+            nRuns++;
+        }
+        ASSERT_EQ(nRuns, int(CpuAutotuner::candidates(3, maxThreads).size()) * nTrials);
+        ASSERT_TRUE(config == expected);
+        ASSERT_EQ(autotuner.nWinners(), 1);
+
+        // Only the candidate being timed can be recorded
+        CpuLaunchConfig other;
+        ASSERT_FALSE(autotuner.next("Map_standard_64_64_32", 3, maxThreads, other));
+        other.chunk = 123;
+        ASSERT_ANY_THROW(autotuner.record("Map_standard_64_64_32", other, 1.0));
+    }
+    {  // The winner is loaded from the cache file
+        CpuAutotuner    autotuner(cacheFile, nTrials);
+        CpuLaunchConfig config;
+        ASSERT_EQ(autotuner.nWinners(), 1);
+        ASSERT_TRUE(autotuner.winner(key, config));
+        ASSERT_TRUE(config == expected);
+        ASSERT_TRUE(autotuner.next(key, 3, maxThreads, config));
+        ASSERT_FALSE(autotuner.winner("Map_standard_64_64_32", config));
+    }
+    std::remove(cacheFile.c_str());
+
+    ASSERT_ANY_THROW(CpuAutotuner("", 0));
+}
@@ -1,3 +1,9 @@
+#include <omp.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <random>
+
 #include "gtest/gtest.h"
 
 #include "Neon/Neon.h"
@@ -20,8 +26,8 @@ TEST(BlasSet, SumUnified)
                                                   Neon::Allocator::MALLOC,
                                                   1);
         auto              streams = dev_set.newStreamSet();
-        auto              start_id = dev_set.newDataSet<int>(0);
-        auto              num_elements = dev_set.newDataSet<int>(int(buffer_size));
+        auto              start_id = dev_set.newDataSet<int64_t>(0);
+        auto              num_elements = dev_set.newDataSet<int64_t>(int64_t(buffer_size));
         for (int32_t i = 0; i < int32_t(num_sets); ++i) {
             output.mem(i)[0] = 0;
             for (int j = 0; j < buffer_size; ++j) {
@@ -46,8 +52,8 @@ TEST(BlasSet, Sum)
         size_t            num_sets = 2;
         std::vector<int>  dev_ids(num_sets, 0);
         Neon::set::DevSet dev_set(Neon::DeviceType::CUDA, dev_ids);
-        auto              start_id = dev_set.newDataSet<int>(0);
-        auto              num_elements = dev_set.newDataSet<int>(int(buffer_size));
+        auto              start_id = dev_set.newDataSet<int64_t>(0);
+        auto              num_elements = dev_set.newDataSet<int64_t>(int64_t(buffer_size));
         auto              d_inputs = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CUDA,
                                                     Neon::Allocator::CUDA_MEM_DEVICE,
                                                     buffer_size);
@@ -88,8 +94,8 @@ TEST(BlasSet, Norm2Unified)
         size_t            num_sets = 2;
         std::vector<int>  dev_ids(num_sets, 0);
         Neon::set::DevSet dev_set(Neon::DeviceType::CUDA, dev_ids);
-        auto              start_id = dev_set.newDataSet<int>(0);
-        auto              num_elements = dev_set.newDataSet<int>(int(buffer_size));
+        auto              start_id = dev_set.newDataSet<int64_t>(0);
+        auto              num_elements = dev_set.newDataSet<int64_t>(int64_t(buffer_size));
         auto              inputs = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CPU,
                                                   Neon::Allocator::CUDA_MEM_UNIFIED,
                                                   buffer_size);
@@ -122,8 +128,8 @@ TEST(BlasSet, Norm2)
         size_t            num_sets = 2;
         std::vector<int>  dev_ids(num_sets, 0);
         Neon::set::DevSet dev_set(Neon::DeviceType::CUDA, dev_ids);
-        auto              start_id = dev_set.newDataSet<int>(0);
-        auto              num_elements = dev_set.newDataSet<int>(int(buffer_size));
+        auto              start_id = dev_set.newDataSet<int64_t>(0);
+        auto              num_elements = dev_set.newDataSet<int64_t>(int64_t(buffer_size));
         auto              d_inputs = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CUDA,
                                                     Neon::Allocator::CUDA_MEM_DEVICE,
                                                     buffer_size);
@@ -164,8 +170,8 @@ TEST(BlasSet, DotUnified)
         size_t            num_sets = 2;
         std::vector<int>  dev_ids(num_sets, 0);
         Neon::set::DevSet dev_set(Neon::DeviceType::CUDA, dev_ids);
-        auto              start_id = dev_set.newDataSet<int>(0);
-        auto              num_elements = dev_set.newDataSet<int>(int(buffer_size));
+        auto              start_id = dev_set.newDataSet<int64_t>(0);
+        auto              num_elements = dev_set.newDataSet<int64_t>(int64_t(buffer_size));
         auto              inputs1 = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CPU,
                                                    Neon::Allocator::CUDA_MEM_UNIFIED,
                                                    buffer_size);
@@ -202,8 +208,8 @@ TEST(BlasSet, Dot)
         size_t            num_sets = 2;
         std::vector<int>  dev_ids(num_sets, 0);
         Neon::set::DevSet dev_set(Neon::DeviceType::CUDA, dev_ids);
-        auto              start_id = dev_set.newDataSet<int>(0);
-        auto              num_elements = dev_set.newDataSet<int>(int(buffer_size));
+        auto              start_id = dev_set.newDataSet<int64_t>(0);
+        auto              num_elements = dev_set.newDataSet<int64_t>(int64_t(buffer_size));
         auto              d_inputs1 = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CUDA,
                                                      Neon::Allocator::CUDA_MEM_DEVICE,
                                                      buffer_size);
@@ -244,6 +250,116 @@ TEST(BlasSet, Dot)
     }
 }
 
+/**
+ * The same data split over a different number of partitions and slices,
+ * and reduced with a different number of threads, gives bit-identical results
+ */
+TEST(BlasSet, DotDeterministic)
+{
+    using dataT = double;
+    const int64_t      n = 100003;
+    std::vector<dataT> x(n);
+    std::vector<dataT> y(n);
+    long double        golden = 0;
+    for (int64_t j = 0; j < n; ++j) {
+        // values spread over many orders of magnitude and with cancellations
+        x[j] = std::sin(0.37 * double(j)) * std::pow(10.0, double(j % 17) - 8.0);
+        y[j] = std::cos(0.11 * double(j));
+        golden += static_cast<long double>(x[j]) * y[j];
+    }
+
+    std::vector<dataT> results;
+    for (int numSets : {1, 2, 3}) {
+        for (int numSlices : {1, 2}) {
+            for (int numThreads : {1, 4}) {
+                omp_set_num_threads(numThreads);
+
+                std::vector<int>  dev_ids(numSets, 0);
+                Neon::set::DevSet dev_set(Neon::DeviceType::CPU, dev_ids);
+                const int64_t     partSize = (n + numSets - 1) / numSets;
+                auto              in1 = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CPU, Neon::Allocator::MALLOC, partSize);
+                auto              in2 = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CPU, Neon::Allocator::MALLOC, partSize);
+                auto              output = dev_set.newMemDevSet<dataT>(Neon::DeviceType::CPU, Neon::Allocator::MALLOC, 1);
+
+                // DataSet copies share their storage: each slice needs its own
+                std::vector<Neon::set::DataSet<int64_t>> start_id;
+                std::vector<Neon::set::DataSet<int64_t>> num_elements;
+                for (int slice = 0; slice < numSlices; ++slice) {
+                    start_id.push_back(dev_set.newDataSet<int64_t>(0));
+                    num_elements.push_back(dev_set.newDataSet<int64_t>(0));
+                }
+                for (int i = 0; i < numSets; ++i) {
+                    const int64_t begin = i * partSize;
+                    const int64_t count = std::min(n, begin + partSize) - begin;
+                    for (int64_t j = 0; j < count; ++j) {
+                        in1.mem(i)[j] = x[begin + j];
+                        in2.mem(i)[j] = y[begin + j];
+                    }
+                    const int64_t half = numSlices == 1 ? count : count / 3;
+                    start_id[0][i] = 0;
+                    num_elements[0][i] = half;
+                    if (numSlices == 2) {
+                        start_id[1][i] = half;
+                        num_elements[1][i] = count - half;
+                    }
+                }
+
+                Neon::set::patterns::BlasSet<dataT> pattern(dev_set, Neon::sys::patterns::Engine::deterministic);
+                results.push_back(pattern.dot(in1, in2, output, start_id, num_elements));
+            }
+        }
+    }
+    omp_set_num_threads(omp_get_num_procs());
+
+    for (const auto& r : results) {
+        EXPECT_EQ(std::memcmp(&r, &results[0], sizeof(dataT)), 0);
+    }
+    EXPECT_NEAR(results[0], double(golden), 1e-12 * std::abs(double(golden)));
+}
+
+TEST(ReproducibleSum, Exact)
+{
+    using Neon::sys::patterns::ReproducibleSum;
+
+    // Cancellations that a floating point accumulator loses
+    const std::vector<double> cancel{1e300, 1.0, -1e300, std::ldexp(1.0, -1074), -std::ldexp(1.0, -1074)};
+    EXPECT_EQ(ReproducibleSum::sum([&](int64_t i) { return cancel[i]; }, 0, int64_t(cancel.size())), 1.0);
+
+    // Opposite terms in shuffled order sum exactly to zero, the sign of the magnitudes does not matter
+    const int64_t       n = 200000;
+    std::vector<double> terms(n);
+    for (int64_t j = 0; j < n / 2; ++j) {
+        terms[2 * j] = std::sin(double(j)) * std::pow(10.0, double(j % 41) - 20.0);
+        terms[2 * j + 1] = -terms[2 * j];
+    }
+    std::mt19937 gen(7);
+    std::shuffle(terms.begin(), terms.end(), gen);
+    EXPECT_EQ(ReproducibleSum::sum([&](int64_t i) { return terms[i]; }, 0, n), 0.0);
+
+    // Merging partial accumulators in any order gives the same bits
+    terms.push_back(-0.1);
+    ReproducibleSum forward;
+    ReproducibleSum backward;
+    const int64_t   chunk = 1000;
+    for (int64_t b = 0; b < n + 1; b += chunk) {
+        ReproducibleSum partial;
+        partial.add([&](int64_t i) { return terms[i]; }, b, std::min(n + 1, b + chunk));
+        forward.merge(partial);
+    }
+    for (int64_t b = n + 1; b > 0; b -= chunk) {
+        backward.add([&](int64_t i) { return terms[i]; }, std::max(int64_t(0), b - chunk), b);
+    }
+    const double f = forward.result();
+    const double r = backward.result();
+    EXPECT_EQ(std::memcmp(&f, &r, sizeof(double)), 0);
+    EXPECT_EQ(f, -0.1);
+
+    // Non finite terms can not be accumulated
+    ReproducibleSum infinite;
+    infinite.add(std::numeric_limits<double>::infinity());
+    EXPECT_ANY_THROW(infinite.result());
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
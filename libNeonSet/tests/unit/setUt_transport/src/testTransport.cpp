@@ -0,0 +1,239 @@
+#include "gtest/gtest.h"
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Neon/set/DevSet.h"
+#include "Neon/set/dist/ShmTransport.h"
+#include "Neon/set/dist/TcpTransport.h"
+
+/**
+ * Creates the transport of a rank. Each run of the ranks has a different run index.
+ */
+using TransportFactory = std::function<std::shared_ptr<Neon::set::dist::Transport>(int run, int rank, int nRanks)>;
+
+/**
+ * Runs rankMain in nRanks forked processes and returns true if all of them succeed
+ */
+bool runRanks(int nRanks, const TransportFactory& factory, const std::function<bool(Neon::set::dist::Transport&)>& rankMain)
+{
+    static int         runCount = 0;
+    const int          run = runCount++;
+    std::vector<pid_t> children;
+    for (int rank = 0; rank < nRanks; rank++) {
+        const pid_t pid = fork();
+        if (pid == 0) {
+            bool isOk = false;
+            try {
+                auto transport = factory(run, rank, nRanks);
+                isOk = rankMain(*transport);
+            } catch (...) {
+                isOk = false;
+            }
+            _exit(isOk ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+    bool isOk = true;
+    for (pid_t pid : children) {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        isOk = isOk && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    return isOk;
+}
+
+bool sendRecv(Neon::set::dist::Transport& transport)
+{
+    const int rank = transport.rank();
+    const int nRanks = transport.nRanks();
+    const int tag = 7;
+    // Two messages with the same tag to each rank (this one included) are received in order
+    for (int dst = 0; dst < nRanks; dst++) {
+        for (int msg = 0; msg < 2; msg++) {
+            std::vector<int> buf(1000, rank * 100 + dst * 10 + msg);
+            transport.send(dst, tag, buf.data(), buf.size() * sizeof(int));
+        }
+    }
+    for (int src = 0; src < nRanks; src++) {
+        for (int msg = 0; msg < 2; msg++) {
+            std::vector<int> buf(1000, -1);
+            transport.recv(src, tag, buf.data(), buf.size() * sizeof(int));
+            for (int val : buf) {
+                if (val != src * 100 + rank * 10 + msg) {
+                    return false;
+                }
+            }
+        }
+    }
+    // A large message does not fit in a ring buffer in one go
+    if (rank == 0 && nRanks > 1) {
+        std::vector<double> buf(1 << 18);
+        for (size_t i = 0; i < buf.size(); i++) {
+            buf[i] = double(i);
+        }
+        transport.send(1, tag + 1, buf.data(), buf.size() * sizeof(double));
+    }
+    if (rank == 1) {
+        std::vector<double> buf(1 << 18, -1);
+        transport.recv(0, tag + 1, buf.data(), buf.size() * sizeof(double));
+        for (size_t i = 0; i < buf.size(); i++) {
+            if (buf[i] != double(i)) {
+                return false;
+            }
+        }
+    }
+    transport.barrier();
+    return true;
+}
+
+bool allreduce(Neon::set::dist::Transport& transport)
+{
+    using Neon::set::dist::ReduceOp;
+    const int rank = transport.rank();
+    const int nRanks = transport.nRanks();
+
+    bool isOk = true;
+    isOk = isOk && transport.allreduce(rank + 1, ReduceOp::sum) == nRanks * (nRanks + 1) / 2;
+    isOk = isOk && transport.allreduce(double(rank), ReduceOp::max) == double(nRanks - 1);
+    isOk = isOk && transport.allreduce(int64_t(rank) - 5, ReduceOp::min) == int64_t(-5);
+
+    std::vector<float> values{float(rank), 1.0f, float(-rank)};
+    transport.allreduce(values.data(), int(values.size()), ReduceOp::sum);
+    isOk = isOk && values[0] == float(nRanks * (nRanks - 1) / 2);
+    isOk = isOk && values[1] == float(nRanks);
+    isOk = isOk && values[2] == -float(nRanks * (nRanks - 1) / 2);
+
+    for (int i = 0; i < 10; i++) {
+        transport.barrier();
+    }
+    return isOk;
+}
+
+/**
+ * Every partition sends three buffers of different sizes to every other partition within a host transfer batch.
+ * The local pairs are copied right away, the remote ones are packed into one message per pair.
+ */
+bool hostTransferBatch(Neon::set::dist::Transport& transport)
+{
+    const int        nPartitions = 5;
+    const int        nChunks = 3;
+    std::vector<int> ids;
+    for (int i = 0; i < nPartitions; i++) {
+        ids.push_back(i);
+    }
+    Neon::set::DevSet devSet(Neon::DeviceType::CPU, ids);
+    // The transport is owned by runRanks
+    devSet.setTransport(std::shared_ptr<Neon::set::dist::Transport>(&transport, [](Neon::set::dist::Transport*) {}));
+
+    auto chunkSize = [](int chunk) { return size_t(16 + 100 * chunk); };
+    auto value = [](int src, int dst, int chunk, size_t i) { return char((src * 31 + dst * 7 + chunk * 3 + int(i)) % 127); };
+
+    // buffers[src][dst][chunk]: sent data on the source side, received data on the destination side
+    using Buffers = std::vector<std::vector<std::vector<std::vector<char>>>>;
+    Buffers sent(nPartitions, std::vector<std::vector<std::vector<char>>>(nPartitions, std::vector<std::vector<char>>(nChunks)));
+    Buffers received = sent;
+    for (int src = 0; src < nPartitions; src++) {
+        for (int dst = 0; dst < nPartitions; dst++) {
+            for (int chunk = 0; chunk < nChunks; chunk++) {
+                sent[src][dst][chunk].resize(chunkSize(chunk));
+                received[src][dst][chunk].assign(chunkSize(chunk), -1);
+                for (size_t i = 0; i < chunkSize(chunk); i++) {
+                    sent[src][dst][chunk][i] = value(src, dst, chunk, i);
+                }
+            }
+        }
+    }
+
+    devSet.beginHostTransferBatch();
+    try {
+        devSet.beginHostTransferBatch();
+        return false;
+    } catch (...) {
+    }
+    for (int chunk = 0; chunk < nChunks; chunk++) {
+        for (int src = 0; src < nPartitions; src++) {
+            for (int dst = 0; dst < nPartitions; dst++) {
+                if (src != dst) {
+                    devSet.hostTransfer(dst, received[src][dst][chunk].data(), src, sent[src][dst][chunk].data(), chunkSize(chunk));
+                }
+            }
+        }
+    }
+    devSet.endHostTransferBatch();
+
+    for (int src = 0; src < nPartitions; src++) {
+        for (int dst = 0; dst < nPartitions; dst++) {
+            if (src == dst || !devSet.isLocal(dst)) {
+                continue;
+            }
+            for (int chunk = 0; chunk < nChunks; chunk++) {
+                if (received[src][dst][chunk] != sent[src][dst][chunk]) {
+                    return false;
+                }
+            }
+        }
+    }
+    try {
+        devSet.endHostTransferBatch();
+        return false;
+    } catch (...) {
+    }
+
+    // A scope left by an exception drops its transfers and leaves the set usable
+    try {
+        Neon::set::DevSet::HostTransferBatchScope batch(devSet);
+        devSet.hostTransfer(nPartitions - 1, received[0][nPartitions - 1][0].data(), 0, sent[0][nPartitions - 1][0].data(), chunkSize(0));
+        throw std::runtime_error("halo update failure");
+    } catch (const std::runtime_error&) {
+    }
+    Neon::set::DevSet::HostTransferBatchScope batch(devSet);
+    batch.commit();
+    transport.barrier();
+    return true;
+}
+
+void runTransport(const TransportFactory& factory)
+{
+    for (int nRanks : {1, 2, 3}) {
+        ASSERT_TRUE(runRanks(nRanks, factory, sendRecv)) << "nRanks " << nRanks;
+        ASSERT_TRUE(runRanks(nRanks, factory, allreduce)) << "nRanks " << nRanks;
+        ASSERT_TRUE(runRanks(nRanks, factory, hostTransferBatch)) << "nRanks " << nRanks;
+    }
+}
+
+TEST(Transport, shm)
+{
+    runTransport([](int run, int rank, int nRanks) {
+        const std::string name = "setUt_transport_" + std::to_string(getppid()) + "_" + std::to_string(run);
+        // Small rings to exercise the wrap around and the back pressure
+        return std::make_shared<Neon::set::dist::ShmTransport>(name, rank, nRanks, size_t(1) << 12);
+    });
+}
+
+TEST(Transport, tcp)
+{
+    const int basePort = 20000 + int(getpid() % 20000);
+    runTransport([basePort](int run, int rank, int nRanks) {
+        // Each run listens on its own ports, the ports of the previous runs may still be in TIME_WAIT
+        return std::make_shared<Neon::set::dist::TcpTransport>(rank, nRanks, basePort + 4 * run);
+    });
+}
+
+TEST(Transport, ownerRank)
+{
+    // A single process transport is enough to check the partition ownership
+    Neon::set::dist::ShmTransport transport("setUt_transport_owner_" + std::to_string(getpid()), 0, 1);
+    for (int nPartitions : {1, 4, 7}) {
+        for (int setIdx = 0; setIdx < nPartitions; setIdx++) {
+            ASSERT_EQ(transport.ownerRank(setIdx, nPartitions), 0);
+        }
+    }
+    ASSERT_NE(Neon::set::dist::Transport::transferTag(0, 1), Neon::set::dist::Transport::transferTag(1, 0));
+}
@@ -25,10 +25,44 @@ struct Options
     auto transferMode() const -> Neon::set::TransferMode;
     auto executor()const -> Neon::skeleton::Executor;
 
+    /**
+     * Selects how the OpenMP threads run the graph: one node at a time on all the partitions (default),
+     * or one thread per partition running the whole graph.
+     */
+    auto setExecutor(Neon::skeleton::Executor executor) -> Options&;
+
+    /**
+     * When enabled (default) the halo updates of all the stencil fields loaded by a container
+     * are merged into a single node, and the fields are exchanged with one message
+     * per pair of partitions owned by different processes.
+     */
+    auto setHaloUpdateBatching(bool enable) -> Options&;
+    auto haloUpdateBatching() const -> bool;
+
+    /**
+     * When enabled (disabled by default) the scheduled graph of the sequence is looked up in,
+     * and stored into, the process wide graph cache, so that sequences with the same structure
+     * are not parsed and scheduled again.
+     */
+    auto setGraphCache(bool enable) -> Options&;
+    auto graphCache() const -> bool;
+
+    /**
+     * Period, in iterations, at which the predicate of a while loop is evaluated (1 by default).
+     * Only the iterations that evaluate the predicate, and the last one, wait for the graph on the host;
+     * the others are enqueued back-to-back. A loop may therefore run up to period - 1 iterations
+     * after the one where the predicate would have stopped it.
+     */
+    auto setLoopCheckPeriod(int period) -> Options&;
+    auto loopCheckPeriod() const -> int;
+
    private:
     Neon::set::TransferMode  mTransferMode{Neon::set::TransferMode::get};
     Neon::skeleton::Occ      mOcc = Occ::none;
     Neon::skeleton::Executor mExecutor = Neon::skeleton::Executor::ompAtNodeLevel;
+    bool                     mHaloUpdateBatching = true;
+    bool                     mGraphCache = false;
+    int                      mLoopCheckPeriod = 1;
 };
 
 }  // namespace Neon::skeleton
\ No newline at end of file
@@ -0,0 +1,158 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Neon/Report.h"
+
+namespace Neon::skeleton {
+
+/**
+ * Execution profiler of the nodes of a skeleton (see Skeleton::setProfiler).
+ *
+ * The stream scheduler records the start and end time of every node it runs, together with
+ * the partition (-1 when the node runs on all the partitions at once), the stream, the iteration
+ * and, for halo update nodes, the number of bytes moved between partitions.
+ * The records are aggregated per node of the skeleton graph: containers with the same name, or the halo
+ * updates of the same field at different points of a sequence, have separate entries. The name of a node
+ * (container name and data view, or halo update of a field) is only used as a label.
+ * The records can be exported as a Chrome trace (chrome://tracing or https://ui.perfetto.dev).
+ *
+ * Per-partition times are only available with Executor::ompAtGraphLevel, where the scheduler runs
+ * each node once per partition. With Executor::ompAtNodeLevel (the default) a node runs all the
+ * partitions in one call and is recorded once, with partition -1.
+ *
+ * Times are measured on the host: with asynchronous streams (CUDA or CPU streams) a node only
+ * measures the time to enqueue its work unless syncEachNode is set, in which case the stream of
+ * the node is synchronized after the node, at the cost of serializing the streams.
+ * Skeletons without a profiler do not pay any cost.
+ */
+class Profiler
+{
+   public:
+    /**
+     * Type of a profiled node
+     */
+    enum class NodeKind
+    {
+        container = 0,
+        haloUpdate = 1,
+        sync = 2
+    };
+
+    static auto toString(NodeKind kind) -> std::string;
+
+    /**
+     * Aggregated statistics of the runs of a node
+     */
+    struct Stats
+    {
+        uint64_t    nodeId{0};
+        std::string name;
+        NodeKind    kind{NodeKind::container};
+        int         count{0};
+        double      totalMs{0};
+        double      meanMs{0};
+        double      p50Ms{0};
+        double      p99Ms{0};
+        uint64_t    bytes{0} /**< bytes moved by all the runs of a halo update node */;
+    };
+
+    explicit Profiler(bool syncEachNode = false);
+
+    /**
+     * True if the stream of a node is synchronized before the end time of the node is recorded
+     */
+    auto syncEachNode() const -> bool;
+
+    /**
+     * Returns the key of the node with the given id, registering it with the given label the first time.
+     * Skeletons built from the same cached graph share the node ids, and therefore the entries.
+     */
+    auto registerNode(uint64_t           nodeId,
+                      const std::string& name,
+                      NodeKind           kind) -> int;
+
+    /**
+     * Marks the beginning of a new iteration of a skeleton
+     */
+    auto beginIteration() -> void;
+
+    /**
+     * Nanoseconds elapsed since the creation of the profiler
+     */
+    auto now() const -> int64_t
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mOrigin).count();
+    }
+
+    /**
+     * Records a run of a node
+     */
+    auto record(int      nodeKey,
+                int      setIdx /**< partition of the run, -1 for all the partitions */,
+                int      streamIdx,
+                int64_t  startNs,
+                int64_t  endNs,
+                uint64_t bytes) -> void;
+
+    /**
+     * Number of iterations recorded so far
+     */
+    auto nIterations() const -> int;
+
+    /**
+     * Statistics of each node, in the order the nodes were registered
+     */
+    auto stats() const -> std::vector<Stats>;
+
+    /**
+     * Adds the statistics of each node to the report.
+     * Nodes sharing a label are told apart by their registration order (e.g. AXPY_STANDARD#1)
+     */
+    auto toReport(Neon::Report&            report,
+                  Neon::Report::SubBlock* subdocAPI = nullptr) const -> void;
+
+    /**
+     * Writes all the records as a Chrome trace JSON file:
+     * a row per partition (process) and stream (thread)
+     */
+    auto ioToChromeTrace(const std::string& fname) const -> void;
+
+    /**
+     * Drops all the records, the registered nodes are kept
+     */
+    auto clear() -> void;
+
+   private:
+    struct Node
+    {
+        uint64_t    nodeId;
+        std::string name;
+        NodeKind    kind;
+    };
+
+    struct Record
+    {
+        int      nodeKey;
+        int      iteration;
+        int      setIdx;
+        int      streamIdx;
+        int64_t  startNs;
+        int64_t  endNs;
+        uint64_t bytes;
+    };
+
+    bool                                  mSyncEachNode{false};
+    std::chrono::steady_clock::time_point mOrigin;
+    int                                   mIteration{0};
+    std::vector<Node>                     mNodes;
+    std::unordered_map<uint64_t, int>     mNodeKeys;
+    std::vector<Record>                   mRecords;
+    mutable std::mutex                    mMutex;
+};
+
+}  // namespace Neon::skeleton
@@ -1,7 +1,13 @@
 #pragma once
+#include <functional>
+#include <memory>
+
+#include "Neon/domain/patterns/PatternScalar.h"
 #include "Neon/set/Backend.h"
 #include "Neon/set/Containter.h"
 #include "Neon/skeleton/Options.h"
+#include "Neon/skeleton/Profiler.h"
+#include "Neon/skeleton/internal/GraphCache.h"
 #include "Neon/skeleton/internal/MultiGpuGraph.h"
 #include "Neon/skeleton/internal/StreamScheduler.h"
 
@@ -36,13 +42,105 @@ struct Skeleton
             exp << "A backend was not set";
             NEON_THROW(exp);
         }
+        if (options.executor() == Executor::ompAtGraphLevel && mBackend.hasCpuZeroCopyHalo()) {
+            // The partitions would read the halos of neighbours that are not synchronized with them
+            NeonException exp("Skeleton");
+            exp << "The graph level executor can not be used on a backend with zero-copy halos";
+            NEON_THROW(exp);
+        }
         mOptions = options;
-        mMultiGraph.init(mBackend, operations, name, options);
-        // m_multiGraph.io2Dot("DB_multiGpuGraph", "graphname");
-        mStreamScheduler.init(mBackend, mMultiGraph);
-        // m_streamScheduler.io2Dot("DB_streamScheduler", "graphname");
+
+        // Sequences with the same structure share the same graph and schedule
+        auto&             cache = internal::GraphCache::global();
+        const bool        useCache = options.graphCache() && cache.isEnabled();
+        const std::string key = useCache ? internal::GraphCache::key(mBackend, operations, options) : "";
+        auto              entry = useCache ? cache.find(key) : nullptr;
+        if (entry) {
+            mMultiGraph = entry->graph.cloneWith(operations);
+            mStreamScheduler = entry->scheduler.cloneFor(mBackend, mMultiGraph);
+        } else {
+            mMultiGraph = internal::MultiGpuGraph();
+            mMultiGraph.init(mBackend, operations, name, options);
+            // m_multiGraph.io2Dot("DB_multiGpuGraph", "graphname");
+            mStreamScheduler.init(mBackend, mMultiGraph);
+            // m_streamScheduler.io2Dot("DB_streamScheduler", "graphname");
+            if (useCache) {
+                cache.insert(key, mBackend, mMultiGraph, mStreamScheduler);
+            }
+        }
+        if (mProfiler) {
+            mStreamScheduler.setProfiler(mProfiler);
+        }
+        mHasSequence = true;
+        mMaxIterations = 1;
+        mPredicate = nullptr;
+        mIterations = 0;
+    }
+
+    /**
+     * Same as sequence but each call to run executes the operations nIterations times.
+     * The iterations are executed back-to-back by the stream scheduler on the same graph:
+     * they are only ordered by a fence on the streams and the host waits for the end of the last one.
+     */
+    void loop(const std::vector<Neon::set::Container>& operations,
+              int                                      nIterations,
+              std::string                              name,
+              Options                                  options = Options())
+    {
+        sequence(operations, name, options);
+        mMaxIterations = nIterations;
+    }
+
+    /**
+     * Same as sequence but each call to run executes the operations until the predicate,
+     * evaluated on the scalar every Options::loopCheckPeriod() iterations, returns false (do-while semantic)
+     * or maxIterations iterations have been executed.
+     * Between two evaluations the iterations are executed back-to-back as in loop.
+     * The scalar is expected to be computed by one of the operations (e.g. a dot container)
+     * and, as for the containers, it is captured by reference.
+     */
+    template <typename T>
+    void whileLoop(const std::vector<Neon::set::Container>& operations,
+                   Neon::PatternScalar<T>&                  scalar,
+                   std::function<bool(const T&)>            predicate,
+                   int                                      maxIterations,
+                   std::string                              name,
+                   Options                                  options = Options())
+    {
+        sequence(operations, name, options);
+        mMaxIterations = maxIterations;
+        mPredicate = [&scalar, predicate]() -> bool {
+            return predicate(scalar());
+        };
     }
 
+    /**
+     * Number of iterations executed by the last call to run
+     */
+    auto getIterations() const -> int
+    {
+        return mIterations;
+    }
+
+
+    /**
+     * Attaches a profiler that records the execution of every node of the skeleton.
+     * The profiler is kept across calls to sequence and can be shared among skeletons.
+     * A null profiler disables the profiling.
+     * Nodes are timed per partition only with Executor::ompAtGraphLevel (see Profiler).
+     */
+    void setProfiler(std::shared_ptr<Neon::skeleton::Profiler> profiler)
+    {
+        mProfiler = std::move(profiler);
+        if (mHasSequence) {
+            mStreamScheduler.setProfiler(mProfiler);
+        }
+    }
+
+    auto getProfiler() const -> std::shared_ptr<Neon::skeleton::Profiler>
+    {
+        return mProfiler;
+    }
 
     void ioToDot(std::string fname, std::string graphname = "")
     {
@@ -54,7 +152,7 @@ struct Skeleton
 
     void run()
     {
-        mStreamScheduler.run(mOptions);
+        mIterations = mStreamScheduler.run(mOptions, mMaxIterations, mPredicate);
     }
 
    private:
@@ -63,7 +161,14 @@ struct Skeleton
     Neon::skeleton::internal::MultiGpuGraph   mMultiGraph;
     Neon::skeleton::internal::StreamScheduler mStreamScheduler;
 
+    int                   mMaxIterations = 1;
+    int                   mIterations = 0;
+    std::function<bool()> mPredicate;
+
+    std::shared_ptr<Neon::skeleton::Profiler> mProfiler;
+
     bool m_inited = {false};
+    bool mHasSequence = {false};
 };
 
 }  // namespace Neon::skeleton
@@ -0,0 +1,96 @@
+#pragma once
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "Neon/set/Backend.h"
+#include "Neon/set/Containter.h"
+#include "Neon/skeleton/Options.h"
+#include "Neon/skeleton/internal/MultiGpuGraph.h"
+#include "Neon/skeleton/internal/StreamScheduler.h"
+
+namespace Neon::skeleton::internal {
+
+/**
+ * Process wide cache of scheduled skeleton graphs, used by the sequences that enable it in their Options.
+ *
+ * Building a skeleton (container parsing, dependency analysis, OCC transformations and stream/event scheduling)
+ * only depends on the structure of the sequence: the backend, the options and, for each container,
+ * its name, type, data view support and data tokens (role of the data in the sequence, access and compute type).
+ * Sequences with the same structure therefore share the same scheduled graph, which is cloned
+ * and bound to the new containers instead of being rebuilt.
+ *
+ * Only the structure of the graphs is stored: the entries do not keep any user container,
+ * field or halo update operation alive. The number of entries is bounded (LRU policy).
+ */
+class GraphCache
+{
+   public:
+    /**
+     * Scheduled graph stored in the cache
+     */
+    struct Entry
+    {
+        MultiGpuGraph   graph;
+        StreamScheduler scheduler;
+    };
+
+    /**
+     * The cache shared by all the skeletons
+     */
+    static auto global() -> GraphCache&;
+
+    /**
+     * Structural key of a sequence. Containers that have not been parsed yet are parsed.
+     */
+    static auto key(const Neon::Backend&                     bk,
+                    const std::vector<Neon::set::Container>& operations,
+                    const Options&                           options) -> std::string;
+
+    /**
+     * Return the entry associated to the key or nullptr
+     */
+    auto find(const std::string& key) -> std::shared_ptr<const Entry>;
+
+    /**
+     * Store a copy of a scheduled graph, which is detached from its containers (see MultiGpuGraph::detach)
+     */
+    auto insert(const std::string&     key,
+                Neon::Backend&         bk,
+                const MultiGpuGraph&   graph,
+                const StreamScheduler& scheduler) -> void;
+
+    auto clear() -> void;
+
+    /**
+     * Enable or disable the cache for all the sequences (enabled by default),
+     * the sequences still have to opt in through Options::setGraphCache. Disabling it also clears it.
+     */
+    auto setEnabled(bool enabled) -> void;
+    auto isEnabled() const -> bool;
+
+    /**
+     * Maximum number of stored graphs
+     */
+    auto setCapacity(size_t capacity) -> void;
+
+    auto size() const -> size_t;
+    auto hits() const -> size_t;
+    auto misses() const -> size_t;
+
+   private:
+    using LruList = std::list<std::pair<std::string, std::shared_ptr<const Entry>>>;
+
+    auto helpEvict() -> void;
+
+    mutable std::mutex                                   mMutex;
+    LruList                                              mLru;
+    std::unordered_map<std::string, LruList::iterator>   mIndex;
+    size_t                                               mCapacity = 64;
+    size_t                                               mHits = 0;
+    size_t                                               mMisses = 0;
+    bool                                                 mEnabled = true;
+};
+
+}  // namespace Neon::skeleton::internal
@@ -1,5 +1,6 @@
 #pragma once
 #include <list>
+#include "Neon/core/types/CsrDiGraph.h"
 #include "Neon/core/types/digraph.h"
 #include "Neon/set//Containter.h"
 #include "Neon/set/Backend.h"
@@ -31,6 +32,29 @@ struct MultiGpuGraph
               std::string                              name,
               Options                                  options);
 
+    /**
+     * Distinct uids of the data loaded by a list of containers, in order of first use.
+     * The position of a uid in the list is the role of the data in the sequence,
+     * which is what identifies the data of a graph once it is detached from its containers.
+     */
+    static auto sequenceDataUids(const std::vector<Neon::set::Container>& operations)
+        -> std::vector<Neon::set::MultiDeviceObjectUid>;
+
+    /**
+     * Return a deep copy of the structure of this graph, which does not reference
+     * any user container, field or halo update operation.
+     * The data of the halo update and left-right sync nodes is identified by its role in the sequence.
+     */
+    auto detach() const -> MultiGpuGraph;
+
+    /**
+     * Return a deep copy of a detached graph bound to another list of containers.
+     * The new containers must be structurally identical to the ones used by init
+     * (same order, types and data tokens, up to the uids of the data), which is what the graph cache verifies.
+     * Halo update nodes are bound to the fields loaded by the new containers in the same role.
+     */
+    auto cloneWith(const std::vector<Neon::set::Container>& operations) const -> MultiGpuGraph;
+
     /**
      * Function to retrieve the container index in the user container list
      * @param id
@@ -258,6 +282,12 @@ struct MultiGpuGraph
                                 Neon::set::TransferMode transferModeE = Neon::set::TransferMode::put)
         -> void;
 
+    /**
+     * Merges the halo update nodes feeding the same container into one batched exchange
+     * (see Neon::skeleton::Options::setHaloUpdateBatching)
+     */
+    auto h_mergeHaloUpdates() -> void;
+
     auto optimizeStandardOCC(const Neon::skeleton::Options&) -> void;
 
     auto optimizeExtendedOCC(const Neon::skeleton::Options&) -> void;
@@ -1,5 +1,8 @@
 #pragma once
+#include <functional>
+#include <memory>
 #include <unordered_set>
+#include "Neon/skeleton/Profiler.h"
 #include "Neon/skeleton/internal/MultiGpuGraph.h"
 
 namespace Neon::skeleton::internal {
@@ -52,8 +55,21 @@ class StreamScheduler
         {
         }
         std::vector<MetaNodeExtended> m_metaNodeExtendedList;
+        int                           m_nUserEvents = 0;
         bool                          useFullBarrierOnAllStreamsAtTheEnd = true;
         bool                          canEndNodeLastBarrierBeOptimizedOut = false;
+
+        std::shared_ptr<Neon::skeleton::Profiler> m_profiler;
+        std::vector<int>                          m_profilerKeys; /** profiler key of each node of m_executionOrder, -1 if not profiled */
+
+        /**
+         * User events of the fence between two iterations of a loop (see Backend::streamFence),
+         * they follow the m_nUserEvents events of the graph
+         */
+        auto helpNLoopFenceEvents() const -> int
+        {
+            return int(m_streamFlags.size()) + 1;
+        }
     };
 
     std::shared_ptr<Storage> m_storage;
@@ -61,6 +77,12 @@ class StreamScheduler
    public:
     auto init(Neon::Backend& bk, MultiGpuGraph& multiGpuGraph) -> void;
 
+    /**
+     * Return a copy of this schedule for the given graph, which must be a clone of the scheduled one.
+     * The streams and events required by the schedule are reserved again on the backend.
+     */
+    auto cloneFor(Neon::Backend& bk, MultiGpuGraph& multiGpuGraph) const -> StreamScheduler;
+
     /**
      * Returns number of levels
      * @return
@@ -140,32 +162,49 @@ class StreamScheduler
      */
     auto run(const Neon::skeleton::Options& options) -> void;
 
+    /**
+     * Execute the graph up to maxIterations times back-to-back.
+     * Every options.loopCheckPeriod() iterations the predicate (if any) is evaluated and the loop stops when it returns false.
+     * The loop runs on the host: the iterations that evaluate the predicate, and the last one, end with the
+     * synchronization of the graph (final barrier or reduction); the others are only ordered by a fence
+     * on the streams, so the host enqueues the next iteration without waiting. There is no in-graph control flow.
+     * @return the number of executed iterations
+     */
+    auto run(const Neon::skeleton::Options& options,
+             int                            maxIterations,
+             const std::function<bool()>&   predicate) -> int;
+
+    /**
+     * Records the execution of the nodes with the profiler, nullptr disables the profiling
+     */
+    auto setProfiler(std::shared_ptr<Neon::skeleton::Profiler> profiler) -> void;
+
    private:
     auto h_getMetaNodeExtended(NodeId id) -> MetaNodeExtended&;
     auto h_getMetaNodeExtended(MetaNode& id) -> MetaNodeExtended&;
     auto h_getMetaNode(NodeId id) -> MetaNode&;
 
-    auto helpRunOmpAtGraphLevel() -> void;
-    auto helpRunOmpAtNodeLevel() -> void;
+    /**
+     * Execute the graph once, without the final barrier when endBarrier is false:
+     * the iteration is then followed by a fence on the streams
+     */
+    auto helpRunIteration(const Neon::skeleton::Options& options,
+                          bool                           endBarrier) -> void;
 
-    template <typename Graph>
-    auto h_dissolveDataDependencies(Graph& graph, NodeId nodeId) -> void
-    {
-        // helper function to update the dependency count of child nodes
-        auto outNeighbours = graph.outNeighbors(nodeId);
-        for (const auto& ngh : outNeighbours) {
-            auto& metaNodeExtended = h_getMetaNodeExtended(ngh);
-            // std::cout << "Node " << nodeId << " dissolve " << ngh << " from " << metaNodeExtended.blockingDependencies << " to " << metaNodeExtended.blockingDependencies - 1 << std::endl;
-            metaNodeExtended.blockingDependencies--;
-        }
-        //        for (auto huNode : h_getMetaNodeExtended(nodeId).childHaloNodes) {
-        //            h_dissolveDataDependencies(huNode);
-        //        }
-    };
+    template <bool withProfiler>
+    auto helpRunOmpAtGraphLevel(bool endBarrier) -> void;
+    template <bool withProfiler>
+    auto helpRunOmpAtNodeLevel(bool endBarrier) -> void;
+
+    /**
+     * Fill the levels following the longest path from the root of the graph
+     */
+    auto helpFillLevels(const Neon::CsrDiGraph& graph) -> void;
 
     auto helpRun(NodeId nodeId, StreamIdx streamIdx) -> void;
     auto helpRun(Neon::SetIdx setIdx, NodeId nodeId, StreamIdx streamIdx) -> void;
     auto helpNvtxName(NodeId nodeId) -> std::string;
+    auto helpProfilerKey(NodeId nodeId) -> int;
     auto helpWaitForEventCompletion(StreamIdx streamIdx, EventIdx eventIdx) -> void;
     auto helpWaitForEventCompletion(Neon::SetIdx setIdx, StreamIdx streamIdx, EventIdx eventIdx) -> void;
     auto helpEnqueueEvent(StreamIdx streamIdx, EventIdx eventIdx) -> void;
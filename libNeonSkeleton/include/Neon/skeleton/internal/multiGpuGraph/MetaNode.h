@@ -43,8 +43,9 @@ struct MetaNode
     Neon::DataView m_dataView{Neon::DataView::STANDARD};
     Neon::Compute  m_compute{Neon::Compute::MAP};
 
-    Neon::set::TransferMode         m_transferMode{Neon::set::TransferMode::get};
-    Neon::set::MultiDeviceObjectUid m_uid;
+    Neon::set::TransferMode                      m_transferMode{Neon::set::TransferMode::get};
+    Neon::set::MultiDeviceObjectUid              m_uid;
+    std::vector<Neon::set::MultiDeviceObjectUid> m_batchedUids; /** fields of the halo updates merged into this node, m_uid first */
 
     size_t m_linearContinuousIndex = 0; /** this index is created when any change to the graph has been completed.
                                          * It provides a way to associate data to nodes by the means of vectors
@@ -52,8 +53,8 @@ struct MetaNode
 
     bool m_hasCoherentInput = false;
 
-    std::function<void(Neon::set::HuOptions& opt)>               m_hu;
-    std::function<void(Neon::SetIdx, Neon::set::HuOptions& opt)> m_huPerDevice;
+    std::vector<std::function<void(Neon::set::HuOptions& opt)>>               m_hu;
+    std::vector<std::function<void(Neon::SetIdx, Neon::set::HuOptions& opt)>> m_huPerDevice;
 
     struct cudaGraphHandles_t
     {
@@ -127,10 +128,42 @@ struct MetaNode
 
     auto isHu() const -> bool;
 
+    /**
+     * Runs the halo updates of all the fields of the node, one after the other
+     */
     auto hu(Neon::set::HuOptions& opt) -> void;
 
     auto hu(Neon::SetIdx setIdx, Neon::set::HuOptions& opt) -> void;
 
+    /**
+     * Replace the halo update operations of a field of the node,
+     * used to bind a halo update node to a new set of containers
+     */
+    auto setHu(int                                                                 fieldIdx,
+               const std::function<void(Neon::set::HuOptions& opt)>&               hu,
+               const std::function<void(Neon::SetIdx, Neon::set::HuOptions& opt)>& huPerDevice) -> void;
+
+    /**
+     * Replace the uid of a field of a halo update or left-right sync node
+     */
+    auto setDataUid(int fieldIdx, const Neon::set::MultiDeviceObjectUid& uid) -> void;
+
+    /**
+     * Moves the fields of another halo update (or left-right sync) node into this one,
+     * so that a single node exchanges the halos of all of them
+     */
+    auto mergeHaloUpdate(const MetaNode& other) -> void;
+
+    /**
+     * Uid of the first field of the node
+     */
+    auto getDataUid() const -> const Neon::set::MultiDeviceObjectUid&;
+
+    /**
+     * Uids of all the fields of a halo update or left-right sync node
+     */
+    auto getDataUids() const -> const std::vector<Neon::set::MultiDeviceObjectUid>&;
+
     auto transferMode() const -> Neon::set::TransferMode;
 
     auto setLinearContinuousIndex(size_t id) -> void;
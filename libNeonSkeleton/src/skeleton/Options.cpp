@@ -16,6 +16,9 @@ void Options::reportStore(Neon::Report& report)
     auto subdoc = report.getSubdoc();
     report.addMember("OCC", OccUtils::toString(mOcc), &subdoc);
     report.addMember("TransferMode", Neon::set::TransferModeUtils::toString(mTransferMode), &subdoc);
+    report.addMember("HaloUpdateBatching", mHaloUpdateBatching, &subdoc);
+    report.addMember("GraphCache", mGraphCache, &subdoc);
+    report.addMember("LoopCheckPeriod", mLoopCheckPeriod, &subdoc);
     report.addSubdoc("SkeletonOptions", subdoc);
 }
 
@@ -33,5 +36,49 @@ auto Options::executor() const -> Neon::skeleton::Executor
     return mExecutor;
 }
 
+auto Options::setExecutor(Neon::skeleton::Executor executor) -> Options&
+{
+    mExecutor = executor;
+    return *this;
+}
+
+auto Options::setHaloUpdateBatching(bool enable) -> Options&
+{
+    mHaloUpdateBatching = enable;
+    return *this;
+}
+
+auto Options::haloUpdateBatching() const -> bool
+{
+    return mHaloUpdateBatching;
+}
+
+auto Options::setGraphCache(bool enable) -> Options&
+{
+    mGraphCache = enable;
+    return *this;
+}
+
+auto Options::graphCache() const -> bool
+{
+    return mGraphCache;
+}
+
+auto Options::setLoopCheckPeriod(int period) -> Options&
+{
+    if (period < 1) {
+        NeonException exp("Options");
+        exp << "The loop check period must be at least one iteration, it is " << period;
+        NEON_THROW(exp);
+    }
+    mLoopCheckPeriod = period;
+    return *this;
+}
+
+auto Options::loopCheckPeriod() const -> int
+{
+    return mLoopCheckPeriod;
+}
+
 }  // namespace skeleton
 }  // namespace Neon
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "Neon/skeleton/Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+#include "Neon/core/core.h"
+
+namespace Neon::skeleton {
+
+namespace {
+auto escapeJson(const std::string& str) -> std::string
+{
+    std::string ret;
+    for (char c : str) {
+        switch (c) {
+            case '"': {
+                ret += "\\\"";
+                break;
+            }
+            case '\\': {
+                ret += "\\\\";
+                break;
+            }
+            case '\n': {
+                ret += "\\n";
+                break;
+            }
+            default: {
+                ret += c;
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * Nearest rank percentile of a sorted vector
+ */
+auto percentile(const std::vector<double>& sorted, double p) -> double
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+    const size_t rank = size_t(std::max(1.0, std::ceil(p * double(sorted.size()))));
+    return sorted[std::min(rank, sorted.size()) - 1];
+}
+}  // namespace
+
+auto Profiler::toString(NodeKind kind) -> std::string
+{
+    switch (kind) {
+        case NodeKind::container: {
+            return "container";
+        }
+        case NodeKind::haloUpdate: {
+            return "haloUpdate";
+        }
+        case NodeKind::sync: {
+            return "sync";
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+Profiler::Profiler(bool syncEachNode)
+    : mSyncEachNode(syncEachNode),
+      mOrigin(std::chrono::steady_clock::now())
+{
+}
+
+auto Profiler::syncEachNode() const -> bool
+{
+    return mSyncEachNode;
+}
+
+auto Profiler::registerNode(uint64_t           nodeId,
+                            const std::string& name,
+                            NodeKind           kind) -> int
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto                        it = mNodeKeys.find(nodeId);
+    if (it != mNodeKeys.end()) {
+        return it->second;
+    }
+    const int key = int(mNodes.size());
+    mNodes.push_back({nodeId, name, kind});
+    mNodeKeys[nodeId] = key;
+    return key;
+}
+
+auto Profiler::beginIteration() -> void
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mIteration++;
+}
+
+auto Profiler::record(int      nodeKey,
+                      int      setIdx,
+                      int      streamIdx,
+                      int64_t  startNs,
+                      int64_t  endNs,
+                      uint64_t bytes) -> void
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRecords.push_back({nodeKey, mIteration - 1, setIdx, streamIdx, startNs, endNs, bytes});
+}
+
+auto Profiler::nIterations() const -> int
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mIteration;
+}
+
+auto Profiler::stats() const -> std::vector<Stats>
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    std::vector<std::vector<double>> durations(mNodes.size());
+    std::vector<Stats>               ret(mNodes.size());
+    for (size_t i = 0; i < mNodes.size(); i++) {
+        ret[i].nodeId = mNodes[i].nodeId;
+        ret[i].name = mNodes[i].name;
+        ret[i].kind = mNodes[i].kind;
+    }
+    for (const auto& r : mRecords) {
+        durations[r.nodeKey].push_back(double(r.endNs - r.startNs) * 1e-6);
+        ret[r.nodeKey].bytes += r.bytes;
+    }
+    for (size_t i = 0; i < mNodes.size(); i++) {
+        auto& d = durations[i];
+        std::sort(d.begin(), d.end());
+        ret[i].count = int(d.size());
+        for (double ms : d) {
+            ret[i].totalMs += ms;
+        }
+        ret[i].meanMs = d.empty() ? 0 : ret[i].totalMs / double(d.size());
+        ret[i].p50Ms = percentile(d, 0.50);
+        ret[i].p99Ms = percentile(d, 0.99);
+    }
+    return ret;
+}
+
+auto Profiler::toReport(Neon::Report&            report,
+                        Neon::Report::SubBlock* subdocAPI) const -> void
+{
+    Report::SubBlock* targetSubDoc = subdocAPI;
+    Report::SubBlock  tmp;
+    if (nullptr == subdocAPI) {
+        tmp = report.getSubdoc();
+        targetSubDoc = &tmp;
+    }
+
+    report.addMember("Iterations", int32_t(nIterations()), targetSubDoc);
+    const auto allStats = stats();
+
+    // The keys of the report must be unique and stable across runs, unlike the node ids
+    std::unordered_map<std::string, int> nWithName;
+    for (const auto& s : allStats) {
+        nWithName[s.name]++;
+    }
+    std::unordered_map<std::string, int> occurrence;
+    for (const auto& s : allStats) {
+        std::string key = s.name;
+        if (nWithName[s.name] > 1) {
+            key += "#" + std::to_string(occurrence[s.name]++);
+        }
+        report.addMember(key + ".kind", toString(s.kind), targetSubDoc);
+        report.addMember(key + ".count", int32_t(s.count), targetSubDoc);
+        report.addMember(key + ".totalMs", s.totalMs, targetSubDoc);
+        report.addMember(key + ".meanMs", s.meanMs, targetSubDoc);
+        report.addMember(key + ".p50Ms", s.p50Ms, targetSubDoc);
+        report.addMember(key + ".p99Ms", s.p99Ms, targetSubDoc);
+        if (s.kind == NodeKind::haloUpdate) {
+            report.addMember(key + ".bytes", s.bytes, targetSubDoc);
+        }
+    }
+
+    if (nullptr == subdocAPI) {
+        report.addSubdoc("SkeletonProfile", *targetSubDoc);
+    }
+}
+
+auto Profiler::ioToChromeTrace(const std::string& fname) const -> void
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    std::ofstream out(fname);
+    if (!out) {
+        NeonException exp("Profiler");
+        exp << "Unable to open " << fname;
+        NEON_THROW(exp);
+    }
+
+    // Partitions are processes (pid 0 for the nodes running on all the partitions) and streams are threads
+    auto pidOf = [](int setIdx) { return setIdx + 1; };
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto separator = [&]() {
+        if (!first) {
+            out << ",";
+        }
+        first = false;
+        out << "\n";
+    };
+
+    std::set<int>                 pids;
+    std::set<std::pair<int, int>> tids;
+    for (const auto& r : mRecords) {
+        pids.insert(pidOf(r.setIdx));
+        tids.insert({pidOf(r.setIdx), r.streamIdx});
+    }
+    for (int pid : pids) {
+        separator();
+        const std::string name = pid == 0 ? "All partitions" : "Partition " + std::to_string(pid - 1);
+        out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+            << ",\"args\":{\"name\":\"" << name << "\"}}";
+        separator();
+        out << "{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":" << pid
+            << ",\"args\":{\"sort_index\":" << pid << "}}";
+    }
+    for (const auto& [pid, streamIdx] : tids) {
+        separator();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << streamIdx
+            << ",\"args\":{\"name\":\"Stream " << streamIdx << "\"}}";
+    }
+
+    out.precision(3);
+    out << std::fixed;
+    for (const auto& r : mRecords) {
+        const Node& node = mNodes[r.nodeKey];
+        separator();
+        out << "{\"name\":\"" << escapeJson(node.name) << "\""
+            << ",\"cat\":\"" << toString(node.kind) << "\""
+            << ",\"ph\":\"X\""
+            << ",\"ts\":" << double(r.startNs) * 1e-3
+            << ",\"dur\":" << double(r.endNs - r.startNs) * 1e-3
+            << ",\"pid\":" << pidOf(r.setIdx)
+            << ",\"tid\":" << r.streamIdx
+            << ",\"args\":{\"node\":" << node.nodeId
+            << ",\"iteration\":" << r.iteration;
+        if (node.kind == NodeKind::haloUpdate) {
+            out << ",\"bytes\":" << r.bytes;
+        }
+        out << "}}";
+    }
+    out << "\n]}\n";
+}
+
+auto Profiler::clear() -> void
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRecords.clear();
+    mIteration = 0;
+}
+
+}  // namespace Neon::skeleton
@@ -0,0 +1,151 @@
+#include "Neon/skeleton/internal/GraphCache.h"
+#include <algorithm>
+#include <sstream>
+
+namespace Neon::skeleton::internal {
+
+auto GraphCache::global() -> GraphCache&
+{
+    static GraphCache cache;
+    return cache;
+}
+
+auto GraphCache::key(const Neon::Backend&                     bk,
+                     const std::vector<Neon::set::Container>& operations,
+                     const Options&                           options) -> std::string
+{
+    std::stringstream s;
+    s << "rt:" << int(bk.runtime())
+      << "|dev:";
+    for (auto const& id : bk.devSet().devId().vec()) {
+        s << id << ",";
+    }
+    s << "|occ:" << int(options.occ())
+      << "|tr:" << int(options.transferMode())
+      << "|ex:" << int(options.executor())
+      << "|hb:" << int(options.haloUpdateBatching());
+
+    for (auto container : operations) {
+        auto& kcInterface = container.getContainerInterface();
+        if (kcInterface.getTokens().empty()) {
+            kcInterface.parse();
+        }
+    }
+    // The data is identified by its role in the sequence, not by its uid,
+    // so that the same sequence on other fields shares the graph
+    const auto uids = MultiGpuGraph::sequenceDataUids(operations);
+    for (auto container : operations) {
+        auto& kcInterface = container.getContainerInterface();
+        s << "|" << kcInterface.getName()
+          << ":" << int(kcInterface.getContainerType())
+          << ":" << int(kcInterface.getDataViewSupport());
+        for (auto const& token : kcInterface.getTokens()) {
+            s << "[" << std::find(uids.begin(), uids.end(), token.uid()) - uids.begin()
+              << "," << int(token.access())
+              << "," << int(token.compute()) << "]";
+        }
+    }
+    return s.str();
+}
+
+auto GraphCache::find(const std::string& key) -> std::shared_ptr<const Entry>
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mEnabled) {
+        return nullptr;
+    }
+    auto it = mIndex.find(key);
+    if (it == mIndex.end()) {
+        mMisses++;
+        return nullptr;
+    }
+    mHits++;
+    mLru.splice(mLru.begin(), mLru, it->second);
+    return it->second->second;
+}
+
+auto GraphCache::insert(const std::string&     key,
+                        Neon::Backend&         bk,
+                        const MultiGpuGraph&   graph,
+                        const StreamScheduler& scheduler) -> void
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mEnabled || mCapacity == 0) {
+        return;
+    }
+    // The scheduler keeps a reference to its graph:
+    // the entry is allocated first so that the graph address does not change.
+    auto entry = std::make_shared<Entry>();
+    entry->graph = graph.detach();
+    entry->scheduler = scheduler.cloneFor(bk, entry->graph);
+
+    auto it = mIndex.find(key);
+    if (it != mIndex.end()) {
+        mLru.erase(it->second);
+        mIndex.erase(it);
+    }
+    mLru.emplace_front(key, entry);
+    mIndex[key] = mLru.begin();
+    helpEvict();
+}
+
+auto GraphCache::clear() -> void
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mLru.clear();
+    mIndex.clear();
+    mHits = 0;
+    mMisses = 0;
+}
+
+auto GraphCache::setEnabled(bool enabled) -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEnabled = enabled;
+    }
+    if (!enabled) {
+        clear();
+    }
+}
+
+auto GraphCache::isEnabled() const -> bool
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEnabled;
+}
+
+auto GraphCache::setCapacity(size_t capacity) -> void
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mCapacity = capacity;
+    helpEvict();
+}
+
+auto GraphCache::size() const -> size_t
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mLru.size();
+}
+
+auto GraphCache::hits() const -> size_t
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mHits;
+}
+
+auto GraphCache::misses() const -> size_t
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMisses;
+}
+
+auto GraphCache::helpEvict() -> void
+{
+    while (mLru.size() > mCapacity) {
+        mIndex.erase(mLru.back().first);
+        mLru.pop_back();
+    }
+}
+
+}  // namespace Neon::skeleton::internal
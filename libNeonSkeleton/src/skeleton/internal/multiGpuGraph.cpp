@@ -1,5 +1,8 @@
 #include "Neon/skeleton/internal/MultiGpuGraph.h"
+#include <algorithm>
 #include <list>
+#include <map>
+#include <unordered_map>
 
 namespace Neon::skeleton::internal {
 
@@ -29,6 +32,9 @@ void MultiGpuGraph::init(Neon::Backend&                           bk,
     optimizations(options);
     h_io2Dot("t1_" + name + ".dot", "i");
     addSyncAndMemoryTransfers(options);
+    if (options.haloUpdateBatching()) {
+        h_mergeHaloUpdates();
+    }
     h_removeRedundantDependencies();
     checkCoherency();
     h_io2Dot("t2_" + name + ".dot", "i");
@@ -153,13 +159,22 @@ auto MultiGpuGraph::h_closure(const std::vector<std::tuple<size_t, Edge>>& speci
         }
     });
 
+    // A container may load several stencil fields that are not written by the previous containers:
+    // the root edge of the container carries all of them
+    std::set<size_t> closedNodes;
     for (auto& specialClosureNode : specialClosureNodes) {
         size_t node_t0 = m_rootNodeId();
         size_t node_t1 = std::get<size_t>(specialClosureNode);
         auto&  edgeMetaData = std::get<Edge>(specialClosureNode);
         if (m_graph().hasEdge({node_t0, node_t1})) {
             Edge& edge = m_graph().getEdgeProperty({node_t0, node_t1});
-            edge = edgeMetaData;
+            if (closedNodes.insert(node_t1).second) {
+                edge = edgeMetaData;
+            } else {
+                for (const auto& info : edgeMetaData.info()) {
+                    edge.infoMutable().push_back(info);
+                }
+            }
         }
     }
     this->h_io2Dot("DB.dot", "");
@@ -173,6 +188,11 @@ auto MultiGpuGraph::h_parse(ContainerIdx kernelContainerIdx)
 {
     auto& container = getContainer(kernelContainerIdx);
     auto& kcInterface = container.getContainerInterface();
+    // A container keeps its tokens once parsed (e.g. by the graph cache),
+    // parsing it again would duplicate them
+    if (!kcInterface.getTokens().empty()) {
+        return kcInterface.getTokens();
+    }
     auto& tokens = kcInterface.parse();
     return tokens;
 }
@@ -333,54 +353,18 @@ auto MultiGpuGraph::h_trackNewContainer(const Neon::set::Container& container,
 
 auto MultiGpuGraph::h_removeRedundantDependencies() -> void
 {
-    std::vector<std::pair<size_t, size_t>> edgesToBeRemoved;
-    m_graph().forEachVertex([&](size_t node) {
-        // Looping over all nodes
-        const auto& children = m_graph().outNeighbors(node);
-        // Checking sons. If no more than one, move to the next node
-        if (children.size() <= 1) {
-            return;
-        }
-        for (const auto& child : children) {
-            if (m_graph().inEdges(child).size() <= 1) {
-                // This child can only be reach by once father
-                // No redundant path here
-                continue;
-            }
-            bool foundRedundant = false;
-            for (const auto& sibling : children) {
-                if (sibling == child) {
-                    continue;
-                }
-                auto frontiar = m_graph().outNeighbors(sibling);
-                while (frontiar.size() != 0) {
-                    auto nextFrontiar = std::set<size_t>();
-
-                    for (const auto& eInFrintier : frontiar) {
-                        if (eInFrintier == child) {
-                            foundRedundant = true;
-                            break;
-                        } else {
-                            for (auto nextE : m_graph().outNeighbors(eInFrintier)) {
-                                nextFrontiar.insert(nextE);
-                            }
-                        }
-                    }  // end FOF
-                    if (foundRedundant) {
-                        break;
-                    }
-                    frontiar = nextFrontiar;
-                }
-                if (foundRedundant)
-                    break;
-            }
-            if (foundRedundant) {
-                edgesToBeRemoved.push_back({node, child});
-            }
+    // An edge is redundant when its target can also be reached through another child of its source.
+    // Stencil dependencies that still need a halo update are kept:
+    // a container may load as stencil fields written by two containers that depend on each other.
+    const auto csr = Neon::CsrDiGraph::fromDiGraph(m_graph());
+    for (const auto& toBeRemoved : csr.transitiveReduction()) {
+        const auto& infos = m_graph().getEdgeProperty(toBeRemoved).info();
+        const bool  hasPendingStencil = std::any_of(infos.begin(), infos.end(), [](const Edge::Info& info) {
+            return info.isStencil() && !info.isHu();
+        });
+        if (!hasPendingStencil) {
+            m_graph().removeEdge(toBeRemoved);
         }
-    });
-    for (const auto& toBeRemoved : edgesToBeRemoved) {
-        m_graph().removeEdge(toBeRemoved);
     }
 }
 
@@ -636,7 +620,12 @@ auto MultiGpuGraph::optimizeExtendedOCC(const Neon::skeleton::Options&) -> void
             size_t mapBoundary = h_cloneKernelNodeNode(mt0, Neon::DataView::BOUNDARY);
             m_schedulingGraph().addVertex(mapInternal);
             m_schedulingGraph().addVertex(mapBoundary);
-            m_schedulingGraph().addEdge(mapBoundary, mapInternal);
+            if (m_graph().getVertexProperty(mt0).isReduce()) {
+                // The boundary view of the dGrid dot, norm2 and multiDot combines its result with the one of the internal view
+                m_graph().addEdge(mapInternal, mapBoundary);
+            } else {
+                m_schedulingGraph().addEdge(mapBoundary, mapInternal);
+            }
 
             {
                 auto inE = m_graph().inEdges(mt0);
@@ -827,7 +816,12 @@ auto MultiGpuGraph::optimizeTwoWayExtendedOCC(const Neon::skeleton::Options&) ->
 
             m_schedulingGraph().addVertex(mapInternal);
             m_schedulingGraph().addVertex(mapBoundary);
-            m_schedulingGraph().addEdge(mapBoundary, mapInternal);
+            if (m_graph().getVertexProperty(mapFront).isReduce()) {
+                // The boundary view of the dGrid dot, norm2 and multiDot combines its result with the one of the internal view
+                m_graph().addEdge(mapInternal, mapBoundary);
+            } else {
+                m_schedulingGraph().addEdge(mapBoundary, mapInternal);
+            }
 
             {
                 auto inE = m_graph().inEdges(mapFront);
@@ -1090,8 +1084,83 @@ auto MultiGpuGraph::addSyncAndMemoryTransfers(const Neon::skeleton::Options& opt
                           }
                       });
 
-        if (detectedStencilEdges != 1) {
-            NEON_THROW_UNSUPPORTED_OPTION("Only one stencil in field is supported for now");
+        if (detectedStencilEdges == 0) {
+            NEON_THROW_UNSUPPORTED_OPTION("No stencil dependency detected for a stencil container");
+        }
+    }
+}
+
+auto MultiGpuGraph::h_mergeHaloUpdates() -> void
+{
+    /**
+     * Each stencil field loaded by a container gets its own chain of a halo update and a left-right sync node
+     * (see h_add_hUpdateSyncNodes): t0 -> first -> last -> t1.
+     * All the chains feeding the same container are merged into the first one, which then
+     * waits for all the producers and exchanges the halos of all the fields at once.
+     */
+    struct Chain
+    {
+        size_t first;
+        size_t last;
+    };
+    std::map<size_t, std::vector<Chain>> chainsByConsumer;
+    for (size_t nodeId : m_graph().vertices()) {
+        const auto& node = m_graph().getVertexProperty(nodeId);
+        if (!node.isHu()) {
+            continue;
+        }
+        Chain chain{nodeId, nodeId};
+        if (node.transferMode() == Neon::set::TransferMode::put) {
+            chain.last = *m_graph().outNeighbors(nodeId).begin();
+        } else {
+            chain.first = *m_graph().inNeighbors(nodeId).begin();
+        }
+        const size_t consumer = *m_graph().outNeighbors(chain.last).begin();
+        chainsByConsumer[consumer].push_back(chain);
+    }
+
+    // Moves the edge properties of an edge of a removed chain to the matching edge of the kept one
+    auto h_moveEdge = [&](const DiGraph::Edge& from, const DiGraph::Edge& to) {
+        const auto& infos = m_graph().getEdgeProperty(from).info();
+        if (!m_graph().hasEdge(to)) {
+            auto edge = m_graph().getEdgeProperty(from).clone();
+            m_graph().addEdge(to.first, to.second, edge);
+            return;
+        }
+        auto& toInfos = m_graph().getEdgeProperty(to).infoMutable();
+        toInfos.insert(toInfos.end(), infos.begin(), infos.end());
+    };
+
+    for (auto& [consumer, chains] : chainsByConsumer) {
+        const Chain& kept = chains[0];
+        for (size_t i = 1; i < chains.size(); i++) {
+            const Chain& merged = chains[i];
+
+            for (const auto& edge : m_graph().inEdges(merged.first)) {
+                h_moveEdge(edge, {edge.first, kept.first});
+            }
+            h_moveEdge({merged.first, merged.last}, {kept.first, kept.last});
+            h_moveEdge({merged.last, consumer}, {kept.last, consumer});
+
+            for (size_t nodeId : {merged.first, merged.last}) {
+                const size_t keptId = nodeId == merged.first ? kept.first : kept.last;
+                m_graph().getVertexProperty(keptId).mergeHaloUpdate(m_graph().getVertexProperty(nodeId));
+
+                if (!m_schedulingGraph().hasVertex(nodeId)) {
+                    m_graph().removeVertex(nodeId);
+                    continue;
+                }
+                // The scheduling constraints of the removed node now apply to the kept one
+                m_schedulingGraph().addVertex(keptId);
+                for (size_t before : m_schedulingGraph().inNeighbors(nodeId)) {
+                    m_schedulingGraph().addEdge(before, keptId);
+                }
+                for (size_t after : m_schedulingGraph().outNeighbors(nodeId)) {
+                    m_schedulingGraph().addEdge(keptId, after);
+                }
+                m_schedulingGraph().removeVertex(nodeId);
+                m_graph().removeVertex(nodeId);
+            }
         }
     }
 }
@@ -1167,4 +1236,97 @@ MultiGpuGraph::MultiGpuGraph()
 {
     m_storage = std::make_shared<Storage>();
 }
-}  // namespace Neon::skeleton::internal
\ No newline at end of file
+
+auto MultiGpuGraph::sequenceDataUids(const std::vector<Neon::set::Container>& operations)
+    -> std::vector<Neon::set::MultiDeviceObjectUid>
+{
+    std::vector<Neon::set::MultiDeviceObjectUid> uids;
+    for (auto container : operations) {
+        for (auto const& token : container.getContainerInterface().getTokens()) {
+            if (std::find(uids.begin(), uids.end(), token.uid()) == uids.end()) {
+                uids.push_back(token.uid());
+            }
+        }
+    }
+    return uids;
+}
+
+auto MultiGpuGraph::detach() const -> MultiGpuGraph
+{
+    MultiGpuGraph detached;
+    detached.m_storage = std::make_shared<Storage>(*m_storage);
+    detached.m_storage->m_kContainers.clear();
+    detached.m_storage->m_dataRecords = UserDataManager();
+
+    const auto uids = sequenceDataUids(m_kContainers());
+    auto       strip = [&](DiGraph& graph) {
+        graph.forEachVertex([&](size_t v) {
+            auto& node = graph.getVertexProperty(v);
+            if (!node.isHu() && !node.isSync()) {
+                return;
+            }
+            const auto nodeUids = node.getDataUids();
+            for (int fieldIdx = 0; fieldIdx < int(nodeUids.size()); fieldIdx++) {
+                auto it = std::find(uids.begin(), uids.end(), nodeUids[fieldIdx]);
+                node.setDataUid(fieldIdx, Neon::set::MultiDeviceObjectUid(it - uids.begin()));
+                if (node.isHu()) {
+                    node.setHu(fieldIdx, nullptr, nullptr);
+                }
+            }
+        });
+    };
+    strip(detached.m_storage->m_userAppGraph);
+    strip(detached.m_storage->m_graph);
+    return detached;
+}
+
+auto MultiGpuGraph::cloneWith(const std::vector<Neon::set::Container>& operations) const -> MultiGpuGraph
+{
+    MultiGpuGraph clone;
+    clone.m_storage = std::make_shared<Storage>(*m_storage);
+    clone.m_storage->m_kContainers = operations;
+
+    // The data of the detached nodes is identified by its role in the sequence,
+    // halo update nodes are bound to the stencil tokens of the data in the same role
+    const auto uids = sequenceDataUids(operations);
+    std::unordered_map<Neon::set::MultiDeviceObjectUid, Neon::set::internal::dependencyTools::DataToken> huTokens;
+    for (auto container : operations) {
+        for (auto const& token : container.getContainerInterface().getTokens()) {
+            if (token.compute() == Neon::Compute::STENCIL) {
+                huTokens.insert_or_assign(token.uid(), token);
+            }
+        }
+    }
+    auto rebind = [&](DiGraph& graph) {
+        graph.forEachVertex([&](size_t v) {
+            auto& node = graph.getVertexProperty(v);
+            if (!node.isHu() && !node.isSync()) {
+                return;
+            }
+            const auto roles = node.getDataUids();
+            for (int fieldIdx = 0; fieldIdx < int(roles.size()); fieldIdx++) {
+                if (roles[fieldIdx] >= uids.size()) {
+                    NeonException exp("MultiGpuGraph");
+                    exp << "The containers do not match the structure of the graph";
+                    NEON_THROW(exp);
+                }
+                const auto uid = uids[roles[fieldIdx]];
+                node.setDataUid(fieldIdx, uid);
+                if (!node.isHu()) {
+                    continue;
+                }
+                auto it = huTokens.find(uid);
+                if (it == huTokens.end()) {
+                    NeonException exp("MultiGpuGraph");
+                    exp << "No stencil container matching the halo update of " << uid;
+                    NEON_THROW(exp);
+                }
+                node.setHu(fieldIdx, it->second.getHaloUpdate(), it->second.getHaloUpdatePerDevice());
+            }
+        });
+    };
+    rebind(clone.m_storage->m_userAppGraph);
+    rebind(clone.m_storage->m_graph);
+    return clone;
+}
+}  // namespace Neon::skeleton::internal
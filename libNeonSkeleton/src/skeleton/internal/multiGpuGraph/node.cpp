@@ -99,6 +99,9 @@ auto MetaNode::toString() const -> std::string
             std::string res =  //"Node ID " + std::to_string(nodeId()) +
                 std::string("Halo Update") +
                 "\n\nTransferMode: " + Neon::set::TransferModeUtils::toString(m_transferMode) + "\\l";
+            if (m_batchedUids.size() > 1) {
+                res += "Fields: " + std::to_string(m_batchedUids.size()) + "\\l";
+            }
             //                              std::string ret = "HU " +
             //                                                Neon::set::Transfer_t::toString(m_transferMode) +
             //                                                " " + std::to_string(m_uid);
@@ -162,8 +165,9 @@ auto MetaNode::haloUpdateFactory(Neon::set::TransferMode
     MetaNode node(++nodeCounter_g, "HaloUpdate", MetaNodeType_e::HALO_UPDATE, -1);
     node.m_transferMode = tm;
     node.m_uid = dataUids;
-    node.m_hu = hu;
-    node.m_huPerDevice = huPerDevice;
+    node.m_batchedUids = {dataUids};
+    node.m_hu = {hu};
+    node.m_huPerDevice = {huPerDevice};
     return node;
 }
 
@@ -171,6 +175,7 @@ auto MetaNode::syncLeftRightFactory(const Neon::set::MultiDeviceObjectUid& dataU
 {
     MetaNode node(++nodeCounter_g, "syncLeftRigh", MetaNodeType_e::SYNC_LEFT_RIGHT, -1);
     node.m_uid = dataUids;
+    node.m_batchedUids = {dataUids};
     return node;
 }
 
@@ -251,12 +256,54 @@ auto MetaNode::cudaGraphHandles_t::last() -> Neon::set::DataSet<cudaGraphNode_t>
 
 auto MetaNode::hu(Neon::set::HuOptions& opt) -> void
 {
-    m_hu(opt);
+    for (auto& hu : m_hu) {
+        hu(opt);
+    }
 }
 
 auto MetaNode::hu(Neon::SetIdx setIdx, Neon::set::HuOptions& opt) -> void
 {
-    m_huPerDevice(setIdx, opt);
+    for (auto& huPerDevice : m_huPerDevice) {
+        huPerDevice(setIdx, opt);
+    }
+}
+
+auto MetaNode::setHu(int                                                                 fieldIdx,
+                     const std::function<void(Neon::set::HuOptions& opt)>&               hu,
+                     const std::function<void(Neon::SetIdx, Neon::set::HuOptions& opt)>& huPerDevice) -> void
+{
+    m_hu.at(fieldIdx) = hu;
+    m_huPerDevice.at(fieldIdx) = huPerDevice;
+}
+
+auto MetaNode::setDataUid(int fieldIdx, const Neon::set::MultiDeviceObjectUid& uid) -> void
+{
+    m_batchedUids.at(fieldIdx) = uid;
+    if (fieldIdx == 0) {
+        m_uid = uid;
+    }
+}
+
+auto MetaNode::mergeHaloUpdate(const MetaNode& other) -> void
+{
+    if (m_nodeType != other.m_nodeType || (!isHu() && !isSync()) || m_transferMode != other.m_transferMode) {
+        NeonException exp("MetaNode");
+        exp << "Only halo update or left-right sync nodes with the same transfer mode can be merged";
+        NEON_THROW(exp);
+    }
+    m_batchedUids.insert(m_batchedUids.end(), other.m_batchedUids.begin(), other.m_batchedUids.end());
+    m_hu.insert(m_hu.end(), other.m_hu.begin(), other.m_hu.end());
+    m_huPerDevice.insert(m_huPerDevice.end(), other.m_huPerDevice.begin(), other.m_huPerDevice.end());
+}
+
+auto MetaNode::getDataUid() const -> const Neon::set::MultiDeviceObjectUid&
+{
+    return m_uid;
+}
+
+auto MetaNode::getDataUids() const -> const std::vector<Neon::set::MultiDeviceObjectUid>&
+{
+    return m_batchedUids;
 }
 
 auto MetaNode::transferMode() const
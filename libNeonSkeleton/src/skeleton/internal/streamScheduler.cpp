@@ -1,4 +1,5 @@
 #include "Neon/skeleton/internal/StreamScheduler.h"
+#include <numeric>
 #include <unordered_set>
 #include "Neon/set/syncrhonizations/event_LR_barrier.h"
 
@@ -41,6 +42,28 @@ auto StreamScheduler::init(Neon::Backend& bk, MultiGpuGraph& multiGpuGraph) -> v
     initExecutionOrder();
 }
 
+auto StreamScheduler::cloneFor(Neon::Backend& bk, MultiGpuGraph& multiGpuGraph) const -> StreamScheduler
+{
+    StreamScheduler clone;
+    clone.m_storage = std::make_shared<Storage>(bk, multiGpuGraph);
+
+    Storage&       dst = *clone.m_storage;
+    const Storage& src = *m_storage;
+    dst.m_levels = src.m_levels;
+    dst.m_streamFlags = src.m_streamFlags;
+    dst.m_initDone = src.m_initDone;
+    dst.m_executionOrder = src.m_executionOrder;
+    dst.m_linearization = src.m_linearization;
+    dst.m_metaNodeExtendedList = src.m_metaNodeExtendedList;
+    dst.m_nUserEvents = src.m_nUserEvents;
+    dst.useFullBarrierOnAllStreamsAtTheEnd = src.useFullBarrierOnAllStreamsAtTheEnd;
+    dst.canEndNodeLastBarrierBeOptimizedOut = src.canEndNodeLastBarrierBeOptimizedOut;
+
+    dst.m_bk.setAvailableStreamSet(int(dst.m_streamFlags.size()));
+    dst.m_bk.setAvailableUserEvents(dst.m_nUserEvents + dst.helpNLoopFenceEvents());
+    return clone;
+}
+
 auto StreamScheduler::initCleanRedundantSync() -> void
 {
     if (m_storage->useFullBarrierOnAllStreamsAtTheEnd) {
@@ -201,65 +224,34 @@ auto StreamScheduler::initCreateLevels() -> void
 {
     auto& diGraph = m_storage->m_graph.getDiGraph();
 
-    // Set the dependency counter of each node
-    diGraph.forEachVertex([&](NodeId nodeId) {
-        auto&     metaNodeExtended = h_getMetaNodeExtended(nodeId);
-        const int nDependencies = int(diGraph.inEdgesCount(nodeId));
-        metaNodeExtended.blockingDependencies = nDependencies;
-    });
+    helpFillLevels(Neon::CsrDiGraph::fromDiGraph(diGraph));
 
-    std::unordered_set<NodeId> frontier;
-    const NodeId               beginning = m_storage->m_graph.rootNodeId();
-    frontier.insert(beginning);
-    // h_dissolveDataDependencies(beginning);
-
-    // Walking the graph following a BFS with constraints
-    int level = -1;
-    while (!frontier.empty()) {
-        addNewLevel();
-        level++;
-        // printf("Level %d \n", level);
-        std::unordered_set<NodeId> nextFrontier;
-        std::unordered_set<NodeId> nodeToApplyDissolveTo;
-        for (auto& frontierNodeId : frontier) {
-            {  // 2. If the node has still some dependencies that are not satisfy,
-                // don't process the node now ad add it to the next frontier
-                // printf("frontierNodeId %ld \n", frontierNodeId);
-                auto& frontierMetaNode = h_getMetaNode(frontierNodeId);
-                auto  frontierMetaNodeExtended = h_getMetaNodeExtended(frontierMetaNode);
-                if (frontierMetaNodeExtended.blockingDependencies != 0) {
-                    // There are some data dependencies still active before processing this node
-                    // Moving the node to the next frontier.
-                    nextFrontier.insert(frontierNodeId);
-                    // std:: cout<< "frontierMetaNode " << frontierNodeId <<" postpone" <<std::endl;
-                    continue;
-                }
-            }
-            {  // 3. Populating the next frontier
-                std::set<size_t> childList = diGraph.outNeighbors(frontierNodeId);
-                for (auto& child : childList) {
-                    nextFrontier.insert(child);
-                }
-            }
-            {  // 4. Upgrade information in the metaNodeExtended
-                auto& metaNode = h_getMetaNode(frontierNodeId);
-                auto& metaNodeExtended = h_getMetaNodeExtended(frontierNodeId);
-                metaNodeExtended.schedulingInfo = MetaNodeExtended::SchedulingInfo(frontierNodeId,
-                                                                                   metaNode.getLinearContinuousIndex(),
-                                                                                   metaNode.getContainerId());
-            }
-            {  // 5. Register the target frontier node to the last level
-                registerNodeToLastLevel(frontierNodeId);
-                nodeToApplyDissolveTo.insert(frontierNodeId);
-            }
+    for (int i = 0; i < nLevels(); i++) {
+        for (NodeId nodeId : getLevel(i)) {
+            auto& metaNode = h_getMetaNode(nodeId);
+            auto& metaNodeExtended = h_getMetaNodeExtended(nodeId);
+            metaNodeExtended.blockingDependencies = 0;
+            metaNodeExtended.schedulingInfo = MetaNodeExtended::SchedulingInfo(nodeId,
+                                                                               metaNode.getLinearContinuousIndex(),
+                                                                               metaNode.getContainerId());
         }
+    }
+}
 
-        // Update all the dependencies
-        for (auto& frontierNode : nodeToApplyDissolveTo) {
-            h_dissolveDataDependencies(diGraph, frontierNode);
+/**
+ * A node is placed one level after the last of its parents, which is the level at which a BFS
+ * from the root node that waits for all the dependencies of a node would visit it.
+ * Nodes of a level are sorted by topological order.
+ */
+auto StreamScheduler::helpFillLevels(const Neon::CsrDiGraph& graph) -> void
+{
+    resetLevels();
+    const std::vector<int> levels = graph.longestPathLevels();
+    for (size_t idx : graph.topologicalOrder()) {
+        while (nLevels() <= levels[idx]) {
+            addNewLevel();
         }
-        // h_print_depcountALL();
-        frontier = nextFrontier;
+        getLevel(levels[idx]).push_back(graph.vertexId(idx));
     }
 }
 
@@ -405,7 +397,9 @@ auto StreamScheduler::initScheduleEvents() -> void
         }
     }
 
-    m_storage->m_bk.setAvailableUserEvents(eventCounter);
+    m_storage->m_nUserEvents = eventCounter;
+    // The events of the graph are followed by the ones of the fence between the iterations of a loop
+    m_storage->m_bk.setAvailableUserEvents(eventCounter + m_storage->helpNLoopFenceEvents());
 }
 
 auto StreamScheduler::initLinearisationList() -> void
@@ -488,72 +482,12 @@ auto StreamScheduler::initExecutionOrder() -> void
     // Aliasing m_executionOrder with variable order
     std::vector<NodeId>& order = m_storage->m_executionOrder;
 
+    // Levels of the data dependencies merged with the scheduling dependencies
+    const auto&                            schedulingGraph = m_storage->m_graph.getSchedulingDiGraph();
+    const std::set<Neon::CsrDiGraph::Edge> schedulingEdges = schedulingGraph.edges();
+    helpFillLevels(Neon::CsrDiGraph::fromDiGraph(m_storage->m_graph.getDiGraph(),
+                                                 {schedulingEdges.begin(), schedulingEdges.end()}));
 
-    auto dataAndSchedulingGraph = m_storage->m_graph.getDiGraph();
-    {
-        const auto& schedulingGraph = m_storage->m_graph.getSchedulingDiGraph();
-        for (auto& edge : schedulingGraph.edges()) {
-            if (!dataAndSchedulingGraph.hasEdge(edge)) {
-                dataAndSchedulingGraph.addEdge(edge.first, edge.second);
-            }
-        }
-    }
-
-    // Set the dependency counter of each node
-    dataAndSchedulingGraph.forEachVertex([&](NodeId nodeId) {
-        auto&     metaNodeExtended = h_getMetaNodeExtended(nodeId);
-        const int nDependencies = int(dataAndSchedulingGraph.inEdgesCount(nodeId));
-        metaNodeExtended.blockingDependencies = nDependencies;
-    });
-
-    std::unordered_set<NodeId> frontier;
-    const NodeId               beginning = m_storage->m_graph.rootNodeId();
-    frontier.insert(beginning);
-
-    // Reseting Levels;
-    resetLevels();
-
-    // Walking the graph following a BFS with constraints
-    int level = -1;
-    while (!frontier.empty()) {
-        addNewLevel();
-        level++;
-        // printf("Level %d \n", level);
-        std::unordered_set<NodeId> nextFrontier;
-        std::unordered_set<NodeId> nodeToApplyDissolveTo;
-        for (auto& frontierNodeId : frontier) {
-            {  // 2. If the node has still some dependencies that are not satisfy,
-                // don't process the node now ad add it to the next frontier
-                // printf("frontierNodeId %ld \n", frontierNodeId);
-                auto& frontierMetaNode = h_getMetaNode(frontierNodeId);
-                auto  frontierMetaNodeExtended = h_getMetaNodeExtended(frontierMetaNode);
-                if (frontierMetaNodeExtended.blockingDependencies != 0) {
-                    // There are some data dependencies still active before processing this node
-                    // Moving the node to the next frontier.
-                    nextFrontier.insert(frontierNodeId);
-                    // std:: cout<< "frontierMetaNode " << frontierNodeId <<" postpone" <<std::endl;
-                    continue;
-                }
-            }
-            {  // 3. Populating the next frontier
-                std::set<size_t> childList = dataAndSchedulingGraph.outNeighbors(frontierNodeId);
-                for (auto& child : childList) {
-                    nextFrontier.insert(child);
-                }
-            }
-            {  // 5. Register the target frontier node to the last level
-                registerNodeToLastLevel(frontierNodeId);
-                nodeToApplyDissolveTo.insert(frontierNodeId);
-            }
-        }
-
-        // Update all the dependencies
-        for (auto& frontierNode : nodeToApplyDissolveTo) {
-            h_dissolveDataDependencies(dataAndSchedulingGraph, frontierNode);
-        }
-        // h_print_depcountALL();
-        frontier = nextFrontier;
-    }
     for (int i = 0; i < nLevels(); i++) {
         Level& lev = getLevel(i);
         for (auto it = lev.begin(), end = lev.end(); it != end; ++it) {
@@ -566,9 +500,14 @@ auto StreamScheduler::initExecutionOrder() -> void
 #endif
 
 
-auto StreamScheduler::helpRunOmpAtNodeLevel() -> void
+template <bool withProfiler>
+auto StreamScheduler::helpRunOmpAtNodeLevel(bool endBarrier) -> void
 {
-    for (auto& nodeId : m_storage->m_executionOrder) {
+    [[maybe_unused]] Neon::skeleton::Profiler* profiler = m_storage->m_profiler.get();
+    const int                                  nNodes = int(m_storage->m_executionOrder.size());
+
+    for (int a = 0; a < nNodes; a++) {
+        auto& nodeId = m_storage->m_executionOrder[a];
 #ifdef NEON_USE_NVTX
         const auto nvtxName = helpNvtxName(nodeId);
         nvtxRangePush(nvtxName.c_str());
@@ -583,12 +522,28 @@ auto StreamScheduler::helpRunOmpAtNodeLevel() -> void
             helpWaitForEventCompletion(streamIdx, eventToBeWaited);
         }
 
-        helpRun(nodeId, streamIdx);
+        if constexpr (withProfiler) {
+            const int key = m_storage->m_profilerKeys[a];
+            if (key != -1) {
+                const uint64_t bytes = m_storage->m_bk.devSet().transferredBytes();
+                const int64_t  start = profiler->now();
+                helpRun(nodeId, streamIdx);
+                if (profiler->syncEachNode()) {
+                    m_storage->m_bk.sync(streamIdx);
+                }
+                // The node runs all the partitions in one call, so there is no per-partition time at this level
+                profiler->record(key, -1, streamIdx, start, profiler->now(), m_storage->m_bk.devSet().transferredBytes() - bytes);
+            } else {
+                helpRun(nodeId, streamIdx);
+            }
+        } else {
+            helpRun(nodeId, streamIdx);
+        }
         if (eventIdx != -1 && nodeId != m_storage->m_graph.finalNodeId()) {
             helpEnqueueEvent(streamIdx, eventIdx);
         }
         if (nodeId == m_storage->m_graph.finalNodeId()) {
-            if (!m_storage->canEndNodeLastBarrierBeOptimizedOut) {
+            if (endBarrier && !m_storage->canEndNodeLastBarrierBeOptimizedOut) {
                 m_storage->m_bk.syncAll();
             }
         }
@@ -598,9 +553,11 @@ auto StreamScheduler::helpRunOmpAtNodeLevel() -> void
     }
 }
 
-auto StreamScheduler::helpRunOmpAtGraphLevel() -> void
+template <bool withProfiler>
+auto StreamScheduler::helpRunOmpAtGraphLevel(bool endBarrier) -> void
 {
-    const int nNodes = int(m_storage->m_executionOrder.size());
+    [[maybe_unused]] Neon::skeleton::Profiler* profiler = m_storage->m_profiler.get();
+    const int                                  nNodes = int(m_storage->m_executionOrder.size());
 
     for (int setIdx = 0; setIdx < m_storage->m_bk.devSet().setCardinality(); setIdx++) {
         for (int a = 0; a < nNodes; a++) {
@@ -620,12 +577,27 @@ auto StreamScheduler::helpRunOmpAtGraphLevel() -> void
                 helpWaitForEventCompletion(setIdx, streamIdx, eventToBeWaited);
             }
 
-            helpRun(setIdx, nodeId, streamIdx);
+            if constexpr (withProfiler) {
+                const int key = m_storage->m_profilerKeys[a];
+                if (key != -1) {
+                    const uint64_t bytes = m_storage->m_bk.devSet().transferredBytes();
+                    const int64_t  start = profiler->now();
+                    helpRun(setIdx, nodeId, streamIdx);
+                    if (profiler->syncEachNode()) {
+                        m_storage->m_bk.sync(setIdx, streamIdx);
+                    }
+                    profiler->record(key, setIdx, streamIdx, start, profiler->now(), m_storage->m_bk.devSet().transferredBytes() - bytes);
+                } else {
+                    helpRun(setIdx, nodeId, streamIdx);
+                }
+            } else {
+                helpRun(setIdx, nodeId, streamIdx);
+            }
             if (eventIdx != -1 && nodeId != m_storage->m_graph.finalNodeId()) {
                 helpEnqueueEvent(setIdx, streamIdx, eventIdx);
             }
             if (nodeId == m_storage->m_graph.finalNodeId()) {
-                if (!m_storage->canEndNodeLastBarrierBeOptimizedOut) {
+                if (endBarrier && !m_storage->canEndNodeLastBarrierBeOptimizedOut) {
                     m_storage->m_bk.syncAll();
                 }
             }
@@ -635,30 +607,94 @@ auto StreamScheduler::helpRunOmpAtGraphLevel() -> void
         }
     }
 }
+
+auto StreamScheduler::setProfiler(std::shared_ptr<Neon::skeleton::Profiler> profiler) -> void
+{
+    m_storage->m_profiler = std::move(profiler);
+    m_storage->m_profilerKeys.clear();
+    if (!m_storage->m_profiler) {
+        return;
+    }
+    for (const auto& nodeId : m_storage->m_executionOrder) {
+        m_storage->m_profilerKeys.push_back(helpProfilerKey(nodeId));
+    }
+}
+
 auto StreamScheduler::run(const Neon::skeleton::Options& options) -> void
 {
+    helpRunIteration(options, true);
+}
+
+auto StreamScheduler::run(const Neon::skeleton::Options& options,
+                          int                            maxIterations,
+                          const std::function<bool()>&   predicate) -> int
+{
+#ifdef NEON_USE_NVTX
+    nvtxRangePush("Skeleton Loop");
+#endif
+    // The host only waits for the graph when the predicate is evaluated and after the last iteration.
+    // The graph then ends either with a barrier on all streams or with a single reduction that
+    // already synchronized to produce its result (canEndNodeLastBarrierBeOptimizedOut),
+    // therefore the predicate can read the scalars computed by the graph.
+    // The other iterations are enqueued back-to-back, ordered by a fence on the streams.
+    const int checkPeriod = options.loopCheckPeriod();
+    int       iteration = 0;
+    while (iteration < maxIterations) {
+        iteration++;
+        const bool check = iteration == maxIterations || (predicate && iteration % checkPeriod == 0);
+        helpRunIteration(options, check);
+        if (check && predicate && !predicate()) {
+            break;
+        }
+    }
+#ifdef NEON_USE_NVTX
+    nvtxRangePop();
+#endif
+    return iteration;
+}
+
+auto StreamScheduler::helpRunIteration(const Neon::skeleton::Options& options,
+                                       bool                           endBarrier) -> void
+{
+    const bool withProfiler = m_storage->m_profiler != nullptr;
+    if (withProfiler) {
+        m_storage->m_profiler->beginIteration();
+    }
+
     if (Neon::skeleton::Executor::ompAtNodeLevel == options.executor()) {
 #ifdef NEON_USE_NVTX
         nvtxRangePush("Skeleton Iteration - ompAtNodeLevel");
 #endif
-        helpRunOmpAtNodeLevel();
+        if (withProfiler) {
+            helpRunOmpAtNodeLevel<true>(endBarrier);
+        } else {
+            helpRunOmpAtNodeLevel<false>(endBarrier);
+        }
 #ifdef NEON_USE_NVTX
         nvtxRangePop();
 #endif
-        return;
-    }
-
-    if (Neon::skeleton::Executor::ompAtGraphLevel == options.executor()) {
+    } else if (Neon::skeleton::Executor::ompAtGraphLevel == options.executor()) {
 #ifdef NEON_USE_NVTX
         nvtxRangePush("Skeleton Iteration - ompAtGraphLevel");
 #endif
-        helpRunOmpAtGraphLevel();
+        if (withProfiler) {
+            helpRunOmpAtGraphLevel<true>(endBarrier);
+        } else {
+            helpRunOmpAtGraphLevel<false>(endBarrier);
+        }
 #ifdef NEON_USE_NVTX
         nvtxRangePop();
 #endif
-        return;
+    } else {
+        NEON_THROW_UNSUPPORTED_OPTION("No supported Executor option.");
+    }
+
+    if (!endBarrier && !m_storage->canEndNodeLastBarrierBeOptimizedOut) {
+        // The next iteration is ordered after this one without blocking the host
+        std::vector<int> streamIdxVec(m_storage->m_streamFlags.size());
+        std::iota(streamIdxVec.begin(), streamIdxVec.end(), 0);
+        m_storage->m_bk.streamFence(streamIdxVec, m_storage->m_nUserEvents);
     }
-    NEON_THROW_UNSUPPORTED_OPTION("No supported Executor option.");
 }
 
 auto StreamScheduler::helpRun(NodeId nodeId, Neon::StreamIdx streamIdx) -> void
@@ -680,9 +716,17 @@ auto StreamScheduler::helpRun(NodeId nodeId, Neon::StreamIdx streamIdx) -> void
             return;
         }
         case MetaNodeType_te::HALO_UPDATE: {
-            const bool           startWithBarrier = false;
+            const bool startWithBarrier = false;
+            if (m_storage->m_bk.hasCpuStreams()) {
+                // CPU transfers are run by the calling thread:
+                // the work previously enqueued on the stream must be completed first
+                m_storage->m_bk.sync(streamIdx);
+            }
             Neon::set::HuOptions huOptions(metaNode.transferMode(), startWithBarrier, streamIdx);
+            // The fields of a merged node are exchanged with one message per pair of remote partitions
+            Neon::set::DevSet::HostTransferBatchScope batch(m_storage->m_bk.devSet());
             metaNode.hu(huOptions);
+            batch.commit();
             return;
         }
         case MetaNodeType_te::HELPER: {
@@ -714,8 +758,14 @@ auto StreamScheduler::helpRun(Neon::SetIdx setIdx, NodeId nodeId, Neon::StreamId
             return;
         }
         case MetaNodeType_te::HALO_UPDATE: {
-            const bool           startWithBarrier = false;
+            const bool startWithBarrier = false;
+            if (m_storage->m_bk.hasCpuStreams()) {
+                m_storage->m_bk.sync(setIdx, streamIdx);
+            }
             Neon::set::HuOptions huOptions(metaNode.transferMode(), startWithBarrier, streamIdx);
+            // Not batched: the partitions of the graph level executor run their halo updates independently,
+            // while a batch of the DevSet collects the transfers of all the partitions.
+            // The fields of a merged node are still exchanged by a single node.
             metaNode.hu(setIdx, huOptions);
             return;
         }
@@ -759,6 +809,30 @@ auto StreamScheduler::helpNvtxName(NodeId nodeId) -> std::string
 }
 
 
+auto StreamScheduler::helpProfilerKey(NodeId nodeId) -> int
+{
+    MetaNode& metaNode = h_getMetaNode(nodeId);
+    switch (metaNode.nodeType()) {
+        case MetaNodeType_te::CONTAINER: {
+            return m_storage->m_profiler->registerNode(metaNode.nodeId(), helpNvtxName(nodeId), Neon::skeleton::Profiler::NodeKind::container);
+        }
+        case MetaNodeType_te::SYNC_LEFT_RIGHT: {
+            return m_storage->m_profiler->registerNode(metaNode.nodeId(), "LeftRightSync", Neon::skeleton::Profiler::NodeKind::sync);
+        }
+        case MetaNodeType_te::HALO_UPDATE: {
+            // Labelled with the fields of the node
+            std::string name = "HaloUpdate";
+            for (const auto& uid : metaNode.getDataUids()) {
+                name += "_" + std::to_string(uid);
+            }
+            return m_storage->m_profiler->registerNode(metaNode.nodeId(), name, Neon::skeleton::Profiler::NodeKind::haloUpdate);
+        }
+        default: {
+            return -1;
+        }
+    }
+}
+
 auto StreamScheduler::helpWaitForEventCompletion(StreamIdx streamIdx, Neon::EventIdx eventIdx) -> void
 {
     auto& bk = m_storage->m_bk;
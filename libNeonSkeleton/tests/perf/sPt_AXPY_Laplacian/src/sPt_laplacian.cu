@@ -15,10 +15,10 @@ auto laplacianFilter(const Field& A_g,
             auto& C = L.load(C_g);
 
             return [A, C] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
-                typename Field::Type sum = 0;
+                typename Field::ComputeType sum = 0;
                 for (int nIdx = 0; nIdx < 6; nIdx++) {
-                    const auto nInfo = A.nghVal(cell, nIdx, 0, typename Field::Type(0));
-                    const auto nVal = nInfo.value;
+                    const auto                        nInfo = A.nghVal(cell, nIdx, 0, typename Field::Type(0));
+                    const typename Field::ComputeType nVal = nInfo.value;
                     sum += nVal;
                 }
                 C(cell, 0) = -sum + 6 * A(cell, 0);
@@ -28,9 +28,9 @@ auto laplacianFilter(const Field& A_g,
 }
 
 template <typename Field>
-auto axpy(const Field&                    A_g,
-          const typename Field::Type alpha,
-          Field&                          C_g) -> Neon::set::Container
+auto axpy(const Field&                      A_g,
+          const typename Field::ComputeType alpha,
+          Field&                            C_g) -> Neon::set::Container
 {
     auto Kontainer = A_g.getGrid().getContainer(
         "axpy", [&A_g, &C_g, alpha ](Neon::set::Loader & L) -> auto {
@@ -57,4 +57,25 @@ template auto axpy<Neon::domain::internal::eGrid::eField<int64_t>>(const Neon::d
 template auto axpy<Neon::domain::internal::eGrid::eField<double>>(const Neon::domain::internal::eGrid::eField<double>& A_g,
                                                                  double                                              alpha,
                                                                  Neon::domain::internal::eGrid::eField<double>&       C_g) -> Neon::set::Container;
+
+template auto laplacianFilter<Neon::domain::internal::eGrid::eField<float>>(const Neon::domain::internal::eGrid::eField<float>& A_g,
+                                                                           Neon::domain::internal::eGrid::eField<float>&       C_g) -> Neon::set::Container;
+
+template auto laplacianFilter<Neon::domain::internal::eGrid::eField<Neon::Half>>(const Neon::domain::internal::eGrid::eField<Neon::Half>& A_g,
+                                                                                Neon::domain::internal::eGrid::eField<Neon::Half>&       C_g) -> Neon::set::Container;
+
+template auto laplacianFilter<Neon::domain::internal::eGrid::eField<Neon::BFloat16>>(const Neon::domain::internal::eGrid::eField<Neon::BFloat16>& A_g,
+                                                                                    Neon::domain::internal::eGrid::eField<Neon::BFloat16>&       C_g) -> Neon::set::Container;
+
+template auto axpy<Neon::domain::internal::eGrid::eField<float>>(const Neon::domain::internal::eGrid::eField<float>& A_g,
+                                                                float                                             alpha,
+                                                                Neon::domain::internal::eGrid::eField<float>&       C_g) -> Neon::set::Container;
+
+template auto axpy<Neon::domain::internal::eGrid::eField<Neon::Half>>(const Neon::domain::internal::eGrid::eField<Neon::Half>& A_g,
+                                                                     float                                                  alpha,
+                                                                     Neon::domain::internal::eGrid::eField<Neon::Half>&       C_g) -> Neon::set::Container;
+
+template auto axpy<Neon::domain::internal::eGrid::eField<Neon::BFloat16>>(const Neon::domain::internal::eGrid::eField<Neon::BFloat16>& A_g,
+                                                                         float                                                      alpha,
+                                                                         Neon::domain::internal::eGrid::eField<Neon::BFloat16>&       C_g) -> Neon::set::Container;
 }  // namespace sk
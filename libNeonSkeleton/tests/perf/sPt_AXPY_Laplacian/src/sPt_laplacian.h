@@ -11,9 +11,9 @@ auto laplacianFilter(const Field& A_g,
                      Field&       C_g) -> Neon::set::Container;
 
 template <typename Field>
-auto axpy(const Field&               A_g,
-          const typename Field::Type alpha,
-          Field&                     C_g) -> Neon::set::Container;
+auto axpy(const Field&                      A_g,
+          const typename Field::ComputeType alpha,
+          Field&                            C_g) -> Neon::set::Container;
 
 extern template auto laplacianFilter<Neon::domain::internal::eGrid::eField<uint64_t>>(const Neon::domain::internal::eGrid::eField<uint64_t>& A_g,
                                                                                    Neon::domain::internal::eGrid::eField<uint64_t>&       C_g) -> Neon::set::Container;
@@ -28,4 +28,25 @@ extern template auto axpy<Neon::domain::internal::eGrid::eField<uint64_t>>(const
 extern template auto axpy<Neon::domain::internal::eGrid::eField<double>>(const Neon::domain::internal::eGrid::eField<double>& A_g,
                                                                       double                                            alpha,
                                                                       Neon::domain::internal::eGrid::eField<double>&       C_g) -> Neon::set::Container;
+
+extern template auto laplacianFilter<Neon::domain::internal::eGrid::eField<float>>(const Neon::domain::internal::eGrid::eField<float>& A_g,
+                                                                                  Neon::domain::internal::eGrid::eField<float>&       C_g) -> Neon::set::Container;
+
+extern template auto laplacianFilter<Neon::domain::internal::eGrid::eField<Neon::Half>>(const Neon::domain::internal::eGrid::eField<Neon::Half>& A_g,
+                                                                                       Neon::domain::internal::eGrid::eField<Neon::Half>&       C_g) -> Neon::set::Container;
+
+extern template auto laplacianFilter<Neon::domain::internal::eGrid::eField<Neon::BFloat16>>(const Neon::domain::internal::eGrid::eField<Neon::BFloat16>& A_g,
+                                                                                           Neon::domain::internal::eGrid::eField<Neon::BFloat16>&       C_g) -> Neon::set::Container;
+
+extern template auto axpy<Neon::domain::internal::eGrid::eField<float>>(const Neon::domain::internal::eGrid::eField<float>& A_g,
+                                                                       float                                             alpha,
+                                                                       Neon::domain::internal::eGrid::eField<float>&       C_g) -> Neon::set::Container;
+
+extern template auto axpy<Neon::domain::internal::eGrid::eField<Neon::Half>>(const Neon::domain::internal::eGrid::eField<Neon::Half>& A_g,
+                                                                            float                                                  alpha,
+                                                                            Neon::domain::internal::eGrid::eField<Neon::Half>&       C_g) -> Neon::set::Container;
+
+extern template auto axpy<Neon::domain::internal::eGrid::eField<Neon::BFloat16>>(const Neon::domain::internal::eGrid::eField<Neon::BFloat16>& A_g,
+                                                                                float                                                      alpha,
+                                                                                Neon::domain::internal::eGrid::eField<Neon::BFloat16>&       C_g) -> Neon::set::Container;
 }  // namespace sk
@@ -38,11 +38,15 @@ double filterAverage(TestConfigurations& config)
     auto& inD = storage.Xd;
     auto& outD = storage.Yd;
 
+    // AXPY reads two fields and writes one, the laplacian reads one field and writes one.
+    // The value is the minimal traffic, as it does not account for halos and cache misses.
+    config.m_bytesPerIteration = size_t(5) * sizeof(T_ta) * size_t(config.m_dim.rMul());
+
     config.m_backend.syncAll();
     // storage.ioToVti("Before_" + std::to_string(0));
 
     Neon::skeleton::Skeleton skl(storage.m_backend);
-    skl.sequence({sk::axpy(inF.cSelf(), T_ta(1.0), outF),
+    skl.sequence({sk::axpy(inF.cSelf(), Neon::ComputeTypeOf<T_ta>(1.0), outF),
                   sk::laplacianFilter(outF.cSelf(), inF)},
                  "axpy_laplacian", config.getSklOpt());
 
@@ -66,10 +70,10 @@ double filterAverage(TestConfigurations& config)
 
     {  // CORRECTNESS TEST
         if (config.m_compare) {
-            storage.axpy_f(inD, T_ta(1.0), outD);
+            storage.axpy_f(inD, Neon::ComputeTypeOf<T_ta>(1.0), outD);
             storage.laplacianFilter_f(outD, inD, storage.m_stencil.neighbours());
             for (int i = 0; i < config.m_nIterations; i++) {
-                storage.axpy_f(inD, T_ta(1.0), outD);
+                storage.axpy_f(inD, Neon::ComputeTypeOf<T_ta>(1.0), outD);
                 storage.laplacianFilter_f(outD, inD, storage.m_stencil.neighbours());
             }
             // storage.ioToVti("Compare_" + std::to_string(0));
@@ -139,11 +143,15 @@ double filterAverage(TestConfigurations& config)
             config.storeInforInReport(report, maxnGPUs);
 
             std::vector<double> times;
+            std::vector<double> bandwidths;
             for (int r = 0; r < config.m_nRepetitions; r++) {
                 f(config);
                 times.push_back(config.m_timer.time());
+                bandwidths.push_back(double(config.m_bytesPerIteration) / (config.m_timer.time() * 1.0e6));
             }
+            report.addMember("bytesPerIteration", uint64_t(config.m_bytesPerIteration));
             report.addMember("timeToSolution_ms", times);
+            report.addMember("effectiveBandwidth_GBs", bandwidths);
         }
     }
     report.write(h_computeTestName(), false);
@@ -6,6 +6,7 @@
 #include "sPt_common.h"
 #include "sPt_stencil.h"
 
+#include <algorithm>
 #include <map>
 
 TestConfigurations testConfigurations;
@@ -24,6 +25,18 @@ TEST(Skeleton, DISABLED_AXPY_then_Laplacian)
     if (testConfigurations.m_dataType == DataType::INT64_TYPE) {
         runAllConfig(filterAverage<Neon::domain::internal::eGrid::eGrid, int64_t>, testConfigurations);
     }
+
+    if (testConfigurations.m_dataType == DataType::FLOAT_TYPE) {
+        runAllConfig(filterAverage<Neon::domain::internal::eGrid::eGrid, float>, testConfigurations);
+    }
+
+    if (testConfigurations.m_dataType == DataType::HALF_TYPE) {
+        runAllConfig(filterAverage<Neon::domain::internal::eGrid::eGrid, Neon::Half>, testConfigurations);
+    }
+
+    if (testConfigurations.m_dataType == DataType::BFLOAT16_TYPE) {
+        runAllConfig(filterAverage<Neon::domain::internal::eGrid::eGrid, Neon::BFloat16>, testConfigurations);
+    }
 }
 
 
@@ -44,7 +57,7 @@ int main(int argc, char** argv)
                 clipp::option("-gpus") & clipp::opt_values("Number of gpus", testConfigurations.m_nGPUs),
                 clipp::option("-occ") & clipp::opt_values("data_type: none, standard, extended, twoWayExtended", occ),
                 clipp::option("-transfer") & clipp::opt_values("data_type: PUT, GET", transfer),
-                clipp::option("-data_type") & clipp::opt_values("data_type: double or int64", dataType),
+                clipp::option("-data_type") & clipp::opt_values("data_type: double, int64, float, half or bfloat16", dataType),
                 clipp::option("-correctness").set(testConfigurations.m_compare),
                 clipp::option("-o") & clipp::opt_values("o", testConfigurations.m_fnamePrefix));
 
@@ -58,6 +71,7 @@ int main(int argc, char** argv)
 
     testConfigurations.m_optSkelOCC = Neon::skeleton::OccUtils::fromString(occ);
     testConfigurations.m_optSkelTransfer = Neon::set::TransferModeUtils::fromString(transfer);
+    std::transform(dataType.begin(), dataType.end(), dataType.begin(), ::toupper);
     testConfigurations.m_dataType = DataTypeStr2Val(dataType);
 
     NEON_INFO(testConfigurations.toString());
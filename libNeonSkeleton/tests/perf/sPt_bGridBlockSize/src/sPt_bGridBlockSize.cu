@@ -0,0 +1,322 @@
+// Memory footprint vs. stencil throughput of bGrid for the supported block sizes (4^3, 8^3 and 16^3).
+// The active domain is a spherical shell whose thickness is chosen to match a requested fill ratio,
+// i.e., the fraction of active cells in the bounding box. For every fill ratio and block size
+// the benchmark reports the allocated memory, the fraction of allocated voxels that are active
+// and the throughput of a 7-point stencil in million cell updates per second (MCUPS).
+// It runs on the CPU (openmp runtime) when no GPU is selected or available.
+// On the CPU the stencil also runs through the per-voxel path of the openmp executor (setAndValidate on every
+// voxel of the allocated blocks) to measure the gain of the block execution (forEachActiveCellInBlock).
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+#include "Neon/Neon.h"
+#include "Neon/Report.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/domain/bGrid.h"
+#include "Neon/set/LambdaExecutor.h"
+
+struct BenchmarkConfig
+{
+    int                 dim = 128;
+    int                 iterations = 20;
+    int                 warmup = 2;
+    int                 nGPUs = 0;
+    std::vector<double> fillRatios = {0.5, 0.1, 0.02};
+    std::string         reportName = "sPt_bGridBlockSize";
+};
+
+struct BenchmarkResult
+{
+    uint64_t nActiveCells = 0;
+    uint64_t nBlocks = 0;
+    uint64_t nAllocatedVoxels = 0;
+    double   fieldMB = 0 /**< memory of one scalar field */;
+    double   metadataMB = 0 /**< block origins, neighbour blocks and active masks */;
+    double   mcups = 0;
+    double   voxelMcups = 0 /**< CPU only, per-voxel path of the executor */;
+    double   checksum = 0;
+    double   voxelChecksum = 0;
+};
+
+template <typename Partition>
+NEON_CUDA_HOST_DEVICE inline auto laplaceCell(const Partition& xLocal, Partition& yLocal, const typename Partition::Cell& cell) -> void
+{
+    using Type = typename Partition::Type;
+    Type res = 0;
+    NEON_UNROLL
+    for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+        auto neighbor = xLocal.nghVal(cell, nghIdx, 0, Type(0));
+        res += neighbor.value;
+    }
+    yLocal(cell, 0) = res - 6 * xLocal(cell, 0);
+}
+
+template <typename Field>
+auto laplace(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Laplace",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                laplaceCell(xLocal, yLocal, cell);
+            };
+        });
+}
+
+/**
+ * The bGrid partition index space without the block execution,
+ * which makes the openmp executor visit the voxels one by one through setAndValidate
+ */
+template <typename IndexSpace>
+struct PerVoxelIndexSpace
+{
+    using Cell = typename IndexSpace::Cell;
+    static constexpr int SpaceDim = IndexSpace::SpaceDim;
+
+    IndexSpace mIndexSpace;
+
+    auto setAndValidate(Cell& cell, const size_t& x, const size_t& y, const size_t& z) const -> bool
+    {
+        return mIndexSpace.setAndValidate(cell, x, y, z);
+    }
+};
+
+template <typename IndexSpace>
+struct PerVoxelContainer
+{
+    using PartitionIndexSpace = PerVoxelIndexSpace<IndexSpace>;
+};
+
+/**
+ * Runs the stencil from x to y through the per-voxel path of the openmp executor
+ */
+template <typename Grid, typename Field>
+auto laplacePerVoxel(Grid& grid, const Field& x, Field& y) -> void
+{
+    using PartitionIndexSpace = typename Grid::PartitionIndexSpace;
+    using Cell = typename Grid::Cell;
+
+    const auto& xLocal = x.getPartition(Neon::DeviceType::CPU, 0, Neon::DataView::STANDARD);
+    auto&       yLocal = y.getPartition(Neon::DeviceType::CPU, 0, Neon::DataView::STANDARD);
+
+    PerVoxelIndexSpace<PartitionIndexSpace> indexSpace{grid.getPartitionIndexSpace(Neon::DeviceType::CPU, 0, Neon::DataView::STANDARD)};
+    const Neon::int64_3d                    gridDim(int64_t(grid.getNumBlocksPerPartition()[0]) * Cell::sBlockVolume, 1, 1);
+
+    Neon::set::internal::execLambdaWithIterator_omp<PerVoxelContainer<PartitionIndexSpace>>(
+        gridDim, indexSpace, [&](const Cell& cell) { laplaceCell(xLocal, yLocal, cell); });
+}
+
+/**
+ * Returns the inner radius of a shell with outer radius R that covers fillRatio of a dim^3 box
+ */
+auto shellInnerRadius(double R, int dim, double fillRatio) -> double
+{
+    const double shellVolume = fillRatio * std::pow(double(dim), 3);
+    const double r3 = R * R * R - 3.0 * shellVolume / (4.0 * M_PI);
+    return r3 > 0 ? std::cbrt(r3) : 0.0;
+}
+
+/**
+ * Cells are visited in a different order for each block size, thus checksums are compared with a tolerance
+ */
+auto sameChecksum(double a, double b) -> bool
+{
+    return std::abs(a - b) <= 1.0e-10 * std::max(std::abs(a), std::abs(b));
+}
+
+template <typename Grid>
+auto runBlockSize(const Neon::Backend&   backend,
+                  const BenchmarkConfig& config,
+                  double                 fillRatio) -> BenchmarkResult
+{
+    using Type = double;
+    using Cell = typename Grid::Cell;
+
+    const double center = 0.5 * double(config.dim);
+    const double R = 0.5 * double(config.dim) - 1;
+    const double r = shellInnerRadius(R, config.dim, fillRatio);
+
+    Grid grid(
+        backend, Neon::index_3d(config.dim, config.dim, config.dim),
+        [=](const Neon::index_3d& idx) {
+            const double x = double(idx.x) - center;
+            const double y = double(idx.y) - center;
+            const double z = double(idx.z) - center;
+            const double d = std::sqrt(x * x + y * y + z * z);
+            return d <= R && d >= r;
+        },
+        Neon::domain::Stencil::s7_Laplace_t());
+
+    BenchmarkResult res;
+    res.nActiveCells = grid.getNumActiveCells();
+    res.nBlocks = grid.getNumBlocksPerPartition()[0];
+    res.nAllocatedVoxels = res.nBlocks * Cell::sBlockVolume;
+    res.fieldMB = double(res.nAllocatedVoxels * sizeof(Type)) / (1024.0 * 1024.0);
+    res.metadataMB = double(res.nBlocks * (sizeof(Neon::int32_3d) +
+                                           26 * sizeof(uint32_t) +
+                                           Cell::sMaskWordsPerBlock * sizeof(uint32_t))) /
+                     (1024.0 * 1024.0);
+
+    auto X = grid.template newField<Type>("X", 1, 0);
+    auto Y = grid.template newField<Type>("Y", 1, 0);
+
+    auto resetFields = [&]() {
+        X.forEachActiveCell([](const Neon::index_3d& idx, const int&, Type& val) {
+            val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29) % 101);
+        });
+        Y.forEachActiveCell([](const Neon::index_3d&, const int&, Type& val) { val = 0; });
+        X.updateCompute(0);
+        Y.updateCompute(0);
+    };
+    resetFields();
+
+    // Each iteration applies the stencil twice, ping-ponging between the two fields
+    auto xToY = laplace(X, Y);
+    auto yToX = laplace(Y, X);
+
+    for (int i = 0; i < config.warmup; i++) {
+        xToY.run(0);
+        yToX.run(0);
+    }
+    backend.syncAll();
+
+    Neon::Timer_ms timer;
+    timer.start();
+    for (int i = 0; i < config.iterations; i++) {
+        xToY.run(0);
+        yToX.run(0);
+    }
+    backend.syncAll();
+    timer.stop();
+
+    X.updateIO(0);
+    backend.syncAll();
+    X.forEachActiveCell([&](const Neon::index_3d&, const int&, Type& val) { res.checksum += val; });
+
+    res.mcups = double(res.nActiveCells) * 2.0 * double(config.iterations) / (timer.time() * 1.0e3);
+
+    if (backend.devType() == Neon::DeviceType::CPU) {
+        resetFields();
+        backend.syncAll();
+        for (int i = 0; i < config.warmup; i++) {
+            laplacePerVoxel(grid, X, Y);
+            laplacePerVoxel(grid, Y, X);
+        }
+
+        Neon::Timer_ms voxelTimer;
+        voxelTimer.start();
+        for (int i = 0; i < config.iterations; i++) {
+            laplacePerVoxel(grid, X, Y);
+            laplacePerVoxel(grid, Y, X);
+        }
+        voxelTimer.stop();
+
+        X.forEachActiveCell([&](const Neon::index_3d&, const int&, Type& val) { res.voxelChecksum += val; });
+        res.voxelMcups = double(res.nActiveCells) * 2.0 * double(config.iterations) / (voxelTimer.time() * 1.0e3);
+    }
+    return res;
+}
+
+/**
+ * Usage: sPt_bGridBlockSize [-dim N] [-iterations N] [-warmup N] [-gpus N] [-fill r0 r1 ...] [-o name]
+ * With -gpus 0 (default) or when no GPU is available the benchmark runs on the CPU.
+ * 16^3 blocks are skipped on the GPU since they exceed the maximum CUDA block size.
+ */
+int main(int argc, char** argv)
+{
+    Neon::init();
+
+    BenchmarkConfig     config;
+    std::vector<double> fillRatios;
+
+    auto cli = (clipp::option("-dim") & clipp::opt_values("dim", config.dim),
+                clipp::option("-iterations") & clipp::opt_values("Number of iterations", config.iterations),
+                clipp::option("-warmup") & clipp::opt_values("Number of warmup iterations", config.warmup),
+                clipp::option("-gpus") & clipp::opt_values("Number of gpus, 0 for the CPU", config.nGPUs),
+                clipp::option("-fill") & clipp::opt_values("Fraction of active cells in the bounding box", fillRatios),
+                clipp::option("-o") & clipp::opt_values("report name", config.reportName));
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << "Invalid input arguments!\n";
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        exit(EXIT_FAILURE);
+    }
+    if (!fillRatios.empty()) {
+        config.fillRatios = fillRatios;
+    }
+
+    const int nAvailableGPUs = Neon::sys::globalSpace::gpuSysObjStorage.numDevs();
+    if (config.nGPUs > nAvailableGPUs) {
+        printf("%d GPUs requested, %d available: running on the CPU\n", config.nGPUs, nAvailableGPUs);
+        config.nGPUs = 0;
+    }
+
+    // bGrid supports a single partition
+    Neon::Backend backend = config.nGPUs > 0 ? Neon::Backend(1, Neon::Runtime::stream)
+                                             : Neon::Backend(1, Neon::Runtime::openmp);
+
+    Neon::Report report("bGrid block size benchmark");
+    report.addMember("Backend", backend.toString());
+    report.addMember("dim", config.dim);
+    report.addMember("nIterations", config.iterations);
+
+    int exitCode = EXIT_SUCCESS;
+
+    printf("%-6s %-6s %12s %10s %10s %10s %10s %10s %11s\n",
+           "fill", "block", "activeCells", "blocks", "occupancy", "fieldMB", "metaMB", "MCUPS", "voxelMCUPS");
+
+    for (const double fillRatio : config.fillRatios) {
+        std::ostringstream fillName;
+        fillName << "fill" << fillRatio;
+
+        auto record = [&](int blockSize, const BenchmarkResult& res) {
+            const double occupancy = double(res.nActiveCells) / double(res.nAllocatedVoxels);
+            printf("%-6.3f %-6d %12lu %10lu %10.3f %10.2f %10.2f %10.2f %11.2f\n",
+                   fillRatio, blockSize, static_cast<unsigned long>(res.nActiveCells),
+                   static_cast<unsigned long>(res.nBlocks), occupancy, res.fieldMB, res.metadataMB, res.mcups, res.voxelMcups);
+
+            const std::string prefix = fillName.str() + "_b" + std::to_string(blockSize) + "_";
+            report.addMember(prefix + "activeCells", res.nActiveCells);
+            report.addMember(prefix + "blocks", res.nBlocks);
+            report.addMember(prefix + "occupancy", occupancy);
+            report.addMember(prefix + "fieldMB", res.fieldMB);
+            report.addMember(prefix + "metadataMB", res.metadataMB);
+            report.addMember(prefix + "MCUPS", res.mcups);
+            if (backend.devType() == Neon::DeviceType::CPU) {
+                report.addMember(prefix + "voxelMCUPS", res.voxelMcups);
+                if (!sameChecksum(res.checksum, res.voxelChecksum)) {
+                    printf("block size %d: the per-voxel path does not match the block execution\n", blockSize);
+                    exitCode = EXIT_FAILURE;
+                }
+            }
+        };
+
+        const BenchmarkResult b4 = runBlockSize<Neon::domain::bGrid4>(backend, config, fillRatio);
+        const BenchmarkResult b8 = runBlockSize<Neon::domain::bGrid8>(backend, config, fillRatio);
+        record(4, b4);
+        record(8, b8);
+        if (!sameChecksum(b4.checksum, b8.checksum)) {
+            printf("block size 8 does not match block size 4\n");
+            exitCode = EXIT_FAILURE;
+        }
+
+        if (backend.devType() == Neon::DeviceType::CPU) {
+            const BenchmarkResult b16 = runBlockSize<Neon::domain::bGrid16>(backend, config, fillRatio);
+            record(16, b16);
+            if (!sameChecksum(b4.checksum, b16.checksum)) {
+                printf("block size 16 does not match block size 4\n");
+                exitCode = EXIT_FAILURE;
+            }
+        }
+    }
+
+    report.write(config.reportName, true);
+    return exitCode;
+}
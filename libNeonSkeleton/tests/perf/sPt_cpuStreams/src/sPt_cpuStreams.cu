@@ -0,0 +1,153 @@
+// Benchmark of the asynchronous CPU streams of the openmp runtime (see Neon::Backend::setCpuStreams).
+// A 7-point Laplacian is applied repeatedly on a partitioned dGrid, with and without OCC,
+// first with the default synchronous openmp runtime and then with CPU streams.
+// With CPU streams the partitions run concurrently and, with OCC, the halo update of the boundary
+// overlaps the computation of the internal cells.
+// The throughput is reported in million cell updates per second (MCUPS).
+
+#include <iostream>
+
+#include "Neon/Neon.h"
+#include "Neon/Report.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+struct BenchmarkConfig
+{
+    int         dim = 128;
+    int         iterations = 20;
+    int         warmup = 2;
+    int         nPartitions = 4;
+    std::string reportName = "sPt_cpuStreams";
+};
+
+template <typename Field>
+auto laplace(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Laplace",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                Type res = 0;
+                for (uint8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                    auto neighbor = xLocal.nghVal(cell, nghIdx, 0, Type(0));
+                    res += neighbor.value;
+                }
+                yLocal(cell, 0) = (res + xLocal(cell, 0)) / Type(7);
+            };
+        });
+}
+
+/**
+ * Runs the benchmark for one configuration and returns the throughput in MCUPS.
+ * The checksum of the result is returned to verify that all configurations compute the same values.
+ */
+auto runConfig(const BenchmarkConfig& config,
+               bool                   cpuStreams,
+               Neon::skeleton::Occ    occ,
+               double&                checksum) -> double
+{
+    using Type = double;
+
+    Neon::Backend backend(config.nPartitions, Neon::Runtime::openmp);
+    backend.setCpuStreams(cpuStreams);
+
+    const Neon::index_3d dim(config.dim, config.dim, config.dim);
+    Neon::domain::dGrid  grid(
+        backend, dim, [](const Neon::index_3d&) { return true; },
+        Neon::domain::Stencil::s7_Laplace_t());
+
+    auto X = grid.newField<Type>("X", 1, 0);
+    auto Y = grid.newField<Type>("Y", 1, 0);
+
+    X.forEachActiveCell([&](const Neon::index_3d& idx, const int&, Type& val) {
+        val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29) % 101);
+    });
+    Y.forEachActiveCell([](const Neon::index_3d&, const int&, Type& val) { val = 0; });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+
+    // Each skeleton run applies the stencil twice, ping-ponging between the two fields
+    Neon::skeleton::Skeleton sk(backend);
+    Neon::skeleton::Options  opt(occ, Neon::set::TransferMode::get);
+    sk.sequence({laplace(X, Y), laplace(Y, X)}, "Laplace", opt);
+
+    for (int i = 0; i < config.warmup; i++) {
+        sk.run();
+    }
+    backend.syncAll();
+
+    Neon::Timer_ms timer;
+    timer.start();
+    for (int i = 0; i < config.iterations; i++) {
+        sk.run();
+    }
+    backend.syncAll();
+    timer.stop();
+
+    X.updateIO(0);
+    backend.syncAll();
+    checksum = 0;
+    X.forEachActiveCell([&](const Neon::index_3d&, const int&, Type& val) { checksum += val; });
+
+    const double nCells = double(dim.rMulTyped<size_t>());
+    return nCells * 2.0 * double(config.iterations) / (timer.time() * 1.0e3);
+}
+
+/**
+ * Usage: sPt_cpuStreams [-dim N] [-iterations N] [-warmup N] [-partitions N] [-o name]
+ */
+int main(int argc, char** argv)
+{
+    Neon::init();
+
+    BenchmarkConfig config;
+
+    auto cli = (clipp::option("-dim") & clipp::opt_values("dim", config.dim),
+                clipp::option("-iterations") & clipp::opt_values("Number of iterations", config.iterations),
+                clipp::option("-warmup") & clipp::opt_values("Number of warmup iterations", config.warmup),
+                clipp::option("-partitions") & clipp::opt_values("Number of CPU partitions", config.nPartitions),
+                clipp::option("-o") & clipp::opt_values("report name", config.reportName));
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << "Invalid input arguments!\n";
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    Neon::Report report("CPU streams benchmark");
+    report.addMember("dim", config.dim);
+    report.addMember("nPartitions", config.nPartitions);
+    report.addMember("nIterations", config.iterations);
+
+    int    exitCode = EXIT_SUCCESS;
+    double referenceChecksum = 0;
+    double referenceMcups = 0;
+    for (bool cpuStreams : {false, true}) {
+        for (auto occ : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard, Neon::skeleton::Occ::extended}) {
+            const std::string name = std::string(cpuStreams ? "cpuStreams_" : "sync_") + Neon::skeleton::OccUtils::toString(occ);
+            double            checksum = 0;
+            const double      mcups = runConfig(config, cpuStreams, occ, checksum);
+
+            if (!cpuStreams && occ == Neon::skeleton::Occ::none) {
+                referenceChecksum = checksum;
+                referenceMcups = mcups;
+            } else if (checksum != referenceChecksum) {
+                printf("%s does not match the synchronous runtime without OCC\n", name.c_str());
+                exitCode = EXIT_FAILURE;
+            }
+
+            printf("%-26s %10.2f MCUPS  speedup %5.2fx\n", name.c_str(), mcups, mcups / referenceMcups);
+            report.addMember(name + "_MCUPS", mcups);
+        }
+    }
+
+    report.write(config.reportName, true);
+    return exitCode;
+}
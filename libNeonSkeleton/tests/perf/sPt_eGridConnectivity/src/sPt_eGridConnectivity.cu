@@ -0,0 +1,193 @@
+// Benchmark of the eGrid connectivity storage (see Neon::domain::internal::eGrid::ConnectivityMode).
+// The domain is a ball inside a cubic background grid. For a 7-point and a 27-point stencil
+// it reports the bytes of metadata per active cell (connectivity table and inverse mapping)
+// and the throughput in million active cell updates per second (MCUPS) of the full and of the compact table.
+// It runs on the CPU (openmp runtime) when no GPU is selected or available.
+
+#include <iostream>
+
+#include "Neon/Neon.h"
+#include "Neon/Report.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+using CellOrdering = Neon::domain::internal::eGrid::CellOrdering;
+using CellOrderingUtils = Neon::domain::internal::eGrid::CellOrderingUtils;
+using ConnectivityMode = Neon::domain::internal::eGrid::ConnectivityMode;
+
+struct BenchmarkConfig
+{
+    int         dim = 128;
+    int         iterations = 20;
+    int         warmup = 2;
+    int         nGPUs = 0;
+    int         nPartitions = 1;
+    std::string ordering = "scan";
+    std::string reportName = "sPt_eGridConnectivity";
+};
+
+/**
+ * Average over all the neighbours of the stencil
+ */
+template <typename Field>
+auto stencilAverage(const Field& x, Field& y, int nNeighbours) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "StencilAverage",
+        [&, nNeighbours](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                Type res = 0;
+                for (int8_t nghIdx = 0; nghIdx < nNeighbours; ++nghIdx) {
+                    auto neighbor = xLocal.nghVal(cell, nghIdx, 0, xLocal(cell, 0));
+                    res += neighbor.value;
+                }
+                yLocal(cell, 0) = res / Type(nNeighbours);
+            };
+        });
+}
+
+auto isActive(const BenchmarkConfig& config, const Neon::index_3d& idx) -> bool
+{
+    const double c = config.dim / 2.0;
+    const double dx = idx.x - c;
+    const double dy = idx.y - c;
+    const double dz = idx.z - c;
+    return dx * dx + dy * dy + dz * dz < c * c;
+}
+
+/**
+ * Runs the benchmark for one stencil and one connectivity mode and returns the throughput in MCUPS.
+ * The checksum of the result is returned to verify that both modes compute the same values.
+ */
+auto runMode(const Neon::Backend&         backend,
+             const BenchmarkConfig&       config,
+             const Neon::domain::Stencil& stencil,
+             ConnectivityMode             mode,
+             double&                      bytesPerCell,
+             double&                      checksum) -> double
+{
+    using Type = double;
+
+    Neon::domain::eGrid grid(
+        backend, Neon::index_3d(config.dim, config.dim, config.dim),
+        [&](const Neon::index_3d& idx) { return isActive(config, idx); },
+        stencil, Neon::Vec_3d<double>(1, 1, 1), Neon::Vec_3d<double>(0, 0, 0), false,
+        CellOrderingUtils::fromString(config.ordering), mode);
+
+    auto X = grid.newField<Type>("X", 1, 0);
+    auto Y = grid.newField<Type>("Y", 1, 0);
+
+    double nActive = 0;
+    X.forEachActiveCell([&](const Neon::index_3d& idx, const int&, Type& val) {
+        val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29) % 101);
+        nActive += 1;
+    });
+    Y.forEachActiveCell([](const Neon::index_3d&, const int&, Type& val) { val = 0; });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+
+    bytesPerCell = double(grid.getConnectivityBytes()) / nActive;
+
+    // Each skeleton run applies the stencil twice, ping-ponging between the two fields
+    const int                nNeighbours = stencil.nNeighbours();
+    Neon::skeleton::Skeleton sk(backend);
+    sk.sequence({stencilAverage(X, Y, nNeighbours), stencilAverage(Y, X, nNeighbours)}, "StencilAverage");
+
+    for (int i = 0; i < config.warmup; i++) {
+        sk.run();
+    }
+    backend.syncAll();
+
+    Neon::Timer_ms timer;
+    timer.start();
+    for (int i = 0; i < config.iterations; i++) {
+        sk.run();
+    }
+    backend.syncAll();
+    timer.stop();
+
+    X.updateIO(0);
+    backend.syncAll();
+    checksum = 0;
+    X.forEachActiveCell([&](const Neon::index_3d&, const int&, Type& val) { checksum += val; });
+
+    return nActive * 2.0 * double(config.iterations) / (timer.time() * 1.0e3);
+}
+
+/**
+ * Usage: sPt_eGridConnectivity [-dim N] [-iterations N] [-warmup N] [-gpus N] [-partitions N] [-ordering name] [-o name]
+ * With -gpus 0 (default) or when no GPU is available the benchmark runs on the CPU.
+ */
+int main(int argc, char** argv)
+{
+    Neon::init();
+
+    BenchmarkConfig config;
+
+    auto cli = (clipp::option("-dim") & clipp::opt_values("dim", config.dim),
+                clipp::option("-iterations") & clipp::opt_values("Number of iterations", config.iterations),
+                clipp::option("-warmup") & clipp::opt_values("Number of warmup iterations", config.warmup),
+                clipp::option("-gpus") & clipp::opt_values("Number of gpus, 0 for the CPU", config.nGPUs),
+                clipp::option("-partitions") & clipp::opt_values("Number of CPU partitions", config.nPartitions),
+                clipp::option("-ordering") & clipp::opt_values("Cell ordering: scan, morton, hilbert or rcm", config.ordering),
+                clipp::option("-o") & clipp::opt_values("report name", config.reportName));
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << "Invalid input arguments!\n";
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    const int nAvailableGPUs = Neon::sys::globalSpace::gpuSysObjStorage.numDevs();
+    if (config.nGPUs > nAvailableGPUs) {
+        printf("%d GPUs requested, %d available: running on the CPU\n", config.nGPUs, nAvailableGPUs);
+        config.nGPUs = 0;
+    }
+
+    Neon::Backend backend = config.nGPUs > 0 ? Neon::Backend(config.nGPUs, Neon::Runtime::stream)
+                                             : Neon::Backend(config.nPartitions, Neon::Runtime::openmp);
+
+    Neon::Report report("eGrid connectivity benchmark");
+    report.addMember("Backend", backend.toString());
+    report.addMember("dim", config.dim);
+    report.addMember("ordering", config.ordering);
+    report.addMember("nIterations", config.iterations);
+
+    const std::vector<std::pair<std::string, Neon::domain::Stencil>> stencils{
+        {"s7", Neon::domain::Stencil::s7_Laplace_t()},
+        {"s27", Neon::domain::Stencil::s27_t()}};
+
+    int exitCode = EXIT_SUCCESS;
+    for (const auto& [stencilName, stencil] : stencils) {
+        double       fullBytes = 0;
+        double       fullChecksum = 0;
+        const double fullMcups = runMode(backend, config, stencil, ConnectivityMode::full, fullBytes, fullChecksum);
+
+        double       compactBytes = 0;
+        double       compactChecksum = 0;
+        const double compactMcups = runMode(backend, config, stencil, ConnectivityMode::compact, compactBytes, compactChecksum);
+
+        if (compactChecksum != fullChecksum) {
+            printf("%s: the compact connectivity does not match the full one\n", stencilName.c_str());
+            exitCode = EXIT_FAILURE;
+        }
+
+        printf("%-4s full    %7.1f B/cell  %10.2f MCUPS\n", stencilName.c_str(), fullBytes, fullMcups);
+        printf("%-4s compact %7.1f B/cell  %10.2f MCUPS  speedup %5.2fx\n",
+               stencilName.c_str(), compactBytes, compactMcups, compactMcups / fullMcups);
+
+        report.addMember(stencilName + "_full_BytesPerCell", fullBytes);
+        report.addMember(stencilName + "_full_MCUPS", fullMcups);
+        report.addMember(stencilName + "_compact_BytesPerCell", compactBytes);
+        report.addMember(stencilName + "_compact_MCUPS", compactMcups);
+    }
+
+    report.write(config.reportName, true);
+    return exitCode;
+}
@@ -0,0 +1,196 @@
+// Stencil benchmark over the eGrid cell orderings (see Neon::domain::internal::eGrid::CellOrdering).
+// The domain is a porous ball: a ball where some of the cells with three odd coordinates are randomly removed
+// (their neighbours are never removed, so no cell is left without neighbours).
+// A 7-point Laplacian is applied repeatedly on a scalar field and, for every ordering,
+// the grid construction time and the throughput in million active cell updates per second (MCUPS) are reported.
+// It runs on the CPU (openmp runtime) when no GPU is selected or available.
+
+#include <iostream>
+
+#include "Neon/Neon.h"
+#include "Neon/Report.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+using CellOrdering = Neon::domain::internal::eGrid::CellOrdering;
+using CellOrderingUtils = Neon::domain::internal::eGrid::CellOrderingUtils;
+
+struct BenchmarkConfig
+{
+    int         dim = 128;
+    int         holes = 50;
+    int         iterations = 20;
+    int         warmup = 2;
+    int         nGPUs = 0;
+    int         nPartitions = 1;
+    std::string reportName = "sPt_eGridOrdering";
+};
+
+template <typename Field>
+auto laplace(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Laplace",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                Type res = 0;
+                for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                    auto neighbor = xLocal.nghVal(cell, nghIdx, 0, Type(0));
+                    res += neighbor.value;
+                }
+                yLocal(cell, 0) = res - 6 * xLocal(cell, 0);
+            };
+        });
+}
+
+/**
+ * Porous ball: cells with odd coordinates are removed with probability holes / 100 (hash based, reproducible)
+ */
+auto isActive(const BenchmarkConfig& config, const Neon::index_3d& idx) -> bool
+{
+    const double c = config.dim / 2.0;
+    const double dx = idx.x - c;
+    const double dy = idx.y - c;
+    const double dz = idx.z - c;
+    if (dx * dx + dy * dy + dz * dz >= c * c) {
+        return false;
+    }
+    if (idx.x % 2 == 0 || idx.y % 2 == 0 || idx.z % 2 == 0) {
+        return true;
+    }
+    uint64_t h = uint64_t(idx.mPitch(config.dim, config.dim)) * 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 29;
+    return int(h % 100) >= config.holes;
+}
+
+/**
+ * Runs the benchmark for one ordering and returns the throughput in MCUPS.
+ * The checksum of the result is returned to verify that all orderings compute the same values.
+ */
+auto runOrdering(const Neon::Backend&   backend,
+                 const BenchmarkConfig& config,
+                 CellOrdering           ordering,
+                 double&                setupMs,
+                 double&                checksum) -> double
+{
+    using Type = double;
+
+    Neon::Timer_ms setup;
+    setup.start();
+    Neon::domain::eGrid grid(
+        backend, Neon::index_3d(config.dim, config.dim, config.dim),
+        [&](const Neon::index_3d& idx) { return isActive(config, idx); },
+        Neon::domain::Stencil::s7_Laplace_t(),
+        Neon::Vec_3d<double>(1, 1, 1), Neon::Vec_3d<double>(0, 0, 0), false, ordering);
+    setup.stop();
+    setupMs = setup.time();
+
+    auto X = grid.newField<Type>("X", 1, 0);
+    auto Y = grid.newField<Type>("Y", 1, 0);
+
+    double nActive = 0;
+    X.forEachActiveCell([&](const Neon::index_3d& idx, const int&, Type& val) {
+        val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29) % 101);
+        nActive += 1;
+    });
+    Y.forEachActiveCell([](const Neon::index_3d&, const int&, Type& val) { val = 0; });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+
+    // Each skeleton run applies the stencil twice, ping-ponging between the two fields
+    Neon::skeleton::Skeleton sk(backend);
+    sk.sequence({laplace(X, Y), laplace(Y, X)}, std::string("Laplace_") + CellOrderingUtils::toString(ordering));
+
+    for (int i = 0; i < config.warmup; i++) {
+        sk.run();
+    }
+    backend.syncAll();
+
+    Neon::Timer_ms timer;
+    timer.start();
+    for (int i = 0; i < config.iterations; i++) {
+        sk.run();
+    }
+    backend.syncAll();
+    timer.stop();
+
+    X.updateIO(0);
+    backend.syncAll();
+    checksum = 0;
+    X.forEachActiveCell([&](const Neon::index_3d&, const int&, Type& val) { checksum += val; });
+
+    return nActive * 2.0 * double(config.iterations) / (timer.time() * 1.0e3);
+}
+
+/**
+ * Usage: sPt_eGridOrdering [-dim N] [-holes N] [-iterations N] [-warmup N] [-gpus N] [-partitions N] [-o name]
+ * With -gpus 0 (default) or when no GPU is available the benchmark runs on the CPU.
+ */
+int main(int argc, char** argv)
+{
+    Neon::init();
+
+    BenchmarkConfig config;
+
+    auto cli = (clipp::option("-dim") & clipp::opt_values("dim", config.dim),
+                clipp::option("-holes") & clipp::opt_values("Percentage of removed odd cells", config.holes),
+                clipp::option("-iterations") & clipp::opt_values("Number of iterations", config.iterations),
+                clipp::option("-warmup") & clipp::opt_values("Number of warmup iterations", config.warmup),
+                clipp::option("-gpus") & clipp::opt_values("Number of gpus, 0 for the CPU", config.nGPUs),
+                clipp::option("-partitions") & clipp::opt_values("Number of CPU partitions", config.nPartitions),
+                clipp::option("-o") & clipp::opt_values("report name", config.reportName));
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << "Invalid input arguments!\n";
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    const int nAvailableGPUs = Neon::sys::globalSpace::gpuSysObjStorage.numDevs();
+    if (config.nGPUs > nAvailableGPUs) {
+        printf("%d GPUs requested, %d available: running on the CPU\n", config.nGPUs, nAvailableGPUs);
+        config.nGPUs = 0;
+    }
+
+    Neon::Backend backend = config.nGPUs > 0 ? Neon::Backend(config.nGPUs, Neon::Runtime::stream)
+                                             : Neon::Backend(config.nPartitions, Neon::Runtime::openmp);
+
+    Neon::Report report("eGrid cell ordering benchmark");
+    report.addMember("Backend", backend.toString());
+    report.addMember("dim", config.dim);
+    report.addMember("holes", config.holes);
+    report.addMember("nIterations", config.iterations);
+
+    int    exitCode = EXIT_SUCCESS;
+    double referenceChecksum = 0;
+    double referenceMcups = 0;
+    for (int i = 0; i < CellOrderingUtils::nConfig; i++) {
+        const auto   ordering = CellOrderingUtils::fromInt(i);
+        const auto   name = std::string(CellOrderingUtils::toString(ordering));
+        double       setupMs = 0;
+        double       checksum = 0;
+        const double mcups = runOrdering(backend, config, ordering, setupMs, checksum);
+
+        if (ordering == CellOrdering::scan) {
+            referenceChecksum = checksum;
+            referenceMcups = mcups;
+        } else if (checksum != referenceChecksum) {
+            printf("%s does not match the scan ordering\n", name.c_str());
+            exitCode = EXIT_FAILURE;
+        }
+
+        printf("%-8s setup %9.1f ms  %10.2f MCUPS  speedup %5.2fx  checksum %e\n",
+               name.c_str(), setupMs, mcups, mcups / referenceMcups, checksum);
+        report.addMember(name + "_Setup_ms", setupMs);
+        report.addMember(name + "_MCUPS", mcups);
+    }
+
+    report.write(config.reportName, true);
+    return exitCode;
+}
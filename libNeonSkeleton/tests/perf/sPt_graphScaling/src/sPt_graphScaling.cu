@@ -0,0 +1,181 @@
+// Scaling of the graph analyses used to build a skeleton.
+// 1. Synthetic dependency graphs from 10 to 10,000 nodes (a chain of operations where each node
+//    also depends on a few random earlier ones, as produced by the data dependency analysis):
+//    time of the CSR snapshot, transitive reduction and levels.
+// 2. Skeleton::sequence on a chain of map containers of increasing length, with the graph cache disabled.
+// Times are reported in ms. It runs on the CPU (openmp runtime) when no GPU is selected or available.
+
+#include <iostream>
+
+#include "Neon/Neon.h"
+#include "Neon/Report.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/core/types/CsrDiGraph.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+struct BenchmarkConfig
+{
+    int         maxNodes = 10000;
+    int         maxContainers = 1000;
+    int         fanIn = 3;
+    int         window = 32;
+    int         nGPUs = 0;
+    int         nPartitions = 2;
+    std::string reportName = "sPt_graphScaling";
+};
+
+/**
+ * Chain of nNodes nodes where each node also depends on fanIn random nodes among the previous window ones
+ */
+auto dependencyGraph(int nNodes, const BenchmarkConfig& config) -> Neon::DiGraph<>
+{
+    Neon::DiGraph<> graph;
+    uint64_t        seed = 42;
+    auto            rnd = [&]() {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return int(seed >> 33);
+    };
+    for (int v = 0; v < nNodes; v++) {
+        graph.addVertex(v);
+        if (v == 0) {
+            continue;
+        }
+        graph.addEdge(v - 1, v);
+        for (int k = 0; k < config.fanIn; k++) {
+            const int parent = v - 1 - rnd() % std::min(v, config.window);
+            graph.addEdge(parent, v);
+        }
+    }
+    return graph;
+}
+
+template <typename Field>
+auto axpy(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "AXPY",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                yLocal(cell, 0) += 2 * xLocal(cell, 0);
+            };
+        });
+}
+
+/**
+ * Usage: sPt_graphScaling [-maxNodes N] [-maxContainers N] [-fanIn N] [-window N] [-gpus N] [-partitions N] [-o name]
+ * With -gpus 0 (default) or when no GPU is available the benchmark runs on the CPU.
+ */
+int main(int argc, char** argv)
+{
+    Neon::init();
+
+    BenchmarkConfig config;
+
+    auto cli = (clipp::option("-maxNodes") & clipp::opt_values("Largest synthetic graph", config.maxNodes),
+                clipp::option("-maxContainers") & clipp::opt_values("Largest skeleton", config.maxContainers),
+                clipp::option("-fanIn") & clipp::opt_values("Random dependencies per node", config.fanIn),
+                clipp::option("-window") & clipp::opt_values("Distance of the random dependencies", config.window),
+                clipp::option("-gpus") & clipp::opt_values("Number of gpus, 0 for the CPU", config.nGPUs),
+                clipp::option("-partitions") & clipp::opt_values("Number of CPU partitions", config.nPartitions),
+                clipp::option("-o") & clipp::opt_values("report name", config.reportName));
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << "Invalid input arguments!\n";
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    Neon::Report report("Skeleton graph scaling benchmark");
+    int          exitCode = EXIT_SUCCESS;
+
+    {  // Synthetic graphs
+        std::vector<int>    sizes;
+        std::vector<double> snapshotMs;
+        std::vector<double> reductionMs;
+        std::vector<double> levelsMs;
+        for (int n = 10; n <= config.maxNodes; n *= 10) {
+            auto graph = dependencyGraph(n, config);
+
+            Neon::Timer_ms timer;
+            timer.start();
+            auto csr = Neon::CsrDiGraph::fromDiGraph(graph);
+            timer.stop();
+            const double snapshot = timer.time();
+
+            timer.start();
+            auto redundant = csr.transitiveReduction();
+            timer.stop();
+            const double reduction = timer.time();
+
+            timer.start();
+            auto levels = csr.longestPathLevels();
+            timer.stop();
+            const double level = timer.time();
+
+            // Every random dependency is implied by the chain
+            const size_t nLeft = csr.numEdges() - redundant.size();
+            printf("%6d nodes %7zu edges: snapshot %9.3f ms  reduction %9.3f ms  levels %9.3f ms\n",
+                   n, csr.numEdges(), snapshot, reduction, level);
+            if (nLeft != size_t(n - 1) || levels[csr.vertexIdx(n - 1)] != n - 1) {
+                printf("%d nodes: unexpected transitive reduction (%zu edges left)\n", n, nLeft);
+                exitCode = EXIT_FAILURE;
+            }
+            sizes.push_back(n);
+            snapshotMs.push_back(snapshot);
+            reductionMs.push_back(reduction);
+            levelsMs.push_back(level);
+        }
+        report.addMember("nNodes", sizes);
+        report.addMember("Snapshot_ms", snapshotMs);
+        report.addMember("TransitiveReduction_ms", reductionMs);
+        report.addMember("Levels_ms", levelsMs);
+    }
+
+    {  // Skeleton
+        const int nAvailableGPUs = Neon::sys::globalSpace::gpuSysObjStorage.numDevs();
+        if (config.nGPUs > nAvailableGPUs) {
+            printf("%d GPUs requested, %d available: running on the CPU\n", config.nGPUs, nAvailableGPUs);
+            config.nGPUs = 0;
+        }
+
+        Neon::Backend backend = config.nGPUs > 0 ? Neon::Backend(config.nGPUs, Neon::Runtime::stream)
+                                                 : Neon::Backend(config.nPartitions, Neon::Runtime::openmp);
+        report.addMember("Backend", backend.toString());
+
+        Neon::domain::dGrid grid(
+            backend, Neon::index_3d(8, 8, 8 * backend.devSet().setCardinality()),
+            [](const Neon::index_3d&) { return true; },
+            Neon::domain::Stencil::s7_Laplace_t());
+
+        auto X = grid.newField<double>("X", 1, 0);
+        auto Y = grid.newField<double>("Y", 1, 0);
+
+        std::vector<int>    sizes;
+        std::vector<double> sequenceMs;
+        for (int n = 10; n <= config.maxContainers; n *= 10) {
+            std::vector<Neon::set::Container> ops;
+            for (int i = 0; i < n; i++) {
+                ops.push_back(i % 2 == 0 ? axpy(X, Y) : axpy(Y, X));
+            }
+            Neon::skeleton::Skeleton sk(backend);
+            Neon::Timer_ms           timer;
+            timer.start();
+            sk.sequence(ops, "graphScaling");
+            timer.stop();
+
+            printf("%6d containers: sequence %9.3f ms\n", n, timer.time());
+            sizes.push_back(n);
+            sequenceMs.push_back(timer.time());
+        }
+        report.addMember("nContainers", sizes);
+        report.addMember("Sequence_ms", sequenceMs);
+    }
+
+    report.write(config.reportName, true);
+    return exitCode;
+}
@@ -0,0 +1,139 @@
+// Benchmark of the launch overhead of the openmp runtime on small grids.
+// A skeleton made of a chain of empty containers is run on dGrids of 16^3 to 64^3 cells per partition,
+// so that the time per container is dominated by the launch: the kernel configuration, the extraction
+// of the partition lambdas and the fork/join of the OpenMP thread team.
+// Each dimension is run twice: with every kernel in a parallel region (the default) and with
+// the serial launch path (see Neon::Backend::setCpuSerialLaunchThreshold), where the kernels of the
+// partitions run on the calling thread.
+// The latency is reported in microseconds per container.
+// The idle threads of the team spin or sleep depending on the OpenMP runtime:
+// run with OMP_WAIT_POLICY=active to keep a persistent spinning team between launches.
+
+#include <iostream>
+#include <limits>
+
+#include <omp.h>
+
+#include "Neon/Neon.h"
+#include "Neon/Report.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+struct BenchmarkConfig
+{
+    std::vector<int> dims{16, 32, 48, 64};
+    int              nContainers = 32;
+    int              iterations = 200;
+    int              warmup = 10;
+    int              nPartitions = 1;
+    std::string      reportName = "sPt_launchOverhead";
+};
+
+/**
+ * A container that loads a field and does nothing with it.
+ */
+template <typename Field>
+auto empty(Field& x, int id) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Empty" + std::to_string(id),
+        [&](Neon::set::Loader& loader) {
+            auto& xLocal = loader.load(x);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell&) mutable {
+                (void)xLocal;
+            };
+        });
+}
+
+/**
+ * Runs the benchmark for one configuration and returns the latency per container in microseconds.
+ */
+auto runConfig(const BenchmarkConfig& config,
+               int                    dim,
+               bool                   serialLaunch) -> double
+{
+    using Type = double;
+
+    Neon::Backend backend(config.nPartitions, Neon::Runtime::openmp);
+    if (serialLaunch) {
+        backend.setCpuSerialLaunchThreshold(std::numeric_limits<int64_t>::max());
+    }
+
+    const Neon::index_3d domain(dim, dim, dim * config.nPartitions);
+    Neon::domain::dGrid  grid(
+        backend, domain, [](const Neon::index_3d&) { return true; },
+        Neon::domain::Stencil::s7_Laplace_t());
+
+    auto X = grid.newField<Type>("X", 1, 0);
+
+    std::vector<Neon::set::Container> ops;
+    for (int i = 0; i < config.nContainers; i++) {
+        ops.push_back(empty(X, i));
+    }
+    Neon::skeleton::Skeleton sk(backend);
+    Neon::skeleton::Options  opt(Neon::skeleton::Occ::none, Neon::set::TransferMode::get);
+    sk.sequence(ops, "Empty", opt);
+
+    for (int i = 0; i < config.warmup; i++) {
+        sk.run();
+    }
+    backend.syncAll();
+
+    Neon::Timer_ms timer;
+    timer.start();
+    for (int i = 0; i < config.iterations; i++) {
+        sk.run();
+    }
+    backend.syncAll();
+    timer.stop();
+
+    return timer.time() * 1.0e3 / double(config.iterations * config.nContainers);
+}
+
+/**
+ * Usage: sPt_launchOverhead [-dims N...] [-containers N] [-iterations N] [-warmup N] [-partitions N] [-o name]
+ */
+int main(int argc, char** argv)
+{
+    Neon::init();
+
+    BenchmarkConfig config;
+
+    auto cli = (clipp::option("-dims") & clipp::values("Dimensions of the partitions", config.dims),
+                clipp::option("-containers") & clipp::opt_values("Number of containers of the skeleton", config.nContainers),
+                clipp::option("-iterations") & clipp::opt_values("Number of iterations", config.iterations),
+                clipp::option("-warmup") & clipp::opt_values("Number of warmup iterations", config.warmup),
+                clipp::option("-partitions") & clipp::opt_values("Number of CPU partitions", config.nPartitions),
+                clipp::option("-o") & clipp::opt_values("report name", config.reportName));
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << "Invalid input arguments!\n";
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    Neon::Report report("Launch overhead benchmark");
+    report.addMember("nPartitions", config.nPartitions);
+    report.addMember("nContainers", config.nContainers);
+    report.addMember("nIterations", config.iterations);
+    report.addMember("nThreads", omp_get_max_threads());
+
+    for (int dim : config.dims) {
+        const double parallelUs = runConfig(config, dim, false);
+        const double serialUs = runConfig(config, dim, true);
+
+        printf("%3d^3 per partition: parallel %8.2f us  serial %8.2f us  per container\n", dim, parallelUs, serialUs);
+
+        auto subdoc = report.getSubdoc();
+        report.addMember("dim", dim, &subdoc);
+        report.addMember("parallelLatencyUs", parallelUs, &subdoc);
+        report.addMember("serialLatencyUs", serialUs, &subdoc);
+        report.addSubdoc("dim" + std::to_string(dim), subdoc);
+    }
+
+    report.write(config.reportName, true);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,331 @@
+// Roofline benchmark of the basic kernels of Neon on the CPU (openmp runtime).
+// Map (axpy), stencil (7, 19 and 27 points), reduction (dot) and halo update kernels are run
+// on dGrid, eGrid and bGrid for a configurable number of partitions and OpenMP threads.
+// Each kernel reports its effective bandwidth (GB/s) and throughput (GFLOP/s), computed from the
+// compulsory memory traffic of the kernel, against the bandwidth ceiling of the machine measured
+// with a STREAM triad. Results are written as JSON through Neon::Report so that runs can be compared.
+//
+// The traffic model counts each field access of a cell once (perfect cache reuse of the stencil
+// neighbours) and ignores the metadata of the grids (e.g. the connectivity table of eGrid),
+// therefore a bandwidth fraction lower than one measures how far a grid is from the ideal layout.
+
+#include <omp.h>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <memory>
+
+#include "Neon/Neon.h"
+#include "Neon/Report.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+
+using Type = double;
+
+struct BenchmarkConfig
+{
+    int              dim = 128;
+    int              iterations = 20;
+    int              warmup = 2;
+    int              nThreads = 0 /**< 0 for the OpenMP default */;
+    std::vector<int> nPartitions = {1, 2};
+    size_t           streamElements = size_t(1) << 25;
+    std::string      reportName = "sPt_roofline";
+};
+
+/**
+ * Compulsory traffic and floating point operations of a kernel per active cell
+ */
+struct Workload
+{
+    double bytesPerCell = 0;
+    double flopsPerCell = 0;
+};
+
+/**
+ * Bandwidth of a STREAM triad a[i] = b[i] + s * c[i] in GB/s, best of nRepeats runs.
+ * As in STREAM, three arrays are counted per element (write allocate traffic is not counted).
+ */
+auto streamTriad(size_t nElements, int nRepeats) -> double
+{
+    std::unique_ptr<double[]> a(new double[nElements]);
+    std::unique_ptr<double[]> b(new double[nElements]);
+    std::unique_ptr<double[]> c(new double[nElements]);
+
+    // First touch by the threads that run the triad
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(nElements); i++) {
+        a[i] = 0;
+        b[i] = 1;
+        c[i] = 2;
+    }
+
+    const double s = 3;
+    double       bestMs = std::numeric_limits<double>::max();
+    for (int r = 0; r < nRepeats; r++) {
+        Neon::Timer_ms timer;
+        timer.start();
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < int64_t(nElements); i++) {
+            a[i] = b[i] + s * c[i];
+        }
+        timer.stop();
+        bestMs = std::min(bestMs, timer.time());
+    }
+    return 3.0 * double(sizeof(double)) * double(nElements) / (bestMs * 1.0e6);
+}
+
+template <typename Field>
+auto axpy(const Type a, const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "AXPY",
+        [&, a](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                yLocal(cell, 0) += a * xLocal(cell, 0);
+            };
+        });
+}
+
+/**
+ * Dot product through the user-defined reduction, which every grid supports
+ */
+template <typename Field>
+auto reduceDot(const Field& x, const Field& y, Neon::template PatternScalar<Type>& result) -> Neon::set::Container
+{
+    using Cell = typename Field::Cell;
+    return x.getGrid().reduce(
+        "ReduceDot",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x);
+            const auto& yLocal = loader.load(y);
+            return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) -> Type {
+                return xLocal(cell, 0) * yLocal(cell, 0);
+            };
+        },
+        Neon::reduceOp::Sum<Type>(), Type(0), result);
+}
+
+/**
+ * Laplacian on all the neighbours of the stencil of the grid
+ */
+template <typename Field>
+auto stencil(const Field& x, Field& y, int nNeighbours) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Stencil",
+        [&, nNeighbours](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                Type res = 0;
+                for (int nghIdx = 0; nghIdx < nNeighbours; ++nghIdx) {
+                    res += xLocal.nghVal(cell, uint8_t(nghIdx), 0, Type(0)).value;
+                }
+                yLocal(cell, 0) = res - Type(nNeighbours) * xLocal(cell, 0);
+            };
+        });
+}
+
+/**
+ * Average time in ms of an iteration of the kernel after config.warmup warm up iterations
+ */
+template <typename Kernel>
+auto timeKernel(const Neon::Backend&   backend,
+                const BenchmarkConfig& config,
+                Kernel                 kernel) -> double
+{
+    for (int i = 0; i < config.warmup; i++) {
+        kernel();
+    }
+    backend.syncAll();
+
+    Neon::Timer_ms timer;
+    timer.start();
+    for (int i = 0; i < config.iterations; i++) {
+        kernel();
+    }
+    backend.syncAll();
+    timer.stop();
+    return timer.time() / double(config.iterations);
+}
+
+/**
+ * Prints and reports the performance of a kernel
+ */
+struct Recorder
+{
+    Neon::Report& report;
+    double        streamGBs;
+
+    auto operator()(const std::string& gridName,
+                    const std::string& kernelName,
+                    int                nPartitions,
+                    uint64_t           nCells,
+                    double             timeMs,
+                    const Workload&    workload) -> void
+    {
+        const double bytes = workload.bytesPerCell * double(nCells);
+        const double flops = workload.flopsPerCell * double(nCells);
+        const double gbs = bytes / (timeMs * 1.0e6);
+        const double gflops = flops / (timeMs * 1.0e6);
+        const double intensity = bytes > 0 ? flops / bytes : 0;
+
+        printf("%-6s %-10s %4d %12lu %10.4f %10.2f %10.2f %8.3f %10.2f\n",
+               gridName.c_str(), kernelName.c_str(), nPartitions, static_cast<unsigned long>(nCells),
+               timeMs, gbs, gflops, gbs / streamGBs, intensity * streamGBs);
+
+        auto subdoc = report.getSubdoc();
+        report.addMember("grid", gridName, &subdoc);
+        report.addMember("kernel", kernelName, &subdoc);
+        report.addMember("partitions", nPartitions, &subdoc);
+        report.addMember("cells", nCells, &subdoc);
+        report.addMember("timeMs", timeMs, &subdoc);
+        report.addMember("GBs", gbs, &subdoc);
+        report.addMember("GFLOPs", gflops, &subdoc);
+        report.addMember("arithmeticIntensity", intensity, &subdoc);
+        report.addMember("bandwidthFraction", gbs / streamGBs, &subdoc);
+        report.addMember("rooflineGFLOPs", intensity * streamGBs, &subdoc);
+        report.addSubdoc(gridName + "_" + kernelName + "_p" + std::to_string(nPartitions), subdoc);
+    }
+};
+
+/**
+ * Runs all the kernels on a grid type.
+ * The map, reduction and halo update kernels run on the grid built for the 7-point stencil.
+ * The dot product runs through the dot pattern of the grid (when withDot is set)
+ * and through the user-defined reduction.
+ */
+template <typename Grid>
+auto runGrid(const BenchmarkConfig& config,
+             const std::string&     gridName,
+             int                    nPartitions,
+             bool                   withDot,
+             Recorder&              record) -> void
+{
+    Neon::Backend        backend(nPartitions, Neon::Runtime::openmp);
+    const Neon::index_3d dim(config.dim, config.dim, config.dim);
+
+    const std::vector<std::pair<int, Neon::domain::Stencil>> stencils{
+        {7, Neon::domain::Stencil::s7_Laplace_t()},
+        {19, Neon::domain::Stencil::s19_t()},
+        {27, Neon::domain::Stencil::s27_t()}};
+
+    for (const auto& [nPoints, gridStencil] : stencils) {
+        Grid           grid(backend, dim, [](const Neon::index_3d&) { return true; }, gridStencil);
+        const uint64_t nCells = grid.getNumActiveCells();
+
+        auto X = grid.template newField<Type>("X", 1, 0);
+        auto Y = grid.template newField<Type>("Y", 1, 0);
+        X.forEachActiveCell([](const Neon::index_3d& idx, const int&, Type& val) {
+            val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29) % 101);
+        });
+        Y.forEachActiveCell([](const Neon::index_3d&, const int&, Type& val) { val = 1; });
+        X.updateCompute(0);
+        Y.updateCompute(0);
+        backend.syncAll();
+
+        if (nPoints == 7) {
+            // y += a * x: two loads and a store, a multiply and an add
+            auto   map = axpy(Type(1.0e-3), X, Y);
+            double ms = timeKernel(backend, config, [&] { map.run(0); });
+            record(gridName, "map", nPartitions, nCells, ms, {3.0 * sizeof(Type), 2.0});
+
+            // Two loads, a multiply and an add
+            auto scalar = grid.template newPatternScalar<Type>();
+            if (withDot) {
+                auto dot = grid.dot("Dot", X, Y, scalar);
+                ms = timeKernel(backend, config, [&] { dot.run(0); });
+                record(gridName, "dot", nPartitions, nCells, ms, {2.0 * sizeof(Type), 2.0});
+            }
+            // Same dot product through the user-defined reduction, available on every grid
+            auto reduction = reduceDot(X, Y, scalar);
+            ms = timeKernel(backend, config, [&] { reduction.run(0); });
+            record(gridName, "reduce", nPartitions, nCells, ms, {2.0 * sizeof(Type), 2.0});
+
+            if (nPartitions > 1) {
+                // Bytes moved between the partitions by the halo update, reported per cell of the grid
+                const uint64_t bytes0 = backend.devSet().transferredBytes();
+                ms = timeKernel(backend, config, [&] {
+                    Neon::set::HuOptions opt(Neon::set::TransferMode::get, false);
+                    X.haloUpdate(opt);
+                });
+                const double bytesPerUpdate = double(backend.devSet().transferredBytes() - bytes0) /
+                                              double(config.warmup + config.iterations);
+                record(gridName, "halo", nPartitions, nCells, ms, {bytesPerUpdate / double(nCells), 0.0});
+            }
+        }
+
+        // Load of the cell and store of the result, an add per neighbour, a multiply and a subtraction
+        const int nNeighbours = gridStencil.nNeighbours();
+        auto      xToY = stencil(X, Y, nNeighbours);
+        double    ms = timeKernel(backend, config, [&] { xToY.run(0); });
+        record(gridName, "stencil" + std::to_string(nPoints), nPartitions, nCells, ms,
+               {2.0 * sizeof(Type), double(nNeighbours + 2)});
+    }
+}
+
+/**
+ * Usage: sPt_roofline [-dim N] [-iterations N] [-warmup N] [-threads N] [-partitions p0 p1 ...] [-streamElements N] [-o name]
+ */
+int main(int argc, char** argv)
+{
+    Neon::init();
+
+    BenchmarkConfig  config;
+    std::vector<int> nPartitions;
+
+    auto cli = (clipp::option("-dim") & clipp::opt_values("dim", config.dim),
+                clipp::option("-iterations") & clipp::opt_values("Number of iterations", config.iterations),
+                clipp::option("-warmup") & clipp::opt_values("Number of warmup iterations", config.warmup),
+                clipp::option("-threads") & clipp::opt_values("Number of OpenMP threads, 0 for the default", config.nThreads),
+                clipp::option("-partitions") & clipp::opt_values("Numbers of CPU partitions", nPartitions),
+                clipp::option("-streamElements") & clipp::opt_values("Size of the STREAM triad arrays", config.streamElements),
+                clipp::option("-o") & clipp::opt_values("report name", config.reportName));
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << "Invalid input arguments!\n";
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        exit(EXIT_FAILURE);
+    }
+    if (!nPartitions.empty()) {
+        config.nPartitions = nPartitions;
+    }
+    if (config.nThreads > 0) {
+        omp_set_num_threads(config.nThreads);
+    }
+
+    const double streamGBs = streamTriad(config.streamElements, 10);
+
+    Neon::Report report("Roofline benchmark");
+    report.commandLine(argc, argv);
+    report.addMember("dim", config.dim);
+    report.addMember("nIterations", config.iterations);
+    report.addMember("nThreads", omp_get_max_threads());
+    report.addMember("streamTriadGBs", streamGBs);
+
+    printf("STREAM triad: %.2f GB/s with %d threads\n", streamGBs, omp_get_max_threads());
+    printf("%-6s %-10s %4s %12s %10s %10s %10s %8s %10s\n",
+           "grid", "kernel", "part", "cells", "ms", "GB/s", "GFLOP/s", "BW frac", "roof GF/s");
+
+    Recorder record{report, streamGBs};
+    for (const int p : config.nPartitions) {
+        runGrid<Neon::domain::dGrid>(config, "dGrid", p, true, record);
+        // eGrid does not implement the dot pattern, its reductions are measured through grid.reduce
+        runGrid<Neon::domain::eGrid>(config, "eGrid", p, false, record);
+        // bGrid supports a single partition
+        if (p == 1) {
+            runGrid<Neon::domain::bGrid>(config, "bGrid", p, true, record);
+        }
+    }
+
+    report.write(config.reportName, true);
+    return EXIT_SUCCESS;
+}
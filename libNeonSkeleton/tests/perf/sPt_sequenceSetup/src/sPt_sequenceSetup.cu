@@ -0,0 +1,195 @@
+// Setup cost of Skeleton::sequence as a function of the graph size.
+// A chain of N Laplacian containers is rebuilt and passed to sequence several times,
+// as iterative solvers do on every call, with and without the skeleton graph cache
+// (see Neon::skeleton::internal::GraphCache). The average setup time is reported in ms.
+// It runs on the CPU (openmp runtime) when no GPU is selected or available.
+
+#include <iostream>
+
+#include "Neon/Neon.h"
+#include "Neon/Report.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+struct BenchmarkConfig
+{
+    int         dim = 32;
+    int         maxContainers = 64;
+    int         samples = 10;
+    int         nGPUs = 0;
+    int         nPartitions = 2;
+    std::string reportName = "sPt_sequenceSetup";
+};
+
+template <typename Field>
+auto laplace(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Laplace",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                Type res = 0;
+                for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                    auto neighbor = xLocal.nghVal(cell, nghIdx, 0, Type(0));
+                    res += neighbor.value;
+                }
+                yLocal(cell, 0) = res - 6 * xLocal(cell, 0);
+            };
+        });
+}
+
+/**
+ * Chain of nContainers stencil operations ping-ponging between the two fields
+ */
+template <typename Field>
+auto chain(Field& X, Field& Y, int nContainers) -> std::vector<Neon::set::Container>
+{
+    std::vector<Neon::set::Container> ops;
+    for (int i = 0; i < nContainers; i++) {
+        ops.push_back(i % 2 == 0 ? laplace(X, Y) : laplace(Y, X));
+    }
+    return ops;
+}
+
+/**
+ * Average time in ms of a sequence call, the containers are re-created for every sample
+ */
+template <typename Field>
+auto timeSetup(const Neon::Backend&   backend,
+               Field&                 X,
+               Field&                 Y,
+               int                    nContainers,
+               bool                   useCache,
+               const BenchmarkConfig& config) -> double
+{
+    double total = 0;
+    for (int s = 0; s < config.samples; s++) {
+        auto                     ops = chain(X, Y, nContainers);
+        Neon::skeleton::Skeleton sk(backend);
+        Neon::Timer_ms           timer;
+        timer.start();
+        sk.sequence(ops, "sequenceSetup", Neon::skeleton::Options().setGraphCache(useCache));
+        timer.stop();
+        total += timer.time();
+    }
+    return total / double(config.samples);
+}
+
+/**
+ * Runs a chain once and returns the checksum of the fields
+ */
+template <typename Field>
+auto runChain(const Neon::Backend& backend,
+              Field&               X,
+              Field&               Y,
+              int                  nContainers,
+              bool                 useCache) -> double
+{
+    using Type = typename Field::Type;
+
+    X.forEachActiveCell([](const Neon::index_3d& idx, const int&, Type& val) {
+        val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29) % 101);
+    });
+    Y.forEachActiveCell([](const Neon::index_3d&, const int&, Type& val) { val = 0; });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+
+    Neon::skeleton::Skeleton sk(backend);
+    sk.sequence(chain(X, Y, nContainers), "sequenceSetupCheck", Neon::skeleton::Options().setGraphCache(useCache));
+    sk.run();
+    backend.syncAll();
+
+    X.updateIO(0);
+    Y.updateIO(0);
+    backend.syncAll();
+    double checksum = 0;
+    X.forEachActiveCell([&](const Neon::index_3d&, const int&, Type& val) { checksum += val; });
+    Y.forEachActiveCell([&](const Neon::index_3d&, const int&, Type& val) { checksum += val; });
+    return checksum;
+}
+
+/**
+ * Usage: sPt_sequenceSetup [-dim N] [-maxContainers N] [-samples N] [-gpus N] [-partitions N] [-o name]
+ * With -gpus 0 (default) or when no GPU is available the benchmark runs on the CPU.
+ */
+int main(int argc, char** argv)
+{
+    Neon::init();
+
+    BenchmarkConfig config;
+
+    auto cli = (clipp::option("-dim") & clipp::opt_values("dim", config.dim),
+                clipp::option("-maxContainers") & clipp::opt_values("Largest number of containers", config.maxContainers),
+                clipp::option("-samples") & clipp::opt_values("Number of sequence calls per size", config.samples),
+                clipp::option("-gpus") & clipp::opt_values("Number of gpus, 0 for the CPU", config.nGPUs),
+                clipp::option("-partitions") & clipp::opt_values("Number of CPU partitions", config.nPartitions),
+                clipp::option("-o") & clipp::opt_values("report name", config.reportName));
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << "Invalid input arguments!\n";
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    const int nAvailableGPUs = Neon::sys::globalSpace::gpuSysObjStorage.numDevs();
+    if (config.nGPUs > nAvailableGPUs) {
+        printf("%d GPUs requested, %d available: running on the CPU\n", config.nGPUs, nAvailableGPUs);
+        config.nGPUs = 0;
+    }
+
+    Neon::Backend backend = config.nGPUs > 0 ? Neon::Backend(config.nGPUs, Neon::Runtime::stream)
+                                             : Neon::Backend(config.nPartitions, Neon::Runtime::openmp);
+
+    Neon::domain::dGrid grid(
+        backend, Neon::index_3d(config.dim, config.dim, config.dim),
+        [](const Neon::index_3d&) { return true; },
+        Neon::domain::Stencil::s7_Laplace_t());
+
+    auto X = grid.newField<double>("X", 1, 0);
+    auto Y = grid.newField<double>("Y", 1, 0);
+
+    Neon::Report report("Skeleton sequence setup benchmark");
+    report.addMember("Backend", backend.toString());
+    report.addMember("dim", config.dim);
+    report.addMember("nSamples", config.samples);
+
+    auto& cache = Neon::skeleton::internal::GraphCache::global();
+
+    int                 exitCode = EXIT_SUCCESS;
+    std::vector<int>    sizes;
+    std::vector<double> coldMs;
+    std::vector<double> cachedMs;
+    for (int n = 1; n <= config.maxContainers; n *= 2) {
+        const double cold = timeSetup(backend, X, Y, n, false, config);
+        const double coldChecksum = runChain(backend, X, Y, n, false);
+
+        // First call fills the cache
+        runChain(backend, X, Y, n, true);
+        const double cached = timeSetup(backend, X, Y, n, true, config);
+        const double cachedChecksum = runChain(backend, X, Y, n, true);
+
+        printf("%4d containers: cold %9.3f ms  cached %9.3f ms  speedup %6.1fx\n",
+               n, cold, cached, cold / cached);
+        if (coldChecksum != cachedChecksum) {
+            printf("%d containers: the cached graph does not match the cold one\n", n);
+            exitCode = EXIT_FAILURE;
+        }
+        sizes.push_back(n);
+        coldMs.push_back(cold);
+        cachedMs.push_back(cached);
+    }
+
+    report.addMember("nContainers", sizes);
+    report.addMember("Cold_ms", coldMs);
+    report.addMember("Cached_ms", cachedMs);
+    report.addMember("CacheHits", int(cache.hits()));
+
+    report.write(config.reportName, true);
+    return exitCode;
+}
@@ -0,0 +1,166 @@
+// Stencil benchmark over the dGrid spatial layouts (see Neon::SpatialLayout).
+// A 7-point Laplacian is applied repeatedly on a scalar field and the throughput
+// is reported for every layout in million cell updates per second (MCUPS).
+// It runs on the CPU (openmp runtime) when no GPU is selected or available.
+
+#include <iostream>
+
+#include "Neon/Neon.h"
+#include "Neon/Report.h"
+#include "Neon/core/tools/clipp.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/skeleton/Skeleton.h"
+
+struct BenchmarkConfig
+{
+    int         dim = 128;
+    int         iterations = 20;
+    int         warmup = 2;
+    int         nGPUs = 0;
+    int         nPartitions = 1;
+    std::string reportName = "sPt_spatialLayout";
+};
+
+template <typename Field>
+auto laplace(const Field& x, Field& y) -> Neon::set::Container
+{
+    return x.getGrid().getContainer(
+        "Laplace",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x, Neon::Compute::STENCIL);
+            auto&       yLocal = loader.load(y);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                Type res = 0;
+                for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                    auto neighbor = xLocal.nghVal(cell, nghIdx, 0, Type(0));
+                    res += neighbor.value;
+                }
+                yLocal(cell, 0) = res - 6 * xLocal(cell, 0);
+            };
+        });
+}
+
+/**
+ * Runs the benchmark for one layout and returns the throughput in MCUPS.
+ * The checksum of the result is returned to verify that all layouts compute the same values.
+ */
+auto runLayout(const Neon::Backend&   backend,
+               Neon::domain::dGrid&   grid,
+               const BenchmarkConfig& config,
+               Neon::SpatialLayout    layout,
+               double&                checksum) -> double
+{
+    using Type = double;
+
+    Neon::MemoryOptions memoryOptions = backend.getMemoryOptions();
+    memoryOptions.setSpatialLayout(layout);
+
+    auto X = grid.newField<Type>("X", 1, 0, Neon::DataUse::IO_COMPUTE, memoryOptions);
+    auto Y = grid.newField<Type>("Y", 1, 0, Neon::DataUse::IO_COMPUTE, memoryOptions);
+
+    X.forEachActiveCell([](const Neon::index_3d& idx, const int&, Type& val) {
+        val = Type((idx.x * 7 + idx.y * 13 + idx.z * 29) % 101);
+    });
+    Y.forEachActiveCell([](const Neon::index_3d&, const int&, Type& val) { val = 0; });
+    X.updateCompute(0);
+    Y.updateCompute(0);
+
+    // Each skeleton run applies the stencil twice, ping-ponging between the two fields
+    Neon::skeleton::Skeleton sk(backend);
+    sk.sequence({laplace(X, Y), laplace(Y, X)}, std::string("Laplace_") + Neon::SpatialLayoutUtils::toString(layout));
+
+    for (int i = 0; i < config.warmup; i++) {
+        sk.run();
+    }
+    backend.syncAll();
+
+    Neon::Timer_ms timer;
+    timer.start();
+    for (int i = 0; i < config.iterations; i++) {
+        sk.run();
+    }
+    backend.syncAll();
+    timer.stop();
+
+    X.updateIO(0);
+    backend.syncAll();
+    checksum = 0;
+    X.forEachActiveCell([&](const Neon::index_3d&, const int&, Type& val) { checksum += val; });
+
+    const double nCells = double(grid.getDimension().rMul());
+    return nCells * 2.0 * double(config.iterations) / (timer.time() * 1.0e3);
+}
+
+/**
+ * Usage: sPt_spatialLayout [-dim N] [-iterations N] [-warmup N] [-gpus N] [-partitions N] [-o name]
+ * With -gpus 0 (default) or when no GPU is available the benchmark runs on the CPU.
+ */
+int main(int argc, char** argv)
+{
+    Neon::init();
+
+    BenchmarkConfig config;
+
+    auto cli = (clipp::option("-dim") & clipp::opt_values("dim", config.dim),
+                clipp::option("-iterations") & clipp::opt_values("Number of iterations", config.iterations),
+                clipp::option("-warmup") & clipp::opt_values("Number of warmup iterations", config.warmup),
+                clipp::option("-gpus") & clipp::opt_values("Number of gpus, 0 for the CPU", config.nGPUs),
+                clipp::option("-partitions") & clipp::opt_values("Number of CPU partitions", config.nPartitions),
+                clipp::option("-o") & clipp::opt_values("report name", config.reportName));
+
+    if (!clipp::parse(argc, argv, cli)) {
+        auto fmt = clipp::doc_formatting{}.doc_column(31);
+        std::cout << "Invalid input arguments!\n";
+        std::cout << make_man_page(cli, argv[0], fmt) << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    const int nAvailableGPUs = Neon::sys::globalSpace::gpuSysObjStorage.numDevs();
+    if (config.nGPUs > nAvailableGPUs) {
+        printf("%d GPUs requested, %d available: running on the CPU\n", config.nGPUs, nAvailableGPUs);
+        config.nGPUs = 0;
+    }
+
+    Neon::Backend backend = config.nGPUs > 0 ? Neon::Backend(config.nGPUs, Neon::Runtime::stream)
+                                             : Neon::Backend(config.nPartitions, Neon::Runtime::openmp);
+
+    Neon::domain::dGrid grid(
+        backend, Neon::index_3d(config.dim, config.dim, config.dim),
+        [](const Neon::index_3d&) { return true; },
+        Neon::domain::Stencil::s7_Laplace_t());
+
+    Neon::Report report("dGrid spatial layout benchmark");
+    report.addMember("Backend", backend.toString());
+    report.addMember("dim", config.dim);
+    report.addMember("nIterations", config.iterations);
+
+    int    exitCode = EXIT_SUCCESS;
+    double referenceChecksum = 0;
+    for (int i = 0; i < Neon::SpatialLayoutUtils::nConfig; i++) {
+        const auto   layout = Neon::SpatialLayoutUtils::fromInt(i);
+        const auto   name = std::string(Neon::SpatialLayoutUtils::toString(layout));
+#if !defined(NEON_USE_SPATIAL_LAYOUT)
+        if (layout != Neon::SpatialLayout::linear) {
+            printf("%-8s skipped, Neon is built without NEON_USE_SPATIAL_LAYOUT\n", name.c_str());
+            continue;
+        }
+#endif
+        double       checksum = 0;
+        const double mcups = runLayout(backend, grid, config, layout, checksum);
+
+        printf("%-8s %10.2f MCUPS  checksum %e\n", name.c_str(), mcups, checksum);
+        report.addMember(name + "_MCUPS", mcups);
+
+        if (layout == Neon::SpatialLayout::linear) {
+            referenceChecksum = checksum;
+        } else if (checksum != referenceChecksum) {
+            printf("%s does not match the linear layout\n", name.c_str());
+            exitCode = EXIT_FAILURE;
+        }
+    }
+
+    report.write(config.reportName, true);
+    return exitCode;
+}
@@ -226,7 +226,7 @@ int getNGpus()
 TEST(Stencil_NoOCC, bGrid)
 {
     int nGpus = 1;
-    using Grid = Neon::domain::internal::bGrid::bGrid;
+    using Grid = Neon::domain::bGrid;
     using Type = int32_t;
     runAllTestConfiguration<Grid, Type, 0>("bGrid_t", SingleStencilNoOCC<Grid, Type, 0>, nGpus, 1);
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/set/CpuAutotuner.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "gtest/gtest.h"
+#include "sUt.runHelper.h"
+#include "sUt_skeleton.onStream.kernels.h"
+
+using namespace Neon::domain::tool::testing;
+static const std::string testFilePrefix("sUt_skeleton_CpuAutotuner");
+
+/**
+ * Map-stencil-map sequence on the openmp runtime with an autotuner:
+ * the first runs of each container go over the candidate loop configurations, the following ones use the winner.
+ * All of them must compute the same values.
+ */
+template <typename G, typename T, int C>
+void CpuAutotunerMapStencilMap(TestData<G, T, C>&  data,
+                               Neon::skeleton::Occ occ,
+                               int                 nIterations)
+{
+    using Type = typename TestData<G, T, C>::Type;
+
+    auto occName = Neon::skeleton::OccUtils::toString(occ);
+    occName[0] = toupper(occName[0]);
+    const std::string appName(testFilePrefix + "_" + occName);
+
+    Neon::skeleton::Skeleton skl(data.getBackend());
+    Neon::skeleton::Options  opt(occ, Neon::set::TransferMode::get);
+
+    const Type scalarVal = 2;
+
+    auto fR = data.getGrid().template newPatternScalar<Type>();
+    fR() = scalarVal;
+    data.getBackend().syncAll();
+
+    data.resetValuesToRandom(1, 50);
+
+    {  // SKELETON
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+
+        std::vector<Neon::set::Container> ops{
+            UserTools::axpy(fR, Y, X),
+            UserTools::laplace(X, Y),
+            UserTools::axpy(fR, Y, Y)};
+
+        skl.sequence(ops, appName, opt);
+        for (int i = 0; i < nIterations; i++) {
+            skl.run();
+        }
+        data.getBackend().syncAll();
+    }
+
+    {  // Golden data
+        Type  dR = scalarVal;
+        auto& X = data.getIODomain(FieldNames::X);
+        auto& Y = data.getIODomain(FieldNames::Y);
+
+        for (int i = 0; i < nIterations; i++) {
+            data.axpy(&dR, Y, X);
+            data.laplace(X, Y);
+            data.axpy(&dR, Y, Y);
+        }
+    }
+    bool isOk = data.compare(FieldNames::X);
+    isOk = isOk && data.compare(FieldNames::Y);
+
+    ASSERT_TRUE(isOk);
+}
+
+template <typename G, typename T, int C>
+void runCpuAutotuner(const Neon::domain::tool::Geometry& geo, int loopDim)
+{
+    // Enough iterations to time every candidate once and then use the winners
+    const int nIterations = int(Neon::set::CpuAutotuner::candidates(loopDim, omp_get_max_threads()).size()) + 2;
+
+    for (int nPartitions : {1, 3}) {
+        for (bool cpuStreams : {false, true}) {
+            for (auto occ : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard}) {
+                Neon::Backend backend(nPartitions, Neon::Runtime::openmp);
+                backend.setCpuStreams(cpuStreams);
+                auto autotuner = std::make_shared<Neon::set::CpuAutotuner>("", 1);
+                backend.setCpuAutotuner(autotuner);
+
+                // The candidates of a CPU stream do not use more threads than its worker
+                const int budget = backend.cpuThreadBudget(0);
+                ASSERT_LE(budget, cpuStreams ? std::max(1, omp_get_max_threads() / nPartitions) : omp_get_max_threads());
+
+                omp_sched_t kind;
+                int         chunk;
+                omp_get_schedule(&kind, &chunk);
+
+                TestData<G, T, C> data(backend, {24, 16, 40}, 1, backend.getMemoryOptions(), geo);
+                CpuAutotunerMapStencilMap<G, T, C>(data, occ, nIterations);
+                ASSERT_GT(autotuner->nWinners(), 0);
+
+                // The tuned launches do not leak their schedule to the calling thread
+                omp_sched_t kindAfter;
+                int         chunkAfter;
+                omp_get_schedule(&kindAfter, &chunkAfter);
+                ASSERT_EQ(kind, kindAfter);
+                ASSERT_EQ(chunk, chunkAfter);
+            }
+        }
+    }
+}
+
+TEST(CpuAutotuner, dGrid)
+{
+    using Grid = Neon::domain::dGrid;
+    using Type = double;
+    runCpuAutotuner<Grid, Type, 0>(Neon::domain::tool::Geometry::FullDomain, 3);
+}
+
+TEST(CpuAutotuner, eGrid)
+{
+    using Grid = Neon::domain::eGrid;
+    using Type = double;
+    runCpuAutotuner<Grid, Type, 0>(Neon::domain::tool::Geometry::Sphere, 1);
+}
@@ -0,0 +1,195 @@
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "gtest/gtest.h"
+#include "sUt.runHelper.h"
+#include "sUt_skeleton.onStream.kernels.h"
+
+using namespace Neon::domain::tool::testing;
+static const std::string testFilePrefix("sUt_skeleton_CpuStreams");
+
+/**
+ * Dot product of a field with itself through the user-defined reduction, which every grid supports
+ */
+template <typename Field, typename T>
+auto selfDot(Field& y, Neon::template PatternScalar<T>& result) -> Neon::set::Container
+{
+    using Cell = typename Field::Cell;
+    return y.getGrid().reduce(
+        "DotContainer",
+        [&](Neon::set::Loader& loader) {
+            const auto& yLocal = loader.load(y);
+            return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) -> T {
+                T res = 0;
+                for (int card = 0; card < yLocal.cardinality(); card++) {
+                    res += yLocal(cell, card) * yLocal(cell, card);
+                }
+                return res;
+            };
+        },
+        Neon::reduceOp::Sum<T>(), T(0), result);
+}
+
+/**
+ * Map-stencil-map sequence followed by a dot product on the openmp runtime with asynchronous CPU streams
+ */
+template <typename G, typename T, int C>
+void CpuStreamsMapStencilDot(TestData<G, T, C>&      data,
+                             Neon::skeleton::Occ     occ,
+                             Neon::set::TransferMode transfer)
+{
+    using Type = typename TestData<G, T, C>::Type;
+
+    auto occName = Neon::skeleton::OccUtils::toString(occ);
+    occName[0] = toupper(occName[0]);
+    const std::string appName(testFilePrefix + "_" + occName);
+
+    Neon::skeleton::Skeleton skl(data.getBackend());
+    Neon::skeleton::Options  opt(occ, transfer);
+
+    const Type scalarVal = 2;
+    const int  nIterations = 5;
+
+    auto fR = data.getGrid().template newPatternScalar<Type>();
+    auto fDot = data.getGrid().template newPatternScalar<Type>();
+    fR() = scalarVal;
+    fDot() = 0;
+    data.getBackend().syncAll();
+
+    data.resetValuesToRandom(1, 50);
+
+    std::vector<Type> dots;
+    {  // SKELETON
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+
+        std::vector<Neon::set::Container> ops{
+            UserTools::axpy(fR, Y, X),
+            UserTools::laplace(X, Y),
+            UserTools::axpy(fR, Y, Y),
+            selfDot(Y, fDot)};
+
+        skl.sequence(ops, appName, opt);
+        for (int i = 0; i < nIterations; i++) {
+            skl.run();
+            data.getBackend().syncAll();
+            dots.push_back(fDot());
+        }
+    }
+
+    {  // Golden data
+        Type  dR = scalarVal;
+        auto& X = data.getIODomain(FieldNames::X);
+        auto& Y = data.getIODomain(FieldNames::Y);
+
+        for (int i = 0; i < nIterations; i++) {
+            data.axpy(&dR, Y, X);
+            data.laplace(X, Y);
+            data.axpy(&dR, Y, Y);
+
+            Type dot = 0;
+            data.dot(Y, Y, &dot);
+            ASSERT_NEAR(dot / dots[i], 1.0, 0.000001) << "No match between " << dot << " and " << dots[i];
+        }
+    }
+    bool isOk = data.compare(FieldNames::X);
+    isOk = isOk && data.compare(FieldNames::Y);
+
+    ASSERT_TRUE(isOk);
+}
+
+template <typename G, typename T, int C>
+void runCpuStreams(const Neon::domain::tool::Geometry& geo)
+{
+    for (int nPartitions : {1, 3}) {
+        for (auto occ : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard,
+                         Neon::skeleton::Occ::extended, Neon::skeleton::Occ::twoWayExtended}) {
+            Neon::Backend backend(nPartitions, Neon::Runtime::openmp);
+            backend.setCpuStreams(true);
+            ASSERT_TRUE(backend.hasCpuStreams());
+
+            TestData<G, T, C> data(backend, {24, 16, 40}, 1, backend.getMemoryOptions(), geo);
+            CpuStreamsMapStencilDot<G, T, C>(data, occ, Neon::set::TransferMode::get);
+        }
+    }
+}
+
+/**
+ * Same sequence with every partition below the serial launch threshold,
+ * so that the kernels run on the calling thread (or on the stream worker) without a parallel region.
+ */
+template <typename G, typename T, int C>
+void runSerialLaunch(const Neon::domain::tool::Geometry& geo)
+{
+    for (int nPartitions : {1, 3}) {
+        for (bool cpuStreams : {false, true}) {
+            Neon::Backend backend(nPartitions, Neon::Runtime::openmp);
+            backend.setCpuStreams(cpuStreams);
+            backend.setCpuSerialLaunchThreshold(int64_t(1) << 40);
+            ASSERT_EQ(backend.cpuSerialLaunchThreshold(), int64_t(1) << 40);
+
+            TestData<G, T, C> data(backend, {24, 16, 40}, 1, backend.getMemoryOptions(), geo);
+            CpuStreamsMapStencilDot<G, T, C>(data, Neon::skeleton::Occ::standard, Neon::set::TransferMode::get);
+        }
+    }
+}
+
+/**
+ * Same sequence with the partitions bound to sockets or to ranges of cores:
+ * the binding changes where the work runs and where the memory lives, never the results.
+ */
+template <typename G, typename T, int C>
+void runCpuBinding(const Neon::domain::tool::Geometry& geo)
+{
+    for (int nPartitions : {1, 3}) {
+        for (auto binding : {Neon::sys::CpuBinding::socket, Neon::sys::CpuBinding::core}) {
+            for (bool cpuStreams : {false, true}) {
+                Neon::Backend backend(nPartitions, Neon::Runtime::openmp);
+                backend.setCpuStreams(cpuStreams);
+                backend.setCpuBinding(binding);
+                ASSERT_EQ(backend.cpuBinding(), binding);
+                for (int i = 0; i < nPartitions; i++) {
+                    ASSERT_FALSE(backend.devSet().partitionCpus(i).empty());
+                }
+
+                // The binding belongs to the backend, the other backends stay unbound
+                Neon::Backend unbound(nPartitions, Neon::Runtime::openmp);
+                ASSERT_EQ(unbound.cpuBinding(), Neon::sys::CpuBinding::none);
+                ASSERT_TRUE(unbound.devSet().partitionCpus(0).empty());
+                ASSERT_EQ(unbound.devSet().partitionNode(0), -1);
+
+                TestData<G, T, C> data(backend, {24, 16, 40}, 1, backend.getMemoryOptions(), geo);
+                CpuStreamsMapStencilDot<G, T, C>(data, Neon::skeleton::Occ::standard, Neon::set::TransferMode::get);
+            }
+        }
+    }
+}
+
+TEST(CpuStreams, dGrid)
+{
+    using Grid = Neon::domain::dGrid;
+    using Type = double;
+    runCpuStreams<Grid, Type, 0>(Neon::domain::tool::Geometry::FullDomain);
+}
+
+TEST(CpuStreams, eGrid)
+{
+    using Grid = Neon::domain::eGrid;
+    using Type = double;
+    runCpuStreams<Grid, Type, 0>(Neon::domain::tool::Geometry::Sphere);
+}
+
+TEST(CpuStreams, serialLaunch)
+{
+    using Grid = Neon::domain::dGrid;
+    using Type = double;
+    runSerialLaunch<Grid, Type, 0>(Neon::domain::tool::Geometry::FullDomain);
+}
+
+TEST(CpuStreams, binding)
+{
+    using Grid = Neon::domain::dGrid;
+    using Type = double;
+    runCpuBinding<Grid, Type, 0>(Neon::domain::tool::Geometry::FullDomain);
+}
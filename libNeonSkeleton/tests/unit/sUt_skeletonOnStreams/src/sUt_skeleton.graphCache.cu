@@ -0,0 +1,97 @@
+#include "Neon/core/types/chrono.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "gtest/gtest.h"
+#include "sUt.runHelper.h"
+#include "sUt_skeleton.onStream.kernels.h"
+
+using namespace Neon::domain::tool::testing;
+static const std::string testFilePrefix("sUt_skeleton_GraphCache");
+
+namespace help {
+template <typename G, typename T, int C>
+void MapStencilCached(TestData<G, T, C>&      data,
+                      Neon::skeleton::Occ     occ,
+                      Neon::set::TransferMode transfer)
+{
+    auto occName = Neon::skeleton::OccUtils::toString(occ);
+    occName[0] = toupper(occName[0]);
+    const std::string appName(testFilePrefix + "_" + occName);
+
+    Neon::skeleton::Options opt(occ, transfer);
+    auto&                   cache = Neon::skeleton::internal::GraphCache::global();
+    opt.setGraphCache(true);
+
+    const int nRepetitions = 3;
+    data.resetValuesToRandom(1, 50);
+
+    {  // SKELETON
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+
+        // The containers are created again for each skeleton, only the first one builds the graph.
+        // Every other repetition swaps the fields: the data is matched by its role in the sequence,
+        // so the graph is shared and its halo updates are bound to the new fields.
+        for (int i = 0; i < nRepetitions; i++) {
+            const size_t hits = cache.hits();
+
+            Neon::skeleton::Skeleton          skl(data.getBackend());
+            auto&                             A = i % 2 == 0 ? X : Y;
+            auto&                             B = i % 2 == 0 ? Y : X;
+            std::vector<Neon::set::Container> ops{
+                UserTools::laplace(A, B),
+                UserTools::laplace(B, A)};
+            skl.sequence(ops, appName, opt);
+            skl.run();
+            data.getBackend().syncAll();
+
+            if (i > 0) {
+                ASSERT_EQ(cache.hits(), hits + 1);
+            }
+        }
+
+        // Sequences that do not opt in do not use the cache
+        const size_t hits = cache.hits();
+        const size_t misses = cache.misses();
+
+        Neon::skeleton::Skeleton skl(data.getBackend());
+        skl.sequence({UserTools::laplace(X, Y), UserTools::laplace(Y, X)}, appName,
+                     Neon::skeleton::Options(occ, transfer));
+        ASSERT_EQ(cache.hits(), hits);
+        ASSERT_EQ(cache.misses(), misses);
+    }
+
+    {  // Golden data
+        auto& X = data.getIODomain(FieldNames::X);
+        auto& Y = data.getIODomain(FieldNames::Y);
+
+        for (int i = 0; i < nRepetitions; i++) {
+            auto& A = i % 2 == 0 ? X : Y;
+            auto& B = i % 2 == 0 ? Y : X;
+            data.laplace(A, NEON_IO B);
+            data.laplace(B, NEON_IO A);
+        }
+    }
+
+    bool isOk = data.compare(FieldNames::Y);
+    isOk = isOk && data.compare(FieldNames::X);
+
+    ASSERT_TRUE(isOk);
+}
+}  // namespace help
+
+template <typename G, typename T, int C>
+void runMapStencilCached(TestData<G, T, C>& data)
+{
+    help::MapStencilCached<G, T, C>(data, Neon::skeleton::Occ::none, Neon::set::TransferMode::get);
+    help::MapStencilCached<G, T, C>(data, Neon::skeleton::Occ::standard, Neon::set::TransferMode::get);
+}
+
+TEST(GraphCache, dGrid)
+{
+    int nGpus = 3;
+    using Grid = Neon::domain::dGrid;
+    using Type = double;
+    runAllTestConfiguration<Grid, Type, 0>("dGrid", runMapStencilCached<Grid, Type, 0>, nGpus, 1);
+}
@@ -0,0 +1,227 @@
+#include "Neon/core/types/chrono.h"
+#include "Neon/domain/bGrid.h"
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "gtest/gtest.h"
+#include "sUt.runHelper.h"
+#include "sUt_skeleton.onStream.kernels.h"
+
+using namespace Neon::domain::tool::testing;
+static const std::string testFilePrefix("sUt_skeleton_Loop");
+
+namespace help {
+/**
+ * Dot product of a field with itself through the user-defined reduction, which every grid supports
+ */
+template <typename Field, typename T>
+auto selfDot(Field& x, Neon::template PatternScalar<T>& result) -> Neon::set::Container
+{
+    using Cell = typename Field::Cell;
+    return x.getGrid().reduce(
+        "DotContainer",
+        [&](Neon::set::Loader& loader) {
+            const auto& xLocal = loader.load(x);
+            return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) -> T {
+                T res = 0;
+                for (int card = 0; card < xLocal.cardinality(); card++) {
+                    res += xLocal(cell, card) * xLocal(cell, card);
+                }
+                return res;
+            };
+        },
+        Neon::reduceOp::Sum<T>(), T(0), result);
+}
+
+template <typename G, typename T, int C>
+void FixedLoop(TestData<G, T, C>&      data,
+               Neon::skeleton::Occ     occ,
+               Neon::set::TransferMode transfer)
+{
+    auto occName = Neon::skeleton::OccUtils::toString(occ);
+    occName[0] = toupper(occName[0]);
+    const std::string appName(testFilePrefix + "_Fixed_" + occName);
+
+    Neon::skeleton::Skeleton skl(data.getBackend());
+    Neon::skeleton::Options  opt(occ, transfer);
+
+    const int nIterations = 5;
+    data.resetValuesToRandom(1, 50);
+
+    {  // SKELETON
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+
+        std::vector<Neon::set::Container> ops{
+            UserTools::laplace(X, Y),
+            UserTools::laplace(Y, X)};
+
+        skl.loop(ops, nIterations, appName, opt);
+        skl.run();
+        data.getBackend().syncAll();
+        ASSERT_EQ(skl.getIterations(), nIterations);
+    }
+
+    {  // Golden data
+        auto& X = data.getIODomain(FieldNames::X);
+        auto& Y = data.getIODomain(FieldNames::Y);
+
+        for (int i = 0; i < nIterations; i++) {
+            data.laplace(X, NEON_IO Y);
+            data.laplace(Y, NEON_IO X);
+        }
+    }
+
+    bool isOk = data.compare(FieldNames::Y);
+    isOk = isOk && data.compare(FieldNames::X);
+
+    ASSERT_TRUE(isOk);
+}
+
+/**
+ * The predicate is evaluated every checkPeriod iterations and stops the loop at its third evaluation
+ */
+template <typename G, typename T, int C>
+void WhileLoop(TestData<G, T, C>&      data,
+               Neon::skeleton::Occ     occ,
+               Neon::set::TransferMode transfer,
+               int                     checkPeriod)
+{
+    using Type = typename TestData<G, T, C>::Type;
+
+    auto occName = Neon::skeleton::OccUtils::toString(occ);
+    occName[0] = toupper(occName[0]);
+    const std::string appName(testFilePrefix + "_While_" + occName);
+
+    Neon::skeleton::Skeleton skl(data.getBackend());
+    Neon::skeleton::Options  opt(occ, transfer);
+    opt.setLoopCheckPeriod(checkPeriod);
+
+    // The predicate stops the loop well before the maximum number of iterations
+    const int maxIterations = 100;
+    const int nExpected = 3;
+
+    auto fR = data.getGrid().template newPatternScalar<Type>();
+    fR() = 0;
+    data.getBackend().syncAll();
+    data.resetValuesToRandom(1, 50);
+
+    std::vector<Type> dots;
+    {  // SKELETON
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+
+        std::vector<Neon::set::Container> ops{
+            UserTools::laplace(X, Y),
+            UserTools::laplace(Y, X),
+            selfDot(X, fR)};
+
+        skl.whileLoop(
+            ops, fR,
+            std::function<bool(const Type&)>([&](const Type& dot) {
+                dots.push_back(dot);
+                return int(dots.size()) < nExpected;
+            }),
+            maxIterations, appName, opt);
+        skl.run();
+        data.getBackend().syncAll();
+        ASSERT_EQ(skl.getIterations(), nExpected * checkPeriod);
+        ASSERT_EQ(int(dots.size()), nExpected);
+    }
+
+    {  // Golden data
+        auto& X = data.getIODomain(FieldNames::X);
+        auto& Y = data.getIODomain(FieldNames::Y);
+
+        for (int i = 0; i < nExpected * checkPeriod; i++) {
+            data.laplace(X, NEON_IO Y);
+            data.laplace(Y, NEON_IO X);
+
+            if ((i + 1) % checkPeriod == 0) {
+                const Type dot = dots[(i + 1) / checkPeriod - 1];
+                Type       dR = 0;
+                data.dot(X, X, &dR);
+                ASSERT_NEAR(dR / dot, 1.0, 0.000001) << "No match between " << dR << " and " << dot;
+            }
+        }
+    }
+
+    bool isOk = data.compare(FieldNames::Y);
+    isOk = isOk && data.compare(FieldNames::X);
+
+    ASSERT_TRUE(isOk);
+}
+}  // namespace help
+
+template <typename G, typename T, int C>
+void runFixedLoop(TestData<G, T, C>& data)
+{
+    for (auto occ : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard, Neon::skeleton::Occ::extended}) {
+        help::FixedLoop<G, T, C>(data, occ, Neon::set::TransferMode::get);
+    }
+}
+
+template <typename G, typename T, int C>
+void runWhileLoop(TestData<G, T, C>& data)
+{
+    for (auto occ : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard, Neon::skeleton::Occ::extended}) {
+        for (int checkPeriod : {1, 2}) {
+            help::WhileLoop<G, T, C>(data, occ, Neon::set::TransferMode::get, checkPeriod);
+        }
+    }
+}
+
+/**
+ * Runs a test on the openmp runtime, with one and with several partitions,
+ * with and without CPU streams (the iterations of a loop are then ordered by a fence on the streams)
+ */
+template <typename G, typename T, int C>
+void runOnCpu(std::function<void(TestData<G, T, C>&)> f,
+              const Neon::domain::tool::Geometry&     geo)
+{
+    for (int nPartitions : {1, 3}) {
+        for (bool cpuStreams : {false, true}) {
+            Neon::Backend backend(nPartitions, Neon::Runtime::openmp);
+            backend.setCpuStreams(cpuStreams);
+            TestData<G, T, C> data(backend, {24, 16, 40}, 1, backend.getMemoryOptions(), geo);
+            f(data);
+        }
+    }
+}
+
+TEST(FixedLoop, dGrid)
+{
+    int nGpus = 3;
+    using Grid = Neon::domain::dGrid;
+    using Type = double;
+    runAllTestConfiguration<Grid, Type, 0>("dGrid", runFixedLoop<Grid, Type, 0>, nGpus, 1);
+    runOnCpu<Grid, Type, 0>(runFixedLoop<Grid, Type, 0>, Neon::domain::tool::Geometry::FullDomain);
+}
+
+TEST(FixedLoop, eGrid)
+{
+    int nGpus = 3;
+    using Grid = Neon::domain::eGrid;
+    using Type = double;
+    runAllTestConfiguration<Grid, Type, 0>("eGrid", runFixedLoop<Grid, Type, 0>, nGpus, 1);
+    runOnCpu<Grid, Type, 0>(runFixedLoop<Grid, Type, 0>, Neon::domain::tool::Geometry::Sphere);
+}
+
+TEST(WhileLoop, dGrid)
+{
+    int nGpus = 3;
+    using Grid = Neon::domain::dGrid;
+    using Type = double;
+    runAllTestConfiguration<Grid, Type, 0>("dGrid", runWhileLoop<Grid, Type, 0>, nGpus, 1);
+    runOnCpu<Grid, Type, 0>(runWhileLoop<Grid, Type, 0>, Neon::domain::tool::Geometry::FullDomain);
+}
+
+TEST(WhileLoop, eGrid)
+{
+    int nGpus = 3;
+    using Grid = Neon::domain::eGrid;
+    using Type = double;
+    runAllTestConfiguration<Grid, Type, 0>("eGrid", runWhileLoop<Grid, Type, 0>, nGpus, 1);
+    runOnCpu<Grid, Type, 0>(runWhileLoop<Grid, Type, 0>, Neon::domain::tool::Geometry::Sphere);
+}
@@ -0,0 +1,136 @@
+#include <memory>
+
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "gtest/gtest.h"
+#include "sUt.runHelper.h"
+#include "sUt_skeleton.onStream.kernels.h"
+
+using namespace Neon::domain::tool::testing;
+static const std::string testFilePrefix("sUt_skeleton_MultiStencil");
+
+/**
+ * Two maps writing X and Y followed by a container loading both X and Y as stencil fields.
+ * With halo update batching the two halo updates are merged into one node,
+ * which is checked by counting the halo update nodes recorded by a profiler.
+ */
+template <typename G, typename T, int C>
+void MapMapMultiStencil(TestData<G, T, C>&  data,
+                        Neon::skeleton::Occ occ,
+                        bool                haloUpdateBatching)
+{
+    using Type = typename TestData<G, T, C>::Type;
+
+    auto occName = Neon::skeleton::OccUtils::toString(occ);
+    occName[0] = toupper(occName[0]);
+    const std::string appName(testFilePrefix + "_" + occName + (haloUpdateBatching ? "_Batched" : ""));
+
+    auto                     profiler = std::make_shared<Neon::skeleton::Profiler>();
+    Neon::skeleton::Skeleton skl(data.getBackend());
+    Neon::skeleton::Options  opt(occ, Neon::set::TransferMode::get);
+    opt.setHaloUpdateBatching(haloUpdateBatching);
+    skl.setProfiler(profiler);
+
+    const Type scalarVal = 2;
+    const int  nIterations = 5;
+
+    auto fR = data.getGrid().template newPatternScalar<Type>();
+    fR() = scalarVal;
+    data.getBackend().syncAll();
+
+    data.resetValuesToRandom(1, 50);
+
+    {  // SKELETON
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+        auto& Z = data.getField(FieldNames::Z);
+
+        std::vector<Neon::set::Container> ops{
+            UserTools::axpy(fR, Y, X),
+            UserTools::axpy(fR, X, Y),
+            UserTools::sumLaplace(X, Y, Z)};
+
+        skl.sequence(ops, appName, opt);
+        skl.ioToDot(appName);
+
+        for (int i = 0; i < nIterations; i++) {
+            skl.run();
+        }
+        data.getBackend().syncAll();
+    }
+
+    {  // Golden data
+        Type  dR = scalarVal;
+        Type  one = 1;
+        auto& X = data.getIODomain(FieldNames::X);
+        auto& Y = data.getIODomain(FieldNames::Y);
+        auto& Z = data.getIODomain(FieldNames::Z);
+        auto& W = data.getIODomain(FieldNames::W);
+
+        for (int i = 0; i < nIterations; i++) {
+            data.axpy(&dR, Y, X);
+            data.axpy(&dR, X, Y);
+            data.laplace(X, Z);
+            data.laplace(Y, W);
+            data.axpy(&one, W, Z);
+        }
+    }
+    bool isOk = data.compare(FieldNames::X);
+    isOk = isOk && data.compare(FieldNames::Y);
+    isOk = isOk && data.compare(FieldNames::Z);
+
+    ASSERT_TRUE(isOk);
+
+    int      nHaloUpdateNodes = 0;
+    int      nSyncNodes = 0;
+    uint64_t haloBytes = 0;
+    for (const auto& s : profiler->stats()) {
+        if (s.kind == Neon::skeleton::Profiler::NodeKind::haloUpdate) {
+            nHaloUpdateNodes++;
+            haloBytes += s.bytes;
+        }
+        if (s.kind == Neon::skeleton::Profiler::NodeKind::sync) {
+            nSyncNodes++;
+        }
+    }
+    if (data.getBackend().devSet().setCardinality() == 1) {
+        ASSERT_EQ(nHaloUpdateNodes, 0);
+        return;
+    }
+    // One halo update and one left-right sync for each stencil field, or for both when batched
+    const int nExpected = haloUpdateBatching ? 1 : 2;
+    ASSERT_EQ(nHaloUpdateNodes, nExpected);
+    ASSERT_EQ(nSyncNodes, nExpected);
+    ASSERT_GT(haloBytes, uint64_t(0));
+}
+
+template <typename G, typename T, int C>
+void runMultiStencil(const Neon::domain::tool::Geometry& geo)
+{
+    for (int nPartitions : {1, 3}) {
+        for (auto occ : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard}) {
+            for (bool haloUpdateBatching : {false, true}) {
+                Neon::Backend backend(nPartitions, Neon::Runtime::openmp);
+
+                TestData<G, T, C> data(backend, {24, 16, 40}, 1, backend.getMemoryOptions(), geo);
+                MapMapMultiStencil<G, T, C>(data, occ, haloUpdateBatching);
+            }
+        }
+    }
+}
+
+TEST(MultiStencil, dGrid)
+{
+    using Grid = Neon::domain::dGrid;
+    using Type = int32_t;
+    runMultiStencil<Grid, Type, 0>(Neon::domain::tool::Geometry::FullDomain);
+}
+
+TEST(MultiStencil, eGrid)
+{
+    using Grid = Neon::domain::eGrid;
+    using Type = int32_t;
+    runMultiStencil<Grid, Type, 0>(Neon::domain::tool::Geometry::Sphere);
+}
@@ -157,4 +157,55 @@ auto laplace(const Field& x,
     return Kontainer;
 }
 
+/**
+ * z = laplace(x) + laplace(y): a container with two stencil fields
+ */
+template <typename Field>
+auto sumLaplace(const Field& x,
+                const Field& y,
+                Field&       z) -> Neon::set::Container
+{
+    auto Kontainer = x.getGrid().getContainer(
+        "SumLaplace", [&](Neon::set::Loader & L) -> auto {
+            auto& xLocal = L.load(x, Neon::Compute::STENCIL);
+            auto& yLocal = L.load(y, Neon::Compute::STENCIL);
+            auto& zLocal = L.load(z);
+
+            return [=] NEON_CUDA_HOST_DEVICE(const typename Field::Cell& cell) mutable {
+                using Type = typename Field::Type;
+                for (int card = 0; card < xLocal.cardinality(); card++) {
+                    Type res = 0;
+
+                    auto checkNeighbor = [&res](Neon::domain::NghInfo<Type>& neighbor) {
+                        if (neighbor.isValid) {
+                            res += neighbor.value;
+                        }
+                    };
+
+                    if constexpr (std::is_same<typename Field::Grid, Neon::domain::internal::eGrid::eGrid>::value) {
+                        for (int8_t nghIdx = 0; nghIdx < 6; ++nghIdx) {
+                            auto neighbor = xLocal.nghVal(cell, nghIdx, card, Type(0));
+                            checkNeighbor(neighbor);
+                            neighbor = yLocal.nghVal(cell, nghIdx, card, Type(0));
+                            checkNeighbor(neighbor);
+                        }
+                    } else {
+                        const int8_t directions[6][3] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+                        for (int d = 0; d < 6; d++) {
+                            typename Field::Partition::nghIdx_t ngh(directions[d][0], directions[d][1], directions[d][2]);
+
+                            auto neighbor = xLocal.nghVal(cell, ngh, card, Type(0));
+                            checkNeighbor(neighbor);
+                            neighbor = yLocal.nghVal(cell, ngh, card, Type(0));
+                            checkNeighbor(neighbor);
+                        }
+                    }
+
+                    zLocal(cell, card) = -6 * res;
+                }
+            };
+        });
+    return Kontainer;
+}
+
 }  // namespace UserTools
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include <fstream>
+#include <memory>
+
+#include "Neon/domain/dGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "gtest/gtest.h"
+#include "sUt.runHelper.h"
+#include "sUt_skeleton.onStream.kernels.h"
+
+using namespace Neon::domain::tool::testing;
+static const std::string testFilePrefix("sUt_skeleton_Profiler");
+
+/**
+ * Map-stencil-map sequence executed with a profiler attached to the skeleton.
+ * Checks that the results are not affected and that every run of a node is recorded.
+ */
+template <typename G, typename T, int C>
+void ProfiledMapStencilMap(TestData<G, T, C>&  data,
+                           Neon::skeleton::Occ occ,
+                           bool                syncEachNode)
+{
+    using Type = typename TestData<G, T, C>::Type;
+
+    auto occName = Neon::skeleton::OccUtils::toString(occ);
+    occName[0] = toupper(occName[0]);
+    const std::string appName(testFilePrefix + "_" + occName);
+
+    auto                     profiler = std::make_shared<Neon::skeleton::Profiler>(syncEachNode);
+    Neon::skeleton::Skeleton skl(data.getBackend());
+    Neon::skeleton::Options  opt(occ, Neon::set::TransferMode::get);
+    skl.setProfiler(profiler);
+
+    const Type scalarVal = 2;
+    const int  nIterations = 4;
+
+    auto fR = data.getGrid().template newPatternScalar<Type>();
+    fR() = scalarVal;
+    data.getBackend().syncAll();
+
+    data.resetValuesToRandom(1, 50);
+
+    {  // SKELETON
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+
+        skl.sequence({UserTools::axpy(fR, Y, X),
+                      UserTools::laplace(X, Y),
+                      UserTools::axpy(fR, Y, Y)},
+                     appName, opt);
+        for (int i = 0; i < nIterations; i++) {
+            skl.run();
+        }
+        data.getBackend().syncAll();
+    }
+
+    {  // Golden data
+        Type  dR = scalarVal;
+        auto& X = data.getIODomain(FieldNames::X);
+        auto& Y = data.getIODomain(FieldNames::Y);
+
+        for (int i = 0; i < nIterations; i++) {
+            data.axpy(&dR, Y, X);
+            data.laplace(X, Y);
+            data.axpy(&dR, Y, Y);
+        }
+    }
+    bool isOk = data.compare(FieldNames::X);
+    isOk = isOk && data.compare(FieldNames::Y);
+    ASSERT_TRUE(isOk);
+
+    ASSERT_EQ(profiler->nIterations(), nIterations);
+    const int nPartitions = data.getBackend().devSet().setCardinality();
+
+    // A node runs once per iteration, or once per partition with the graph level executor.
+    // Nodes with the same name (e.g. the two axpy) have their own statistics.
+    const int nRunsPerIteration = opt.executor() == Neon::skeleton::Executor::ompAtGraphLevel ? nPartitions : 1;
+
+    int      nContainerRuns = 0;
+    int      nAxpyNodes = 0;
+    int      nHaloRuns = 0;
+    uint64_t haloBytes = 0;
+    for (const auto& s : profiler->stats()) {
+        ASSERT_GT(s.count, 0) << s.name;
+        ASSERT_EQ(s.count, nIterations * nRunsPerIteration) << s.name;
+        ASSERT_LE(s.p50Ms, s.p99Ms) << s.name;
+        ASSERT_GE(s.meanMs, 0) << s.name;
+        if (s.kind == Neon::skeleton::Profiler::NodeKind::container) {
+            nContainerRuns += s.count;
+            nAxpyNodes += s.name.rfind("AXPY", 0) == 0 ? 1 : 0;
+        }
+        if (s.kind == Neon::skeleton::Profiler::NodeKind::haloUpdate) {
+            nHaloRuns += s.count;
+            haloBytes += s.bytes;
+        }
+    }
+    ASSERT_GE(nContainerRuns, 3 * nIterations * nRunsPerIteration);
+    ASSERT_GE(nAxpyNodes, 2);
+    if (nPartitions > 1) {
+        ASSERT_GT(nHaloRuns, 0);
+        ASSERT_GT(haloBytes, uint64_t(0));
+    }
+
+    Neon::Report report(appName);
+    profiler->toReport(report);
+
+    const std::string traceName = appName + ".trace.json";
+    profiler->ioToChromeTrace(traceName);
+    std::ifstream trace(traceName);
+    ASSERT_TRUE(trace.good());
+    std::string header;
+    std::getline(trace, header);
+    ASSERT_EQ(header.rfind("{\"displayTimeUnit\"", 0), size_t(0));
+
+    // Detaching the profiler stops the recording
+    skl.setProfiler(nullptr);
+    skl.run();
+    data.getBackend().syncAll();
+    ASSERT_EQ(profiler->nIterations(), nIterations);
+}
+
+TEST(Profiler, dGrid)
+{
+    using Grid = Neon::domain::dGrid;
+    using Type = double;
+    for (int nPartitions : {1, 3}) {
+        for (auto occ : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard}) {
+            for (bool syncEachNode : {false, true}) {
+                Neon::Backend           backend(nPartitions, Neon::Runtime::openmp);
+                TestData<Grid, Type, 0> data(backend, {24, 16, 40}, 1, backend.getMemoryOptions(), Neon::domain::tool::Geometry::FullDomain);
+                ProfiledMapStencilMap<Grid, Type, 0>(data, occ, syncEachNode);
+            }
+        }
+    }
+}
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <limits>
+
+#include "Neon/domain/dGrid.h"
+#include "Neon/domain/eGrid.h"
+#include "Neon/set/Containter.h"
+#include "Neon/skeleton/Skeleton.h"
+#include "gtest/gtest.h"
+#include "sUt.runHelper.h"
+#include "sUt_skeleton.onStream.kernels.h"
+
+using namespace Neon::domain::tool::testing;
+static const std::string testFilePrefix("sUt_skeleton_Reduce");
+
+namespace help {
+template <typename Field, typename T, typename CombineOp>
+auto reduceField(const std::string& name, Field& f, CombineOp combine, T identity, Neon::PatternReduction<T>& result)
+    -> Neon::set::Container
+{
+    using Cell = typename Field::Cell;
+    return f.getGrid().reduce(
+        name,
+        [&](Neon::set::Loader& loader) {
+            const auto& fLocal = loader.load(f);
+            return [=] NEON_CUDA_HOST_DEVICE(const Cell& cell) -> T {
+                return fLocal(cell, 0);
+            };
+        },
+        combine, identity, result);
+}
+
+/**
+ * Axpy-stencil sequence with user-defined reductions of the stencil input (front reduction of the extended OCC)
+ * and of the stencil output. With OCC the reductions run as INTERNAL and BOUNDARY views,
+ * and the STANDARD results must match the golden data of every iteration whatever the order of the two views.
+ */
+template <typename G, typename T, int C>
+void MapStencilReduce(TestData<G, T, C>&      data,
+                      Neon::skeleton::Occ     occ,
+                      Neon::set::TransferMode transfer)
+{
+    using Type = typename TestData<G, T, C>::Type;
+
+    auto occName = Neon::skeleton::OccUtils::toString(occ);
+    occName[0] = toupper(occName[0]);
+    const std::string appName(testFilePrefix + "_" + occName);
+
+    Neon::skeleton::Skeleton skl(data.getBackend());
+    Neon::skeleton::Options  opt(occ, transfer);
+
+    const Type scalarVal = 2;
+    const int  nIterations = 3;
+
+    auto fR = data.getGrid().template newPatternScalar<Type>();
+    fR() = scalarVal;
+    data.getBackend().syncAll();
+    data.resetValuesToRandom(1, 50);
+
+    Neon::PatternReduction<Type> sumX(0);
+    Neon::PatternReduction<Type> sum(0);
+    Neon::PatternReduction<Type> max(0);
+
+    std::vector<Type> sumXs;
+    std::vector<Type> sums;
+    std::vector<Type> maxs;
+    {  // SKELETON
+        auto& X = data.getField(FieldNames::X);
+        auto& Y = data.getField(FieldNames::Y);
+
+        std::vector<Neon::set::Container> ops{
+            UserTools::axpy(fR, Y, X),
+            reduceField("SumX", X, Neon::reduceOp::Sum<Type>(), Type(0), sumX),
+            UserTools::laplace(X, Y),
+            reduceField("Sum", Y, Neon::reduceOp::Sum<Type>(), Type(0), sum),
+            reduceField("Max", Y, Neon::reduceOp::Max<Type>(), std::numeric_limits<Type>::lowest(), max)};
+
+        skl.sequence(ops, appName, opt);
+        for (int i = 0; i < nIterations; i++) {
+            skl.run();
+            data.getBackend().syncAll();
+            sumXs.push_back(sumX());
+            sums.push_back(sum());
+            maxs.push_back(max());
+        }
+    }
+
+    {  // Golden data
+        Type  dR = scalarVal;
+        auto& X = data.getIODomain(FieldNames::X);
+        auto& Y = data.getIODomain(FieldNames::Y);
+
+        for (int i = 0; i < nIterations; i++) {
+            data.axpy(&dR, Y, X);
+
+            Type sumXGolden = 0;
+            data.forEachActiveIODomain([&](const Neon::index_3d&, int card, Type& x) {
+                if (card == 0) {
+#pragma omp atomic
+                    sumXGolden += x;
+                }
+            },
+                                       X);
+            ASSERT_EQ(sumXs[i], sumXGolden) << "Iteration " << i << " with OCC " << occName;
+
+            data.laplace(X, Y);
+
+            Type sumGolden = 0;
+            Type maxGolden = std::numeric_limits<Type>::lowest();
+            data.forEachActiveIODomain([&](const Neon::index_3d&, int card, Type& y) {
+                if (card == 0) {
+#pragma omp critical
+                    {
+                        sumGolden += y;
+                        maxGolden = std::max(maxGolden, y);
+                    }
+                }
+            },
+                                       Y);
+            ASSERT_EQ(sums[i], sumGolden) << "Iteration " << i << " with OCC " << occName;
+            ASSERT_EQ(maxs[i], maxGolden) << "Iteration " << i << " with OCC " << occName;
+        }
+    }
+}
+}  // namespace help
+
+template <typename G, typename T, int C>
+void runReduce(const Neon::domain::tool::Geometry& geo)
+{
+    for (int nPartitions : {1, 3}) {
+        for (auto occ : {Neon::skeleton::Occ::none, Neon::skeleton::Occ::standard,
+                         Neon::skeleton::Occ::extended, Neon::skeleton::Occ::twoWayExtended}) {
+            Neon::Backend     backend(nPartitions, Neon::Runtime::openmp);
+            TestData<G, T, C> data(backend, {24, 16, 40}, 1, backend.getMemoryOptions(), geo);
+            help::MapStencilReduce<G, T, C>(data, occ, Neon::set::TransferMode::get);
+        }
+    }
+}
+
+TEST(Reduce, dGrid)
+{
+    using Grid = Neon::domain::dGrid;
+    using Type = int64_t;
+    runReduce<Grid, Type, 0>(Neon::domain::tool::Geometry::FullDomain);
+}
+
+TEST(Reduce, eGrid)
+{
+    using Grid = Neon::domain::eGrid;
+    using Type = int64_t;
+    runReduce<Grid, Type, 0>(Neon::domain::tool::Geometry::Sphere);
+}
@@ -39,12 +39,16 @@ Real_ta CG_t<Grid_ta, Real_ta>::h_computeResidual(std::shared_ptr<matVec_t> A, F
     Neon::skeleton::Skeleton   skeleton(bk);
     auto                       delta_init = m_r.getGrid().template newPatternScalar<Real_ta>();
 
+    // The same sequence is built at every solve, its scheduled graph is reused from the graph cache
+    Neon::skeleton::Options opt;
+    opt.setGraphCache(true);
+
     skeleton.sequence({initR<Grid_ta, Real_ta>(m_r, x, b, bd),
                        A->matVec(x, bd, m_s),
                        AXPY<Grid_ta, Real_ta>(m_r, m_s),
                        m_r.getGrid().dot("init_rTr", m_r, m_r, delta_init),
                        copy<Grid_ta, Real_ta>(m_p, m_r)},
-                      "CG::computeInitResidual");
+                      "CG::computeInitResidual", opt);
     skeleton.run();
     bk.sync();
 
@@ -100,6 +104,28 @@ SolverStatus CG_t<Grid_ta, Real_ta>::solve(std::shared_ptr<matVec_t>        A,
 
     delta_new() = delta_init;
 
+    // After each iteration the residual is recorded and the convergence is checked before the next one.
+    // The skeleton runs the iterations from the host, one graph execution per iteration.
+    auto isDone = [](SolverStatus st) {
+        return st == SolverStatus::Converged || st == SolverStatus::Error || st == SolverStatus::IterationLimit;
+    };
+    std::function<bool(const Real_ta&)> keepIterating = [&](const Real_ta& deltaNew) -> bool {
+        ++iter;
+        result.residualEnd = std::sqrt(deltaNew);
+
+        // Store residual norms if requested
+        if (params.needResiduals) {
+            result.residuals.push_back(result.residualEnd);
+        }
+        if (iter == params.maxIterations) {
+            // No check after the last iteration, the status of the previous check is returned
+            return false;
+        }
+        // Stop if converged/diverged/reached maximum iteration
+        status = this->converged(deltaNew, delta_init_sq, iter, params);
+        return !isDone(status);
+    };
+
     // beta := delta_new/delta_old (computed on the fly inside updateP container)
     // p := r + beta*s (updateP container)
     // s := Ap (matVec container)
@@ -109,12 +135,18 @@ SolverStatus CG_t<Grid_ta, Real_ta>::solve(std::shared_ptr<matVec_t>        A,
     // r := r - alpha*S (updateXandR container)
     // delta_old := delta_new (done inside updateXandR container)
     // delta_new := <r,r> (dot container)
-    cgIter.sequence({updateP<Grid_ta, Real_ta>(m_p, m_r, delta_new(), delta_old()),
-                     A->matVec(m_p, bd, m_s),
-                     m_p.getGrid().dot("pAp", m_p, m_s, pAp),
-                     updateXandR<Grid_ta, Real_ta>(x, m_r, m_p, m_s, delta_new(), pAp(), delta_old()),
-                     m_r.getGrid().dot("rTr", m_r, m_r, delta_new)},
-                    result.solverName, opt);
+    //
+    // The iteration graph only depends on the structure of the sequence, so the solves after the first one
+    // reuse it from the graph cache
+    Neon::skeleton::Options iterOpt = opt;
+    iterOpt.setGraphCache(true);
+    cgIter.whileLoop({updateP<Grid_ta, Real_ta>(m_p, m_r, delta_new(), delta_old()),
+                      A->matVec(m_p, bd, m_s),
+                      m_p.getGrid().dot("pAp", m_p, m_s, pAp),
+                      updateXandR<Grid_ta, Real_ta>(x, m_r, m_p, m_s, delta_new(), pAp(), delta_old()),
+                      m_r.getGrid().dot("rTr", m_r, m_r, delta_new)},
+                     delta_new, keepIterating, int(params.maxIterations),
+                     result.solverName, iterOpt);
     delta_old() = 0;
 
     // Save the multi-GPU graph
@@ -127,20 +159,11 @@ SolverStatus CG_t<Grid_ta, Real_ta>::solve(std::shared_ptr<matVec_t>        A,
     timerSolution.start();
 
 
-    for (iter = 0; iter < params.maxIterations; ++iter) {
-        // Stop if converged/diverged/reached maximum iteration
+    if (params.maxIterations > 0) {
+        // Stop if the initial guess is already converged/diverged
         status = this->converged(delta_new(), delta_init_sq, iter, params);
-        if (status == SolverStatus::Converged || status == SolverStatus::Error || status == SolverStatus::IterationLimit) {
-            break;
-        }
-
-        cgIter.run();
-
-        result.residualEnd = std::sqrt(delta_new());
-
-        // Store residual norms if requested
-        if (params.needResiduals) {
-            result.residuals.push_back(result.residualEnd);
+        if (!isDone(status)) {
+            cgIter.run();
         }
     }
 
@@ -162,11 +185,13 @@ void CG_t<Grid_ta, Real_ta>::reset()
     auto& bk = this->h_getBackend(m_r);
 
     Neon::skeleton::Skeleton skeleton(bk);
+    Neon::skeleton::Options  opt;
+    opt.setGraphCache(true);
 
     skeleton.sequence({set<Grid_ta, Real_ta>(m_r, Real_ta(0.0)),
                        set<Grid_ta, Real_ta>(m_p, Real_ta(0.0)),
                        set<Grid_ta, Real_ta>(m_s, Real_ta(0.0))},
-                      "CG::Reset");
+                      "CG::Reset", opt);
     skeleton.run();
     bk.sync();
 }
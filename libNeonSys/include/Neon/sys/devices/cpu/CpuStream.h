@@ -0,0 +1,128 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Neon {
+namespace sys {
+
+/**
+ * CPU counterpart of a cudaEvent_t.
+ * Each record operation is identified by a ticket: the event is "occurred" for a ticket
+ * once the stream where it was recorded has executed all the work enqueued before the record.
+ * As with CUDA events, waiting on an event that has never been recorded does not block.
+ */
+class CpuEvent
+{
+    friend class CpuStream;
+
+   public:
+    CpuEvent() = default;
+    CpuEvent(const CpuEvent&) = delete;
+    CpuEvent& operator=(const CpuEvent&) = delete;
+
+    /**
+     * Blocks the calling thread until the last recorded operation has occurred
+     */
+    auto sync() const -> void;
+
+   private:
+    /**
+     * Returns a new ticket for a record operation
+     */
+    auto helpNewTicket() -> uint64_t;
+
+    /**
+     * Returns the ticket of the last record operation
+     */
+    auto helpLastTicket() const -> uint64_t;
+
+    /**
+     * Marks as occurred all the record operations up to the ticket
+     */
+    auto helpComplete(uint64_t ticket) -> void;
+
+    /**
+     * Blocks the calling thread until the record operation with the given ticket has occurred
+     */
+    auto helpWait(uint64_t ticket) const -> void;
+
+    mutable std::mutex              mMutex;
+    mutable std::condition_variable mOccurred;
+    uint64_t                        mRecorded{0};
+    uint64_t                        mCompleted{0};
+};
+
+/**
+ * CPU counterpart of a cudaStream_t: an in-order work queue served by a dedicated worker thread.
+ * Work enqueued on different streams runs concurrently, work enqueued on the same stream runs in order.
+ * The worker thread limits the size of the OpenMP teams it opens to nThreads (when positive),
+ * so that the concurrent streams of a backend share the cores instead of oversubscribing them.
+ * When a list of logical CPUs is given, the worker thread, and therefore its OpenMP team, is bound to them.
+ * An exception thrown by an enqueued task is stored and rethrown by the next sync().
+ */
+class CpuStream
+{
+   public:
+    explicit CpuStream(int nThreads = 0, std::vector<int> cpus = {});
+    ~CpuStream();
+    CpuStream(const CpuStream&) = delete;
+    CpuStream& operator=(const CpuStream&) = delete;
+
+    /**
+     * Appends a task to the queue. The call returns immediately.
+     */
+    auto enqueue(std::function<void()> task) -> void;
+
+    /**
+     * Records the event: the event occurs once all the tasks enqueued so far have been executed.
+     * Same semantic as cudaEventRecord.
+     */
+    auto enqueueEvent(const std::shared_ptr<CpuEvent>& event) -> void;
+
+    /**
+     * Makes all the future work of the stream wait for the last record of the event.
+     * Same semantic as cudaStreamWaitEvent.
+     */
+    auto waitForEvent(const std::shared_ptr<CpuEvent>& event) -> void;
+
+    /**
+     * Blocks the calling thread until all the enqueued tasks have been executed.
+     * Same semantic as cudaStreamSynchronize.
+     */
+    auto sync() -> void;
+
+    /**
+     * Returns the maximum size of the OpenMP teams opened by the tasks of the stream
+     */
+    auto nThreads() const -> int;
+
+    /**
+     * Returns the logical CPUs the worker thread is bound to, empty if it is not bound
+     */
+    auto cpus() const -> const std::vector<int>&;
+
+   private:
+    auto helpWorkerLoop() -> void;
+
+    std::mutex                        mMutex;
+    std::condition_variable           mTaskReady;
+    std::condition_variable           mIdle;
+    std::deque<std::function<void()>> mTasks;
+    bool                              mBusy{false};
+    bool                              mStop{false};
+    std::exception_ptr                mError;
+    int                               mNThreads{0};
+    std::vector<int>                  mCpus;
+    std::thread                       mWorker;
+};
+
+}  // namespace sys
+}  // namespace Neon
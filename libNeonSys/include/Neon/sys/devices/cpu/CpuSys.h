@@ -4,6 +4,7 @@
 #include "Neon/core/core.h"
 #include "Neon/sys/devices/DevInterface.h"
 #include "Neon/sys/devices/cpu/CpuDevice.h"
+#include "Neon/sys/devices/cpu/CpuTopology.h"
 #include "Neon/sys/devices/memType.h"
 #include "Neon/sys/memory/CpuMem.h"
 
@@ -53,9 +54,15 @@ class CpuSys
     */
     bool isInit() const;
 
+    /**
+     * Returns the sockets, cores and NUMA nodes of the CPU, discovered by init()
+     */
+    auto topology() const -> const CpuTopology&;
+
 
    private:
-    bool mInit;
+    bool        mInit;
+    CpuTopology mTopology;
 };
 
 
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Neon {
+namespace sys {
+
+/**
+ * How the partitions of a CPU DevSet are mapped to the cores of the machine (see CpuTopology::partitionCpus)
+ */
+enum struct CpuBinding
+{
+    none = 0 /**< the threads run wherever the OS and the OpenMP runtime place them */,
+    socket = 1 /**< each partition runs on the cores of one socket */,
+    core = 2 /**< each partition runs on a contiguous range of cores */
+};
+
+struct CpuBindingUtils
+{
+    static auto toString(CpuBinding binding) -> std::string;
+    static auto fromString(const std::string& binding) -> CpuBinding;
+};
+
+/**
+ * Logical CPUs of the machine with their core, socket and NUMA node.
+ * On Linux the topology is read from sysfs (/sys/devices/system/cpu and /sys/devices/system/node),
+ * elsewhere, or when sysfs is not readable, all the hardware threads are assumed to be cores of one socket and one node.
+ */
+class CpuTopology
+{
+   public:
+    struct LogicalCpu
+    {
+        int id{0} /**< OS index of the logical CPU */;
+        int core{0} /**< index of the physical core, unique over the sockets */;
+        int socket{0};
+        int node{0} /**< NUMA node */;
+    };
+
+    CpuTopology() = default;
+
+    /**
+     * Discovers the topology of the machine.
+     * @param sysfsRoot root of the sysfs system directory, to be changed only for testing
+     */
+    static auto discover(const std::string& sysfsRoot = "/sys/devices/system") -> CpuTopology;
+
+    /**
+     * Logical CPUs sorted by socket, core and id
+     */
+    auto cpus() const -> const std::vector<LogicalCpu>&;
+
+    auto nCpus() const -> int;
+    auto nCores() const -> int;
+    auto nSockets() const -> int;
+    auto nNodes() const -> int;
+
+    /**
+     * Logical CPUs assigned to each of nPartitions partitions.
+     * With socket binding partition i runs on socket i modulo the number of sockets.
+     * With core binding the cores, ordered by socket, are split into nPartitions contiguous ranges
+     * (partitions share cores when there are fewer cores than partitions); each partition gets all the
+     * hardware threads of its cores. Without binding every partition gets all the CPUs.
+     */
+    auto partitionCpus(int nPartitions, CpuBinding binding) const -> std::vector<std::vector<int>>;
+
+    /**
+     * NUMA node hosting most of the given logical CPUs, -1 if none of them is known
+     */
+    auto nodeOf(const std::vector<int>& cpus) const -> int;
+
+    /**
+     * Parses a sysfs CPU list such as "0-3,8,10-11"
+     */
+    static auto parseCpuList(const std::string& list) -> std::vector<int>;
+
+    /**
+     * Formats CPUs as a compact list such as "0-3,8,10-11"
+     */
+    static auto toCpuList(std::vector<int> cpus) -> std::string;
+
+    /**
+     * Restricts the calling thread to the given logical CPUs.
+     * Threads created afterwards by the calling thread (e.g. its OpenMP team) inherit the restriction.
+     * Returns false if the binding is not supported or failed.
+     */
+    static auto bindThread(const std::vector<int>& cpus) -> bool;
+
+    /**
+     * Sets the NUMA node as the preferred node of the pages of a memory buffer, moving the pages already touched.
+     * Only the whole pages within the buffer are affected.
+     * Returns false if the binding is not supported or failed.
+     */
+    static auto bindMemory(void* mem, size_t bytes, int node) -> bool;
+
+   private:
+    std::vector<LogicalCpu> mCpus;
+    int                     mNCores{0};
+    int                     mNSockets{0};
+    int                     mNNodes{0};
+};
+
+}  // namespace sys
+}  // namespace Neon
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "Neon/core/core.h"
+#include "Neon/sys/devices/cpu/CpuStream.h"
 #include "Neon/sys/devices/gpu/ComputeID.h"
 
 #include <atomic>
+#include <memory>
 #include <vector>
 
 //#include "cuda.h"
@@ -32,6 +34,8 @@ struct GpuEvent
 
     std::atomic_size_t* m_referenceCounter{nullptr}; /**< Reference counter */
 
+    std::shared_ptr<CpuEvent> m_cpuEvent; /**< Event used instead of the CUDA event by the CPU backend */
+
    private:
     //--------------------------------------------------------------------------
     // PRIVATE INITIALIZATION
@@ -57,6 +61,11 @@ struct GpuEvent
      */
     GpuEvent();
 
+    /**
+     * Creates an event backed by a CpuEvent instead of a CUDA event
+     */
+    explicit GpuEvent(std::shared_ptr<CpuEvent> cpuEvent);
+
     /**
      * Copy constructor
      */
@@ -107,6 +116,16 @@ struct GpuEvent
      */
     /*[[nodiscard]]*/ const ComputeID& gpuId() const;
 
+    /**
+     * Returns true if the event is backed by a CpuEvent
+     */
+    bool isCpuEvent() const;
+
+    /**
+     * Returns the CpuEvent backing the event
+     */
+    const std::shared_ptr<CpuEvent>& cpuEvent() const;
+
     //--------------------------------------------------------------------------
     // RESOURCE MANAGEMENT
     //--------------------------------------------------------------------------
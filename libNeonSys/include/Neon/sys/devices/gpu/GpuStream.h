@@ -1,8 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 #include <vector>
 #include "Neon/core/core.h"
+#include "Neon/sys/devices/cpu/CpuStream.h"
 #include "Neon/sys/devices/gpu/GpuEvent.h"
 #include "Neon/sys/devices/gpu/ComputeID.h"
 
@@ -20,6 +22,9 @@ struct GpuStream
     /**< Reference counter */
     std::atomic_size_t* m_referenceCounter{nullptr};
 
+    /**< Work queue used instead of the CUDA stream by the CPU backend (see CpuStream) */
+    std::shared_ptr<CpuStream> m_cpuStream;
+
    private:
     //--------------------------------------------------------------------------
     // PRIVATE INITIALIZATION
@@ -49,6 +54,11 @@ struct GpuStream
      */
     GpuStream() = default;
 
+    /**
+     * Creates a stream backed by a CPU work queue instead of a CUDA stream
+     */
+    explicit GpuStream(std::shared_ptr<CpuStream> cpuStream);
+
     /**
      * Copy constructor
      * @param other
@@ -100,6 +110,16 @@ struct GpuStream
      */
     const ComputeID& gpuId() const;
 
+    /**
+     * Returns true if the stream is backed by a CPU work queue
+     */
+    bool isCpuStream() const;
+
+    /**
+     * Returns the CPU work queue backing the stream
+     */
+    CpuStream& cpuStream() const;
+
     //--------------------------------------------------------------------------
     // RESOURCE MANAGEMENT
     //--------------------------------------------------------------------------
@@ -134,6 +154,10 @@ struct GpuStream
     void sync() const
     {
         if constexpr (run_et::et::sync == runMode) {
+            if (m_cpuStream) {
+                m_cpuStream->sync();
+                return;
+            }
             cudaError_t retCode = cudaStreamSynchronize(m_cudaStream);
             if (cudaSuccess != retCode) {
                 NeonException exc("GpuStream_t");
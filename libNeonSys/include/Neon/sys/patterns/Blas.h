@@ -1,8 +1,10 @@
 #pragma once
 #include <cublas_v2.h>
+#include <vector>
 
 #include "Neon/sys/devices/gpu/GpuStream.h"
 #include "Neon/sys/memory/MemDevice.h"
+#include "Neon/sys/patterns/ReproducibleSum.h"
 
 namespace Neon::sys::patterns {
 
@@ -10,6 +12,7 @@ enum class Engine
 {
     cuBlas = 0,
     CUB = 1,
+    deterministic = 2, /**< host only: bit-reproducible sums for any number of threads and partitions (see ReproducibleSum) */
 };
 
 /**
@@ -56,8 +59,8 @@ class Blas
     */
     void absoluteSum(const MemDevice<T>& input /**< input buffer. Should be allocated on the device */,
                      MemDevice<T>&       output /**< output buffer. Its size should be >=1 and it should be allocated on the device */,
-                     int                 start_id = 0 /**< index of the first element where computation should be done*/,
-                     int                 num_elements = std::numeric_limits<int>::max() /**< number of elements where computation should be done starting from start_id*/);
+                     int64_t             start_id = 0 /**< index of the first element where computation should be done*/,
+                     int64_t             num_elements = std::numeric_limits<int64_t>::max() /**< number of elements where computation should be done starting from start_id*/);
 
     /**
      * Compute the dot product of the input buffers i.e. sum_{i=0}^{n-1}(input1[i]*input2[i])
@@ -66,8 +69,19 @@ class Blas
     void dot(const MemDevice<T>& input1 /**< first input buffer. Should be allocated on the device */,
              const MemDevice<T>& input2 /**< second input buffer. Should be allocated on the device */,
              MemDevice<T>&       output /**< output buffer. Its size should be >=1 and it should be allocated on the device */,
-             int                 start_id /**< index of the first element where computation should be done*/,
-             int                 num_elements = std::numeric_limits<int>::max() /**< number of elements where computation should be done starting from start_id*/);
+             int64_t             start_id /**< index of the first element where computation should be done*/,
+             int64_t             num_elements = std::numeric_limits<int64_t>::max() /**< number of elements where computation should be done starting from start_id*/);
+
+    /**
+     * Compute several dot products at once i.e. output[k] = sum_{i=0}^{n-1}(inputs1[k][i]*inputs2[k][i]).
+     * On the host all the products are accumulated in a single pass over the inputs.
+     * On the device each product is a cuBLAS call.
+    */
+    void multiDot(const std::vector<const MemDevice<T>*>& inputs1 /**< first input buffer of each product. Should be allocated on the device */,
+                  const std::vector<const MemDevice<T>*>& inputs2 /**< second input buffer of each product. Should be allocated on the device */,
+                  MemDevice<T>&                           output /**< output buffer. Its size should be >= the number of products and it should be allocated on the host */,
+                  int64_t                                 start_id /**< index of the first element where computation should be done*/,
+                  int64_t                                 num_elements = std::numeric_limits<int64_t>::max() /**< number of elements where computation should be done starting from start_id*/);
 
     /**
      * Execute the second phase on reduction using CUB engine      
@@ -87,8 +101,8 @@ class Blas
     */
     void norm2(const MemDevice<T>& input /**< input buffer. Should be allocated on the device */,
                MemDevice<T>&       output /**< output buffer. Its size should be >=1 and it should be allocated on the device */,
-               int                 start_id = 0 /**< index of the first element where computation should be done*/,
-               int                 num_elements = std::numeric_limits<int>::max() /**< number of elements where computation should be done starting from start_id*/);
+               int64_t             start_id = 0 /**< index of the first element where computation should be done*/,
+               int64_t             num_elements = std::numeric_limits<int64_t>::max() /**< number of elements where computation should be done starting from start_id*/);
 
     /**
      * Destructor which releases all internal data i.e., destroy cuBLAS handle 
@@ -101,6 +115,12 @@ class Blas
     */
     void checkAllocator(const MemDevice<T>& input, const MemDevice<T>& output);
 
+    /**
+     * Number of elements as taken by cuBLAS, which only supports 32-bit sizes.
+     * Throw an exception if the range does not fit
+    */
+    static int cublasSize(int64_t num_elements);
+
     std::shared_ptr<cublasHandle_t> mHandle;                /**< cuBLAS handle */
     Neon::DeviceType                mDevType;               /** < type of the device*/
     DeviceID                        mDevID;                 /** < the device on which the computation and temp memory allocations happens*/
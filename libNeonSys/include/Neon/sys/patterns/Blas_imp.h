@@ -71,11 +71,22 @@ void Blas<T>::checkAllocator(const MemDevice<T>& input, const MemDevice<T>& outp
 }
 
 template <typename T>
-void Blas<T>::absoluteSum(const MemDevice<T>& input, MemDevice<T>& output, int start_id, int num_elements)
+int Blas<T>::cublasSize(int64_t num_elements)
+{
+    if (num_elements > int64_t(std::numeric_limits<int>::max())) {
+        NeonException exc("Blas");
+        exc << "cuBLAS can not reduce " << num_elements << " elements in a single call, the limit is " << std::numeric_limits<int>::max();
+        NEON_THROW(exc);
+    }
+    return static_cast<int>(num_elements);
+}
+
+template <typename T>
+void Blas<T>::absoluteSum(const MemDevice<T>& input, MemDevice<T>& output, int64_t start_id, int64_t num_elements)
 {
     checkAllocator(input, output);
 
-    num_elements = (num_elements == std::numeric_limits<int>::max()) ? static_cast<int>(input.nElements()) : num_elements;
+    num_elements = (num_elements == std::numeric_limits<int64_t>::max()) ? static_cast<int64_t>(input.nElements()) : num_elements;
 
 
     if (input.allocType() == Neon::Allocator::CUDA_MEM_DEVICE ||
@@ -86,6 +97,9 @@ void Blas<T>::absoluteSum(const MemDevice<T>& input, MemDevice<T>& output, int s
             exc << "cuBLAS engine only works with float and double data type";
             NEON_THROW(exc);
         }
+        if (mEngine == Engine::deterministic) {
+            NEON_THROW_UNSUPPORTED_OPTION("The deterministic engine only supports inputs allocated on the host");
+        }
         [[maybe_unused]] auto check_error = [&](cublasStatus_t status) {
             if (status != CUBLAS_STATUS_SUCCESS) {
                 NeonException exc("Blas::absoluteSum");
@@ -94,7 +108,7 @@ void Blas<T>::absoluteSum(const MemDevice<T>& input, MemDevice<T>& output, int s
             }
         };
         if constexpr (std::is_same<T, float>::value) {
-            cublasStatus_t status = cublasSasum(*mHandle, num_elements,
+            cublasStatus_t status = cublasSasum(*mHandle, cublasSize(num_elements),
                                                 input.mem() + start_id, 1,
                                                 output.mem());
             check_error(status);
@@ -102,7 +116,7 @@ void Blas<T>::absoluteSum(const MemDevice<T>& input, MemDevice<T>& output, int s
         }
 
         if constexpr (std::is_same<T, double>::value) {
-            cublasStatus_t status = cublasDasum(*mHandle, static_cast<int>(num_elements),
+            cublasStatus_t status = cublasDasum(*mHandle, cublasSize(num_elements),
                                                 input.mem() + start_id, 1,
                                                 output.mem());
             check_error(status);
@@ -110,10 +124,18 @@ void Blas<T>::absoluteSum(const MemDevice<T>& input, MemDevice<T>& output, int s
         }
     } else if (input.allocType() == Neon::Allocator::CUDA_MEM_HOST ||
                input.allocType() == Neon::Allocator::MALLOC) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (mEngine == Engine::deterministic) {
+                const T* in = input.mem();
+                output.mem()[0] = static_cast<T>(ReproducibleSum::sum([in](int64_t i) { return std::abs(double(in[i])); },
+                                                                      start_id, start_id + num_elements));
+                return;
+            }
+        }
         T ret = 0;
 #pragma omp parallel for reduction(+ \
                                    : ret)
-        for (int i = start_id; i < start_id + num_elements; ++i) {
+        for (int64_t i = start_id; i < start_id + num_elements; ++i) {
             if constexpr (std::is_signed_v<T>) {
                 ret += std::abs(input.mem()[i]);
             } else {
@@ -125,7 +147,7 @@ void Blas<T>::absoluteSum(const MemDevice<T>& input, MemDevice<T>& output, int s
 }
 
 template <typename T>
-void Blas<T>::dot(const MemDevice<T>& input1, const MemDevice<T>& input2, MemDevice<T>& output, int start_id, int num_elements)
+void Blas<T>::dot(const MemDevice<T>& input1, const MemDevice<T>& input2, MemDevice<T>& output, int64_t start_id, int64_t num_elements)
 {
     checkAllocator(input1, output);
     checkAllocator(input2, output);
@@ -138,7 +160,7 @@ void Blas<T>::dot(const MemDevice<T>& input1, const MemDevice<T>& input2, MemDev
         NEON_THROW(exc);
     }
 
-    num_elements = (num_elements == std::numeric_limits<int>::max()) ? static_cast<int>(input1.nElements()) : num_elements;
+    num_elements = (num_elements == std::numeric_limits<int64_t>::max()) ? static_cast<int64_t>(input1.nElements()) : num_elements;
 
     if (input1.allocType() == Neon::Allocator::CUDA_MEM_DEVICE ||
         input1.allocType() == Neon::Allocator::CUDA_MEM_UNIFIED) {
@@ -148,6 +170,9 @@ void Blas<T>::dot(const MemDevice<T>& input1, const MemDevice<T>& input2, MemDev
             exc << "cuBLAS engine only works with float and double data type";
             NEON_THROW(exc);
         }
+        if (mEngine == Engine::deterministic) {
+            NEON_THROW_UNSUPPORTED_OPTION("The deterministic engine only supports inputs allocated on the host");
+        }
 
         [[maybe_unused]] auto check_error = [&](cublasStatus_t status) {
             if (status != CUBLAS_STATUS_SUCCESS) {
@@ -158,7 +183,7 @@ void Blas<T>::dot(const MemDevice<T>& input1, const MemDevice<T>& input2, MemDev
         };
 
         if constexpr (std::is_same<T, float>::value) {
-            cublasStatus_t status = cublasSdot(*mHandle, num_elements,
+            cublasStatus_t status = cublasSdot(*mHandle, cublasSize(num_elements),
                                                input1.mem() + start_id, 1,
                                                input2.mem() + start_id, 1,
                                                output.mem());
@@ -167,7 +192,7 @@ void Blas<T>::dot(const MemDevice<T>& input1, const MemDevice<T>& input2, MemDev
         }
 
         if constexpr (std::is_same<T, double>::value) {
-            cublasStatus_t status = cublasDdot(*mHandle, static_cast<int>(num_elements),
+            cublasStatus_t status = cublasDdot(*mHandle, cublasSize(num_elements),
                                                input1.mem() + start_id, 1,
                                                input2.mem() + start_id, 1,
                                                output.mem());
@@ -176,10 +201,19 @@ void Blas<T>::dot(const MemDevice<T>& input1, const MemDevice<T>& input2, MemDev
         }
     } else if (input1.allocType() == Neon::Allocator::CUDA_MEM_HOST ||
                input1.allocType() == Neon::Allocator::MALLOC) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (mEngine == Engine::deterministic) {
+                const T* in1 = input1.mem();
+                const T* in2 = input2.mem();
+                output.mem()[0] = static_cast<T>(ReproducibleSum::sum([in1, in2](int64_t i) { return double(in1[i]) * double(in2[i]); },
+                                                                      start_id, start_id + num_elements));
+                return;
+            }
+        }
         T ret = 0;
 #pragma omp parallel for reduction(+ \
                                    : ret)
-        for (int i = start_id; i < start_id + num_elements; ++i) {
+        for (int64_t i = start_id; i < start_id + num_elements; ++i) {
             ret += input1.mem()[i] * input2.mem()[i];
         }
         output.mem()[0] = ret;
@@ -187,11 +221,120 @@ void Blas<T>::dot(const MemDevice<T>& input1, const MemDevice<T>& input2, MemDev
 }
 
 template <typename T>
-void Blas<T>::norm2(const MemDevice<T>& input, MemDevice<T>& output, int start_id, int num_elements)
+void Blas<T>::multiDot(const std::vector<const MemDevice<T>*>& inputs1,
+                       const std::vector<const MemDevice<T>*>& inputs2,
+                       MemDevice<T>&                           output,
+                       int64_t                                 start_id,
+                       int64_t                                 num_elements)
+{
+    const int nProducts = static_cast<int>(inputs1.size());
+    if (nProducts == 0 || inputs2.size() != inputs1.size()) {
+        NeonException exc("Blas::multiDot");
+        exc << "Expecting the same (non zero) number of first and second inputs";
+        exc << "\n Number of first inputs = " << inputs1.size();
+        exc << "\n Number of second inputs = " << inputs2.size();
+        NEON_THROW(exc);
+    }
+    if (output.nElements() < static_cast<size_t>(nProducts)) {
+        NeonException exc("Blas::multiDot");
+        exc << "Output size " << output.nElements() << " is smaller than the number of products " << nProducts;
+        NEON_THROW(exc);
+    }
+    for (int k = 0; k < nProducts; ++k) {
+        checkAllocator(*inputs1[k], output);
+        checkAllocator(*inputs2[k], output);
+        if (inputs1[k]->nElements() != inputs1[0]->nElements() ||
+            inputs2[k]->nElements() != inputs1[0]->nElements()) {
+            NeonException exc("Blas::multiDot");
+            exc << "All inputs should have the same size";
+            NEON_THROW(exc);
+        }
+    }
+
+    num_elements = (num_elements == std::numeric_limits<int64_t>::max()) ? static_cast<int64_t>(inputs1[0]->nElements()) : num_elements;
+
+    if (inputs1[0]->allocType() == Neon::Allocator::CUDA_MEM_DEVICE ||
+        inputs1[0]->allocType() == Neon::Allocator::CUDA_MEM_UNIFIED) {
+
+        if constexpr (!std::is_same<T, double>::value && !std::is_same<T, float>::value) {
+            NeonException exc("Blas::multiDot");
+            exc << "cuBLAS engine only works with float and double data type";
+            NEON_THROW(exc);
+        }
+        if (mEngine == Engine::deterministic) {
+            NEON_THROW_UNSUPPORTED_OPTION("The deterministic engine only supports inputs allocated on the host");
+        }
+
+        [[maybe_unused]] auto check_error = [&](cublasStatus_t status) {
+            if (status != CUBLAS_STATUS_SUCCESS) {
+                NeonException exc("Blas::multiDot");
+                exc << "cuBLAS error during dot product operation with error: " << Neon::sys::cublasGetErrorString(status);
+                NEON_THROW(exc);
+            }
+        };
+
+        for (int k = 0; k < nProducts; ++k) {
+            if constexpr (std::is_same<T, float>::value) {
+                cublasStatus_t status = cublasSdot(*mHandle, cublasSize(num_elements),
+                                                   inputs1[k]->mem() + start_id, 1,
+                                                   inputs2[k]->mem() + start_id, 1,
+                                                   output.mem() + k);
+                check_error(status);
+            }
+
+            if constexpr (std::is_same<T, double>::value) {
+                cublasStatus_t status = cublasDdot(*mHandle, cublasSize(num_elements),
+                                                   inputs1[k]->mem() + start_id, 1,
+                                                   inputs2[k]->mem() + start_id, 1,
+                                                   output.mem() + k);
+                check_error(status);
+            }
+        }
+    } else if (inputs1[0]->allocType() == Neon::Allocator::CUDA_MEM_HOST ||
+               inputs1[0]->allocType() == Neon::Allocator::MALLOC) {
+        std::vector<const T*> a(nProducts);
+        std::vector<const T*> b(nProducts);
+        for (int k = 0; k < nProducts; ++k) {
+            a[k] = inputs1[k]->mem();
+            b[k] = inputs2[k]->mem();
+            output.mem()[k] = 0;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            if (mEngine == Engine::deterministic) {
+                for (int k = 0; k < nProducts; ++k) {
+                    const T* in1 = a[k];
+                    const T* in2 = b[k];
+                    output.mem()[k] = static_cast<T>(ReproducibleSum::sum([in1, in2](int64_t i) { return double(in1[i]) * double(in2[i]); },
+                                                                          start_id, start_id + num_elements));
+                }
+                return;
+            }
+        }
+        // Each thread accumulates all the products over its chunk of elements,
+        // the partial sums are then combined once per thread
+#pragma omp parallel default(shared)
+        {
+            std::vector<T> partial(nProducts, T(0));
+#pragma omp for
+            for (int64_t i = start_id; i < start_id + num_elements; ++i) {
+                for (int k = 0; k < nProducts; ++k) {
+                    partial[k] += a[k][i] * b[k][i];
+                }
+            }
+#pragma omp critical
+            for (int k = 0; k < nProducts; ++k) {
+                output.mem()[k] += partial[k];
+            }
+        }
+    }
+}
+
+template <typename T>
+void Blas<T>::norm2(const MemDevice<T>& input, MemDevice<T>& output, int64_t start_id, int64_t num_elements)
 {
     checkAllocator(input, output);
 
-    num_elements = (num_elements == std::numeric_limits<int>::max()) ? static_cast<int>(input.nElements()) : num_elements;
+    num_elements = (num_elements == std::numeric_limits<int64_t>::max()) ? static_cast<int64_t>(input.nElements()) : num_elements;
 
     if (input.allocType() == Neon::Allocator::CUDA_MEM_DEVICE ||
         input.allocType() == Neon::Allocator::CUDA_MEM_UNIFIED) {
@@ -201,6 +344,9 @@ void Blas<T>::norm2(const MemDevice<T>& input, MemDevice<T>& output, int start_i
             exc << "cuBLAS engine only works with float and double data type";
             NEON_THROW(exc);
         }
+        if (mEngine == Engine::deterministic) {
+            NEON_THROW_UNSUPPORTED_OPTION("The deterministic engine only supports inputs allocated on the host");
+        }
 
         [[maybe_unused]] auto check_error = [&](cublasStatus_t status) {
             if (status != CUBLAS_STATUS_SUCCESS) {
@@ -210,7 +356,7 @@ void Blas<T>::norm2(const MemDevice<T>& input, MemDevice<T>& output, int start_i
             }
         };
         if constexpr (std::is_same<T, float>::value) {
-            cublasStatus_t status = cublasSnrm2(*mHandle, num_elements,
+            cublasStatus_t status = cublasSnrm2(*mHandle, cublasSize(num_elements),
                                                 input.mem() + start_id, 1,
                                                 output.mem());
             check_error(status);
@@ -218,7 +364,7 @@ void Blas<T>::norm2(const MemDevice<T>& input, MemDevice<T>& output, int start_i
         }
 
         if constexpr (std::is_same<T, double>::value) {
-            cublasStatus_t status = cublasDnrm2(*mHandle, static_cast<int>(num_elements),
+            cublasStatus_t status = cublasDnrm2(*mHandle, cublasSize(num_elements),
                                                 input.mem() + start_id, 1,
                                                 output.mem());
             check_error(status);
@@ -228,10 +374,18 @@ void Blas<T>::norm2(const MemDevice<T>& input, MemDevice<T>& output, int start_i
 
     } else if (input.allocType() == Neon::Allocator::CUDA_MEM_HOST ||
                input.allocType() == Neon::Allocator::MALLOC) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (mEngine == Engine::deterministic) {
+                const T* in = input.mem();
+                output.mem()[0] = static_cast<T>(std::sqrt(ReproducibleSum::sum([in](int64_t i) { return double(in[i]) * double(in[i]); },
+                                                                                start_id, start_id + num_elements)));
+                return;
+            }
+        }
         T ret = 0;
 #pragma omp parallel for reduction(+ \
                                    : ret)
-        for (int i = start_id; i < start_id + num_elements; ++i) {
+        for (int64_t i = start_id; i < start_id + num_elements; ++i) {
             ret += input.mem()[i] * input.mem()[i];
         }
         output.mem()[0] = static_cast<T>(std::sqrt(ret));
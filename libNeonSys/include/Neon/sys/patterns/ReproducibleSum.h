@@ -0,0 +1,190 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "Neon/core/core.h"
+
+namespace Neon::sys::patterns {
+
+/**
+ * Order independent summation of double precision terms through a binned integer superaccumulator.
+ *
+ * Every double is an integer multiple of 2^-1074. A term is split into 32-bit bins (limbs) of that fixed
+ * point representation and added to them as integers, so no rounding happens until the final conversion:
+ * the accumulated value is the exact sum of the terms, whatever the order of the additions, the number of
+ * threads or the partitions and slices the terms are split into.
+ * The result is a single pass over the terms, the instances of different threads (or processes) are combined
+ * by adding their limbs, which is exact too.
+ *
+ * Limbs are stored in 64-bit signed integers: the additions accumulate in the upper bits and the carries
+ * are propagated before they can overflow.
+ */
+class ReproducibleSum
+{
+   public:
+    /** Limbs covering the full double range (2^-1074 to 2^1024) plus carry headroom */
+    static constexpr int nLimbs = 68;
+    /** Limbs and the counter of non finite terms */
+    static constexpr int nWords = nLimbs + 1;
+
+    ReproducibleSum() = default;
+
+    /**
+     * Accumulate a single term
+     */
+    auto add(double x) -> void
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        const int exponent = int((bits >> 52) & 0x7ff);
+        if (exponent == 0x7ff) {
+            mWords[nLimbs]++;
+            return;
+        }
+        uint64_t mantissa = bits & ((uint64_t(1) << 52) - 1);
+        if (exponent != 0) {
+            mantissa |= uint64_t(1) << 52;
+        }
+        if (mantissa == 0) {
+            return;
+        }
+        // x = +/- mantissa * 2^(pos - 1074)
+        const int      pos = exponent == 0 ? 0 : exponent - 1;
+        const int      limb = pos / 32;
+        const int      shift = pos % 32;
+        const uint64_t lo = (mantissa & sMask) << shift;
+        const uint64_t hi = (mantissa >> 32) << shift;
+        const int64_t  c0 = int64_t(lo & sMask);
+        const int64_t  c1 = int64_t(lo >> 32) + int64_t(hi & sMask);
+        const int64_t  c2 = int64_t(hi >> 32);
+        if (bits >> 63) {
+            mWords[limb] -= c0;
+            mWords[limb + 1] -= c1;
+            mWords[limb + 2] -= c2;
+        } else {
+            mWords[limb] += c0;
+            mWords[limb + 1] += c1;
+            mWords[limb + 2] += c2;
+        }
+        if (++mNAdds >= sMaxAdds) {
+            helpNormalize();
+        }
+    }
+
+    /**
+     * Accumulate term(i) for i in [begin, end).
+     * Each thread accumulates its own instance, the instances are then merged in any order.
+     */
+    template <typename TermT>
+    auto add(TermT term, int64_t begin, int64_t end) -> void
+    {
+#pragma omp parallel
+        {
+            ReproducibleSum local;
+#pragma omp for nowait
+            for (int64_t i = begin; i < end; ++i) {
+                local.add(term(i));
+            }
+#pragma omp critical
+            merge(local);
+        }
+    }
+
+    /**
+     * Single pass over term(i) for i in [begin, end)
+     */
+    template <typename TermT>
+    static auto sum(TermT term, int64_t begin, int64_t end) -> double
+    {
+        ReproducibleSum ret;
+        ret.add(term, begin, end);
+        return ret.result();
+    }
+
+    /**
+     * Accumulate the limbs of another instance
+     */
+    auto merge(const ReproducibleSum& other) -> void
+    {
+        if (mNAdds + other.mNAdds + 1 >= sMaxAdds) {
+            helpNormalize();
+        }
+        for (int k = 0; k < nWords; k++) {
+            mWords[k] += other.mWords[k];
+        }
+        // A normalized instance still moves each limb by less than 2^32
+        mNAdds += other.mNAdds + 1;
+    }
+
+    /**
+     * Normalized limbs followed by the counter of non finite terms,
+     * e.g. to add up element-wise the words of instances living in different processes before calling result.
+     */
+    auto words() -> std::array<int64_t, nWords>&
+    {
+        helpNormalize();
+        return mWords;
+    }
+
+    /**
+     * Rounding of the exact sum to double precision
+     */
+    auto result() -> double
+    {
+        if (mWords[nLimbs] != 0) {
+            NeonException exc("ReproducibleSum");
+            exc << "Terms are not finite";
+            NEON_THROW(exc);
+        }
+        helpNormalize();
+        std::array<int64_t, nLimbs> limbs;
+        std::copy(mWords.begin(), mWords.begin() + nLimbs, limbs.begin());
+        const bool negative = limbs[nLimbs - 1] < 0;
+        if (negative) {
+            for (auto& limb : limbs) {
+                limb = -limb;
+            }
+            helpCarry(limbs);
+        }
+        // Normalized limbs are unique for a given value, so is the rounding
+        double ret = 0;
+        for (int k = nLimbs - 1; k >= 0; k--) {
+            if (limbs[k] != 0) {
+                ret += std::ldexp(double(limbs[k]), 32 * k - 1074);
+            }
+        }
+        return negative ? -ret : ret;
+    }
+
+   private:
+    static constexpr uint64_t sMask = 0xffffffff;
+    /** Each addition moves a limb by less than 2^33, the limbs are normalized long before 2^63 */
+    static constexpr int64_t sMaxAdds = int64_t(1) << 29;
+
+    /**
+     * Propagate the carries so that all limbs but the last one are in [0, 2^32)
+     */
+    template <typename Limbs>
+    static auto helpCarry(Limbs& limbs) -> void
+    {
+        for (int k = 0; k < nLimbs - 1; k++) {
+            const int64_t low = int64_t(uint64_t(limbs[k]) & sMask);
+            limbs[k + 1] += (limbs[k] - low) / (int64_t(1) << 32);
+            limbs[k] = low;
+        }
+    }
+
+    auto helpNormalize() -> void
+    {
+        helpCarry(mWords);
+        mNAdds = 0;
+    }
+
+    std::array<int64_t, nWords> mWords{};
+    int64_t                     mNAdds = 0;
+};
+
+}  // namespace Neon::sys::patterns
@@ -22,6 +22,8 @@
 
 #include "Neon/core/tools/Logger.h"
 
+#include "Neon/sys/devices/cpu/CpuTopology.h"
+#include "Neon/sys/global/CpuSysGlobal.h"
 #include "Neon/sys/global/GpuSysGlobal.h"
 
 #include "Neon/Report.h"
@@ -101,6 +103,14 @@ auto Report::system() -> void
 
 #endif
 
+    if (Neon::sys::globalSpace::cpuSysObj().isInit()) {
+        const auto& topology = Neon::sys::globalSpace::cpuSysObj().topology();
+        addMember("CPU Sockets", topology.nSockets(), &subdoc);
+        addMember("CPU Cores", topology.nCores(), &subdoc);
+        addMember("CPU Logical Cores", topology.nCpus(), &subdoc);
+        addMember("NUMA Nodes", topology.nNodes(), &subdoc);
+    }
+
     addSubdoc("System", subdoc);
 }
 
@@ -0,0 +1,152 @@
+#include "Neon/sys/devices/cpu/CpuStream.h"
+
+#include <algorithm>
+#include <omp.h>
+#include <utility>
+
+#include "Neon/core/core.h"
+#include "Neon/sys/devices/cpu/CpuTopology.h"
+
+namespace Neon {
+namespace sys {
+
+auto CpuEvent::sync() const -> void
+{
+    helpWait(helpLastTicket());
+}
+
+auto CpuEvent::helpNewTicket() -> uint64_t
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return ++mRecorded;
+}
+
+auto CpuEvent::helpLastTicket() const -> uint64_t
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mRecorded;
+}
+
+auto CpuEvent::helpComplete(uint64_t ticket) -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCompleted = std::max(mCompleted, ticket);
+    }
+    mOccurred.notify_all();
+}
+
+auto CpuEvent::helpWait(uint64_t ticket) const -> void
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mOccurred.wait(lock, [&] { return mCompleted >= ticket; });
+}
+
+CpuStream::CpuStream(int nThreads, std::vector<int> cpus)
+    : mNThreads(nThreads),
+      mCpus(std::move(cpus))
+{
+    mWorker = std::thread([this] { helpWorkerLoop(); });
+}
+
+CpuStream::~CpuStream()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mTaskReady.notify_all();
+    if (mWorker.joinable()) {
+        mWorker.join();
+    }
+}
+
+auto CpuStream::enqueue(std::function<void()> task) -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTasks.push_back(std::move(task));
+    }
+    mTaskReady.notify_one();
+}
+
+auto CpuStream::enqueueEvent(const std::shared_ptr<CpuEvent>& event) -> void
+{
+    const uint64_t ticket = event->helpNewTicket();
+    enqueue([event, ticket] { event->helpComplete(ticket); });
+}
+
+auto CpuStream::waitForEvent(const std::shared_ptr<CpuEvent>& event) -> void
+{
+    // The ticket is taken now: later records of the event do not affect this wait
+    const uint64_t ticket = event->helpLastTicket();
+    if (ticket == 0) {
+        return;
+    }
+    enqueue([event, ticket] { event->helpWait(ticket); });
+}
+
+auto CpuStream::sync() -> void
+{
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mIdle.wait(lock, [&] { return mTasks.empty() && !mBusy; });
+        std::swap(error, mError);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+auto CpuStream::nThreads() const -> int
+{
+    return mNThreads;
+}
+
+auto CpuStream::cpus() const -> const std::vector<int>&
+{
+    return mCpus;
+}
+
+auto CpuStream::helpWorkerLoop() -> void
+{
+    // The binding is done before the OpenMP team of the worker is created, so that the team inherits it
+    if (!mCpus.empty() && !CpuTopology::bindThread(mCpus)) {
+        NEON_WARNING("CpuStream: unable to bind the worker thread to the CPUs {}", CpuTopology::toCpuList(mCpus));
+    }
+    if (mNThreads > 0) {
+        omp_set_num_threads(mNThreads);
+    }
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mTaskReady.wait(lock, [&] { return mStop || !mTasks.empty(); });
+            if (mTasks.empty()) {
+                return;
+            }
+            task = std::move(mTasks.front());
+            mTasks.pop_front();
+            mBusy = true;
+        }
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mError) {
+                mError = std::current_exception();
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mBusy = false;
+            if (mTasks.empty()) {
+                mIdle.notify_all();
+            }
+        }
+    }
+}
+
+}  // namespace sys
+}  // namespace Neon
@@ -18,8 +18,11 @@ void CpuSys::init()
 
     this->m_cpuDevVec.emplace_back();
     this->m_cpuMemVec.emplace_back(this->m_cpuDevVec[0]);
+    mTopology = CpuTopology::discover();
 
     NEON_INFO("CpuSys_t: Loading info on CPU subsystem");
+    NEON_INFO("CpuSys_t: {} sockets, {} cores, {} logical cores, {} NUMA nodes",
+              mTopology.nSockets(), mTopology.nCores(), mTopology.nCpus(), mTopology.nNodes());
 }
 
 const CpuDev& CpuSys::dev() const
@@ -46,5 +49,10 @@ bool CpuSys::isInit() const
     return mInit;
 }
 
+auto CpuSys::topology() const -> const CpuTopology&
+{
+    return mTopology;
+}
+
 }  // namespace sys
 }  // End of namespace Neon
\ No newline at end of file
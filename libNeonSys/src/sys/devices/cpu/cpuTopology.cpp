@@ -0,0 +1,329 @@
+#include "Neon/sys/devices/cpu/CpuTopology.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "Neon/core/core.h"
+
+namespace Neon {
+namespace sys {
+
+namespace {
+/**
+ * Reads the first line of a sysfs file, false if the file can not be read
+ */
+auto readLine(const std::string& fname, std::string& line) -> bool
+{
+    std::ifstream in(fname);
+    if (!in || !std::getline(in, line)) {
+        return false;
+    }
+    return true;
+}
+
+auto readInt(const std::string& fname, int defaultValue) -> int
+{
+    std::string line;
+    if (!readLine(fname, line)) {
+        return defaultValue;
+    }
+    try {
+        return std::stoi(line);
+    } catch (...) {
+        return defaultValue;
+    }
+}
+}  // namespace
+
+auto CpuBindingUtils::toString(CpuBinding binding) -> std::string
+{
+    switch (binding) {
+        case CpuBinding::none: {
+            return "none";
+        }
+        case CpuBinding::socket: {
+            return "socket";
+        }
+        case CpuBinding::core: {
+            return "core";
+        }
+    }
+    NEON_THROW_UNSUPPORTED_OPTION("");
+}
+
+auto CpuBindingUtils::fromString(const std::string& binding) -> CpuBinding
+{
+    for (auto option : {CpuBinding::none, CpuBinding::socket, CpuBinding::core}) {
+        if (binding == toString(option)) {
+            return option;
+        }
+    }
+    NeonException exp("CpuBindingUtils");
+    exp << "Unknown CPU binding " << binding;
+    NEON_THROW(exp);
+}
+
+auto CpuTopology::parseCpuList(const std::string& list) -> std::vector<int>
+{
+    std::vector<int>  cpus;
+    std::stringstream ss(list);
+    std::string       range;
+    while (std::getline(ss, range, ',')) {
+        range.erase(std::remove_if(range.begin(), range.end(), [](unsigned char c) { return std::isspace(c); }), range.end());
+        if (range.empty()) {
+            continue;
+        }
+        try {
+            const auto dash = range.find('-');
+            const int  first = std::stoi(range.substr(0, dash));
+            const int  last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; cpu++) {
+                cpus.push_back(cpu);
+            }
+        } catch (...) {
+            NeonException exp("CpuTopology");
+            exp << "Invalid CPU list " << list;
+            NEON_THROW(exp);
+        }
+    }
+    return cpus;
+}
+
+auto CpuTopology::toCpuList(std::vector<int> cpus) -> std::string
+{
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+    std::ostringstream os;
+    for (size_t i = 0; i < cpus.size();) {
+        size_t j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+            j++;
+        }
+        os << (i == 0 ? "" : ",") << cpus[i];
+        if (j > i) {
+            os << "-" << cpus[j];
+        }
+        i = j + 1;
+    }
+    return os.str();
+}
+
+auto CpuTopology::discover(const std::string& sysfsRoot) -> CpuTopology
+{
+    CpuTopology topology;
+
+    std::string      online;
+    std::vector<int> ids;
+    if (readLine(sysfsRoot + "/cpu/online", online)) {
+        ids = parseCpuList(online);
+    }
+    if (ids.empty()) {
+        // No sysfs: one socket with one core per hardware thread
+        const int n = std::max(1, int(std::thread::hardware_concurrency()));
+        for (int i = 0; i < n; i++) {
+            topology.mCpus.push_back({i, i, 0, 0});
+        }
+        topology.mNCores = n;
+        topology.mNSockets = 1;
+        topology.mNNodes = 1;
+        return topology;
+    }
+
+    std::map<int, int> nodeOfCpu;
+    const std::string  nodeDir = sysfsRoot + "/node";
+    std::error_code    ec;
+    if (std::filesystem::is_directory(nodeDir, ec)) {
+        for (const auto& entry : std::filesystem::directory_iterator(nodeDir, ec)) {
+            const std::string name = entry.path().filename().string();
+            std::string       list;
+            if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+                !std::all_of(name.begin() + 4, name.end(), [](unsigned char c) { return std::isdigit(c); }) ||
+                !readLine(entry.path().string() + "/cpulist", list)) {
+                continue;
+            }
+            const int node = std::stoi(name.substr(4));
+            for (int cpu : parseCpuList(list)) {
+                nodeOfCpu[cpu] = node;
+            }
+        }
+    }
+
+    // Sockets and cores are renumbered densely, cores are unique over the sockets
+    std::map<int, int>                 socketIdx;
+    std::map<std::pair<int, int>, int> coreIdx;
+    std::vector<std::pair<int, int>>   socketCoreOfCpu;
+    for (int id : ids) {
+        const std::string topo = sysfsRoot + "/cpu/cpu" + std::to_string(id) + "/topology/";
+        const int         socket = std::max(0, readInt(topo + "physical_package_id", 0));
+        const int         core = readInt(topo + "core_id", id);
+        socketIdx[socket] = 0;
+        coreIdx[{socket, core}] = 0;
+        socketCoreOfCpu.emplace_back(socket, core);
+    }
+    int count = 0;
+    for (auto& [socket, idx] : socketIdx) {
+        idx = count++;
+    }
+    count = 0;
+    for (auto& [socketCore, idx] : coreIdx) {
+        idx = count++;
+    }
+
+    std::map<int, int> nodes;
+    for (size_t i = 0; i < ids.size(); i++) {
+        LogicalCpu cpu;
+        cpu.id = ids[i];
+        cpu.socket = socketIdx[socketCoreOfCpu[i].first];
+        cpu.core = coreIdx[socketCoreOfCpu[i]];
+        auto nodeIt = nodeOfCpu.find(ids[i]);
+        cpu.node = nodeIt == nodeOfCpu.end() ? 0 : nodeIt->second;
+        nodes[cpu.node] = 0;
+        topology.mCpus.push_back(cpu);
+    }
+    std::sort(topology.mCpus.begin(), topology.mCpus.end(), [](const LogicalCpu& a, const LogicalCpu& b) {
+        return std::make_tuple(a.socket, a.core, a.id) < std::make_tuple(b.socket, b.core, b.id);
+    });
+    topology.mNCores = int(coreIdx.size());
+    topology.mNSockets = int(socketIdx.size());
+    topology.mNNodes = int(nodes.size());
+    return topology;
+}
+
+auto CpuTopology::cpus() const -> const std::vector<LogicalCpu>&
+{
+    return mCpus;
+}
+
+auto CpuTopology::nCpus() const -> int
+{
+    return int(mCpus.size());
+}
+
+auto CpuTopology::nCores() const -> int
+{
+    return mNCores;
+}
+
+auto CpuTopology::nSockets() const -> int
+{
+    return mNSockets;
+}
+
+auto CpuTopology::nNodes() const -> int
+{
+    return mNNodes;
+}
+
+auto CpuTopology::partitionCpus(int nPartitions, CpuBinding binding) const -> std::vector<std::vector<int>>
+{
+    std::vector<std::vector<int>> ret(std::max(0, nPartitions));
+    for (int p = 0; p < nPartitions; p++) {
+        for (const auto& cpu : mCpus) {
+            bool isIn = true;
+            switch (binding) {
+                case CpuBinding::none: {
+                    break;
+                }
+                case CpuBinding::socket: {
+                    isIn = cpu.socket == p % mNSockets;
+                    break;
+                }
+                case CpuBinding::core: {
+                    if (nPartitions <= mNCores) {
+                        const int firstCore = int(int64_t(p) * mNCores / nPartitions);
+                        const int lastCore = int(int64_t(p + 1) * mNCores / nPartitions);
+                        isIn = cpu.core >= firstCore && cpu.core < lastCore;
+                    } else {
+                        isIn = cpu.core == p % mNCores;
+                    }
+                    break;
+                }
+            }
+            if (isIn) {
+                ret[p].push_back(cpu.id);
+            }
+        }
+    }
+    return ret;
+}
+
+auto CpuTopology::nodeOf(const std::vector<int>& cpus) const -> int
+{
+    std::map<int, int> counts;
+    for (const auto& cpu : mCpus) {
+        if (std::find(cpus.begin(), cpus.end(), cpu.id) != cpus.end()) {
+            counts[cpu.node]++;
+        }
+    }
+    int node = -1;
+    int best = 0;
+    for (const auto& [n, c] : counts) {
+        if (c > best) {
+            node = n;
+            best = c;
+        }
+    }
+    return node;
+}
+
+auto CpuTopology::bindThread([[maybe_unused]] const std::vector<int>& cpus) -> bool
+{
+#ifdef __linux__
+    if (cpus.empty()) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+auto CpuTopology::bindMemory([[maybe_unused]] void* mem, [[maybe_unused]] size_t bytes, [[maybe_unused]] int node) -> bool
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    if (mem == nullptr || node < 0) {
+        return false;
+    }
+    const uintptr_t pageSize = uintptr_t(sysconf(_SC_PAGESIZE));
+    const uintptr_t begin = (uintptr_t(mem) + pageSize - 1) / pageSize * pageSize;
+    const uintptr_t end = (uintptr_t(mem) + bytes) / pageSize * pageSize;
+    if (end <= begin) {
+        // Smaller than a page
+        return false;
+    }
+    // Same values as MPOL_PREFERRED and MPOL_MF_MOVE of <numaif.h>, which is not required
+    const int                  mpolPreferred = 1;
+    const unsigned             mpolMfMove = 1u << 1;
+    const size_t               bitsPerWord = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> nodeMask(size_t(node) / bitsPerWord + 1, 0);
+    nodeMask[size_t(node) / bitsPerWord] |= 1ul << (size_t(node) % bitsPerWord);
+    return syscall(SYS_mbind, begin, end - begin, mpolPreferred, nodeMask.data(), nodeMask.size() * bitsPerWord + 1, mpolMfMove) == 0;
+#else
+    return false;
+#endif
+}
+
+}  // namespace sys
+}  // namespace Neon
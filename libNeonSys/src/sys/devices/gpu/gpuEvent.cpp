@@ -23,11 +23,18 @@ GpuEvent::GpuEvent(ComputeID gpuIdx, cudaEvent_t cudaEvent)
     m_referenceCounter = new std::atomic_size_t(1);
 }
 
+GpuEvent::GpuEvent(std::shared_ptr<CpuEvent> cpuEvent)
+{
+    this->helper_ResetLocal();
+    m_cpuEvent = std::move(cpuEvent);
+}
+
 GpuEvent::GpuEvent(const GpuEvent& other)
 {
     m_gpuId = other.m_gpuId;
     m_cudaEvent = other.m_cudaEvent;
     m_referenceCounter = other.m_referenceCounter;
+    m_cpuEvent = other.m_cpuEvent;
     if (other.m_referenceCounter != nullptr) {
         m_referenceCounter->fetch_add(1);
     }
@@ -42,6 +49,7 @@ GpuEvent::GpuEvent(GpuEvent&& other)
     m_gpuId = other.m_gpuId;
     m_cudaEvent = other.m_cudaEvent;
     m_referenceCounter = other.m_referenceCounter;
+    m_cpuEvent = std::move(other.m_cpuEvent);
     //    if(other.m_referenceCounter != nullptr) {
     //        m_referenceCounter->fetch_add(1);
     //    }
@@ -56,6 +64,7 @@ GpuEvent& GpuEvent::operator=(const GpuEvent& other) noexcept
         m_gpuId = other.m_gpuId;
         m_cudaEvent = other.m_cudaEvent;
         m_referenceCounter = other.m_referenceCounter;
+        m_cpuEvent = other.m_cpuEvent;
         if (other.m_referenceCounter != nullptr) {
             m_referenceCounter->fetch_add(1);
         }
@@ -71,6 +80,7 @@ GpuEvent& GpuEvent::operator=(GpuEvent&& other) noexcept
         m_gpuId = other.m_gpuId;
         m_cudaEvent = other.m_cudaEvent;
         m_referenceCounter = other.m_referenceCounter;
+        m_cpuEvent = std::move(other.m_cpuEvent);
 
         other.helper_ResetLocal();
     }
@@ -89,6 +99,7 @@ void GpuEvent::helper_ResetLocal()
     m_gpuId.setInvalid();
     m_cudaEvent = nullptr;
     m_referenceCounter = nullptr;
+    m_cpuEvent.reset();
 }
 
 void GpuEvent::helper_ResetGlobal()
@@ -131,8 +142,27 @@ const ComputeID& GpuEvent::gpuId() const
     return m_gpuId;
 }
 
+bool GpuEvent::isCpuEvent() const
+{
+    return m_cpuEvent != nullptr;
+}
+
+const std::shared_ptr<CpuEvent>& GpuEvent::cpuEvent() const
+{
+    if (!m_cpuEvent) {
+        NeonException exp("GpuEvent_t");
+        exp << "The event is not backed by a CpuEvent.";
+        NEON_THROW(exp);
+    }
+    return m_cpuEvent;
+}
+
 void GpuEvent::sync() const
 {
+    if (m_cpuEvent) {
+        m_cpuEvent->sync();
+        return;
+    }
     auto res = cudaEventSynchronize(m_cudaEvent);
     if (res != cudaSuccess) {
         NeonException exp("GpuEvent_t");
@@ -16,6 +16,12 @@ GpuStream::GpuStream(ComputeID gpuIdx, cudaStream_t cudaStream)
     m_referenceCounter = new std::atomic_size_t(1);
 }
 
+GpuStream::GpuStream(std::shared_ptr<CpuStream> cpuStream)
+{
+    helper_ResetLocal();
+    m_cpuStream = std::move(cpuStream);
+}
+
 //GpuStream_t::GpuStream_t(gpu_id gpuIdx, cudaStream_t cudaStream, GpuStreamSet* streamSet){
 //    m_gpuId = gpuIdx;
 //    m_cudaStream = cudaStream;
@@ -28,6 +34,7 @@ GpuStream::GpuStream(const GpuStream& other)
     m_gpuId = other.m_gpuId;
     m_cudaStream = other.m_cudaStream;
     m_referenceCounter = other.m_referenceCounter;
+    m_cpuStream = other.m_cpuStream;
     if (other.m_referenceCounter != nullptr) {
         m_referenceCounter->fetch_add(1);
     }
@@ -42,6 +49,7 @@ GpuStream::GpuStream(GpuStream&& other)
     m_gpuId = other.m_gpuId;
     m_cudaStream = other.m_cudaStream;
     m_referenceCounter = other.m_referenceCounter;
+    m_cpuStream = std::move(other.m_cpuStream);
 
     other.helper_ResetLocal();
 }
@@ -53,6 +61,7 @@ GpuStream& GpuStream::operator=(const GpuStream& other) noexcept
         m_gpuId = other.m_gpuId;
         m_cudaStream = other.m_cudaStream;
         m_referenceCounter = other.m_referenceCounter;
+        m_cpuStream = other.m_cpuStream;
         if (other.m_referenceCounter != nullptr) {
             m_referenceCounter->fetch_add(1);
         }
@@ -71,6 +80,7 @@ GpuStream& GpuStream::operator=(GpuStream&& other) noexcept
         m_gpuId = other.m_gpuId;
         m_cudaStream = other.m_cudaStream;
         m_referenceCounter = other.m_referenceCounter;
+        m_cpuStream = std::move(other.m_cpuStream);
     }
     other.helper_ResetLocal();
     return *this;
@@ -87,6 +97,7 @@ void GpuStream::helper_ResetLocal()
     m_gpuId.setInvalid();
     m_cudaStream = nullptr;
     m_referenceCounter = nullptr;
+    m_cpuStream.reset();
 }
 
 void GpuStream::helper_ResetGlobal()
@@ -127,6 +138,10 @@ void GpuStream::release()
 
 void GpuStream::enqueueEvent(GpuEvent& event) const
 {
+    if (m_cpuStream) {
+        m_cpuStream->enqueueEvent(event.cpuEvent());
+        return;
+    }
     Neon::sys::globalSpace::gpuSysObj().dev(m_gpuId).tools.setActiveDevContext();
     cudaEvent_t cudaEvent = event.event();
     cudaError_t retCode = cudaEventRecord(cudaEvent, m_cudaStream);
@@ -143,6 +158,10 @@ void GpuStream::enqueueEvent(GpuEvent& event) const
 
 void GpuStream::waitForEvent(const GpuEvent& event) const
 {
+    if (m_cpuStream) {
+        m_cpuStream->waitForEvent(event.cpuEvent());
+        return;
+    }
     Neon::sys::globalSpace::gpuSysObj().dev(m_gpuId).tools.setActiveDevContext();
     cudaEvent_t cudaEvent = event.event();
     cudaError_t retCode = cudaStreamWaitEvent(m_cudaStream, cudaEvent, 0);
@@ -161,6 +180,21 @@ const ComputeID& GpuStream::gpuId() const
     return m_gpuId;
 }
 
+bool GpuStream::isCpuStream() const
+{
+    return m_cpuStream != nullptr;
+}
+
+CpuStream& GpuStream::cpuStream() const
+{
+    if (!m_cpuStream) {
+        NeonException exc("GpuStream_t");
+        exc << "The stream is not backed by a CPU work queue.";
+        NEON_THROW(exc);
+    }
+    return *m_cpuStream;
+}
+
 
 }  // End of namespace sys
 }  // End of namespace Neon
@@ -0,0 +1,122 @@
+#include "gtest/gtest.h"
+
+#include "Neon/Neon.h"
+
+#include "Neon/sys/devices/cpu/CpuTopology.h"
+#include "Neon/sys/global/CpuSysGlobal.h"
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+using Neon::sys::CpuBinding;
+using Neon::sys::CpuTopology;
+
+namespace {
+auto writeFile(const std::filesystem::path& fname, const std::string& content) -> void
+{
+    std::filesystem::create_directories(fname.parent_path());
+    std::ofstream out(fname);
+    out << content << "\n";
+}
+
+/**
+ * Fake sysfs of a machine with 2 sockets (one NUMA node each), 2 cores per socket and 2 hardware threads per core.
+ * As on most Linux machines the sibling threads are numbered after all the cores.
+ */
+auto newFakeSysfs() -> std::filesystem::path
+{
+    const auto root = std::filesystem::temp_directory_path() / "sysUt_devCpu_sysfs";
+    std::filesystem::remove_all(root);
+    writeFile(root / "cpu" / "online", "0-7");
+    for (int cpu = 0; cpu < 8; cpu++) {
+        const int  socket = (cpu / 2) % 2;
+        const int  coreId = cpu % 2;
+        const auto topo = root / "cpu" / ("cpu" + std::to_string(cpu)) / "topology";
+        writeFile(topo / "physical_package_id", std::to_string(socket));
+        writeFile(topo / "core_id", std::to_string(coreId));
+    }
+    writeFile(root / "node" / "node0" / "cpulist", "0-1,4-5");
+    writeFile(root / "node" / "node1" / "cpulist", "2-3,6-7");
+    return root;
+}
+}  // namespace
+
+TEST(cpuTopology, cpuList)
+{
+    ASSERT_EQ(CpuTopology::parseCpuList("0-3,8,10-11\n"), std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+    ASSERT_TRUE(CpuTopology::parseCpuList("").empty());
+    ASSERT_ANY_THROW(CpuTopology::parseCpuList("0-a"));
+
+    ASSERT_EQ(CpuTopology::toCpuList({11, 0, 2, 1, 3, 8, 10, 3}), "0-3,8,10-11");
+    ASSERT_EQ(CpuTopology::toCpuList({}), "");
+}
+
+TEST(cpuTopology, fakeSysfs)
+{
+    const auto root = newFakeSysfs();
+    const auto topology = CpuTopology::discover(root.string());
+    std::filesystem::remove_all(root);
+
+    ASSERT_EQ(topology.nCpus(), 8);
+    ASSERT_EQ(topology.nCores(), 4);
+    ASSERT_EQ(topology.nSockets(), 2);
+    ASSERT_EQ(topology.nNodes(), 2);
+
+    // Each partition gets both the hardware threads of its cores
+    auto cores = topology.partitionCpus(2, CpuBinding::core);
+    ASSERT_EQ(cores, std::vector<std::vector<int>>({{0, 4, 1, 5}, {2, 6, 3, 7}}));
+    ASSERT_EQ(topology.nodeOf(cores[0]), 0);
+    ASSERT_EQ(topology.nodeOf(cores[1]), 1);
+
+    cores = topology.partitionCpus(4, CpuBinding::core);
+    ASSERT_EQ(cores, std::vector<std::vector<int>>({{0, 4}, {1, 5}, {2, 6}, {3, 7}}));
+
+    // More partitions than sockets: the sockets are shared round robin
+    auto sockets = topology.partitionCpus(3, CpuBinding::socket);
+    ASSERT_EQ(sockets[0], sockets[2]);
+    ASSERT_EQ(CpuTopology::toCpuList(sockets[1]), "2-3,6-7");
+
+    for (const auto& cpus : topology.partitionCpus(3, CpuBinding::none)) {
+        ASSERT_EQ(CpuTopology::toCpuList(cpus), "0-7");
+    }
+    ASSERT_EQ(topology.nodeOf({42}), -1);
+}
+
+TEST(cpuTopology, system)
+{
+    const auto& topology = Neon::sys::globalSpace::cpuSysObj().topology();
+    ASSERT_GT(topology.nCpus(), 0);
+    ASSERT_GT(topology.nCores(), 0);
+    ASSERT_LE(topology.nCores(), topology.nCpus());
+    ASSERT_GT(topology.nSockets(), 0);
+    ASSERT_GT(topology.nNodes(), 0);
+
+    // Every CPU belongs to exactly one partition
+    for (int nPartitions : {1, 2, 3, 64}) {
+        const auto cpus = topology.partitionCpus(nPartitions, CpuBinding::core);
+        std::set<int> all;
+        size_t        count = 0;
+        for (const auto& partition : cpus) {
+            ASSERT_FALSE(partition.empty());
+            all.insert(partition.begin(), partition.end());
+            count += partition.size();
+        }
+        ASSERT_EQ(int(all.size()), topology.nCpus());
+        if (nPartitions <= topology.nCores()) {
+            ASSERT_EQ(int(count), topology.nCpus());
+        }
+    }
+
+    // Binding the calling thread to its first partition and back to all the CPUs
+    const auto partitions = topology.partitionCpus(2, CpuBinding::core);
+    if (CpuTopology::bindThread(partitions[0])) {
+        ASSERT_TRUE(CpuTopology::bindThread(topology.partitionCpus(1, CpuBinding::none)[0]));
+    }
+
+    std::vector<char> buffer(1 << 20, 0);
+    // Memory placement may not be permitted in a container: only the call is checked
+    CpuTopology::bindMemory(buffer.data(), buffer.size(), topology.nodeOf(partitions[0]));
+}